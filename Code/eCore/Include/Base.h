@@ -74,6 +74,13 @@ Macro definitions (CPU architecture)
   #endif
 #endif
 
+#ifdef E_PLATFORM_SIMD_SSE
+  #define E_SIMD_SSE            1
+#endif
+#ifdef E_PLATFORM_SIMD_AVX
+  #define E_SIMD_AVX            1
+#endif
+
 /*----------------------------------------------------------------------------------------------------------------------
 Macro definitions (debug)
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -109,7 +116,9 @@ Please note that this macro has the following usage contract:
 1. The macro defines an API function to be imported unless the E_SETTING_DYNAMIC_LIBRARY macro is defined (which sets
 the API function to be exported). Only projects compiled as dynamic libraries should define E_SETTING_DYNAMIC_LIBRARY.
 ----------------------------------------------------------------------------------------------------------------------*/
+#define E_ALIGN(n)              E_PLATFORM_ALIGN(n)
 #define E_FORCE_INLINE          E_PLATFORM_FORCE_INLINE
+#define E_THREAD_LOCAL          E_PLATFORM_THREAD_LOCAL
 #define E_API                   E_PLATFORM_API
 
 /*----------------------------------------------------------------------------------------------------------------------
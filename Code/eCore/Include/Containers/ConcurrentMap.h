@@ -0,0 +1,276 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ConcurrentMap.h
+This file defines the ConcurrentMap class. ConcurrentMap is a thread-safe hash map built as a set of Map stripes, each
+one guarded by its own mutex. The stripe is selected by remixing the key hash (Map indices use its lower bits) so
+threads working on different keys rarely contend for the same lock.
+*/
+
+#ifndef E3_CONCURRENT_MAP_H
+#define E3_CONCURRENT_MAP_H
+
+#include <Containers/Map.h>
+#include <Threads/Lock.h>
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentMap
+
+Please note that this class has the following usage contract:
+
+1. All methods are thread-safe. ConcurrentMap uses the same MapHasher specializations as Map.
+2. Values are returned by copy as references would outlive the stripe lock. Large values should be stored through
+(smart) pointers.
+3. FindOrInsert inserts the given value if the key does not exist and returns the stored value. FindOrCreate does the
+same invoking the given function (ValueType function()) only if the key does not exist: the function is invoked holding
+the stripe lock so the value is created once even when several threads request it at the same time.
+4. Update invokes the given function (void function(ValueType& value)) holding the stripe lock, allowing atomic read,
+modify & write operations on existing values. It returns false when the key does not exist.
+5. ForEach invokes the given function (void function(const KeyType& key, ValueType& value)) for every pair, locking a
+stripe at a time. Hence it does NOT provide a consistent snapshot when other threads modify the map.
+6. GetCount locks every stripe in turn, so its result is only an approximation under concurrency.
+7. Functions passed to FindOrCreate, Update and ForEach MUST NOT access the map (the stripe mutex is not recursive).
+8. StripeCount MUST be a power of 2.
+9. Stripes are 64 byte aligned. Heap allocated maps only keep that alignment if the allocator provides it.
+----------------------------------------------------------------------------------------------------------------------*/
+template <
+  typename KeyType,
+  typename ValueType = KeyType,
+  template<typename KeyType, size_t = sizeof(KeyType)> class HasherClass = MapHasher,
+  U32 StripeCount = 64>
+class ConcurrentMap
+{
+public:
+  typedef Map<KeyType, ValueType, HasherClass>  MapType;
+  typedef HasherClass<KeyType>                  Hasher;
+
+  ConcurrentMap() {}
+  ~ConcurrentMap() {}
+
+  // Accessors
+  size_t      GetCount() const;
+  U32         GetStripeCount() const;
+  bool        HasKey(const KeyType& key) const;
+  bool        IsEmpty() const;
+
+  // Methods
+  void        Clear();
+  bool        Find(const KeyType& key, ValueType& value) const;
+  template <typename Function>
+  ValueType   FindOrCreate(const KeyType& key, Function createValue);
+  ValueType   FindOrInsert(const KeyType& key, const ValueType& value);
+  template <typename Function>
+  void        ForEach(Function function);
+  bool        Insert(const KeyType& key, const ValueType& value);
+  bool        RemoveIf(const KeyType& key);
+  template <typename Function>
+  bool        Update(const KeyType& key, Function update);
+
+private:
+  static_assert(StripeCount > 0 && (StripeCount & (StripeCount - 1)) == 0, "StripeCount must be a power of 2");
+
+  // Stripes are cache line aligned (hence their size is a multiple of 64 bytes) to avoid false sharing between
+  // contiguous stripes
+  struct E_ALIGN(64) Stripe
+  {
+    Threads::Mutex  mutex;
+    MapType         map;
+  };
+
+  mutable Stripe    mStripes[StripeCount];
+
+  Stripe&           GetStripe(const KeyType& key) const;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(ConcurrentMap)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentMap accessors
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline size_t ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::GetCount() const
+{
+  size_t count = 0;
+  for (U32 i = 0; i < StripeCount; ++i)
+  {
+    // [Critical section]
+    Threads::Lock l(mStripes[i].mutex);
+    count += mStripes[i].map.GetCount();
+  }
+  return count;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline U32 ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::GetStripeCount() const
+{
+  return StripeCount;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline bool ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::HasKey(const KeyType& key) const
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  return stripe.map.HasKey(key);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline bool ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::IsEmpty() const
+{
+  for (U32 i = 0; i < StripeCount; ++i)
+  {
+    // [Critical section]
+    Threads::Lock l(mStripes[i].mutex);
+    if (!mStripes[i].map.IsEmpty()) return false;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentMap methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline void ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::Clear()
+{
+  for (U32 i = 0; i < StripeCount; ++i)
+  {
+    // [Critical section]
+    Threads::Lock l(mStripes[i].mutex);
+    mStripes[i].map.Clear();
+  }
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline bool ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::Find(const KeyType& key, ValueType& value) const
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  const ValueType* pValue = stripe.map.FindValue(key);
+  if (pValue == nullptr) return false;
+  value = *pValue;
+  return true;
+}
+
+/**
+Finds the key value or inserts a value created by the given function if the key does not exist.
+@param key the key.
+@param createValue the value creation function (ValueType function()) invoked holding the stripe lock.
+@return the stored value.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+template <typename Function>
+inline ValueType ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::FindOrCreate(const KeyType& key, Function createValue)
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  ValueType* pValue = stripe.map.FindValue(key);
+  if (pValue) return *pValue;
+  return stripe.map.Insert(key, createValue())->second;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline ValueType ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::FindOrInsert(const KeyType& key, const ValueType& value)
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  ValueType* pValue = stripe.map.FindValue(key);
+  if (pValue) return *pValue;
+  return stripe.map.Insert(key, value)->second;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+template <typename Function>
+inline void ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::ForEach(Function function)
+{
+  for (U32 i = 0; i < StripeCount; ++i)
+  {
+    // [Critical section]
+    Threads::Lock l(mStripes[i].mutex);
+    for (auto it = begin(mStripes[i].map); it != end(mStripes[i].map); ++it) function((*it).first, (*it).second);
+  }
+}
+
+/**
+Inserts a pair or replaces the key value if the key exists.
+@param key the key.
+@param value the value.
+@return true if the key did not exist and false otherwise.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline bool ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::Insert(const KeyType& key, const ValueType& value)
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  size_t count = stripe.map.GetCount();
+  stripe.map.Insert(key, value);
+  return stripe.map.GetCount() != count;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline bool ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::RemoveIf(const KeyType& key)
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  return stripe.map.RemoveIf(key);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+template <typename Function>
+inline bool ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::Update(const KeyType& key, Function update)
+{
+  Stripe& stripe = GetStripe(key);
+  // [Critical section]
+  Threads::Lock l(stripe.mutex);
+  ValueType* pValue = stripe.map.FindValue(key);
+  if (pValue == nullptr) return false;
+  update(*pValue);
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentMap private methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U32 StripeCount>
+inline typename ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::Stripe& ConcurrentMap<KeyType, ValueType, HasherClass, StripeCount>::GetStripe(const KeyType& key) const
+{
+  // Remixing keeps keys of the same stripe spread over the stripe map (and handles weak hashes like Djb2)
+  return mStripes[Math::Murmur3<U32>::Hash(static_cast<U32>(Hasher::Hash(key))) & (StripeCount - 1)];
+}
+}
+}
+
+#endif
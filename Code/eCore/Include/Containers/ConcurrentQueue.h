@@ -0,0 +1,435 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ConcurrentQueue.h
+This file defines the ConcurrentQueue class. ConcurrentQueue implements a fixed capacity lock-free circular buffer
+queue. The multiple producer versions are based on the bounded MPMC queue by Dmitry Vyukov.
+*/
+
+#ifndef E3_CONCURRENT_QUEUE_H
+#define E3_CONCURRENT_QUEUE_H
+
+#include <Assertion/Assert.h>
+#include <Memory/Memory.h>
+#include <Threads/Atomic.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_CONCURRENT_QUEUE_SIZE_VALUE "Size value (%d) must be a power of 2 greater than 1"
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue modes
+----------------------------------------------------------------------------------------------------------------------*/
+enum ConcurrentQueueMode
+{
+  eConcurrentQueueModeMpmc,   // Multiple producers, multiple consumers
+  eConcurrentQueueModeMpsc,   // Multiple producers, single consumer
+  eConcurrentQueueModeSpsc    // Single producer, single consumer
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue
+
+Please note that this class has the following usage contract:
+
+1. Push and Pop are thread-safe and lock-free as long as the number of producers / consumers respects the mode.
+2. Push returns false when the queue is full and Pop returns false when the queue is empty (they never block). A 
+default constructed queue has no elements storage till Resize is called: it is both empty and full.
+3. Size MUST be a power of 2. The queue holds up to size elements.
+4. Accessors (except GetCount and IsEmpty which are approximations under concurrency), SetAllocator and Resize are NOT
+thread-safe. Resize discards the current elements.
+5. T MUST be default constructible and copy assignable.
+6. The MPMC / MPSC version stores a sequence number per element: a producer claims a slot by increasing the tail index
+and publishes the element by updating the slot sequence, so consumers never read half written elements. The SPSC
+version only requires the head and tail indices.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, ConcurrentQueueMode Mode = eConcurrentQueueModeMpmc>
+class ConcurrentQueue
+{
+public:
+  ConcurrentQueue();
+  explicit ConcurrentQueue(size_t size);
+  ~ConcurrentQueue();
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  size_t            GetCount() const;
+  size_t            GetSize() const;
+  bool              IsEmpty() const;
+  void              SetAllocator(Memory::IAllocator* p);
+
+  // Methods
+  bool              Pop(T& value);
+  bool              Push(const T& value);
+  void              Resize(size_t size);
+
+private:
+  struct Cell
+  {
+    A32             sequence;
+    T               value;
+  };
+
+  // Head and tail indices are kept in separate cache lines to avoid false sharing between producers and consumers
+  A32               mHead;
+  U8                mHeadPadding[64 - sizeof(A32)];
+  A32               mTail;
+  U8                mTailPadding[64 - sizeof(A32)];
+  Memory::IAllocator* mpAllocator;
+  Cell*             mpCells;
+  U32               mMask;
+
+  void              Destroy();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(ConcurrentQueue)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue specialization (SPSC)
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class ConcurrentQueue<T, eConcurrentQueueModeSpsc>
+{
+public:
+  ConcurrentQueue();
+  explicit ConcurrentQueue(size_t size);
+  ~ConcurrentQueue();
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  size_t            GetCount() const;
+  size_t            GetSize() const;
+  bool              IsEmpty() const;
+  void              SetAllocator(Memory::IAllocator* p);
+
+  // Methods
+  bool              Pop(T& value);
+  bool              Push(const T& value);
+  void              Resize(size_t size);
+
+private:
+  A32               mHead;
+  U8                mHeadPadding[64 - sizeof(A32)];
+  A32               mTail;
+  U8                mTailPadding[64 - sizeof(A32)];
+  Memory::IAllocator* mpAllocator;
+  T*                mpData;
+  U32               mMask;
+
+  void              Destroy();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(ConcurrentQueue)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, ConcurrentQueueMode Mode>
+inline ConcurrentQueue<T, Mode>::ConcurrentQueue()
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpCells(nullptr)
+  , mMask(0)
+{
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline ConcurrentQueue<T, Mode>::ConcurrentQueue(size_t size)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpCells(nullptr)
+  , mMask(0)
+{
+  Resize(size);
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline ConcurrentQueue<T, Mode>::~ConcurrentQueue()
+{
+  Destroy();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, ConcurrentQueueMode Mode>
+inline const Memory::IAllocator* ConcurrentQueue<T, Mode>::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline size_t ConcurrentQueue<T, Mode>::GetCount() const
+{
+  I32 count = static_cast<I32>(mTail.Get() - mHead.Get());
+  return (count > 0) ? static_cast<size_t>(count) : 0;
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline size_t ConcurrentQueue<T, Mode>::GetSize() const
+{
+  return mpCells ? mMask + 1 : 0;
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline bool ConcurrentQueue<T, Mode>::IsEmpty() const
+{
+  return GetCount() == 0;
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline void ConcurrentQueue<T, Mode>::SetAllocator(Memory::IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  size_t size = GetSize();
+  Destroy();
+  mpAllocator = p;
+  if (size) Resize(size);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Pops the front element.
+@param value the popped element.
+@return false if the queue is empty.
+@throw nothing.
+*/
+template <typename T, ConcurrentQueueMode Mode>
+inline bool ConcurrentQueue<T, Mode>::Pop(T& value)
+{
+  if (mpCells == nullptr) return false;
+  U32 head = mHead.Get();
+  for (;;)
+  {
+    Cell& cell = mpCells[head & mMask];
+    I32 difference = static_cast<I32>(cell.sequence.GetAcquire() - (head + 1));
+    // Element not published yet: empty queue
+    if (difference < 0) return false;
+    if (difference == 0)
+    {
+      // A single consumer owns the head index so it does not need to claim the slot
+      if (Mode == eConcurrentQueueModeMpsc)
+      {
+        mHead = head + 1;
+        break;
+      }
+      U32 original = mHead.CompareExchange(head, head + 1);
+      if (original == head) break;
+      head = original;
+    }
+    // Another consumer claimed the slot
+    else head = mHead.Get();
+  }
+  Cell& cell = mpCells[head & mMask];
+  value = cell.value;
+  // Release the slot for the producer of the next round
+  cell.sequence.SetRelease(head + mMask + 1);
+  return true;
+}
+
+/**
+Pushes an element to the back of the queue.
+@param value the element to push.
+@return false if the queue is full.
+@throw nothing.
+*/
+template <typename T, ConcurrentQueueMode Mode>
+inline bool ConcurrentQueue<T, Mode>::Push(const T& value)
+{
+  if (mpCells == nullptr) return false;
+  U32 tail = mTail.Get();
+  for (;;)
+  {
+    Cell& cell = mpCells[tail & mMask];
+    I32 difference = static_cast<I32>(cell.sequence.GetAcquire() - tail);
+    // Slot not released by the consumer yet: full queue
+    if (difference < 0) return false;
+    if (difference == 0)
+    {
+      U32 original = mTail.CompareExchange(tail, tail + 1);
+      if (original == tail) break;
+      tail = original;
+    }
+    // Another producer claimed the slot
+    else tail = mTail.Get();
+  }
+  Cell& cell = mpCells[tail & mMask];
+  cell.value = value;
+  // Publish the element
+  cell.sequence.SetRelease(tail + 1);
+  return true;
+}
+
+template <typename T, ConcurrentQueueMode Mode>
+inline void ConcurrentQueue<T, Mode>::Resize(size_t size)
+{
+  E_ASSERT_MSG(size > 1 && (size & (size - 1)) == 0, E_ASSERT_MSG_CONCURRENT_QUEUE_SIZE_VALUE, size);
+  Destroy();
+  mpCells = E_NEW(Cell, size, mpAllocator, Memory::IAllocator::eTagArrayNew);
+  mMask = static_cast<U32>(size - 1);
+  for (U32 i = 0; i < size; ++i) mpCells[i].sequence = i;
+  mHead = 0;
+  mTail = 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, ConcurrentQueueMode Mode>
+inline void ConcurrentQueue<T, Mode>::Destroy()
+{
+  if (mpCells) E_DELETE(mpCells, mMask + 1, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+  mpCells = nullptr;
+  mMask = 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue<T, eConcurrentQueueModeSpsc> initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline ConcurrentQueue<T, eConcurrentQueueModeSpsc>::ConcurrentQueue()
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpData(nullptr)
+  , mMask(0)
+{
+}
+
+template <typename T>
+inline ConcurrentQueue<T, eConcurrentQueueModeSpsc>::ConcurrentQueue(size_t size)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpData(nullptr)
+  , mMask(0)
+{
+  Resize(size);
+}
+
+template <typename T>
+inline ConcurrentQueue<T, eConcurrentQueueModeSpsc>::~ConcurrentQueue()
+{
+  Destroy();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue<T, eConcurrentQueueModeSpsc> accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline const Memory::IAllocator* ConcurrentQueue<T, eConcurrentQueueModeSpsc>::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+template <typename T>
+inline size_t ConcurrentQueue<T, eConcurrentQueueModeSpsc>::GetCount() const
+{
+  I32 count = static_cast<I32>(mTail.GetAcquire() - mHead.GetAcquire());
+  return (count > 0) ? static_cast<size_t>(count) : 0;
+}
+
+template <typename T>
+inline size_t ConcurrentQueue<T, eConcurrentQueueModeSpsc>::GetSize() const
+{
+  return mpData ? mMask + 1 : 0;
+}
+
+template <typename T>
+inline bool ConcurrentQueue<T, eConcurrentQueueModeSpsc>::IsEmpty() const
+{
+  return GetCount() == 0;
+}
+
+template <typename T>
+inline void ConcurrentQueue<T, eConcurrentQueueModeSpsc>::SetAllocator(Memory::IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  size_t size = GetSize();
+  Destroy();
+  mpAllocator = p;
+  if (size) Resize(size);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue<T, eConcurrentQueueModeSpsc> methods
+
+Note that the consumer only writes the head index and the producer only writes the tail index.
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline bool ConcurrentQueue<T, eConcurrentQueueModeSpsc>::Pop(T& value)
+{
+  U32 head = mHead.Get();
+  if (head == mTail.GetAcquire()) return false;
+  value = mpData[head & mMask];
+  mHead.SetRelease(head + 1);
+  return true;
+}
+
+template <typename T>
+inline bool ConcurrentQueue<T, eConcurrentQueueModeSpsc>::Push(const T& value)
+{
+  if (mpData == nullptr) return false;
+  U32 tail = mTail.Get();
+  if (tail - mHead.GetAcquire() > mMask) return false;
+  mpData[tail & mMask] = value;
+  mTail.SetRelease(tail + 1);
+  return true;
+}
+
+template <typename T>
+inline void ConcurrentQueue<T, eConcurrentQueueModeSpsc>::Resize(size_t size)
+{
+  E_ASSERT_MSG(size > 1 && (size & (size - 1)) == 0, E_ASSERT_MSG_CONCURRENT_QUEUE_SIZE_VALUE, size);
+  Destroy();
+  mpData = E_NEW(T, size, mpAllocator, Memory::IAllocator::eTagArrayNew);
+  mMask = static_cast<U32>(size - 1);
+  mHead = 0;
+  mTail = 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ConcurrentQueue<T, eConcurrentQueueModeSpsc> private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void ConcurrentQueue<T, eConcurrentQueueModeSpsc>::Destroy()
+{
+  if (mpData) E_DELETE(mpData, mMask + 1, mpAllocator, Memory::IAllocator::eTagArrayDelete);
+  mpData = nullptr;
+  mMask = 0;
+}
+}
+}
+
+#endif
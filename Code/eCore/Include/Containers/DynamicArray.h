@@ -73,6 +73,8 @@ Please note that this class has the following usage contract:
 allowed, letting classes using DynamicArray to check the bounds if necessary.
 3. Swap or operator= can be used to reallocate the array on demand.
 4. Reserve only reallocates when the parameter size value is bigger than the array size.
+5. Reserve and Resize keep the allocator set through SetAllocator.
+6. Move construction and assignment take ownership of the other array memory (and allocator) leaving it empty.
 
 Note that you can use Resize(0) to destroy the array content and deallocate the memory.
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -82,11 +84,14 @@ class DynamicArray
 public:
   DynamicArray();
   explicit DynamicArray(size_t size);
+  DynamicArray(size_t size, Memory::IAllocator* pAllocator);
   DynamicArray(const DynamicArray& other);
+  DynamicArray(DynamicArray&& other);
   DynamicArray(const T* pData, size_t count);
   ~DynamicArray();
 
   DynamicArray&             operator=(const DynamicArray& other);
+  DynamicArray&             operator=(DynamicArray&& other);
   const T&                  operator[](size_t index) const;
   T&                        operator[](size_t index);
   bool                      operator==(const DynamicArray& other) const;
@@ -95,6 +100,7 @@ public:
   bool                      operator!=(const T* pPtr) const;      
 
   const Memory::IAllocator* GetAllocator() const;
+  Memory::IAllocator*       GetAllocator();
   size_t		                GetByteSize() const;
   const T*	                GetPtr() const;
   T*			                  GetPtr();
@@ -112,7 +118,7 @@ private:
   T*                        mpPtr;
   size_t                    mSize;
 
-  // This class defines a copy constructor and assignment operator
+  // This class defines copy & move constructors and assignment operators
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -131,6 +137,12 @@ inline DynamicArray<T>::DynamicArray(size_t size)
   , mpPtr(E_NEW(T, size, mpAllocator, Memory::IAllocator::eTagArrayNew))
   , mSize(size) {}
 
+template <typename T>
+inline DynamicArray<T>::DynamicArray(size_t size, Memory::IAllocator* pAllocator)
+  : mpAllocator(pAllocator)
+  , mpPtr(E_NEW(T, size, mpAllocator, Memory::IAllocator::eTagArrayNew))
+  , mSize(size) {}
+
 template <typename T>
 inline DynamicArray<T>::DynamicArray(const DynamicArray& other)
   : mpAllocator(other.mpAllocator)
@@ -140,6 +152,16 @@ inline DynamicArray<T>::DynamicArray(const DynamicArray& other)
   Copy(other.GetPtr(), mSize);
 }
 
+template <typename T>
+inline DynamicArray<T>::DynamicArray(DynamicArray&& other)
+  : mpAllocator(other.mpAllocator)
+  , mpPtr(other.mpPtr)
+  , mSize(other.mSize)
+{
+  other.mpPtr = nullptr;
+  other.mSize = 0;
+}
+
 template <typename T>
 inline DynamicArray<T>::DynamicArray(const T* pData, size_t count)
   : mpAllocator(Memory::Global::GetAllocator())
@@ -168,6 +190,13 @@ inline DynamicArray<T>& DynamicArray<T>::operator=(const DynamicArray& other)
   return *this;
 }
 
+template <typename T>
+inline DynamicArray<T>& DynamicArray<T>::operator=(DynamicArray&& other)
+{
+  DynamicArray<T>(std::move(other)).Swap(*this);
+  return *this;
+}
+
 template <typename T>
 inline const T& DynamicArray<T>::operator[](size_t index) const
 {
@@ -218,6 +247,12 @@ inline const Memory::IAllocator* DynamicArray<T>::GetAllocator() const
   return mpAllocator;
 }
 
+template <typename T>
+inline Memory::IAllocator* DynamicArray<T>::GetAllocator()
+{
+  return mpAllocator;
+}
+
 template<typename T>
 inline size_t DynamicArray<T>::GetByteSize() const
 {
@@ -272,14 +307,14 @@ inline void DynamicArray<T>::Reserve(size_t size)
 {
   if (size > mSize)
   {
-    DynamicArray<T>(size).Swap(*this);
+    DynamicArray<T>(size, mpAllocator).Swap(*this);
   }
 }
 
 template <typename T>
 inline void DynamicArray<T>::Resize(size_t size)
 {
-  DynamicArray<T>(size).Swap(*this);
+  DynamicArray<T>(size, mpAllocator).Swap(*this);
 }
 
 template <typename T>
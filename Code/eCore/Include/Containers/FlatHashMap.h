@@ -0,0 +1,728 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file FlatHashMap.h
+This file defines the FlatHashMap class. FlatHashMap implements linear probing on a power of 2 sized array like Map but
+keeps a separate control array storing a byte per pair: empty pairs are marked with a reserved value while valid pairs
+store a 7 bit tag of their key hash. Probing compares 16 control bytes at once using SSE2 and only compares keys whose
+tag matches, so the map can run at a higher occupancy (87.5%) than Map while keeping lookups fast and cache friendly.
+Implementation based on: https://abseil.io/about/design/swisstables
+*/
+
+#ifndef E3_FLAT_HASH_MAP_H
+#define E3_FLAT_HASH_MAP_H
+
+#include <Containers/Map.h>
+#include <emmintrin.h>
+#include <intrin.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_FLAT_HASH_MAP_COUNT_VALUE      "Size (%d) must be big enough to hold the element count (%d)"
+#define E_ASSERT_MSG_FLAT_HASH_MAP_ITERATOR_VALUE   "Iterator must be valid"
+#define E_ASSERT_MSG_FLAT_HASH_MAP_KEY_VALUE        "Key must exist"
+#define E_ASSERT_MSG_FLAT_HASH_MAP_COUNT_MAX_VALUE  "Count cannot be greater than (%d)"
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap
+
+Please note that this class has the following usage contract:
+
+1. FlatHashMap shares the Map interface and uses the same MapHasher specializations (only Hash and IsEqual are used).
+2. Clear, Compact, Remove and Resize methods invalidate iterators. Insert and Emplace do too whenever the map grows.
+3. Resize method requires a power of 2 size value and sizes smaller than kGroupSize are rounded up to kGroupSize.
+4. Resize preserves existing data and will E_ASSERT_MSG when the size cannot hold the current count.
+5. Resize with a size of 0 calls Clear and deallocates the map memory.
+6. Compact on an empty map has the same effects a Resize(0).
+7. The map grows (doubling its size) when its occupancy would exceed 87.5%.
+8. The operator [] does NOT insert, it just retrieves the object if existent (use Insert for that purpose).
+9. Keys and values are only constructed for valid pairs. Insert moves the key and value, Emplace constructs the value
+in place from the given arguments and rehashing moves pairs instead of copying them.
+10. Removal shifts back the following pairs of the probe sequence so no tombstones are ever left behind: lookups never
+degrade after many removals and the map does not need to be rehashed to clean them up.
+
+Note that the control array has kGroupSize - 1 extra bytes mirroring its first bytes. This allows loading a 16 byte
+group starting at any pair without having to handle the array wrap around.
+----------------------------------------------------------------------------------------------------------------------*/
+template <
+  typename KeyType,
+  typename ValueType = KeyType,
+  template<typename KeyType, size_t = sizeof(KeyType)> class HasherClass = MapHasher>
+class FlatHashMap
+{
+public:
+  typedef Pair<KeyType, ValueType>  Pair;
+  typedef HasherClass<KeyType>      Hasher;
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  ConstIterator
+  ----------------------------------------------------------------------------------------------------------------------*/
+  class ConstIterator
+  {
+  public:
+    typedef ConstIterator   ThisType;
+    typedef const Pair&     Reference;
+    typedef ptrdiff_t       DifferenceType;
+
+    ConstIterator(Pair* pCurrent, const U8* pControl, const Pair* pEnd) : mpCurrent(pCurrent), mpControl(pControl), mpEnd(pEnd) {}
+    inline Reference  operator*() const { return *mpCurrent; }
+    inline bool       operator==(const ThisType& other) const { return mpCurrent == other.mpCurrent; }
+    inline bool       operator!=(const ThisType& other) const { return mpCurrent != other.mpCurrent; }
+    inline bool       operator<(const ThisType& other) const  { return mpCurrent < other.mpCurrent; }
+    inline ThisType&  operator++()                            { do { ++mpCurrent; ++mpControl; } while (mpCurrent != mpEnd && *mpControl == kEmpty); return *this; }
+    DifferenceType    operator-(const ThisType& other) const  { return mpCurrent - other.mpCurrent; }
+
+  protected:
+    Pair*             mpCurrent;
+    const U8*         mpControl;
+    const Pair*       mpEnd;
+  };
+
+  /*----------------------------------------------------------------------------------------------------------------------
+  Iterator
+  ----------------------------------------------------------------------------------------------------------------------*/
+  class Iterator : public ConstIterator
+  {
+  public:
+    typedef Iterator  ThisType;
+    typedef Pair&     Reference;
+
+    Iterator(Pair* pCurrent, const U8* pControl, const Pair* pEnd) : ConstIterator(pCurrent, pControl, pEnd) {}
+    inline Reference  operator*() const { return *mpCurrent; }
+  };
+
+  explicit FlatHashMap(size_t initialSize = kGroupSize);
+  FlatHashMap(const FlatHashMap& other);
+  FlatHashMap(FlatHashMap&& other);
+  ~FlatHashMap();
+
+  FlatHashMap&              operator=(const FlatHashMap& other);
+  FlatHashMap&              operator=(FlatHashMap&& other);
+  const ValueType&          operator[](const KeyType& key) const;
+  ValueType&                operator[](const KeyType& key);
+
+  // Basic operations
+  const Memory::IAllocator* GetAllocator() const;
+  ConstIterator             GetBegin() const;
+  Iterator                  GetBegin();
+  size_t                    GetCount() const;
+  ConstIterator             GetEnd() const;
+  Iterator                  GetEnd();
+  size_t                    GetSize() const;
+  bool                      HasKey(const KeyType& key) const;
+  bool                      IsEmpty() const;
+  bool                      IsValid(ConstIterator cit) const;
+  void                      SetAllocator(Memory::IAllocator* p);
+
+  void                      Clear();
+  void                      Compact();
+  template <typename... Args>
+  Pair*                     Emplace(const KeyType& key, Args&&... args);
+  ConstIterator             Find(const KeyType& key) const;
+  Iterator                  Find(const KeyType& key);
+  const Pair*               FindPair(const KeyType& key) const;
+  Pair*                     FindPair(const KeyType& key);
+  const ValueType*          FindValue(const KeyType& key) const;
+  ValueType*                FindValue(const KeyType& key);
+  Pair*                     Insert(KeyType key, ValueType value);
+  void                      Remove(Iterator it);
+  bool                      RemoveIf(const KeyType& key);
+  void                      RemovePair(Pair* pPair);
+  void                      Resize(size_t size);
+  void                      Swap(FlatHashMap& other);
+
+private:
+  static const U8           kEmpty = 0x80;
+  static const U8           kTagMask = 0x7f;
+  static const U8           kTagBitCount = 7;
+  static const U8           kGroupSize = 16;
+  static const U32          kMaxElementCount = 0x7fffffff; // Max I32 value
+
+  Memory::IAllocator*       mpAllocator;
+  U8*                       mpControl;
+  Pair*                     mpData;
+  size_t                    mSize;
+  size_t                    mCount;
+
+  static U32                GetFirstBitIndex(U32 mask);
+  static U32                GetMatchMask(__m128i group, U8 tag);
+  static U8                 GetTag(size_t hash);
+
+  Pair*                     FindSlot(const KeyType& key, bool& isFound);
+  size_t                    FindEmptyIndex(size_t hash) const;
+  Pair*                     GetBeginPair() const;
+  size_t                    GetIdealIndex(size_t hash) const;
+  size_t                    GetMaxCount(size_t size) const;
+  void                      Reallocate(size_t size, Memory::IAllocator* pAllocator);
+  void                      Release();
+  void                      SetControl(size_t index, U8 control);
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+FlatHashMap<KeyType, ValueType, HasherClass>::FlatHashMap(size_t initialSize)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpControl(nullptr)
+  , mpData(nullptr)
+  , mSize(0)
+  , mCount(0)
+{
+  E_ASSERT_MSG(Math::IsPower2(initialSize), E_ASSERT_MSG_MATH_POWER_OF_TWO_VALUE);
+  Reallocate(Math::Max<size_t>(initialSize, kGroupSize), mpAllocator);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+FlatHashMap<KeyType, ValueType, HasherClass>::FlatHashMap(const FlatHashMap& other)
+  : mpAllocator(other.mpAllocator)
+  , mpControl(nullptr)
+  , mpData(nullptr)
+  , mSize(0)
+  , mCount(0)
+{
+  if (other.mSize == 0) return;
+
+  // Same size keeps the same pair positions
+  Reallocate(other.mSize, mpAllocator);
+  Memory::Copy(mpControl, other.mpControl, mSize + kGroupSize - 1);
+  for (size_t i = 0; i < mSize; ++i)
+  {
+    if (mpControl[i] != kEmpty)
+    {
+      new (&mpData[i].first) KeyType(other.mpData[i].first);
+      new (&mpData[i].second) ValueType(other.mpData[i].second);
+    }
+  }
+  mCount = other.mCount;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+FlatHashMap<KeyType, ValueType, HasherClass>::FlatHashMap(FlatHashMap&& other)
+  : mpAllocator(other.mpAllocator)
+  , mpControl(other.mpControl)
+  , mpData(other.mpData)
+  , mSize(other.mSize)
+  , mCount(other.mCount)
+{
+  other.mpControl = nullptr;
+  other.mpData = nullptr;
+  other.mSize = 0;
+  other.mCount = 0;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+FlatHashMap<KeyType, ValueType, HasherClass>::~FlatHashMap()
+{
+  Release();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap operators
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline FlatHashMap<KeyType, ValueType, HasherClass>& FlatHashMap<KeyType, ValueType, HasherClass>::operator=(const FlatHashMap& other)
+{
+  FlatHashMap(other).Swap(*this);
+  return *this;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline FlatHashMap<KeyType, ValueType, HasherClass>& FlatHashMap<KeyType, ValueType, HasherClass>::operator=(FlatHashMap&& other)
+{
+  FlatHashMap(std::move(other)).Swap(*this);
+  return *this;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline const ValueType& FlatHashMap<KeyType, ValueType, HasherClass>::operator[](const KeyType& key) const
+{
+  const ValueType* pValue = FindValue(key);
+  E_ASSERT_MSG(pValue, E_ASSERT_MSG_FLAT_HASH_MAP_KEY_VALUE);
+  return *pValue;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline ValueType& FlatHashMap<KeyType, ValueType, HasherClass>::operator[](const KeyType& key)
+{
+  return const_cast<ValueType&>(static_cast<const FlatHashMap*>(this)->operator[](key));
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap accessors
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline const Memory::IAllocator* FlatHashMap<KeyType, ValueType, HasherClass>::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::ConstIterator FlatHashMap<KeyType, ValueType, HasherClass>::GetBegin() const
+{
+  Pair* pBegin = GetBeginPair();
+  return ConstIterator(pBegin, mpControl + (pBegin - mpData), mpData + mSize);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Iterator FlatHashMap<KeyType, ValueType, HasherClass>::GetBegin()
+{
+  Pair* pBegin = GetBeginPair();
+  return Iterator(pBegin, mpControl + (pBegin - mpData), mpData + mSize);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline size_t FlatHashMap<KeyType, ValueType, HasherClass>::GetCount() const
+{
+  return mCount;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::ConstIterator FlatHashMap<KeyType, ValueType, HasherClass>::GetEnd() const
+{
+  Pair* pEnd = mpData + mSize;
+  return ConstIterator(pEnd, mpControl + mSize, pEnd);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Iterator FlatHashMap<KeyType, ValueType, HasherClass>::GetEnd()
+{
+  Pair* pEnd = mpData + mSize;
+  return Iterator(pEnd, mpControl + mSize, pEnd);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline size_t FlatHashMap<KeyType, ValueType, HasherClass>::GetSize() const
+{
+  return mSize;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline bool FlatHashMap<KeyType, ValueType, HasherClass>::HasKey(const KeyType& key) const
+{
+  return FindPair(key) != nullptr;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline bool FlatHashMap<KeyType, ValueType, HasherClass>::IsEmpty() const
+{
+  return (mCount == 0);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline bool FlatHashMap<KeyType, ValueType, HasherClass>::IsValid(ConstIterator cit) const
+{
+  return (!(cit < GetBegin()) && cit != GetEnd());
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::SetAllocator(Memory::IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  if (p == mpAllocator) return;
+  if (mSize) Reallocate(mSize, p);
+  else mpAllocator = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Clear()
+{
+  if (mCount == 0) return;
+  for (size_t i = 0; i < mSize; ++i)
+  {
+    if (mpControl[i] != kEmpty)
+    {
+      Memory::Destruct(&mpData[i].second);
+      Memory::Destruct(&mpData[i].first);
+    }
+  }
+  memset(mpControl, kEmpty, mSize + kGroupSize - 1);
+  mCount = 0;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Compact()
+{
+  size_t size = kGroupSize;
+  while (GetMaxCount(size) < mCount) size *= 2;
+  Resize(mCount ? size : 0);
+}
+
+/**
+Inserts a pair constructing its value in place from the given arguments. If the key exists its value is replaced by a
+value constructed from the given arguments.
+@param key the pair key.
+@param args the value constructor arguments.
+@return the pair.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+template <typename... Args>
+inline typename Pair<KeyType, ValueType>* FlatHashMap<KeyType, ValueType, HasherClass>::Emplace(const KeyType& key, Args&&... args)
+{
+  bool isFound = false;
+  Pair* pPair = FindSlot(key, isFound);
+  if (isFound)
+  {
+    pPair->second = ValueType(std::forward<Args>(args)...);
+    return pPair;
+  }
+  new (&pPair->first) KeyType(key);
+  new (&pPair->second) ValueType(std::forward<Args>(args)...);
+  return pPair;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::ConstIterator FlatHashMap<KeyType, ValueType, HasherClass>::Find(const KeyType& key) const
+{
+  Pair* pPair = const_cast<Pair*>(FindPair(key));
+  if (!pPair) return GetEnd();
+  return ConstIterator(pPair, mpControl + (pPair - mpData), mpData + mSize);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Iterator FlatHashMap<KeyType, ValueType, HasherClass>::Find(const KeyType& key)
+{
+  Pair* pPair = FindPair(key);
+  if (!pPair) return GetEnd();
+  return Iterator(pPair, mpControl + (pPair - mpData), mpData + mSize);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename const Pair<KeyType, ValueType>* FlatHashMap<KeyType, ValueType, HasherClass>::FindPair(const KeyType& key) const
+{
+  if (mCount == 0) return nullptr;
+
+  size_t hash = Hasher::Hash(key);
+  U8 tag = GetTag(hash);
+  for (size_t index = GetIdealIndex(hash); ; index = (index + kGroupSize) & (mSize - 1))
+  {
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mpControl + index));
+    U32 emptyMask = static_cast<U32>(_mm_movemask_epi8(group));
+    U32 tagMask = GetMatchMask(group, tag);
+    // The probe sequence ends at the first empty pair: ignore tag matches beyond it
+    if (emptyMask) tagMask &= emptyMask ^ (emptyMask - 1);
+    while (tagMask)
+    {
+      const Pair* pPair = mpData + ((index + GetFirstBitIndex(tagMask)) & (mSize - 1));
+      if (Hasher::IsEqual(pPair->first, key)) return pPair;
+      tagMask &= tagMask - 1;
+    }
+    if (emptyMask) return nullptr;
+  }
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename Pair<KeyType, ValueType>* FlatHashMap<KeyType, ValueType, HasherClass>::FindPair(const KeyType& key)
+{
+  return const_cast<Pair*>(const_cast<const FlatHashMap*>(this)->FindPair(key));
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline const ValueType* FlatHashMap<KeyType, ValueType, HasherClass>::FindValue(const KeyType& key) const
+{
+  const Pair* pPair = FindPair(key);
+  return pPair ? &pPair->second : nullptr;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline ValueType* FlatHashMap<KeyType, ValueType, HasherClass>::FindValue(const KeyType& key)
+{
+  return const_cast<ValueType*>(const_cast<const FlatHashMap*>(this)->FindValue(key));
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename Pair<KeyType, ValueType>* FlatHashMap<KeyType, ValueType, HasherClass>::Insert(KeyType key, ValueType value)
+{
+  bool isFound = false;
+  Pair* pPair = FindSlot(key, isFound);
+  if (isFound)
+  {
+    pPair->second = std::move(value);
+    return pPair;
+  }
+  new (&pPair->first) KeyType(std::move(key));
+  new (&pPair->second) ValueType(std::move(value));
+  return pPair;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Remove(Iterator it)
+{
+  E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_FLAT_HASH_MAP_ITERATOR_VALUE);
+  RemovePair(&*it);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline bool FlatHashMap<KeyType, ValueType, HasherClass>::RemoveIf(const KeyType& key)
+{
+  Pair* pPair = FindPair(key);
+  if (pPair)
+  {
+    RemovePair(pPair);
+    return true;
+  }
+  return false;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::RemovePair(Pair* pPair)
+{
+  E_ASSERT(pPair >= mpData && static_cast<size_t>(pPair - mpData) < mSize);
+  size_t index = static_cast<size_t>(pPair - mpData);
+  E_ASSERT(mpControl[index] != kEmpty);
+
+  // Shift back the following pairs of the probe sequence which can be moved closer to their ideal index
+  for (size_t next = (index + 1) & (mSize - 1); mpControl[next] != kEmpty; next = (next + 1) & (mSize - 1))
+  {
+    size_t ideal = GetIdealIndex(Hasher::Hash(mpData[next].first));
+    if (((index - ideal) & (mSize - 1)) < ((next - ideal) & (mSize - 1)))
+    {
+      mpData[index].first = std::move(mpData[next].first);
+      mpData[index].second = std::move(mpData[next].second);
+      SetControl(index, mpControl[next]);
+      index = next;
+    }
+  }
+  Memory::Destruct(&mpData[index].second);
+  Memory::Destruct(&mpData[index].first);
+  SetControl(index, kEmpty);
+  --mCount;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Resize(size_t size)
+{
+  if (size == 0)
+  {
+    Release();
+    return;
+  }
+  E_ASSERT_MSG(Math::IsPower2(size), E_ASSERT_MSG_MATH_POWER_OF_TWO_VALUE);
+  size = Math::Max<size_t>(size, kGroupSize);
+  E_ASSERT_MSG(GetMaxCount(size) >= mCount, E_ASSERT_MSG_FLAT_HASH_MAP_COUNT_VALUE, size, mCount);
+  if (size != mSize) Reallocate(size, mpAllocator);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Swap(FlatHashMap& other)
+{
+  Memory::IAllocator* pAllocator = mpAllocator;
+  U8* pControl = mpControl;
+  Pair* pData = mpData;
+  size_t size = mSize;
+  size_t count = mCount;
+
+  mpAllocator = other.mpAllocator;
+  mpControl = other.mpControl;
+  mpData = other.mpData;
+  mSize = other.mSize;
+  mCount = other.mCount;
+
+  other.mpAllocator = pAllocator;
+  other.mpControl = pControl;
+  other.mpData = pData;
+  other.mSize = size;
+  other.mCount = count;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+FlatHashMap private methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline U32 FlatHashMap<KeyType, ValueType, HasherClass>::GetFirstBitIndex(U32 mask)
+{
+  unsigned long index = 0;
+  _BitScanForward(&index, mask);
+  return static_cast<U32>(index);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline U32 FlatHashMap<KeyType, ValueType, HasherClass>::GetMatchMask(__m128i group, U8 tag)
+{
+  return static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(tag)))));
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline U8 FlatHashMap<KeyType, ValueType, HasherClass>::GetTag(size_t hash)
+{
+  return static_cast<U8>(hash & kTagMask);
+}
+
+/**
+Finds the key pair or the empty pair where the key should be inserted (growing the map if required). When the key is
+not found the pair control byte is already set and the count increased, so the caller MUST construct the pair.
+@param key the key.
+@param isFound set to true if the key pair exists and false otherwise.
+@return the key pair if it exists or the empty pair to insert it otherwise.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Pair* FlatHashMap<KeyType, ValueType, HasherClass>::FindSlot(const KeyType& key, bool& isFound)
+{
+  E_ASSERT_MSG(mCount <= kMaxElementCount, E_ASSERT_MSG_FLAT_HASH_MAP_COUNT_MAX_VALUE, kMaxElementCount);
+  if (mSize == 0) Reallocate(kGroupSize, mpAllocator);
+
+  Pair* pPair = FindPair(key);
+  if (pPair)
+  {
+    isFound = true;
+    return pPair;
+  }
+  if (mCount + 1 > GetMaxCount(mSize)) Reallocate(mSize * 2, mpAllocator);
+
+  size_t hash = Hasher::Hash(key);
+  size_t index = FindEmptyIndex(hash);
+  SetControl(index, GetTag(hash));
+  ++mCount;
+  isFound = false;
+  return mpData + index;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline size_t FlatHashMap<KeyType, ValueType, HasherClass>::FindEmptyIndex(size_t hash) const
+{
+  for (size_t index = GetIdealIndex(hash); ; index = (index + kGroupSize) & (mSize - 1))
+  {
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mpControl + index));
+    U32 emptyMask = static_cast<U32>(_mm_movemask_epi8(group));
+    if (emptyMask) return (index + GetFirstBitIndex(emptyMask)) & (mSize - 1);
+  }
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Pair* FlatHashMap<KeyType, ValueType, HasherClass>::GetBeginPair() const
+{
+  size_t index = 0;
+  while (index != mSize && mpControl[index] == kEmpty) ++index;
+  return mpData + index;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline size_t FlatHashMap<KeyType, ValueType, HasherClass>::GetIdealIndex(size_t hash) const
+{
+  // The tag uses the lower hash bits so the index uses the upper ones
+  return (hash >> kTagBitCount) & (mSize - 1);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline size_t FlatHashMap<KeyType, ValueType, HasherClass>::GetMaxCount(size_t size) const
+{
+  // 87.5% max occupancy
+  return size - (size >> 3);
+}
+
+/**
+Moves the existing pairs to new arrays.
+@param size the new array size.
+@param pAllocator the new arrays allocator.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Reallocate(size_t size, Memory::IAllocator* pAllocator)
+{
+  Memory::IAllocator* pOldAllocator = mpAllocator;
+  U8* pOldControl = mpControl;
+  Pair* pOldData = mpData;
+  size_t oldSize = mSize;
+
+  mpAllocator = pAllocator;
+  mpControl = static_cast<U8*>(mpAllocator->Allocate(size + kGroupSize - 1, Memory::IAllocator::eTagArrayNew));
+  mpData = static_cast<Pair*>(mpAllocator->Allocate(sizeof(Pair) * size, Memory::IAllocator::eTagArrayNew));
+  mSize = size;
+  memset(mpControl, kEmpty, mSize + kGroupSize - 1);
+
+  // Move old pairs (destroying them as they are moved)
+  for (size_t i = 0; i < oldSize; ++i)
+  {
+    if (pOldControl[i] != kEmpty)
+    {
+      Pair* pOldPair = pOldData + i;
+      size_t hash = Hasher::Hash(pOldPair->first);
+      size_t index = FindEmptyIndex(hash);
+      SetControl(index, GetTag(hash));
+      new (&mpData[index].first) KeyType(std::move(pOldPair->first));
+      new (&mpData[index].second) ValueType(std::move(pOldPair->second));
+      Memory::Destruct(&pOldPair->second);
+      Memory::Destruct(&pOldPair->first);
+    }
+  }
+  if (pOldData)
+  {
+    pOldAllocator->Deallocate(pOldData, Memory::IAllocator::eTagArrayDelete);
+    pOldAllocator->Deallocate(pOldControl, Memory::IAllocator::eTagArrayDelete);
+  }
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::Release()
+{
+  if (mpData == nullptr) return;
+  Clear();
+  mpAllocator->Deallocate(mpData, Memory::IAllocator::eTagArrayDelete);
+  mpAllocator->Deallocate(mpControl, Memory::IAllocator::eTagArrayDelete);
+  mpControl = nullptr;
+  mpData = nullptr;
+  mSize = 0;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline void FlatHashMap<KeyType, ValueType, HasherClass>::SetControl(size_t index, U8 control)
+{
+  mpControl[index] = control;
+  // Mirror the first bytes so groups can be loaded at any index
+  if (index < kGroupSize - 1) mpControl[mSize + index] = control;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+STD begin and end expressions for range for loop
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::ConstIterator
+begin(const FlatHashMap<KeyType, ValueType, HasherClass>& map) { return map.GetBegin(); }
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Iterator
+begin(FlatHashMap<KeyType, ValueType, HasherClass>& map) { return map.GetBegin(); }
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::ConstIterator
+end(const FlatHashMap<KeyType, ValueType, HasherClass>& map) { return map.GetEnd(); }
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass>
+inline typename FlatHashMap<KeyType, ValueType, HasherClass>::Iterator
+end(FlatHashMap<KeyType, ValueType, HasherClass>& map) { return map.GetEnd(); }
+}
+}
+
+#endif
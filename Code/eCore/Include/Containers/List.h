@@ -120,6 +120,10 @@ correct and necessary. The combination of these facts may incur in a destructor
 (for list removed objects: first on removal, second on list destruction due to DynamicArray destructor). This double 
 call cost is worth the safe memory management and allows specific control methods such as SetCount to be used without 
 risking the heap allocation while ensuring proper item destruction.
+
+Note 3: as list items are always constructed EmplaceBack constructs a temporary from the given arguments and moves it
+into the list. PushBack and InsertAt rvalue versions move the given value as well. On growth existing items are moved 
+into the new memory (memcpy for POD types) instead of being copied.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T, size_t Granularity = 1, U8 GrowthPercentage = E_INTERNAL_SETTING_LIST_GROWTH_PERCENTAGE>
 class List
@@ -136,9 +140,13 @@ public:
   explicit List(size_t size);
   List(size_t size, const T& value);
   List(const T* pData, size_t count);
+  List(const List& other);
+  List(List&& other);
   ~List();
 
   // Operators
+  List&                     operator=(const List& other);
+  List&                     operator=(List&& other);
   const T&                  operator [] (size_t index) const;
   T&                        operator [] (size_t index);
 
@@ -167,6 +175,8 @@ public:
   void                      Clear();
   void                      Compact();
   void                      Copy(const T* pData, size_t count, size_t startIndex = 0);
+  template <typename... Args>
+  void                      EmplaceBack(Args&&... args);
   void                      EnsureSize(size_t size);
   void                      Fill(const T& value, size_t startIndex = 0);
   ConstIterator             Find(const T& value) const;
@@ -174,8 +184,10 @@ public:
   size_t                    FindIndex(const T& value) const;
   T*                        FindValue(const T& value);
   void                      InsertAt(const T& value, size_t index);
+  void                      InsertAt(T&& value, size_t index);
   void                      PopBack(size_t count = 1);
   void                      PushBack(const T& value);
+  void                      PushBack(T&& value);
   void                      PushBack(const T* pData, size_t count);
   void                      PushBack(const List& other);
   void                      Remove(Iterator it, size_t count = 1);
@@ -193,8 +205,9 @@ private:
   size_t                    mCount;
 
   void                      Grow();
+  size_t                    PrepareInsertAt(size_t index);
 
-  // Relying on default copy constructor and assignment operator
+  // This class defines copy & move constructors and assignment operators
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -230,6 +243,21 @@ inline List<T, Granularity, GrowthPercentage>::List(const T* pData, size_t count
   mData.Copy(pData, mCount);
 }
 
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline List<T, Granularity, GrowthPercentage>::List(const List& other)
+  : mData(other.mData)
+  , mCount(other.mCount)
+{
+}
+
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline List<T, Granularity, GrowthPercentage>::List(List&& other)
+  : mData(std::move(other.mData))
+  , mCount(other.mCount)
+{
+  other.mCount = 0;
+}
+
 template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline List<T, Granularity, GrowthPercentage>::~List() {}
 
@@ -237,6 +265,26 @@ inline List<T, Granularity, GrowthPercentage>::~List() {}
 List operators
 ----------------------------------------------------------------------------------------------------------------------*/
 
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline List<T, Granularity, GrowthPercentage>& List<T, Granularity, GrowthPercentage>::operator=(const List& other)
+{
+  mData = other.mData;
+  mCount = other.mCount;
+  return *this;
+}
+
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline List<T, Granularity, GrowthPercentage>& List<T, Granularity, GrowthPercentage>::operator=(List&& other)
+{
+  if (this != &other)
+  {
+    mData = std::move(other.mData);
+    mCount = other.mCount;
+    other.mCount = 0;
+  }
+  return *this;
+}
+
 template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline const T& List<T, Granularity, GrowthPercentage>::operator[](size_t index) const
 {
@@ -397,6 +445,13 @@ inline void List<T, Granularity, GrowthPercentage>::Copy(const T* pData, size_t
   mCount = Math::Max(mCount, startIndex + count);
 }
 
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+template <typename... Args>
+inline void List<T, Granularity, GrowthPercentage>::EmplaceBack(Args&&... args)
+{
+  PushBack(T(std::forward<Args>(args)...));
+}
+
 template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline void List<T, Granularity, GrowthPercentage>::EnsureSize(size_t size)
 {
@@ -443,20 +498,13 @@ inline T* List<T, Granularity, GrowthPercentage>::FindValue(const T& value)
 template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline void List<T, Granularity, GrowthPercentage>::InsertAt(const T& value, size_t index)
 {
-  if (mCount == mData.GetSize())
-  {
-    Grow();
-  }
-  if (index > mCount)
-  {
-    index = mCount;
-  }
-  for (size_t i = mCount; i > index; --i)
-  {
-    mData[i] = mData[i - 1];
-  }
-  mData[index] = value;
-  mCount++;
+  mData[PrepareInsertAt(index)] = value;
+}
+
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline void List<T, Granularity, GrowthPercentage>::InsertAt(T&& value, size_t index)
+{
+  mData[PrepareInsertAt(index)] = std::move(value);
 }
 
 template <typename T, size_t Granularity, U8 GrowthPercentage>
@@ -477,6 +525,16 @@ inline void List<T, Granularity, GrowthPercentage>::PushBack(const T& value)
   mData[mCount++] = value;
 }
 
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline void List<T, Granularity, GrowthPercentage>::PushBack(T&& value)
+{
+  if (mCount == mData.GetSize())
+  {
+    Grow();
+  }
+  mData[mCount++] = std::move(value);
+}
+
 template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline void List<T, Granularity, GrowthPercentage>::PushBack(const T* pData, size_t count)
 {
@@ -514,7 +572,7 @@ template <typename T, size_t Granularity, U8 GrowthPercentage>
 inline void List<T, Granularity, GrowthPercentage>::RemoveFast(Iterator it)
 {
   E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_LIST_ITERATOR_VALUE);
-  *it = mData[--mCount];
+  *it = std::move(mData[--mCount]);
   Memory::Destruct(GetEnd());
 }
 
@@ -568,9 +626,9 @@ inline void List<T, Granularity, GrowthPercentage>::Resize(size_t size)
     size = Math::CeilMultiple(size, Granularity);
     if (size  != mData.GetSize())
     {
-      DynamicArray<T> temp(size);
+      DynamicArray<T> temp(size, mData.GetAllocator());
       // GetPtr() is used in favor of &mData[0] to avoid calling non-const DynamicArray::operator [] on an empty array (which would assert).
-      temp.Copy(mData.GetPtr(), Math::Min(mCount, size));
+      Memory::MoveAssign(temp.GetPtr(), mData.GetPtr(), Math::Min(mCount, size));
       mData.Swap(temp);
     }
   }
@@ -593,6 +651,26 @@ inline void List<T, Granularity, GrowthPercentage>::Grow()
   Resize(growSize == mData.GetSize() ? growSize + 1 : growSize);
 }
 
+template <typename T, size_t Granularity, U8 GrowthPercentage>
+inline size_t List<T, Granularity, GrowthPercentage>::PrepareInsertAt(size_t index)
+{
+  // Grows if required and shifts the items from the given index returning the (clamped) insertion index
+  if (mCount == mData.GetSize())
+  {
+    Grow();
+  }
+  if (index > mCount)
+  {
+    index = mCount;
+  }
+  for (size_t i = mCount; i > index; --i)
+  {
+    mData[i] = std::move(mData[i - 1]);
+  }
+  mCount++;
+  return index;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 STD begin and end expressions for range for loop
 
@@ -27,8 +27,8 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 This file defines the Map class. Map implements linear probing on a power of 2 sized array. This characteristic in 
 combination with the modulus operator (performed on the hashed key value by the array size minus one) improves the pair 
 distribution over the array, minimizing collision of keys and therefore optimizing the probing. This implementation is 
-performs really well in terms of speed with moderate memory usage (1.25 times the map count by default) however Map can 
-only be used only with POD types.
+performs really well in terms of speed with moderate memory usage (1.25 times the map count by default). Non-POD keys
+and values are supported: values are only constructed for valid pairs and pairs are moved on rehash.
 Implementation based on: http://preshing.com/20130107/this-hash-table-is-faster-than-a-judy-array/
 */
 
@@ -36,7 +36,7 @@ Implementation based on: http://preshing.com/20130107/this-hash-table-is-faster-
 #define E3_MAP2_H
 
 #include "Pair.h"
-#include <Containers/DynamicArray.h>
+#include <Memory/Memory.h>
 #include <Math/Hash.h>
 #include <Math/Comparison.h>
 #include <Assertion/Assert.h>
@@ -115,6 +115,10 @@ Please note that this class has the following usage contract:
 14. Every time a key is invalidated its pair value destructor is called.
 15. The class does not let specializing HasherClass from outside:
 'template<typename = KeyType> class HasherClass = MapHasher' vs 'typename HasherClass = MapHasher<KeyType>'
+16. Keys are constructed (and invalidated) for every pair of the array while values are only constructed for valid
+pairs: Insert move constructs the value and Emplace constructs it in place from the given arguments. Rehashing and
+removal move pairs instead of copying them. For POD types these operations reduce to plain copies.
+17. SetAllocator moves the existing pairs to memory allocated with the new allocator.
 
 Note that FindPair is faster than Find as it does not require iterator instancing. This map is optimized for speed
 while also allowing iteration. For this reason it is recommended to use iterators when iteration is needed.
@@ -167,10 +171,14 @@ public:
   };
 
   explicit Map(size_t initialSize = kDefaultMinSize);
+  Map(const Map& other);
+  Map(Map&& other);
   ~Map();
 
-  const ValueType&          operator[](KeyType key) const;
-  ValueType&                operator[](KeyType key);
+  Map&                      operator=(const Map& other);
+  Map&                      operator=(Map&& other);
+  const ValueType&          operator[](const KeyType& key) const;
+  ValueType&                operator[](const KeyType& key);
 
   // Basic operations
   const Memory::IAllocator* GetAllocator() const;
@@ -181,34 +189,45 @@ public:
   Iterator                  GetEnd();
   U8                        GetMaxOccupancyPercentage() const;
   size_t                    GetSize() const;
-  bool                      HasKey(KeyType key) const;
+  bool                      HasKey(const KeyType& key) const;
   bool                      IsEmpty() const;
   bool                      IsValid(ConstIterator cit) const;
   void                      SetAllocator(Memory::IAllocator* p);
 
   void                      Clear();
   void                      Compact();
-  ConstIterator             Find(KeyType key) const;
-  Iterator                  Find(KeyType key);
-  const Pair*               FindPair(KeyType key) const;
-  Pair*                     FindPair(KeyType key);
+  template <typename... Args>
+  Pair*                     Emplace(const KeyType& key, Args&&... args);
+  ConstIterator             Find(const KeyType& key) const;
+  Iterator                  Find(const KeyType& key);
+  const Pair*               FindPair(const KeyType& key) const;
+  Pair*                     FindPair(const KeyType& key);
+  const ValueType*          FindValue(const KeyType& key) const;
+  ValueType*                FindValue(const KeyType& key);
   Pair*                     Insert(KeyType key, ValueType value);
   void                      Remove(Iterator it);
-  bool                      RemoveIf(KeyType key);
+  bool                      RemoveIf(const KeyType& key);
   void                      RemovePair(Pair* pPair);
   void                      Resize(size_t size);
+  void                      Swap(Map& other);
 
 private:
-  DynamicArray<Pair>        mData;
+  Memory::IAllocator*       mpAllocator;
+  Pair*                     mpData;
+  size_t                    mSize;
   size_t                    mCount;
   static const U32          kMaxElementCount = 0x7fffffff; // Max I32 value
   static const U8           kDefaultMinSize = 8;
 
+  Pair*                     CreatePairs(size_t size) const;
+  void                      DestroyPairs(Pair* pData, size_t size) const;
+  Pair*                     FindSlot(const KeyType& key, bool& isFound);
   Pair*                     GetBeginPair() const;
-  Pair*                     GetIdealPair(KeyType key) const;
+  Pair*                     GetIdealPair(const KeyType& key) const;
   Pair*                     GetEndPair() const;
   Pair*                     GetNextPair(Pair* pPair) const;
   size_t                    GetPairDistance(Pair* pLeft, Pair* pRight) const;
+  void                      Reallocate(size_t size, Memory::IAllocator* pAllocator);
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -216,22 +235,71 @@ Map initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Map(size_t initialSize)
-  : mData(initialSize)
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpData(nullptr)
+  , mSize(initialSize)
   , mCount(0)
 {
-  // Initialize regular cells
   E_ASSERT_MSG(Math::IsPower2(initialSize), E_ASSERT_MSG_MATH_POWER_OF_TWO_VALUE);
-  for (U32 i = 0; i < mData.GetSize(); ++i) Hasher::Invalidate(mData[i].first);
+  mpData = CreatePairs(initialSize);
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::~Map() {}
+Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Map(const Map& other)
+  : mpAllocator(other.mpAllocator)
+  , mpData(nullptr)
+  , mSize(other.mSize)
+  , mCount(other.mCount)
+{
+  // Same size keeps the same pair positions
+  mpData = CreatePairs(mSize);
+  for (size_t i = 0; i < mSize; ++i)
+  {
+    if (Hasher::IsValid(other.mpData[i].first))
+    {
+      mpData[i].first = other.mpData[i].first;
+      new (&mpData[i].second) ValueType(other.mpData[i].second);
+    }
+  }
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Map(Map&& other)
+  : mpAllocator(other.mpAllocator)
+  , mpData(other.mpData)
+  , mSize(other.mSize)
+  , mCount(other.mCount)
+{
+  other.mpData = nullptr;
+  other.mSize = 0;
+  other.mCount = 0;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::~Map()
+{
+  DestroyPairs(mpData, mSize);
+}
 
 /*----------------------------------------------------------------------------------------------------------------------
 Map operators
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline const ValueType& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::operator[](KeyType key) const
+inline Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::operator=(const Map& other)
+{
+  Map(other).Swap(*this);
+  return *this;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::operator=(Map&& other)
+{
+  Map(std::move(other)).Swap(*this);
+  return *this;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline const ValueType& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::operator[](const KeyType& key) const
 {
   const ValueType* pValue = FindValue(key);
   E_ASSERT_MSG(pValue, E_ASSERT_MSG_MAP_KEY_VALUE);
@@ -239,7 +307,7 @@ inline const ValueType& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercent
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline ValueType& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::operator[](KeyType key)
+inline ValueType& Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::operator[](const KeyType& key)
 {
   return const_cast<ValueType&>(static_cast<const Map*>(this)->operator[](key));
 }
@@ -250,7 +318,7 @@ Map accessors
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline const Memory::IAllocator* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetAllocator() const
 {
-  return mData.GetAllocator();
+  return mpAllocator;
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
@@ -294,11 +362,11 @@ inline U8 Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetMaxOc
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline size_t Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetSize() const
 {
-  return mData.GetSize();
+  return mSize;
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline bool Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::HasKey(KeyType key) const
+inline bool Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::HasKey(const KeyType& key) const
 {
   return FindPair(key) != nullptr;
 }
@@ -318,7 +386,8 @@ inline bool Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::IsVali
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::SetAllocator(Memory::IAllocator* p)
 {
-  mData.SetAllocator(p);
+  E_ASSERT_PTR(p);
+  if (p != mpAllocator) Reallocate(mSize, p);
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -327,12 +396,12 @@ Map methods
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Clear()
 {
-  for (U32 i = 0; i < mData.GetSize(); ++i)
+  for (size_t i = 0; i < mSize; ++i)
   {
-    if (Hasher::IsValid(mData[i].first))
+    if (Hasher::IsValid(mpData[i].first))
     {
-      Memory::Destruct(&mData[i].second);
-      Hasher::Invalidate(mData[i].first);
+      Memory::Destruct(&mpData[i].second);
+      Hasher::Invalidate(mpData[i].first);
     }
   }
   mCount = 0;
@@ -344,8 +413,33 @@ inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Compac
   Resize(mCount ? Math::CeilPowerOf2((mCount * 100 + MaxOccupancyPercentage) / MaxOccupancyPercentage) : 0);
 }
 
+/**
+Inserts a pair constructing its value in place from the given arguments. If the key exists its value is replaced by a
+value constructed from the given arguments.
+@param key the pair key.
+@param args the value constructor arguments.
+@return the pair.
+@throw nothing.
+*/
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::ConstIterator Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Find(KeyType key) const
+template <typename... Args>
+inline typename Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Emplace(const KeyType& key, Args&&... args)
+{
+  bool isFound = false;
+  Pair* pPair = FindSlot(key, isFound);
+  if (isFound)
+  {
+    pPair->second = ValueType(std::forward<Args>(args)...);
+    return pPair;
+  }
+  ++mCount;
+  pPair->first = key;
+  new (&pPair->second) ValueType(std::forward<Args>(args)...);
+  return pPair;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::ConstIterator Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Find(const KeyType& key) const
 {
   Pair* pPair = const_cast<Pair*>(FindPair(key));
   Pair* pEnd = GetEndPair();
@@ -354,7 +448,7 @@ inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Co
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Iterator Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Find(KeyType key)
+inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Iterator Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Find(const KeyType& key)
 {
   Pair* pPair = const_cast<Pair*>(FindPair(key));
   Pair* pEnd = GetEndPair();
@@ -363,10 +457,10 @@ inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::It
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline typename const Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindPair(KeyType key) const
+inline typename const Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindPair(const KeyType& key) const
 {
   E_ASSERT_MSG(Hasher::IsValid(key), E_ASSERT_MSG_MAP_KEY_VALUE);
-  if (mData.GetSize() && Hasher::IsValid(key))
+  if (mSize && Hasher::IsValid(key))
   {
     for (Pair* pPair = GetIdealPair(key); Hasher::IsValid(pPair->first); pPair = GetNextPair(pPair))
     {
@@ -377,44 +471,38 @@ inline typename const Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherCl
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline typename Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindPair(KeyType key)
+inline typename Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindPair(const KeyType& key)
 {
   return const_cast<Pair*>(const_cast<const Map*>(this)->FindPair(key));
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline typename Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Insert(KeyType key, ValueType value)
+inline const ValueType* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindValue(const KeyType& key) const
 {
-  E_ASSERT_MSG(Hasher::IsValid(key), E_ASSERT_MSG_MAP_KEY_VALUE);
-  E_ASSERT_MSG(mCount <= kMaxElementCount, E_ASSERT_MSG_MAP_COUNT_MAX_VALUE, kMaxElementCount);
-  if (mData.GetSize() == 0) Resize(kDefaultMinSize);
+  const Pair* pPair = FindPair(key);
+  return pPair ? &pPair->second : nullptr;
+}
 
-  for (;;)
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline ValueType* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindValue(const KeyType& key)
+{
+  return const_cast<ValueType*>(const_cast<const Map*>(this)->FindValue(key));
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline typename Pair<KeyType, ValueType>* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Insert(KeyType key, ValueType value)
+{
+  bool isFound = false;
+  Pair* pPair = FindSlot(key, isFound);
+  if (isFound)
   {
-    for (Pair* pPair = GetIdealPair(key); ; pPair = GetNextPair(pPair))
-    {
-      // Existing key
-      if (Hasher::IsEqual(pPair->first, key))
-      {
-        pPair->second = value;
-        return pPair;
-      }
-      if (!Hasher::IsValid(pPair->first))
-      {
-        // Check current size
-        if ((mCount + 1) * 100 >= mData.GetSize() * MaxOccupancyPercentage)
-        {
-          Resize(mData.GetSize() * 2);
-          break;
-        }
-        // Insert new pair
-        ++mCount;
-        pPair->first = key;
-        pPair->second = value;
-        return pPair;
-      }
-    }
+    pPair->second = std::move(value);
+    return pPair;
   }
+  ++mCount;
+  pPair->first = std::move(key);
+  new (&pPair->second) ValueType(std::move(value));
+  return pPair;
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
@@ -425,7 +513,7 @@ inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Remove
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline bool Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::RemoveIf(KeyType key)
+inline bool Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::RemoveIf(const KeyType& key)
 {
   Pair* pPair = FindPair(key);
   if (pPair)
@@ -440,7 +528,7 @@ template <typename KeyType, typename ValueType, template<typename, size_t> class
 inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::RemovePair(Pair* pPair)
 {
   // Remove from regular cells
-  E_ASSERT(pPair >= mData.GetPtr() && static_cast<size_t>(pPair - mData.GetPtr()) < mData.GetSize());
+  E_ASSERT(pPair >= mpData && static_cast<size_t>(pPair - mpData) < mSize);
   E_ASSERT(Hasher::IsValid(pPair->first));
 
   // Remove this pPair by shuffling neighboring cells so there are no gaps in anyone's probe chain
@@ -451,15 +539,15 @@ inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Remove
       // There's nobody to swap with. Go ahead and clear this pPair, then return
       Memory::Destruct(&pPair->second);
       Hasher::Invalidate(pPair->first);
-      pPair->second = 0;
       mCount--;
       return;
     }
     Pair* ideal = GetIdealPair(neighbor->first);
     if (GetPairDistance(ideal, pPair) < GetPairDistance(ideal, neighbor))
     {
-      // Swap with neighbor, then make neighbor the new pPair to remove.
-      *pPair = *neighbor;
+      // Move neighbor, then make neighbor the new pPair to remove.
+      pPair->first = std::move(neighbor->first);
+      pPair->second = std::move(neighbor->second);
       pPair = neighbor;
     }
   }
@@ -470,48 +558,109 @@ inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Resize
 {
   if (size == 0)
   {
-    mData.Resize(0);
+    DestroyPairs(mpData, mSize);
+    mpData = nullptr;
+    mSize = 0;
     mCount = 0;
     return;
   }
   E_ASSERT_MSG(Math::IsPower2(size), E_ASSERT_MSG_MATH_POWER_OF_TWO_VALUE);
   E_ASSERT_MSG(size >= mCount, E_ASSERT_MSG_MAP_COUNT_VALUE, size, mCount);
-  if (size != mData.GetSize())
+  if (size != mSize) Reallocate(size, mpAllocator);
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Swap(Map& other)
+{
+  Memory::IAllocator* pAllocator = mpAllocator;
+  Pair* pData = mpData;
+  size_t size = mSize;
+  size_t count = mCount;
+
+  mpAllocator = other.mpAllocator;
+  mpData = other.mpData;
+  mSize = other.mSize;
+  mCount = other.mCount;
+
+  other.mpAllocator = pAllocator;
+  other.mpData = pData;
+  other.mSize = size;
+  other.mCount = count;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Map private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::CreatePairs(size_t size) const
+{
+  if (size == 0) return nullptr;
+  // Only keys are constructed: values are constructed on insertion
+  Pair* pData = static_cast<Pair*>(mpAllocator->Allocate(sizeof(Pair) * size, Memory::IAllocator::eTagArrayNew));
+  for (size_t i = 0; i < size; ++i)
+  {
+    Memory::Construct(&pData[i].first);
+    Hasher::Invalidate(pData[i].first);
+  }
+  return pData;
+}
+
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::DestroyPairs(Pair* pData, size_t size) const
+{
+  if (pData == nullptr) return;
+  for (size_t i = 0; i < size; ++i)
   {
-    // Swap current array with an array of the new size
-    DynamicArray<Pair> temp(size);
-    mData.Swap(temp);
-    for (U32 i = 0; i < mData.GetSize(); ++i) Hasher::Invalidate(mData[i].first);
-
-    // Iterate through old array
-    Pair* oldBegin = temp.GetPtr();
-    Pair* oldEnd = oldBegin + temp.GetSize();
-    for (Pair* oldPair = oldBegin; oldPair != oldEnd; ++oldPair)
+    if (Hasher::IsValid(pData[i].first)) Memory::Destruct(&pData[i].second);
+    Memory::Destruct(&pData[i].first);
+  }
+  mpAllocator->Deallocate(pData, Memory::IAllocator::eTagArrayDelete);
+}
+
+/**
+Finds the key pair or the empty pair where the key should be inserted (growing the map if required).
+@param key the key.
+@param isFound set to true if the key pair exists and false otherwise.
+@return the key pair if it exists or the empty pair to insert it otherwise.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::FindSlot(const KeyType& key, bool& isFound)
+{
+  E_ASSERT_MSG(Hasher::IsValid(key), E_ASSERT_MSG_MAP_KEY_VALUE);
+  E_ASSERT_MSG(mCount <= kMaxElementCount, E_ASSERT_MSG_MAP_COUNT_MAX_VALUE, kMaxElementCount);
+  if (mSize == 0) Resize(kDefaultMinSize);
+
+  for (;;)
+  {
+    for (Pair* pPair = GetIdealPair(key); ; pPair = GetNextPair(pPair))
     {
-      if (Hasher::IsValid(oldPair->first))
+      // Existing key
+      if (Hasher::IsEqual(pPair->first, key))
+      {
+        isFound = true;
+        return pPair;
+      }
+      if (!Hasher::IsValid(pPair->first))
       {
-        // Insert oldPair into current array
-        for (Pair* pPair = GetIdealPair(oldPair->first); ; pPair = GetNextPair(pPair))
+        // Check current size
+        if ((mCount + 1) * 100 >= mSize * MaxOccupancyPercentage)
         {
-          if (!Hasher::IsValid(pPair->first))
-          {
-            *pPair = *oldPair;
-            break;
-          }
+          Resize(mSize * 2);
+          break;
         }
+        isFound = false;
+        return pPair;
       }
     }
   }
 }
 
-/*----------------------------------------------------------------------------------------------------------------------
-Map private methods
-----------------------------------------------------------------------------------------------------------------------*/
-
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetBeginPair() const
 {
-  Pair* pBegin = const_cast<Pair*>(mData.GetPtr());
+  Pair* pBegin = mpData;
   while (pBegin != GetEndPair() && !Hasher::IsValid(pBegin->first)) ++pBegin;
   return pBegin;
 }
@@ -519,25 +668,63 @@ inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pa
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetEndPair() const
 {
-  return const_cast<Pair*>(mData.GetPtr()) + mData.GetSize();
+  return mpData + mSize;
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
-inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetIdealPair(KeyType key) const
+inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetIdealPair(const KeyType& key) const
 {
-  return const_cast<Pair*>(mData.GetPtr() + (Hasher::Hash(key) & (mData.GetSize() - 1)));
+  return mpData + (Hasher::Hash(key) & (mSize - 1));
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline typename Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Pair* Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetNextPair(Pair* pPair) const
 {
-  return (pPair + 1 != GetEndPair()) ? pPair + 1 : const_cast<Pair*>(mData.GetPtr());
+  return (pPair + 1 != GetEndPair()) ? pPair + 1 : mpData;
 }
 
 template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
 inline size_t Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::GetPairDistance(Pair* pLeft, Pair* pRight) const 
 {
-  return (pLeft < pRight) ? pRight + mData.GetSize() - pLeft : pRight - pLeft;
+  return (pLeft < pRight) ? pRight + mSize - pLeft : pRight - pLeft;
+}
+
+/**
+Moves the existing pairs to a new array.
+@param size the new array size.
+@param pAllocator the new array allocator.
+@throw nothing.
+*/
+template <typename KeyType, typename ValueType, template<typename, size_t> class HasherClass, U8 MaxOccupancyPercentage>
+inline void Map<KeyType, ValueType, HasherClass, MaxOccupancyPercentage>::Reallocate(size_t size, Memory::IAllocator* pAllocator)
+{
+  Memory::IAllocator* pOldAllocator = mpAllocator;
+  Pair* pOldBegin = mpData;
+  Pair* pOldEnd = mpData + mSize;
+
+  mpAllocator = pAllocator;
+  mpData = CreatePairs(size);
+  mSize = size;
+
+  // Move old pairs (destroying them as they are moved)
+  for (Pair* pOldPair = pOldBegin; pOldPair != pOldEnd; ++pOldPair)
+  {
+    if (Hasher::IsValid(pOldPair->first))
+    {
+      for (Pair* pPair = GetIdealPair(pOldPair->first); ; pPair = GetNextPair(pPair))
+      {
+        if (!Hasher::IsValid(pPair->first))
+        {
+          pPair->first = std::move(pOldPair->first);
+          new (&pPair->second) ValueType(std::move(pOldPair->second));
+          Memory::Destruct(&pOldPair->second);
+          break;
+        }
+      }
+    }
+    Memory::Destruct(&pOldPair->first);
+  }
+  if (pOldBegin) pOldAllocator->Deallocate(pOldBegin, Memory::IAllocator::eTagArrayDelete);
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -61,6 +61,8 @@ Please note that this class has the following usage contract:
 
 1. GetFront will E_ASSERT_MSG on an empty queue.
 2. On resize array elements are always default initialized.
+3. Emplace constructs a temporary from the given arguments and moves it into the queue. Push rvalue version moves the 
+given value as well. On resize existing items are moved into the new memory instead of being copied.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T, U8 GrowthPercentage = E_INTERNAL_SETTING_QUEUE_GROWTH_PERCENTAGE>
 class Queue
@@ -68,8 +70,14 @@ class Queue
 public:
   Queue();
   explicit Queue(size_t size);
+  Queue(const Queue& other);
+  Queue(Queue&& other);
   ~Queue();
 
+  // Operators
+  Queue&            operator=(const Queue& other);
+  Queue&            operator=(Queue&& other);
+
   // Accessors
   const Memory::IAllocator* GetAllocator() const;
   size_t            GetCount() const;
@@ -84,9 +92,12 @@ public:
   // Methods        
   void              Clear();
   void              Compact();
+  template <typename... Args>
+  void              Emplace(Args&&... args);
   void              EnsureSize(size_t size);
   void              Pop(size_t count = 1);
   void              Push(const T& value);
+  void              Push(T&& value);
   void              Push(const T* pData, size_t count);
   void              Reserve(size_t size);
   void              Resize(size_t size);
@@ -98,7 +109,9 @@ private:
   size_t            mHead;
   size_t            mTail;
 
-  // Relying on default copy constructor and assignment operator
+  size_t            PreparePush();
+
+  // This class defines copy & move constructors and assignment operators
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -121,11 +134,62 @@ inline Queue<T, GrowthPercentage>::Queue(size_t size)
 {
 }
 
+template <typename T, U8 GrowthPercentage>
+inline Queue<T, GrowthPercentage>::Queue(const Queue& other)
+  : mData(other.mData)
+  , mCount(other.mCount)
+  , mHead(other.mHead)
+  , mTail(other.mTail)
+{
+}
+
+template <typename T, U8 GrowthPercentage>
+inline Queue<T, GrowthPercentage>::Queue(Queue&& other)
+  : mData(std::move(other.mData))
+  , mCount(other.mCount)
+  , mHead(other.mHead)
+  , mTail(other.mTail)
+{
+  other.mCount = 0;
+  other.mHead = 0;
+  other.mTail = 0;
+}
+
 template <typename T, U8 GrowthPercentage>
 inline Queue<T, GrowthPercentage>::~Queue()
 {
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+Queue operators
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, U8 GrowthPercentage>
+inline Queue<T, GrowthPercentage>& Queue<T, GrowthPercentage>::operator=(const Queue& other)
+{
+  mData = other.mData;
+  mCount = other.mCount;
+  mHead = other.mHead;
+  mTail = other.mTail;
+  return *this;
+}
+
+template <typename T, U8 GrowthPercentage>
+inline Queue<T, GrowthPercentage>& Queue<T, GrowthPercentage>::operator=(Queue&& other)
+{
+  if (this != &other)
+  {
+    mData = std::move(other.mData);
+    mCount = other.mCount;
+    mHead = other.mHead;
+    mTail = other.mTail;
+    other.mCount = 0;
+    other.mHead = 0;
+    other.mTail = 0;
+  }
+  return *this;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Queue accessors
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -205,6 +269,13 @@ inline void Queue<T, GrowthPercentage>::Compact()
   Resize(mCount);
 }
 
+template <typename T, U8 GrowthPercentage>
+template <typename... Args>
+inline void Queue<T, GrowthPercentage>::Emplace(Args&&... args)
+{
+  mData[PreparePush()] = T(std::forward<Args>(args)...);
+}
+
 template <typename T, U8 GrowthPercentage>
 inline void Queue<T, GrowthPercentage>::EnsureSize(size_t size)
 {
@@ -236,14 +307,13 @@ inline void Queue<T, GrowthPercentage>::Pop(size_t count)
 template <typename T, U8 GrowthPercentage>
 inline void Queue<T, GrowthPercentage>::Push(const T& value)
 {
-  if (mCount == mData.GetSize())
-  {
-    size_t growSize = static_cast<size_t>(mData.GetSize() * (GrowthPercentage + 100) / 100);
-    Resize(growSize == mData.GetSize() ? growSize + 1 : growSize);
-  }
-  mData[mTail++] = value;
-  if (mTail == mData.GetSize()) mTail = 0;
-  mCount++;
+  mData[PreparePush()] = value;
+}
+
+template <typename T, U8 GrowthPercentage>
+inline void Queue<T, GrowthPercentage>::Push(T&& value)
+{
+  mData[PreparePush()] = std::move(value);
 }
 
 template <typename T, U8 GrowthPercentage>
@@ -256,7 +326,7 @@ template <typename T, U8 GrowthPercentage>
 inline void Queue<T, GrowthPercentage>::Reserve(size_t size)
 {
   Clear();
-  mData = DynamicArray<T>(size);
+  mData.Resize(size);
 }
 
 template <typename T, U8 GrowthPercentage>
@@ -265,16 +335,16 @@ inline void Queue<T, GrowthPercentage>::Resize(size_t size)
   if (size == 0)
   {
     Clear();
-    mData = DynamicArray<T>();
+    mData.Resize(0);
   }
   else if (size != mData.GetSize())
   {
     mTail = 0;
-    DynamicArray<T> temp(size);
+    DynamicArray<T> temp(size, mData.GetAllocator());
     size_t copySize = Math::Min(size, mCount);
     while (mTail != copySize)
     {
-      temp[mTail++] = mData[mHead++];
+      temp[mTail++] = std::move(mData[mHead++]);
       if (mHead == mData.GetSize()) mHead = 0;
     }
     mHead = 0;
@@ -290,6 +360,24 @@ inline void Queue<T, GrowthPercentage>::Trim(size_t size)
   mTail = mHead + mCount;
   if (mTail > mData.GetSize()) mTail -= mData.GetSize();
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+Queue private methods
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, U8 GrowthPercentage>
+inline size_t Queue<T, GrowthPercentage>::PreparePush()
+{
+  // Grows if required and advances the tail returning the index of the slot to write to
+  if (mCount == mData.GetSize())
+  {
+    size_t growSize = static_cast<size_t>(mData.GetSize() * (GrowthPercentage + 100) / 100);
+    Resize(growSize == mData.GetSize() ? growSize + 1 : growSize);
+  }
+  size_t index = mTail++;
+  if (mTail == mData.GetSize()) mTail = 0;
+  mCount++;
+  return index;
+}
 }
 }
 
@@ -0,0 +1,704 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SmallList.h
+This file defines the SmallList class. SmallList is a List variant holding up to a compile-time number of elements in
+inline storage, only spilling to a DynamicArray (and hence to its allocator) when that capacity is exceeded.
+*/
+
+#ifndef E3_SMALL_LIST_H
+#define E3_SMALL_LIST_H
+
+#include "List.h"
+
+namespace E
+{
+namespace Containers
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList
+
+Please note that this class has the following usage contract:
+
+1. SmallList provides the same interface as List and follows the List usage contract, with the exceptions below.
+2. The list size is never smaller than InlineCapacity. While the size is InlineCapacity elements are stored inline and
+no memory is allocated.
+3. Growing over InlineCapacity moves the list elements to heap memory allocated through the list allocator. Resizing
+back to a size smaller or equal to InlineCapacity (e.g. Compact) moves them back inline and deallocates the heap memory.
+4. Resize(0) sets the element count to 0 and deallocates the heap memory (if any).
+5. Resize to a size smaller than the current count reduces the element count to the new size.
+6. Iterators and pointers are invalidated whenever elements move between inline and heap storage, as well as on copy.
+7. InlineCapacity MUST be greater than zero and a multiple of Granularity.
+8. Moving a list with heap storage takes over its memory, while inline elements are moved one by one (they live in the
+instance). In both cases the moved-from list is left empty and inline.
+
+Note: inline elements are part of the SmallList instance, so large InlineCapacity values make the instance (and any
+class holding it) equally large. SmallList is intended for short lists like event bindings or per draw parameters.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, size_t InlineCapacity, size_t Granularity = 1, U8 GrowthPercentage = E_INTERNAL_SETTING_LIST_GROWTH_PERCENTAGE>
+class SmallList
+{
+public:
+  // Types
+  typedef typename T* Iterator;
+  typedef typename const T* ConstIterator;
+
+  // Constants
+  static const size_t  kInvalidIndex = static_cast<size_t>(-1); // 0xffffffff
+
+  SmallList();
+  explicit SmallList(size_t size);
+  SmallList(size_t size, const T& value);
+  SmallList(const T* pData, size_t count);
+  SmallList(const SmallList& other);
+  SmallList(SmallList&& other);
+  ~SmallList();
+
+  // Operators
+  SmallList&                operator=(const SmallList& other);
+  SmallList&                operator=(SmallList&& other);
+  const T&                  operator [] (size_t index) const;
+  T&                        operator [] (size_t index);
+
+  // Accessors
+  const Memory::IAllocator* GetAllocator() const;
+  ConstIterator             GetBack() const;
+  Iterator                  GetBack();
+  ConstIterator             GetBegin() const;
+  Iterator                  GetBegin();
+  size_t                    GetCount() const;
+  ConstIterator             GetEnd() const;
+  Iterator                  GetEnd();
+  size_t                    GetGranularity() const;
+  U8                        GetGrowthPercentage() const;
+  size_t                    GetInlineCapacity() const;
+  const T*                  GetPtr() const;
+  T*                        GetPtr();
+  size_t                    GetSize() const;
+  bool                      HasValue(const T& value) const;
+  bool                      IsEmpty() const;
+  bool                      IsInline() const;
+  bool                      IsValid(ConstIterator cit) const;
+  bool                      IsValid(size_t index) const;
+  void                      SetAllocator(Memory::IAllocator* p);
+  void                      SetCount(size_t count);
+
+  // Methods
+  void                      Clear();
+  void                      Compact();
+  void                      Copy(const T* pData, size_t count, size_t startIndex = 0);
+  template <typename... Args>
+  void                      EmplaceBack(Args&&... args);
+  void                      EnsureSize(size_t size);
+  void                      Fill(const T& value, size_t startIndex = 0);
+  ConstIterator             Find(const T& value) const;
+  Iterator                  Find(const T& value);
+  size_t                    FindIndex(const T& value) const;
+  T*                        FindValue(const T& value);
+  void                      InsertAt(const T& value, size_t index);
+  void                      InsertAt(T&& value, size_t index);
+  void                      PopBack(size_t count = 1);
+  void                      PushBack(const T& value);
+  void                      PushBack(T&& value);
+  void                      PushBack(const T* pData, size_t count);
+  void                      PushBack(const SmallList& other);
+  void                      Remove(Iterator it, size_t count = 1);
+  void                      RemoveIndex(size_t index);
+  void                      RemoveFast(Iterator cit);
+  void                      RemoveIndexFast(size_t index);
+  bool                      RemoveIf(const T& value);
+  bool                      RemoveIfFast(const T& value);
+  void                      Reserve(size_t size);
+  void                      Resize(size_t size);
+  void                      Trim(size_t count);
+
+private:
+  static_assert(InlineCapacity > 0 && InlineCapacity % Granularity == 0, "InlineCapacity must be a non-zero multiple of Granularity");
+
+  T                         mInlineData[InlineCapacity];
+  DynamicArray<T>           mHeapData;
+  T*                        mpData;
+  size_t                    mSize;
+  size_t                    mCount;
+
+  void                      Grow();
+  size_t                    PrepareInsertAt(size_t index);
+  void                      UpdateData();
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SmallList()
+  : mpData(mInlineData)
+  , mSize(InlineCapacity)
+  , mCount(0)
+{
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SmallList(size_t size)
+  : mpData(mInlineData)
+  , mSize(InlineCapacity)
+  , mCount(0)
+{
+  Reserve(size);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SmallList(size_t size, const T& value)
+  : mpData(mInlineData)
+  , mSize(InlineCapacity)
+  , mCount(0)
+{
+  Reserve(size);
+  Fill(value);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SmallList(const T* pData, size_t count)
+  : mpData(mInlineData)
+  , mSize(InlineCapacity)
+  , mCount(0)
+{
+  PushBack(pData, count);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SmallList(const SmallList& other)
+  : mHeapData(other.mHeapData)
+  , mCount(other.mCount)
+{
+  if (other.IsInline()) Memory::Copy(mInlineData, other.mInlineData, mCount);
+  UpdateData();
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SmallList(SmallList&& other)
+  : mHeapData(std::move(other.mHeapData))
+  , mCount(other.mCount)
+{
+  if (IsInline()) Memory::MoveAssign(mInlineData, other.mInlineData, mCount);
+  UpdateData();
+  other.mCount = 0;
+  other.UpdateData();
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::~SmallList() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList operators
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>& SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::operator=(const SmallList& other)
+{
+  if (this != &other)
+  {
+    if (other.IsInline())
+    {
+      // Keep the allocator (as DynamicArray::Resize does) while releasing the heap memory
+      mHeapData.Resize(0);
+      Memory::Copy(mInlineData, other.mInlineData, other.mCount);
+    }
+    else
+    {
+      mHeapData = other.mHeapData;
+    }
+    mCount = other.mCount;
+    UpdateData();
+  }
+  return *this;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline SmallList<T, InlineCapacity, Granularity, GrowthPercentage>& SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::operator=(SmallList&& other)
+{
+  if (this != &other)
+  {
+    if (other.IsInline())
+    {
+      mHeapData.Resize(0);
+      Memory::MoveAssign(mInlineData, other.mInlineData, other.mCount);
+    }
+    else
+    {
+      mHeapData = std::move(other.mHeapData);
+    }
+    mCount = other.mCount;
+    UpdateData();
+    other.mCount = 0;
+    other.UpdateData();
+  }
+  return *this;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline const T& SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::operator[](size_t index) const
+{
+  E_ASSERT_MSG(IsValid(index), E_ASSERT_MSG_LIST_INDEX_VALUE, index, mSize);
+  return mpData[index];
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline T& SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::operator[](size_t index)
+{
+  // Like List, write access is checked against the size and not against the count
+  E_ASSERT_MSG(index < mSize, E_ASSERT_MSG_LIST_INDEX_VALUE, index, mSize);
+  return mpData[index];
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline const Memory::IAllocator* SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetAllocator() const
+{
+  return mHeapData.GetAllocator();
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::ConstIterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetBack() const
+{
+  return (mCount == 0) ? GetEnd() : ConstIterator(mpData + mCount - 1);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Iterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetBack()
+{
+  return const_cast<Iterator>(const_cast<const SmallList*>(this)->GetBack());
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::ConstIterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetBegin() const
+{
+  return mpData;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Iterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetBegin()
+{
+  return mpData;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetCount() const
+{
+  return mCount;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::ConstIterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetEnd() const
+{
+  return mpData + mCount;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Iterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetEnd()
+{
+  return mpData + mCount;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetGranularity() const
+{
+  return Granularity;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline U8 SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetGrowthPercentage() const
+{
+  return GrowthPercentage;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetInlineCapacity() const
+{
+  return InlineCapacity;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline const T* SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetPtr() const
+{
+  return mpData;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline T* SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetPtr()
+{
+  return mpData;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::GetSize() const
+{
+  return mSize;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::HasValue(const T& value) const
+{
+  return (Find(value) != GetEnd());
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::IsEmpty() const
+{
+  return (mCount == 0);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::IsInline() const
+{
+  return (mHeapData.GetSize() == 0);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::IsValid(ConstIterator cit) const
+{
+  return (!(cit < GetBegin()) && cit < GetEnd());
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::IsValid(size_t index) const
+{
+  return (index < mCount);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SetAllocator(Memory::IAllocator* p)
+{
+  // Heap data already allocated keeps being deallocated through its original allocator (as in List)
+  mHeapData.SetAllocator(p);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::SetCount(size_t count)
+{
+  E_ASSERT_MSG(mSize >= count, E_ASSERT_MSG_LIST_COUNT_VALUE, count, mSize);
+  mCount = count;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Clear()
+{
+  Memory::Destruct(mpData, mCount);
+  mCount = 0;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Compact()
+{
+  Resize(mCount);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Copy(const T* pData, size_t count, size_t startIndex)
+{
+  EnsureSize(startIndex + count);
+  Memory::Copy(mpData + startIndex, pData, count);
+  mCount = Math::Max(mCount, startIndex + count);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+template <typename... Args>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::EmplaceBack(Args&&... args)
+{
+  PushBack(T(std::forward<Args>(args)...));
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::EnsureSize(size_t size)
+{
+  if (mSize < size) Resize(size);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Fill(const T& value, size_t startIndex)
+{
+  // Check index value, otherwise we may have undefined values
+  E_ASSERT_MSG (mCount >= startIndex, E_ASSERT_MSG_LIST_FILL_INDEX_VALUE);
+  for (mCount = startIndex; mCount < mSize; ++mCount) mpData[mCount] = value;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::ConstIterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Find(const T& value) const
+{
+  size_t i = 0;
+  for (i; i < mCount && mpData[i] != value; ++i) continue;
+  return mpData + i;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Iterator SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Find(const T& value)
+{
+  return const_cast<Iterator>(const_cast<const SmallList*>(this)->Find(value));
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::FindIndex(const T& value) const
+{
+  ConstIterator cit = Find(value);
+  return (cit != GetEnd()) ? static_cast<size_t>(cit - GetBegin()) : kInvalidIndex;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline T* SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::FindValue(const T& value)
+{
+  Iterator it = Find(value);
+  return (it != GetEnd()) ? &*it : nullptr;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::InsertAt(const T& value, size_t index)
+{
+  mpData[PrepareInsertAt(index)] = value;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::InsertAt(T&& value, size_t index)
+{
+  mpData[PrepareInsertAt(index)] = std::move(value);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::PopBack(size_t count)
+{
+  E_ASSERT_MSG(mCount >= count, E_ASSERT_MSG_LIST_REMOVE_COUNT_VALUE);
+  mCount -= count;
+  Memory::Destruct(GetEnd(), count);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::PushBack(const T& value)
+{
+  if (mCount == mSize)
+  {
+    Grow();
+  }
+  mpData[mCount++] = value;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::PushBack(T&& value)
+{
+  if (mCount == mSize)
+  {
+    Grow();
+  }
+  mpData[mCount++] = std::move(value);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::PushBack(const T* pData, size_t count)
+{
+  EnsureSize(mCount + count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    mpData[mCount++] = pData[i];
+  }
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::PushBack(const SmallList& other)
+{
+  PushBack(other.GetPtr(), other.mCount);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Remove(Iterator it, size_t count /* = 1 */)
+{
+  E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_LIST_ITERATOR_VALUE);
+  E_ASSERT_MSG(mCount >= count, E_ASSERT_MSG_LIST_REMOVE_COUNT_VALUE);
+  mCount -= count;
+  Memory::Move(it, it + count, GetEnd() - it);
+  Memory::Destruct(GetEnd(), count);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::RemoveIndex(size_t index)
+{
+  Remove(&(*this)[index]);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::RemoveFast(Iterator it)
+{
+  E_ASSERT_MSG(IsValid(it), E_ASSERT_MSG_LIST_ITERATOR_VALUE);
+  *it = std::move(mpData[--mCount]);
+  Memory::Destruct(GetEnd());
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::RemoveIndexFast(size_t index)
+{
+  RemoveFast(&(*this)[index]);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::RemoveIf(const T& value)
+{
+  Iterator it = Find(value);
+  if (it != GetEnd())
+  {
+    Remove(it);
+    return true;
+  }
+  return false;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline bool SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::RemoveIfFast(const T& value)
+{
+  Iterator it = Find(value);
+  if (it != GetEnd())
+  {
+    RemoveFast(it);
+    return true;
+  }
+  return false;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Reserve(size_t size)
+{
+  mCount = 0;
+  size = Math::CeilMultiple(size, Granularity);
+  if (size > mSize)
+  {
+    mHeapData.Reserve(size);
+    UpdateData();
+  }
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Resize(size_t size)
+{
+  if (size == 0)
+  {
+    mCount = 0;
+    mHeapData.Resize(0);
+  }
+  else
+  {
+    size = Math::CeilMultiple(size, Granularity);
+    mCount = Math::Min(mCount, size);
+    if (size <= InlineCapacity)
+    {
+      // Move back inline (nothing to do if already there)
+      if (!IsInline())
+      {
+        Memory::MoveAssign(mInlineData, mHeapData.GetPtr(), mCount);
+        mHeapData.Resize(0);
+      }
+    }
+    else if (size != mSize)
+    {
+      DynamicArray<T> temp(size, mHeapData.GetAllocator());
+      Memory::MoveAssign(temp.GetPtr(), mpData, mCount);
+      mHeapData.Swap(temp);
+    }
+  }
+  UpdateData();
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Trim(size_t count)
+{
+  if (count < mCount) PopBack(mCount - count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SmallList private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Grow()
+{
+  size_t growSize = static_cast<size_t>(mSize * (GrowthPercentage + 100) / 100);
+  Resize(growSize == mSize ? growSize + 1 : growSize);
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline size_t SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::PrepareInsertAt(size_t index)
+{
+  // Grows if required and shifts the items from the given index returning the (clamped) insertion index
+  if (mCount == mSize)
+  {
+    Grow();
+  }
+  if (index > mCount)
+  {
+    index = mCount;
+  }
+  for (size_t i = mCount; i > index; --i)
+  {
+    mpData[i] = std::move(mpData[i - 1]);
+  }
+  mCount++;
+  return index;
+}
+
+template <typename T, size_t InlineCapacity, size_t Granularity, U8 GrowthPercentage>
+inline void SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::UpdateData()
+{
+  if (IsInline())
+  {
+    mpData = mInlineData;
+    mSize = InlineCapacity;
+  }
+  else
+  {
+    mpData = mHeapData.GetPtr();
+    mSize = mHeapData.GetSize();
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+STD begin and end expressions for range for loop (see List.h)
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, size_t InlineCapacity, size_t Granularity, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::ConstIterator begin(const SmallList<T, InlineCapacity, Granularity, GrowthPercentage>& list) { return list.GetBegin(); }
+
+template <typename T, size_t InlineCapacity, size_t Granularity, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Iterator begin(SmallList<T, InlineCapacity, Granularity, GrowthPercentage>& list) { return list.GetBegin(); }
+
+template <typename T, size_t InlineCapacity, size_t Granularity, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::ConstIterator end(const SmallList<T, InlineCapacity, Granularity, GrowthPercentage>& list) { return list.GetEnd(); }
+
+template <typename T, size_t InlineCapacity, size_t Granularity, E::U8 GrowthPercentage>
+inline typename SmallList<T, InlineCapacity, Granularity, GrowthPercentage>::Iterator end(SmallList<T, InlineCapacity, Granularity, GrowthPercentage>& list) { return list.GetEnd(); }
+}
+}
+
+#endif
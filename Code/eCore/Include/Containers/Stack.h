@@ -43,6 +43,7 @@ Please note that this class has the following usage contract:
 
 1. GetTop will E_ASSERT_MSG on empty stack.
 2. On resize array elements are always default initialized (inherited from list).
+3. Emplace and Push rvalue version move the new item into the stack (inherited from list EmplaceBack / PushBack).
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
 class Stack
@@ -50,8 +51,14 @@ class Stack
 public:
   Stack();
   explicit Stack(size_t size);
+  Stack(const Stack& other);
+  Stack(Stack&& other);
   ~Stack();
 
+  // Operators
+  Stack&                    operator=(const Stack& other);
+  Stack&                    operator=(Stack&& other);
+
   // Accessors
   const Memory::IAllocator* GetAllocator() const;
   size_t                    GetCount() const;
@@ -67,9 +74,12 @@ public:
   // Methods                
   void                      Clear();
   void                      Compact();
+  template <typename... Args>
+  void                      Emplace(Args&&... args);
   void                      EnsureSize(size_t size);
   void                      Pop(size_t count = 1);
   void                      Push(const T& value);
+  void                      Push(T&& value);
   void                      Push(const T* pData, size_t count);
   void                      Reserve(size_t size);
   void                      Resize(size_t size);
@@ -78,7 +88,7 @@ public:
 private:
   List<T>                   mList;
 
-  // Relying on default copy constructor and assignment operator
+  // This class defines copy & move constructors and assignment operators
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -95,11 +105,41 @@ inline Stack<T>::Stack(size_t size)
 {
 }
 
+template <typename T>
+inline Stack<T>::Stack(const Stack& other)
+  : mList(other.mList)
+{
+}
+
+template <typename T>
+inline Stack<T>::Stack(Stack&& other)
+  : mList(std::move(other.mList))
+{
+}
+
 template <typename T>
 inline Stack<T>::~Stack()
 {
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+Stack operators
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Stack<T>& Stack<T>::operator=(const Stack& other)
+{
+  mList = other.mList;
+  return *this;
+}
+
+template <typename T>
+inline Stack<T>& Stack<T>::operator=(Stack&& other)
+{
+  mList = std::move(other.mList);
+  return *this;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Stack accessors
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -181,6 +221,13 @@ inline void Stack<T>::Compact()
   mList.Compact();
 }
 
+template <typename T>
+template <typename... Args>
+inline void Stack<T>::Emplace(Args&&... args)
+{
+  mList.EmplaceBack(std::forward<Args>(args)...);
+}
+
 template <typename T>
 inline void Stack<T>::EnsureSize(size_t size)
 {
@@ -199,6 +246,12 @@ inline void Stack<T>::Push(const T& value)
   mList.PushBack(value);
 }
 
+template <typename T>
+inline void Stack<T>::Push(T&& value)
+{
+  mList.PushBack(std::move(value));
+}
+
 template <typename T>
 inline void Stack<T>::Push(const T* pData, size_t count)
 {
@@ -41,8 +41,15 @@ This file defines includes all the headers required by the Utilities library for
 #include <Containers/Stack.h>
 #include <FileSystem/Archive.h>
 #include <FileSystem/File.h>
+#include <FileSystem/IoQueue.h>
+#include <FileSystem/Pack.h>
+#include <FileSystem/Scanner.h>
+#include <FileSystem/Watcher.h>
 #include <Math/Random.h>
 #include <Text/String.h>
+#include <Threads/TaskGraph.h>
+#include <Threads/TaskScheduler.h>
+#include <Threads/ThreadLocal.h>
 #include <Threads/ThreadPool.h>
 #include <Time/Time.h>
 #include <Serialization/XmlSerializer.h>
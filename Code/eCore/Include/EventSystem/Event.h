@@ -82,7 +82,7 @@ Usage:
 #define E3_EVENT_H
 
 #include <Base.h>
-#include <Containers/List.h>
+#include <Containers/SmallList.h>
 #include <Assertion/Assert.h>
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -154,7 +154,8 @@ private:
     EventHandler    handlerMethod;
   };
 
-  typedef Containers::List<Binding> BindingList;
+  // Most callbacks have a few bindings: keep them inline to avoid allocating on every first Bind
+  typedef Containers::SmallList<Binding, 4> BindingList;
 
   template <typename EventHandlerClass, void(EventHandlerClass::*Method)(const EventClass&)>
   static void Binder(IEventHandler* pEventHandler, const EventClass& event);
@@ -222,7 +223,8 @@ private:
     EventHandler            handlerMethod;
   };
 
-  typedef Containers::List<Binding> BindingList;
+  // Most callbacks have a few bindings: keep them inline to avoid allocating on every first Bind
+  typedef Containers::SmallList<Binding, 4> BindingList;
 
   template <typename EventHandlerClass, typename EventClass, void(EventHandlerClass::*Method)(const EventClass&)>
   static void Binder(IEventHandler* pEventHandler, const IEvent& event);
@@ -378,7 +380,7 @@ inline void GenericEventCallback::Unbind(IEvent::Type typeId, EventHandlerClass*
     const Binding& binding = *it;
     if (binding.typeId == typeId && binding.pEventHandler == pEventHandler && binding.handlerMethod == handlerMethod)
     {
-      mBindingList.RemoveFast(it); // List is sequential container: do not increase the iterator after removal
+      mBindingList.RemoveFast(it); // BindingList is a sequential container: do not increase the iterator after removal
     }
     else
     {
@@ -395,7 +397,7 @@ inline void GenericEventCallback::Unbind(const IEventHandler* pEventHandler)
     const Binding& binding = *it;
     if (binding.pEventHandler == pEventHandler)
     {
-      mBindingList.RemoveFast(it); // List is sequential container: do not increase the iterator after removal
+      mBindingList.RemoveFast(it); // BindingList is a sequential container: do not increase the iterator after removal
     }
     else
     {
@@ -40,6 +40,23 @@ namespace FileSystem
 {
 /*----------------------------------------------------------------------------------------------------------------------
 Archive
+
+Please note that this class has the following usage contract: 
+
+1. eOpenModeRead, eOpenModeWrite and eOpenModeAppend stream the file through a binary std::fstream: Read and Write 
+copy data from / to caller buffers.
+2. eOpenModeMap maps the whole file read only into memory. Read still copies from the current position (so streaming 
+code works in both read modes), while GetData, GetView and ReadView give zero copy access to the file bytes. Views are
+valid until Close. On 32 bit builds the file has to fit in the free address space, otherwise Open fails. Read, GetView 
+and ReadView are clamped to the file end: reads past it are short (as in the stream mode) and views past it are empty.
+SetPosition, Prefetch, Release and GetResidentSize clamp their positions and ranges to the file end as well.
+3. The access pattern is a caching hint given to the OS on Open (ignored by the stream modes). Prefetch asks the OS to 
+bring a mapped range into memory ahead of its use and Release drops a range from the process working set (pages stay
+in the system file cache); both are hints and do nothing in the stream modes.
+4. GetResidentSize tells how many bytes of a mapped range are in the process working set, accessing the rest page 
+faults. GetPageFaultCount gets the page fault count of the whole process (soft and hard faults), meant to be sampled 
+before and after a load to account for its faults.
+5. GetSize is the file size in the read modes and 0 in the write modes.
 ----------------------------------------------------------------------------------------------------------------------*/
 class Archive
 {
@@ -48,25 +65,60 @@ public:
   {
     eOpenModeRead,
     eOpenModeWrite,
-    eOpenModeAppend
+    eOpenModeAppend,
+    eOpenModeMap
+  };
+
+  enum AccessPattern
+  {
+    eAccessPatternNormal,
+    eAccessPatternSequential,
+    eAccessPatternRandom
   };
 
-  Archive();
-  ~Archive();
+  // Read only range of a mapped archive
+  struct View
+  {
+    const U8*   pData;
+    size_t      size;
+
+    View() : pData(nullptr), size(0) {}
+    View(const U8* pData, size_t size) : pData(pData), size(size) {}
+  };
+
+  E_API Archive();
+  E_API ~Archive();
 
   // Accessors
-  const Path&   GetPath() const;
-  bool          IsOpen() const;
+  E_API const U8*     GetData() const;
+  E_API const Path&   GetPath() const;
+  E_API size_t        GetPosition();
+  E_API size_t        GetResidentSize(size_t offset, size_t length) const;
+  E_API size_t        GetSize() const;
+  E_API View          GetView(size_t offset, size_t length) const;
+  E_API bool          IsMapped() const;
+  E_API bool          IsOpen() const;
+  E_API void          SetPosition(size_t position);
 
   // Methods
-  void          Close();
-  bool          Open(const Path& filePath, OpenMode openMode = eOpenModeRead);
-  void          Read(char* pTarget, size_t length);
-  void          Write(const char* pSource, size_t length);
+  E_API void          Close();
+  E_API bool          Open(const Path& filePath, OpenMode openMode = eOpenModeRead, 
+                           AccessPattern accessPattern = eAccessPatternNormal);
+  E_API void          Prefetch(size_t offset, size_t length) const;
+  E_API void          Read(char* pTarget, size_t length);
+  E_API View          ReadView(size_t length);
+  E_API void          Release(size_t offset, size_t length) const;
+  E_API void          Write(const char* pSource, size_t length);
+
+  // Static methods
+  E_API static U64    GetPageFaultCount();
 
 private:
-  Path          mFilePath;
-  std::fstream  mFileStream;
+  Path                mFilePath;
+  std::fstream        mFileStream;
+  size_t              mPosition;  // Mapped read position
+  size_t              mSize;
+  E_PIMPL             mpImpl;     // Platform file mapping
 
   E_DISABLE_COPY_AND_ASSSIGNMENT(Archive);
 };
@@ -61,6 +61,7 @@ enum Flags
   eFlagDirectory  = 2,
   eFlagReadOnly   = 4,
   eFlagHidden     = 8,
+  eFlagLink       = 16, // Symbolic link or junction (reparse point)
   eFlagAny        = eFlagFile | eFlagDirectory
 };
 
@@ -86,18 +87,23 @@ E_API bool		Destroy(const Path& path);
 E_API bool	  Exists(const Path& path);
 }
 
+typedef Containers::List<File::Info> InfoList;
+
 /*----------------------------------------------------------------------------------------------------------------------
 Directory
 
 Please note that this namespace have the following usage contract:
 
 1. Directory uses Path assuming UTF-8 encoding.
+2. The GetChildren overload taking an info list gets the File::Info of every child along with its path in the same 
+directory enumeration pass (no File::GetInfo query per child). It returns false if the directory can not be read.
 ----------------------------------------------------------------------------------------------------------------------*/
 namespace Directory
 {
 E_API bool 		IsEmpty(const Path& path);
 E_API Path    GetBase();
 E_API bool 	  GetChildren(const Path& path, PathList& directoryList, U8 fileFlags = File::eFlagAny);
+E_API bool 	  GetChildren(const Path& path, PathList& pathList, InfoList& infoList, U8 fileFlags = File::eFlagAny);
 E_API Path    GetParent(const Path& path);
 E_API bool    Create(const Path& path);
 E_API bool    Destroy(const Path& path);
@@ -109,6 +115,7 @@ File types
 ----------------------------------------------------------------------------------------------------------------------*/
 typedef Containers::List<FileSystem::Path> FilePathList;
 typedef FileSystem::File::Info FileInfo;
+typedef Containers::List<FileSystem::File::Info> FileInfoList;
 typedef FileSystem::File::Flags FileFlags;
 }
 
@@ -0,0 +1,197 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file IoQueue.h
+This file declares the IoQueue class.
+*/
+
+#ifndef E3_IO_QUEUE_H
+#define E3_IO_QUEUE_H
+
+#include "Path.h"
+#include <Containers/List.h>
+#include <Threads/Atomic.h>
+#include <Threads/ConditionVariable.h>
+#include <Threads/Mutex.h>
+
+namespace E
+{
+namespace Threads
+{
+// Forward declarations
+class IRunnable;
+class ThreadPool;
+}
+
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue
+
+IoQueue reads files asynchronously: callers submit batches of read requests and keep working while the reads are in
+flight, polling the requests or waiting for them.
+
+This class is thread-safe.
+
+Please note that this class has the following usage contract: 
+
+1. Requests are caller owned and MUST remain valid (as well as their target buffers) until they are done. A request 
+can be submitted again once it is done.
+2. Requests are issued highest priority first (in submission order within a priority), keeping up to 
+GetMaxInFlightCount reads in flight. A high enough in flight count keeps the device queues full.
+3. eBackendNative uses an I/O completion port: a single service thread opens the files and issues overlapped reads, 
+handling their completion. eBackendThreadPool performs blocking reads from a pool of reader threads owned by the queue 
+(one per in flight read). eBackendThreadPool is also used when the native backend is not available.
+4. Once a request is done (completed, failed or cancelled) its completion runnable (if any) is added to the thread 
+pool, so ThreadPool::WaitForItem can wait for it. The global thread pool is used unless SetThreadPool is called; with 
+a nullptr thread pool (or a full one) completions run on the I/O thread. A completion runnable MUST NOT be shared by
+requests in flight at the same time.
+5. A request keeps its in flight slot while its completion is dispatched, so IsIdle and WaitForIdle account for the
+completions run on the I/O thread, whereas Wait may return before the request completion is dispatched. The 
+completions of requests cancelled while pending are dispatched before Cancel and CancelAll return.
+6. Reads stop at the end of the file: GetReadSize tells how many bytes were read. Requests on files that can not be
+opened fail.
+7. Cancel removes pending requests from the queue and aborts in flight ones (an in flight read may still complete). 
+Cancel returns false if the request is already done.
+8. Destruction cancels all the requests and waits for the in flight ones to finish.
+----------------------------------------------------------------------------------------------------------------------*/
+class IoQueue
+{
+  class Impl;
+  class Reader;
+
+public:
+  enum Backend
+  {
+    eBackendNative,
+    eBackendThreadPool
+  };
+
+  enum Priority
+  {
+    ePriorityLow,
+    ePriorityNormal,
+    ePriorityHigh,
+    ePriorityCount
+  };
+
+  enum Status
+  {
+    eStatusNone,
+    eStatusPending,
+    eStatusInProgress,
+    eStatusCompleted,
+    eStatusFailed,
+    eStatusCancelled
+  };
+
+  // Read request (reads size bytes starting at offset into pTarget)
+  class Request
+  {
+  public:
+    E_API Request();
+    E_API Request(const Path& filePath, U8* pTarget, size_t size, U64 offset = 0, 
+                  Threads::IRunnable* pCompletion = nullptr);
+
+    // Accessors
+    E_API size_t              GetReadSize() const;
+    E_API Status              GetStatus() const;
+    E_API bool                IsDone() const;
+
+    Path                      filePath;
+    U8*                       pTarget;
+    size_t                    size;
+    U64                       offset;
+    Threads::IRunnable*       pCompletion;  // Runnable added to the thread pool once the request is done
+
+  private:
+    Request*                  mpNext;       // Pending / in flight list links
+    Request*                  mpPrev;
+    size_t                    mReadSize;
+    A32                       mStatus;
+    A32                       mCancelFlag;  // Set to abort an in flight read
+    Priority                  mPriority;
+
+    friend class IoQueue;
+    friend class Impl;
+    friend class Reader;
+  };
+
+  static const U32            kDefaultMaxInFlightCount = 32;
+  static const U32            kMaxInFlightCount = 256;
+
+  E_API explicit IoQueue(Backend backend = eBackendNative);
+  E_API ~IoQueue();
+
+  // Accessors
+  E_API Backend               GetBackend() const;
+  E_API U32                   GetInFlightCount() const;     // Gets the number of requests being read
+  E_API U32                   GetMaxInFlightCount() const;
+  E_API U32                   GetPendingCount() const;      // Gets the number of requests waiting to be issued
+  E_API bool                  IsIdle() const;               // Returns true if there are no pending or in flight requests
+  E_API void                  SetMaxInFlightCount(U32 v);
+  E_API void                  SetThreadPool(Threads::ThreadPool* pThreadPool);
+
+  // Methods
+  E_API bool                  Cancel(Request& request);
+  E_API void                  CancelAll();
+  E_API void                  Submit(Request& request, Priority priority = ePriorityNormal);
+  E_API void                  Submit(Request* pRequests, size_t count, Priority priority = ePriorityNormal);
+  E_API void                  Wait(const Request& request); // Makes the calling thread wait till the request is done
+  E_API void                  WaitForIdle();                // Makes the calling thread wait till all requests are done
+
+private:
+  typedef Containers::List<Reader*> ReaderList;
+
+  mutable Threads::Mutex      mMutex;
+  Threads::ConditionVariable  mDoneCondition;               // Signaled when a request is done
+  Threads::ConditionVariable  mPendingCondition;            // Signaled when a reader may issue a request
+  Request*                    mpPendingHeads[ePriorityCount]; // Pending requests FIFO list per priority
+  Request*                    mpPendingTails[ePriorityCount];
+  Request*                    mpInFlightHead;
+  Request*                    mpInFlightTail;
+  ReaderList                  mReaderList;
+  Threads::ThreadPool*        mpThreadPool;
+  Backend                     mBackend;
+  U32                         mInFlightCount;
+  U32                         mMaxInFlightCount;
+  U32                         mPendingCount;
+  bool                        mTerminationFlag;
+  E_PIMPL                     mpImpl;                       // Native backend (nullptr for eBackendThreadPool)
+
+  void                        Complete(Request* pRequest, Status status, size_t readSize);
+  void                        Dispatch(Threads::IRunnable* pCompletion, Threads::ThreadPool* pThreadPool);
+  Threads::IRunnable*         Finish(Request* pRequest, Status status, size_t readSize);
+  Request*                    PopPending();
+
+  static void                 Link(Request*& pHead, Request*& pTail, Request* pRequest);
+  static void                 Unlink(Request*& pHead, Request*& pTail, Request* pRequest);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(IoQueue)
+};
+}
+}
+
+#endif
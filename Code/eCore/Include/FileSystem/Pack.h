@@ -0,0 +1,193 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Pack.h
+This file declares the Pack and PackWriter classes.
+*/
+
+#ifndef E3_PACK_H
+#define E3_PACK_H
+
+#include "Archive.h"
+#include <Containers/DynamicArray.h>
+#include <Containers/List.h>
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Pack
+
+A pack is a single file holding many entries (small files) behind a hashed table of contents, so opening an entry 
+is a hash lookup instead of an open / stat round trip to the file system.
+
+Pack file layout (native byte order):
+
+[Header, padded to kAlignment] [Payloads, each starting at a multiple of kAlignment] [Table of contents]
+
+The table of contents starts at a multiple of kAlignment and holds the slot table (slotCount Slot values), the entry 
+table (entryCount Entry values) and the name table (nameTableSize bytes of zero terminated entry paths).
+
+Please note that this class has the following usage contract: 
+
+1. Entry paths are relative, case sensitive and use '/' as separator. Find accepts '\' separators as well as leading 
+separators, so Windows style paths can be looked up directly.
+2. Slots are indexed by the Math::Fnv32 hash of the entry path modulo slotCount (linear probing). The slot table is at 
+most half full, which keeps lookups O(1).
+3. The pack is mapped read only (Archive::eOpenModeMap): GetView gives zero copy access to an entry payload and 
+Prefetch / Release hints go through GetArchive. Views and entries are valid until Close. Payloads are aligned to 
+kAlignment, so they can be read with unbuffered or asynchronous I/O as well (IoQueue requests with the entry offset).
+4. Compressed entries (eEntryFlagCompressed) are stored as given to PackWriter::AddCompressed: GetView gives the stored 
+bytes and Entry::size the byte size once decompressed. Pack does not decompress, flags from eEntryFlagUser up are 
+free for the caller (to tell the codec for instance).
+5. Open fails if the file is not a valid pack.
+----------------------------------------------------------------------------------------------------------------------*/
+class Pack
+{
+public:
+  static const U32  kAlignment    = 4096;
+  static const U32  kInvalidIndex = 0xffffffff;
+  static const U32  kMagic        = 0x4b503345; // "E3PK"
+  static const U32  kVersion      = 1;
+
+  enum EntryFlags
+  {
+    eEntryFlagCompressed  = 1,
+    eEntryFlagUser        = 256
+  };
+
+  struct Header
+  {
+    U32             magic;
+    U32             version;
+    U32             entryCount;
+    U32             slotCount;      // Power of 2, at least twice the entry count
+    U64             tocOffset;      // Table of contents offset
+    U64             nameTableSize;
+  };
+
+  struct Slot
+  {
+    U32             hash;
+    U32             entryIndex;     // kInvalidIndex for empty slots
+  };
+
+  struct Entry
+  {
+    U64             offset;         // Payload offset
+    U64             storedSize;     // Payload byte size in the pack
+    U64             size;           // Payload byte size once decompressed (storedSize if not compressed)
+    U32             nameOffset;     // Entry path offset in the name table
+    U16             nameLength;
+    U16             flags;
+
+    bool            IsCompressed() const { return (flags & eEntryFlagCompressed) != 0; }
+  };
+
+  E_API Pack();
+  E_API ~Pack();
+
+  // Accessors
+  E_API const Archive&  GetArchive() const;
+  E_API const Entry&    GetEntry(size_t index) const;
+  E_API size_t          GetEntryCount() const;
+  E_API const char*     GetName(const Entry& entry) const;
+  E_API const Path&     GetPath() const;
+  E_API Archive::View   GetView(const Entry& entry) const;
+  E_API bool            IsOpen() const;
+
+  // Methods
+  E_API void            Close();
+  E_API const Entry*    Find(const Path& entryPath) const;
+  E_API bool            Open(const Path& packPath, 
+                             Archive::AccessPattern accessPattern = Archive::eAccessPatternRandom);
+
+private:
+  bool                  Load();
+
+  Archive               mArchive;
+  const Header*         mpHeader;
+  const Slot*           mpSlots;
+  const Entry*          mpEntries;
+  const char*           mpNames;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Pack);
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackWriter
+
+Please note that this class has the following usage contract: 
+
+1. Entries are written as they are added, the table of contents and the header are written on Close (the pack is not
+valid until then). Destruction closes the pack.
+2. Entry paths follow the Pack contract (they are converted to '/' separators). Adding an entry path twice fails.
+3. AddDirectory adds the files of a directory tree, using their paths relative to the directory as entry paths.
+4. AddCompressed stores data compressed by the caller: size is the byte size once decompressed and flags are stored 
+along with eEntryFlagCompressed.
+----------------------------------------------------------------------------------------------------------------------*/
+class PackWriter
+{
+public:
+  E_API PackWriter();
+  E_API ~PackWriter();
+
+  // Accessors
+  E_API size_t          GetEntryCount() const;
+  E_API bool            IsOpen() const;
+
+  // Methods
+  E_API bool            Add(const Path& entryPath, const U8* pData, size_t size);
+  E_API bool            AddCompressed(const Path& entryPath, const U8* pData, size_t storedSize, size_t size, 
+                                      U16 flags = 0);
+  E_API bool            AddDirectory(const Path& directoryPath);
+  E_API bool            AddFile(const Path& entryPath, const Path& filePath);
+  E_API bool            Close();
+  E_API bool            Open(const Path& packPath);
+
+private:
+  bool                  AddChildren(const Path& directoryPath, size_t basePathLength);
+  Pack::Entry*          AddEntry(const Path& entryPath, U16 flags);
+  void                  EndEntry(Pack::Entry& entry, U64 size);
+  void                  Pad();
+  void                  Write(const void* pSource, size_t length);
+
+  typedef Containers::List<Pack::Entry> EntryList;
+  typedef Containers::List<Pack::Slot> SlotList;
+
+  Archive                       mArchive;
+  Containers::DynamicArray<U8>  mBuffer;    // AddFile copy buffer
+  EntryList                     mEntryList;
+  Containers::List<char>        mNameList;
+  SlotList                      mSlotList;
+  U64                           mPosition;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(PackWriter);
+};
+}
+}
+
+#endif
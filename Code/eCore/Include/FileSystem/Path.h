@@ -31,6 +31,7 @@ This file defines the library file system path types.
 #ifndef E3_PATH_H
 #define E3_PATH_H
 
+#include <Math/Hash.h>
 #include <Text/String.h>
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -66,6 +67,18 @@ namespace FileSystem
  ----------------------------------------------------------------------------------------------------------------------*/
 typedef E::Text::CharArray<char, E_INTERNAL_SETTING_PATH_SIZE> Path;
 typedef E::Text::CharArray<wchar_t, E_INTERNAL_SETTING_PATH_SIZE> WPath;
+
+/*----------------------------------------------------------------------------------------------------------------------
+PathHasher
+
+Hasher for maps keyed by Path e.g. FlatHashMap<Path, ValueType, PathHasher> (only Hash and IsEqual are provided).
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename KeyType, size_t = sizeof(KeyType)>
+struct PathHasher
+{
+  inline static size_t  Hash(const KeyType& key)                         { return Math::Fnv32<KeyType>::Hash(key); }
+  inline static bool    IsEqual(const KeyType& key1, const KeyType& key2) { return key1 == key2; }
+};
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Scanner.h
+This file declares the Scanner class.
+*/
+
+#ifndef E3_SCANNER_H
+#define E3_SCANNER_H
+
+#include "File.h"
+#include <Containers/FlatHashMap.h>
+#include <Threads/ConditionVariable.h>
+#include <Threads/Mutex.h>
+
+namespace E
+{
+namespace Threads
+{
+// Forward declarations
+class ThreadPool;
+}
+
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner
+
+Scanner walks a directory tree getting the path and the File::Info of every file and directory below its root. 
+Directories are enumerated in parallel by up to GetMaxWorkerCount workers, each directory listing (infos included) 
+coming out of a single Directory::GetChildren pass.
+
+Please note that this class has the following usage contract: 
+
+1. Scan calls MUST NOT overlap. Scan returns false if the root path is not a readable directory; subdirectories which 
+can not be read are listed but not walked.
+2. Items are listed in no particular order (use the path to sort them) and the root directory is not listed. The file 
+flags filter the items the same way Directory::GetChildren does, whereas all directories are walked regardless.
+3. Worker 0 runs on the calling thread and the rest are added to the thread pool. The global thread pool is used 
+unless SetThreadPool is called; with a nullptr thread pool (or a full one) the scan runs on the calling thread only.
+4. Links (directories flagged File::eFlagLink) are listed but not walked, so link cycles are never followed.
+5. Every scan keeps the listings of the directories walked in the cache, which SaveCache / LoadCache keep on disk. A 
+directory whose last write time matches the cached one reuses its cached listing instead of being enumerated again, 
+so only the changed directories of the tree hit the file system (the subdirectories of a reused listing are still 
+queried for their last write time).
+6. A directory last write time changes when entries are added, removed or renamed, but NOT when a file is rewritten in 
+place. Thus the sizes and times of files rewritten in place since the listing was cached are stale: use ClearCache (or 
+query the file) when those matter.
+7. LoadCache fails (keeping the current cache) if the file is not a valid cache written by the same platform build.
+----------------------------------------------------------------------------------------------------------------------*/
+class Scanner
+{
+  class Worker;
+
+public:
+  struct Item
+  {
+    Path                      path;
+    File::Info                info;
+  };
+
+  typedef Containers::List<Item> ItemList;
+
+  static const U32            kDefaultMaxWorkerCount = 8;
+  static const U32            kMaxWorkerCount = 64;
+  static const U32            kCacheMagic = 0x43533345;   // "E3SC"
+  static const U32            kCacheVersion = 1;
+
+  E_API Scanner();
+  E_API ~Scanner();
+
+  // Accessors
+  E_API size_t                GetCachedDirectoryCount() const;
+  E_API U32                   GetMaxWorkerCount() const;
+  E_API size_t                GetReusedDirectoryCount() const;  // Gets the directories taken from the cache last scan
+  E_API size_t                GetScannedDirectoryCount() const; // Gets the directories enumerated last scan
+  E_API void                  SetMaxWorkerCount(U32 v);
+  E_API void                  SetThreadPool(Threads::ThreadPool* pThreadPool);
+
+  // Methods
+  E_API void                  ClearCache();
+  E_API bool                  LoadCache(const Path& cachePath);
+  E_API bool                  SaveCache(const Path& cachePath) const;
+  E_API bool                  Scan(const Path& rootPath, ItemList& itemList, U8 fileFlags = File::eFlagAny);
+
+private:
+  // Cached directory listing: the child infos and their names, that is their path suffixes (separator included) 
+  // one after another, each zero terminated
+  struct Listing
+  {
+    Time::Date                lastWriteTime;
+    InfoList                  infoList;
+    Containers::List<char>    nameList;
+  };
+
+  struct Task
+  {
+    Path                      path;
+    Time::Date                lastWriteTime;
+  };
+
+  typedef Containers::FlatHashMap<Path, Listing, PathHasher> ListingMap;
+  typedef Containers::List<Task> TaskList;
+  typedef Containers::List<Worker*> WorkerList;
+
+  Threads::Mutex              mMutex;
+  Threads::ConditionVariable  mTaskCondition;               // Signaled when tasks are added or the scan is over
+  ListingMap                  mListingMap;                  // Cache (read only while scanning)
+  TaskList                    mTaskList;                    // Directories left to walk
+  WorkerList                  mWorkerList;
+  Threads::ThreadPool*        mpThreadPool;
+  size_t                      mReusedDirectoryCount;
+  size_t                      mScannedDirectoryCount;
+  U32                         mBusyCount;                   // Workers walking a directory
+  U32                         mMaxWorkerCount;
+  U8                          mFileFlags;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Scanner)
+};
+}
+}
+
+#endif
@@ -0,0 +1,138 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Watcher.h
+This file declares the Watcher class.
+*/
+
+#ifndef E3_WATCHER_H
+#define E3_WATCHER_H
+
+#include "Path.h"
+#include <Containers/FlatHashMap.h>
+#include <Containers/List.h>
+#include <EventSystem/Event.h>
+#include <Threads/Mutex.h>
+#include <Time/Time.h>
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher
+
+Watcher gets notified by the file system when the files and directories below the watched directories change, 
+coalescing the notifications per path and raising them through its change event callback once they settle down.
+
+Please note that this class has the following usage contract: 
+
+1. AddWatch, RemoveWatch, Update and Flush MUST be called from the same thread, where events are raised. The watches
+are served by a background thread which just queues the changes.
+2. Changes are coalesced per path: e.g. a file modified several times is reported once, added and then modified is 
+reported as added, removed and then added back is reported as modified and added and then removed is not reported.
+3. Update raises the changes of the paths which did not change for the debounce time (so a file being written is 
+reported once it is done) while Flush raises them all. Events are raised in no particular order. 
+4. Renames are reported as the old path removal and the new path addition. Paths are made of the watch directory path 
+and the changed path relative to it. Overlapping watches report their common changes once (from the last watch 
+notified).
+5. eActionRescan tells some changes below the watch directory were lost (the notification buffer overflowed or the 
+watch directory itself was removed, moved or became unreachable): the watch path should be scanned again, comparing 
+it against the known state (see Scanner). A watch stops after a rescan event unless it was caused by an overflow.
+6. RemoveWatch drops the queued changes of the watch and no events are raised for it afterwards.
+----------------------------------------------------------------------------------------------------------------------*/
+class Watcher
+{
+  class Impl;
+
+public:
+  enum Action
+  {
+    eActionAdded,
+    eActionRemoved,
+    eActionModified,
+    eActionRescan
+  };
+
+  struct ChangeEvent
+  {
+    Path                      path;
+    U32                       watchId;
+    Action                    action;
+
+    ChangeEvent() : watchId(kInvalidWatchId), action(eActionModified) {}
+    ChangeEvent(const Path& path, U32 watchId, Action action) : path(path), watchId(watchId), action(action) {}
+  };
+
+  typedef EventSystem::EventCallback<ChangeEvent> ChangeEventCallback;
+
+  static const U32            kInvalidWatchId = 0;
+  static const I64            kDefaultDebounceTime = TimeValue::kOneMillisecond * 100;
+
+  E_API Watcher();
+  E_API ~Watcher();
+
+  // Accessors
+  E_API ChangeEventCallback&  GetChangeEventCallback();
+  E_API TimeValue             GetDebounceTime() const;
+  E_API size_t                GetPendingCount() const;      // Gets the number of coalesced changes not raised yet
+  E_API size_t                GetWatchCount() const;
+  E_API bool                  IsAvailable() const;          // Returns false if the platform watch service failed
+  E_API void                  SetDebounceTime(TimeValue tv);
+
+  // Methods
+  E_API U32                   AddWatch(const Path& directoryPath, bool isRecursive = true);
+  E_API size_t                Flush();                      // Raises all the pending changes
+  E_API bool                  RemoveWatch(U32 watchId);
+  E_API size_t                Update();                     // Raises the pending changes older than the debounce time
+
+private:
+  struct Change
+  {
+    TimeValue                 time;                         // Last notification time
+    U32                       watchId;
+    Action                    action;
+  };
+
+  typedef Containers::FlatHashMap<Path, Change, PathHasher> ChangeMap;
+  typedef Containers::List<ChangeEvent> ChangeEventList;
+
+  mutable Threads::Mutex      mMutex;
+  ChangeMap                   mChangeMap;                   // Pending changes (shared with the watch service thread)
+  ChangeEventCallback         mChangeEventCallback;
+  Containers::List<U32>       mWatchIdList;
+  TimeValue                   mDebounceTime;
+  U32                         mNextWatchId;
+  E_PIMPL                     mpImpl;
+
+  void                        Notify(U32 watchId, const Path& path, Action action);
+  size_t                      Raise(TimeValue debounceTime);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Watcher)
+};
+}
+}
+
+#endif
@@ -32,12 +32,15 @@ This file defines some useful math algorithms.
 
 #include <Base.h>
 #include <Math/Comparison.h>
+#include <Memory/Memory.h>
+#include <Threads/ThreadPool.h>
 
 /*----------------------------------------------------------------------------------------------------------------------
 Memory assertion messages
 ----------------------------------------------------------------------------------------------------------------------*/
 #define E_ASSERT_MSG_ALGORITHM_ARRAY_INDICES_VALUE    "DynamicArray start index (%d) must be smaller than array end index (%d)"
 #define E_ASSERT_MSG_ALGORITHM_SORTING_NETWORK_VALUE  "Sorting network doe not support a size of (%d)"
+#define E_ASSERT_MSG_ALGORITHM_BUFFER_OVERLAP         "Sorting buffer must not overlap the array"
 
 namespace E
 {
@@ -58,12 +61,99 @@ struct Comparer
   inline static bool IsLess(const T& a, const T& b) { return a < b; }
 };
 
+/*----------------------------------------------------------------------------------------------------------------------
+KeyExtractor
+
+Please note that this class has the following usage contract: 
+
+1. KeyExtractor gives the sorting key of an element for the radix sort. The default one uses the element itself as key. 
+Custom extractors define a KeyType typedef and a static GetKey method e.g. the depth of a draw call.
+2. KeyType MUST have a RadixKey specialization (U32, I32, F32, U64, I64 and D64 are supported).
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+struct KeyExtractor
+{
+  typedef T KeyType;
+  inline static const T& GetKey(const T& v) { return v; }
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+RadixKey
+
+Maps a key to an unsigned integer with the same ordering, so that the radix sort can sort it byte by byte. Signed 
+integers get their sign bit flipped. Floating point values get the sign bit flipped when positive and all their bits 
+flipped when negative (IEEE 754 values are sign + magnitude).
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+struct RadixKey;
+
+template <>
+struct RadixKey<U32>
+{
+  typedef U32 Type;
+  inline static U32 Get(U32 v) { return v; }
+};
+
+template <>
+struct RadixKey<I32>
+{
+  typedef U32 Type;
+  inline static U32 Get(I32 v) { return static_cast<U32>(v) ^ 0x80000000; }
+};
+
+template <>
+struct RadixKey<F32>
+{
+  typedef U32 Type;
+  inline static U32 Get(F32 v) 
+  { 
+    U32 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits ^ (static_cast<U32>(static_cast<I32>(bits) >> 31) | 0x80000000);
+  }
+};
+
+template <>
+struct RadixKey<U64>
+{
+  typedef U64 Type;
+  inline static U64 Get(U64 v) { return v; }
+};
+
+template <>
+struct RadixKey<I64>
+{
+  typedef U64 Type;
+  inline static U64 Get(I64 v) { return static_cast<U64>(v) ^ 0x8000000000000000ULL; }
+};
+
+template <>
+struct RadixKey<D64>
+{
+  typedef U64 Type;
+  inline static U64 Get(D64 v) 
+  { 
+    U64 bits;
+    memcpy(&bits, &v, sizeof(bits));
+    return bits ^ (static_cast<U64>(static_cast<I64>(bits) >> 63) | 0x8000000000000000ULL);
+  }
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 Sorting
 
 Please note that this class has the following usage contract: 
 
 Note: bear in mind that in this class methods are optimized for speed rather than code repetition.
+
+1. RadixSort is a stable LSD radix sort (8 bits per pass) on the key given by a KeyExtractor. It needs a temporary
+buffer of the same size as the array: pass one to avoid the allocation in per-frame sorts, otherwise it is allocated 
+with the global allocator. Passes where all keys share the same byte are skipped.
+2. ParallelSort splits the array in chunks sorted by IntroSort in a ThreadPool (the global one by default) and merges 
+them by pairs, also in the ThreadPool. The calling thread takes part in the work and the method returns when the array 
+is sorted. Arrays too small to be split are sorted by IntroSort on the calling thread. The same buffer rules as in 
+RadixSort apply.
+3. ParallelSort MUST not be called from a task of the same ThreadPool.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T, template<typename = T> class ComparerClass = Comparer>
 class Sorting
@@ -81,14 +171,32 @@ public:
   static void         QuickSort3Way(T* ptr, size_t size);
   static void         QuickSortDualPivot(T* ptr, size_t startIndex, size_t endIndex);
   static void         QuickSortDualPivot(T* ptr, size_t size);
+  static void         ParallelSort(T* ptr, size_t size, T* pBuffer = nullptr, Threads::ThreadPool* pPool = nullptr);
+  static void         RadixSort(T* ptr, size_t size, T* pBuffer = nullptr);
+  template <typename KeyExtractorClass>
+  static void         RadixSort(T* ptr, size_t size, T* pBuffer = nullptr);
 
 private:
+  static const size_t kParallelMinChunkLength = 1 << 14;
+
+  struct ParallelSortTask : public Threads::IRunnable
+  {
+    I32               Run();
+
+    T*                pSource;
+    T*                pTarget;      // nullptr to sort the chunk in place
+    size_t            startIndex;
+    size_t            middleIndex;
+    size_t            endIndex;     // Past the last element
+  };
+
   static const size_t kMinDistanceSize = 13;
   static const size_t kSmallArrayLength = 32;
 
   static void         IntroSortDepth(T* ptr, size_t startIndex, size_t endIndex, size_t depth);
   static size_t       Median3(T* ptr, size_t startIndex, size_t endIndex);
   static size_t       Partition(T* ptr, size_t startIndex, size_t endIndex);
+  static void         RunParallelSortTasks(ParallelSortTask* pTasks, size_t count, Threads::ThreadPool* pPool);
   inline static void  Swap(T& a, T& b) { if (Comparer<T>::IsEqual(a, b)) return; T tmp = a; a = b; b = tmp; }
   inline static void  SwapIfSmaller(T& a, T& b) { if (!Comparer<T>::IsLess(a, b)) return; T tmp = a; a = b; b = tmp; }
 };
@@ -178,7 +286,7 @@ inline void Sorting<T, ComparerClass>::InsertionSort(T* ptr, size_t startIndex,
   {
     T pivot = ptr[i];
     size_t j = i;
-    for (; j > 0 && ComparerClass<T>::IsLess(pivot, ptr[j - 1]); --j) ptr[j] = ptr[j - 1];
+    for (; j > startIndex && ComparerClass<T>::IsLess(pivot, ptr[j - 1]); --j) ptr[j] = ptr[j - 1];
     ptr[j] = pivot;
   }
 }
@@ -408,6 +516,138 @@ inline void Sorting<T, ComparerClass>::QuickSortDualPivot(T* ptr, size_t size)
   QuickSortDualPivot(ptr, 0, size - 1);
 }   
 
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSort (parallel merge sort)
+
+1. The chunk count is the greatest power of two not above the processor count with chunks of at least 
+kParallelMinChunkLength elements, so that every merge pass merges pairs of equally sized runs.
+2. Merge passes go back and forth between the array and the buffer. The result is copied back if the last pass ends 
+in the buffer.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, template<typename> class ComparerClass>
+inline void Sorting<T, ComparerClass>::ParallelSort(T* ptr, size_t size, T* pBuffer /*= nullptr*/, 
+                                                    Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  E_ASSERT_MSG(size > 1, E_ASSERT_MSG_MATH_GREATER_THAN_ONE_VALUE);
+  E_ASSERT_MSG(pBuffer == nullptr || pBuffer + size <= ptr || ptr + size <= pBuffer, 
+               E_ASSERT_MSG_ALGORITHM_BUFFER_OVERLAP);
+  size_t chunkCount = 1;
+  size_t maxChunkCount = Threads::Thread::GetProcessorCount();
+  while (chunkCount * 2 <= maxChunkCount && size / (chunkCount * 2) >= kParallelMinChunkLength) chunkCount *= 2;
+  if (chunkCount == 1)
+  {
+    IntroSort(ptr, size);
+    return;
+  }
+  if (pPool == nullptr) pPool = &Threads::Global::GetThreadPool();
+  T* pTempBuffer = (pBuffer == nullptr) ? Memory::Create<T>(size) : pBuffer;
+  ParallelSortTask* pTasks = Memory::Create<ParallelSortTask>(chunkCount);
+  // Sort chunks
+  size_t chunkLength = size / chunkCount;
+  for (size_t i = 0; i < chunkCount; ++i)
+  {
+    pTasks[i].pSource = ptr;
+    pTasks[i].pTarget = nullptr;
+    pTasks[i].startIndex = i * chunkLength;
+    pTasks[i].middleIndex = pTasks[i].startIndex;
+    pTasks[i].endIndex = (i == chunkCount - 1) ? size : pTasks[i].startIndex + chunkLength;
+  }
+  RunParallelSortTasks(pTasks, chunkCount, pPool);
+  // Merge runs by pairs
+  T* pSource = ptr;
+  T* pTarget = pTempBuffer;
+  for (size_t runCount = chunkCount; runCount > 1; runCount /= 2)
+  {
+    size_t taskCount = runCount / 2;
+    for (size_t i = 0; i < taskCount; ++i)
+    {
+      pTasks[i].pSource = pSource;
+      pTasks[i].pTarget = pTarget;
+      pTasks[i].startIndex = pTasks[2 * i].startIndex;
+      pTasks[i].middleIndex = pTasks[2 * i + 1].startIndex;
+      pTasks[i].endIndex = pTasks[2 * i + 1].endIndex;
+    }
+    RunParallelSortTasks(pTasks, taskCount, pPool);
+    T* pTmp = pSource;
+    pSource = pTarget;
+    pTarget = pTmp;
+  }
+  if (pSource != ptr) Memory::Copy(ptr, pSource, size);
+  Memory::Destroy(pTasks, chunkCount);
+  if (pBuffer == nullptr) Memory::Destroy(pTempBuffer, size);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+RadixSort (LSD radix sort)
+
+Implementation based on http://codercorner.com/RadixSortRevisited.htm
+
+1. All the byte histograms are built in a single read pass before the scatter passes.
+2. Passes go back and forth between the array and the buffer. The result is copied back if the last pass ends in the
+buffer.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, template<typename> class ComparerClass>
+inline void Sorting<T, ComparerClass>::RadixSort(T* ptr, size_t size, T* pBuffer /*= nullptr*/)
+{
+  RadixSort<KeyExtractor<T> >(ptr, size, pBuffer);
+}
+
+template <typename T, template<typename> class ComparerClass>
+template <typename KeyExtractorClass>
+inline void Sorting<T, ComparerClass>::RadixSort(T* ptr, size_t size, T* pBuffer /*= nullptr*/)
+{
+  typedef RadixKey<typename KeyExtractorClass::KeyType> RadixKeyClass;
+  typedef typename RadixKeyClass::Type RadixType;
+  static const size_t kPassCount = sizeof(RadixType);
+  static const size_t kDigitCount = 256;
+
+  E_ASSERT_MSG(size > 1, E_ASSERT_MSG_MATH_GREATER_THAN_ONE_VALUE);
+  E_ASSERT_MSG(pBuffer == nullptr || pBuffer + size <= ptr || ptr + size <= pBuffer, 
+               E_ASSERT_MSG_ALGORITHM_BUFFER_OVERLAP);
+  // Build the histograms of every pass
+  size_t histograms[kPassCount][kDigitCount];
+  Memory::Zero(&histograms[0][0], kPassCount * kDigitCount);
+  for (size_t i = 0; i < size; ++i)
+  {
+    RadixType key = RadixKeyClass::Get(KeyExtractorClass::GetKey(ptr[i]));
+    for (size_t pass = 0; pass < kPassCount; ++pass) ++histograms[pass][(key >> (pass * 8)) & 0xFF];
+  }
+  // Scatter
+  T* pTempBuffer = nullptr;
+  T* pSource = ptr;
+  T* pTarget = nullptr;
+  for (size_t pass = 0; pass < kPassCount; ++pass)
+  {
+    size_t* pHistogram = histograms[pass];
+    size_t shift = pass * 8;
+    // Skip the pass if all keys share the same digit
+    if (pHistogram[(RadixKeyClass::Get(KeyExtractorClass::GetKey(ptr[0])) >> shift) & 0xFF] == size) continue;
+    if (pTarget == nullptr)
+    {
+      pTempBuffer = (pBuffer == nullptr) ? Memory::Create<T>(size) : pBuffer;
+      pTarget = pTempBuffer;
+    }
+    // Turn counts into offsets
+    size_t offset = 0;
+    for (size_t i = 0; i < kDigitCount; ++i)
+    {
+      size_t count = pHistogram[i];
+      pHistogram[i] = offset;
+      offset += count;
+    }
+    for (size_t i = 0; i < size; ++i)
+    {
+      RadixType key = RadixKeyClass::Get(KeyExtractorClass::GetKey(pSource[i]));
+      pTarget[pHistogram[(key >> shift) & 0xFF]++] = pSource[i];
+    }
+    T* pTmp = pSource;
+    pSource = pTarget;
+    pTarget = pTmp;
+  }
+  if (pSource != ptr) Memory::Copy(ptr, pSource, size);
+  if (pBuffer == nullptr && pTempBuffer != nullptr) Memory::Destroy(pTempBuffer, size);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Sorting private methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -501,6 +741,59 @@ inline size_t Sorting<T, ComparerClass>::Partition(T* ptr, size_t startIndex, si
 
   return rightIndex;
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+RunParallelSortTasks
+
+The calling thread runs the first task. Tasks rejected by the ThreadPool (maximum pending item count reached) are run 
+by the calling thread as well.
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, template<typename> class ComparerClass>
+inline void Sorting<T, ComparerClass>::RunParallelSortTasks(ParallelSortTask* pTasks, size_t count, 
+                                                            Threads::ThreadPool* pPool)
+{
+  for (size_t i = 1; i < count; ++i)
+  {
+    if (!pPool->AddItem(&pTasks[i])) pTasks[i].Run();
+  }
+  pTasks[0].Run();
+  for (size_t i = 1; i < count; ++i) pPool->WaitForItem(&pTasks[i]);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+ParallelSortTask
+
+Sorts the [startIndex, endIndex) chunk in place or merges the [startIndex, middleIndex) and [middleIndex, endIndex) 
+sorted runs into the target array. Equal elements are taken from the left run first.
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, template<typename> class ComparerClass>
+inline I32 Sorting<T, ComparerClass>::ParallelSortTask::Run()
+{
+  if (pTarget == nullptr)
+  {
+    IntroSort(pSource, startIndex, endIndex - 1);
+    return 0;
+  }
+  size_t leftIndex = startIndex;
+  size_t rightIndex = middleIndex;
+  size_t targetIndex = startIndex;
+  while (leftIndex < middleIndex && rightIndex < endIndex)
+  {
+    if (ComparerClass<T>::IsLess(pSource[rightIndex], pSource[leftIndex]))
+    {
+      pTarget[targetIndex++] = pSource[rightIndex++];
+    }
+    else
+    {
+      pTarget[targetIndex++] = pSource[leftIndex++];
+    }
+  }
+  if (leftIndex < middleIndex) Memory::Copy(pTarget + targetIndex, pSource + leftIndex, middleIndex - leftIndex);
+  if (rightIndex < endIndex) Memory::Copy(pTarget + targetIndex, pSource + rightIndex, endIndex - rightIndex);
+  return 0;
+}
 }
 }
 
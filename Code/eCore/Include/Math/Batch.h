@@ -0,0 +1,535 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Batch.h
+This file defines the Batch class, with array level versions of the Matrix4 and Box3 transformations.
+*/
+
+#ifndef E_MATH_BATCH_H
+#define E_MATH_BATCH_H
+
+#include <Base.h>
+#include <Math/Box3.h>
+#include <Math/Matrix4.h>
+#include <Math/Simd.h>
+#include <Math/Vector3.h>
+#include <Memory/Memory.h>
+#include <Threads/ThreadPool.h>
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Batch
+
+Please note that this class has the following usage contract: 
+
+1. Methods give the same results as calling the per element Matrix4 / Box3 method on every element: TransformPoints 
+uses Matrix4::TransformPoint, RotateVectors uses Matrix4::RotateVector, TransformBoxes uses Box3::Transform and 
+Multiply uses Matrix4::operator*. The F32 versions process 4 elements at a time with SSE when E_SIMD_SSE is defined.
+2. Vectors are given as arrays of Vector3 (AoS) or as one array per component (SoA). SoA arrays avoid the shuffles 
+needed to gather the AoS components, so they are the faster choice for data only used in batches.
+3. Results may be written over the source arrays (pResults == pPoints), but partially overlapping arrays are not 
+supported.
+4. When a ThreadPool is given, arrays are split in chunks of at least kMinTaskLength elements (up to one per 
+processor) run in the ThreadPool. The calling thread takes part in the work and the method returns when all the 
+elements are processed. Without a ThreadPool everything runs on the calling thread.
+5. Methods taking a ThreadPool MUST not be called from a task of the same ThreadPool.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class Batch
+{
+public:
+  static const size_t kMinTaskLength = 1 << 12;
+
+  static void Multiply(Matrix4<T>* pResults, const Matrix4<T>* pA, const Matrix4<T>* pB, size_t count, 
+                       Threads::ThreadPool* pPool = nullptr);
+  static void RotateVectors(Vector3<T>* pResults, const Vector3<T>* pVectors, size_t count, const Matrix4<T>& m, 
+                            Threads::ThreadPool* pPool = nullptr);
+  static void RotateVectors(T* pResultsX, T* pResultsY, T* pResultsZ, const T* pX, const T* pY, const T* pZ, 
+                            size_t count, const Matrix4<T>& m, Threads::ThreadPool* pPool = nullptr);
+  static void TransformBoxes(Box3<T>* pResults, const Box3<T>* pBoxes, size_t count, const Matrix4<T>& m, 
+                             Threads::ThreadPool* pPool = nullptr);
+  static void TransformPoints(Vector3<T>* pResults, const Vector3<T>* pPoints, size_t count, const Matrix4<T>& m, 
+                              Threads::ThreadPool* pPool = nullptr);
+  static void TransformPoints(T* pResultsX, T* pResultsY, T* pResultsZ, const T* pX, const T* pY, const T* pZ, 
+                              size_t count, const Matrix4<T>& m, Threads::ThreadPool* pPool = nullptr);
+
+private:
+  struct MatrixKernel
+  {
+    void              Run(size_t startIndex, size_t endIndex) const;
+
+    Matrix4<T>*       pResults;
+    const Matrix4<T>* pA;
+    const Matrix4<T>* pB;
+  };
+
+  struct BoxKernel
+  {
+    void              Run(size_t startIndex, size_t endIndex) const;
+
+    Box3<T>*          pResults;
+    const Box3<T>*    pBoxes;
+    const Matrix4<T>* pMatrix;
+  };
+
+  struct VectorKernel
+  {
+    void              Run(size_t startIndex, size_t endIndex) const;
+
+    Vector3<T>*       pResults;
+    const Vector3<T>* pVectors;
+    const Matrix4<T>* pMatrix;
+    bool              isPoint;
+  };
+
+  struct ComponentKernel
+  {
+    void              Run(size_t startIndex, size_t endIndex) const;
+
+    T*                pResults[3];
+    const T*          pComponents[3];
+    const Matrix4<T>* pMatrix;
+    bool              isPoint;
+  };
+
+  template <class KernelClass>
+  struct Task : public Threads::IRunnable
+  {
+    I32                 Run();
+
+    const KernelClass*  pKernel;
+    size_t              startIndex;
+    size_t              endIndex;     // Past the last element
+  };
+
+  template <class KernelClass>
+  static void RunKernel(const KernelClass& kernel, size_t count, Threads::ThreadPool* pPool);
+
+  static void RotateVectorArray(Vector3<T>* pResults, const Vector3<T>* pVectors, size_t count, const Matrix4<T>& m);
+  static void RotateVectorArray(T** pResults, const T* const* pComponents, size_t count, const Matrix4<T>& m);
+  static void TransformBoxArray(Box3<T>* pResults, const Box3<T>* pBoxes, size_t count, const Matrix4<T>& m);
+  static void TransformPointArray(Vector3<T>* pResults, const Vector3<T>* pPoints, size_t count, const Matrix4<T>& m);
+  static void TransformPointArray(T** pResults, const T* const* pComponents, size_t count, const Matrix4<T>& m);
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Batch methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void Batch<T>::Multiply(Matrix4<T>* pResults, const Matrix4<T>* pA, const Matrix4<T>* pB, size_t count, 
+                               Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  MatrixKernel kernel;
+  kernel.pResults = pResults;
+  kernel.pA = pA;
+  kernel.pB = pB;
+  RunKernel(kernel, count, pPool);
+}
+
+template <typename T>
+inline void Batch<T>::RotateVectors(Vector3<T>* pResults, const Vector3<T>* pVectors, size_t count, 
+                                    const Matrix4<T>& m, Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  VectorKernel kernel;
+  kernel.pResults = pResults;
+  kernel.pVectors = pVectors;
+  kernel.pMatrix = &m;
+  kernel.isPoint = false;
+  RunKernel(kernel, count, pPool);
+}
+
+template <typename T>
+inline void Batch<T>::RotateVectors(T* pResultsX, T* pResultsY, T* pResultsZ, const T* pX, const T* pY, const T* pZ, 
+                                    size_t count, const Matrix4<T>& m, Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  ComponentKernel kernel;
+  kernel.pResults[0] = pResultsX;
+  kernel.pResults[1] = pResultsY;
+  kernel.pResults[2] = pResultsZ;
+  kernel.pComponents[0] = pX;
+  kernel.pComponents[1] = pY;
+  kernel.pComponents[2] = pZ;
+  kernel.pMatrix = &m;
+  kernel.isPoint = false;
+  RunKernel(kernel, count, pPool);
+}
+
+template <typename T>
+inline void Batch<T>::TransformBoxes(Box3<T>* pResults, const Box3<T>* pBoxes, size_t count, const Matrix4<T>& m, 
+                                     Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  BoxKernel kernel;
+  kernel.pResults = pResults;
+  kernel.pBoxes = pBoxes;
+  kernel.pMatrix = &m;
+  RunKernel(kernel, count, pPool);
+}
+
+template <typename T>
+inline void Batch<T>::TransformPoints(Vector3<T>* pResults, const Vector3<T>* pPoints, size_t count, 
+                                      const Matrix4<T>& m, Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  VectorKernel kernel;
+  kernel.pResults = pResults;
+  kernel.pVectors = pPoints;
+  kernel.pMatrix = &m;
+  kernel.isPoint = true;
+  RunKernel(kernel, count, pPool);
+}
+
+template <typename T>
+inline void Batch<T>::TransformPoints(T* pResultsX, T* pResultsY, T* pResultsZ, const T* pX, const T* pY, 
+                                      const T* pZ, size_t count, const Matrix4<T>& m, 
+                                      Threads::ThreadPool* pPool /*= nullptr*/)
+{
+  ComponentKernel kernel;
+  kernel.pResults[0] = pResultsX;
+  kernel.pResults[1] = pResultsY;
+  kernel.pResults[2] = pResultsZ;
+  kernel.pComponents[0] = pX;
+  kernel.pComponents[1] = pY;
+  kernel.pComponents[2] = pZ;
+  kernel.pMatrix = &m;
+  kernel.isPoint = true;
+  RunKernel(kernel, count, pPool);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Batch private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+RunKernel
+
+Task boundaries are multiples of 4 so that only the last task has a remainder to be processed by the scalar code. The 
+calling thread runs the first task. Tasks rejected by the ThreadPool (maximum pending item count reached) are run by 
+the calling thread as well.
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+template <class KernelClass>
+inline void Batch<T>::RunKernel(const KernelClass& kernel, size_t count, Threads::ThreadPool* pPool)
+{
+  size_t taskCount = (pPool == nullptr) ? 1 : count / kMinTaskLength;
+  size_t maxTaskCount = Threads::Thread::GetProcessorCount();
+  if (taskCount > maxTaskCount) taskCount = maxTaskCount;
+  if (taskCount <= 1)
+  {
+    kernel.Run(0, count);
+    return;
+  }
+  Task<KernelClass>* pTasks = Memory::Create<Task<KernelClass> >(taskCount);
+  size_t taskLength = (count / taskCount) & ~static_cast<size_t>(3);
+  for (size_t i = 0; i < taskCount; ++i)
+  {
+    pTasks[i].pKernel = &kernel;
+    pTasks[i].startIndex = i * taskLength;
+    pTasks[i].endIndex = (i == taskCount - 1) ? count : pTasks[i].startIndex + taskLength;
+  }
+  for (size_t i = 1; i < taskCount; ++i)
+  {
+    if (!pPool->AddItem(&pTasks[i])) pTasks[i].Run();
+  }
+  pTasks[0].Run();
+  for (size_t i = 1; i < taskCount; ++i) pPool->WaitForItem(&pTasks[i]);
+  Memory::Destroy(pTasks, taskCount);
+}
+
+template <typename T>
+inline void Batch<T>::RotateVectorArray(Vector3<T>* pResults, const Vector3<T>* pVectors, size_t count, 
+                                        const Matrix4<T>& m)
+{
+  for (size_t i = 0; i < count; ++i) pResults[i] = Matrix4<T>::RotateVector(m, pVectors[i]);
+}
+
+template <typename T>
+inline void Batch<T>::RotateVectorArray(T** pResults, const T* const* pComponents, size_t count, const Matrix4<T>& m)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    Vector3<T> v = Matrix4<T>::RotateVector(m, Vector3<T>(pComponents[0][i], pComponents[1][i], pComponents[2][i]));
+    pResults[0][i] = v.x;
+    pResults[1][i] = v.y;
+    pResults[2][i] = v.z;
+  }
+}
+
+template <typename T>
+inline void Batch<T>::TransformBoxArray(Box3<T>* pResults, const Box3<T>* pBoxes, size_t count, const Matrix4<T>& m)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    pResults[i] = pBoxes[i];
+    pResults[i].Transform(m);
+  }
+}
+
+template <typename T>
+inline void Batch<T>::TransformPointArray(Vector3<T>* pResults, const Vector3<T>* pPoints, size_t count, 
+                                          const Matrix4<T>& m)
+{
+  for (size_t i = 0; i < count; ++i) pResults[i] = Matrix4<T>::TransformPoint(m, pPoints[i]);
+}
+
+template <typename T>
+inline void Batch<T>::TransformPointArray(T** pResults, const T* const* pComponents, size_t count, const Matrix4<T>& m)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    Vector3<T> p = Matrix4<T>::TransformPoint(m, Vector3<T>(pComponents[0][i], pComponents[1][i], pComponents[2][i]));
+    pResults[0][i] = p.x;
+    pResults[1][i] = p.y;
+    pResults[2][i] = p.z;
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Batch kernels
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void Batch<T>::MatrixKernel::Run(size_t startIndex, size_t endIndex) const
+{
+  for (size_t i = startIndex; i < endIndex; ++i) pResults[i] = pA[i] * pB[i];
+}
+
+template <typename T>
+inline void Batch<T>::BoxKernel::Run(size_t startIndex, size_t endIndex) const
+{
+  TransformBoxArray(pResults + startIndex, pBoxes + startIndex, endIndex - startIndex, *pMatrix);
+}
+
+template <typename T>
+inline void Batch<T>::VectorKernel::Run(size_t startIndex, size_t endIndex) const
+{
+  if (isPoint)
+  {
+    TransformPointArray(pResults + startIndex, pVectors + startIndex, endIndex - startIndex, *pMatrix);
+  }
+  else
+  {
+    RotateVectorArray(pResults + startIndex, pVectors + startIndex, endIndex - startIndex, *pMatrix);
+  }
+}
+
+template <typename T>
+inline void Batch<T>::ComponentKernel::Run(size_t startIndex, size_t endIndex) const
+{
+  T* pTaskResults[3] = { pResults[0] + startIndex, pResults[1] + startIndex, pResults[2] + startIndex };
+  const T* pTaskComponents[3] = 
+  { 
+    pComponents[0] + startIndex, pComponents[1] + startIndex, pComponents[2] + startIndex 
+  };
+  if (isPoint)
+  {
+    TransformPointArray(pTaskResults, pTaskComponents, endIndex - startIndex, *pMatrix);
+  }
+  else
+  {
+    RotateVectorArray(pTaskResults, pTaskComponents, endIndex - startIndex, *pMatrix);
+  }
+}
+
+template <typename T>
+template <class KernelClass>
+inline I32 Batch<T>::Task<KernelClass>::Run()
+{
+  pKernel->Run(startIndex, endIndex);
+  return 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Batch F32 specializations (SSE)
+
+The array methods transform 4 elements at a time with the components in separate registers (AoS arrays are shuffled 
+on load and store), so every operation matches the scalar evaluation order of the per element F32 methods. Points 
+transformed by an affine matrix skip the w division. Remainders are processed by the per element methods.
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SIMD_SSE
+template <>
+inline void Batch<F32>::RotateVectorArray(Vector3<F32>* pResults, const Vector3<F32>* pVectors, size_t count, 
+                                          const Matrix4<F32>& m)
+{
+  Simd::F32x4 m0 = Simd::Splat(m[0]), m1 = Simd::Splat(m[1]), m2 = Simd::Splat(m[2]);
+  Simd::F32x4 m4 = Simd::Splat(m[4]), m5 = Simd::Splat(m[5]), m6 = Simd::Splat(m[6]);
+  Simd::F32x4 m8 = Simd::Splat(m[8]), m9 = Simd::Splat(m[9]), m10 = Simd::Splat(m[10]);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    Simd::F32x4 x, y, z;
+    Simd::LoadXyz4(&pVectors[i].x, x, y, z);
+    Simd::StoreXyz4(&pResults[i].x, 
+      Simd::MulAdd(z, m8, Simd::MulAdd(y, m4, Simd::Mul(x, m0))),
+      Simd::MulAdd(z, m9, Simd::MulAdd(y, m5, Simd::Mul(x, m1))),
+      Simd::MulAdd(z, m10, Simd::MulAdd(y, m6, Simd::Mul(x, m2))));
+  }
+  for (; i < count; ++i) pResults[i] = Matrix4<F32>::RotateVector(m, pVectors[i]);
+}
+
+template <>
+inline void Batch<F32>::RotateVectorArray(F32** pResults, const F32* const* pComponents, size_t count, 
+                                          const Matrix4<F32>& m)
+{
+  Simd::F32x4 m0 = Simd::Splat(m[0]), m1 = Simd::Splat(m[1]), m2 = Simd::Splat(m[2]);
+  Simd::F32x4 m4 = Simd::Splat(m[4]), m5 = Simd::Splat(m[5]), m6 = Simd::Splat(m[6]);
+  Simd::F32x4 m8 = Simd::Splat(m[8]), m9 = Simd::Splat(m[9]), m10 = Simd::Splat(m[10]);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pComponents[0] + i);
+    Simd::F32x4 y = Simd::Load(pComponents[1] + i);
+    Simd::F32x4 z = Simd::Load(pComponents[2] + i);
+    Simd::Store(pResults[0] + i, Simd::MulAdd(z, m8, Simd::MulAdd(y, m4, Simd::Mul(x, m0))));
+    Simd::Store(pResults[1] + i, Simd::MulAdd(z, m9, Simd::MulAdd(y, m5, Simd::Mul(x, m1))));
+    Simd::Store(pResults[2] + i, Simd::MulAdd(z, m10, Simd::MulAdd(y, m6, Simd::Mul(x, m2))));
+  }
+  for (; i < count; ++i)
+  {
+    Vector3<F32> v = Matrix4<F32>::RotateVector(m, Vector3<F32>(pComponents[0][i], pComponents[1][i], 
+                                                                pComponents[2][i]));
+    pResults[0][i] = v.x;
+    pResults[1][i] = v.y;
+    pResults[2][i] = v.z;
+  }
+}
+
+template <>
+inline void Batch<F32>::TransformBoxArray(Box3<F32>* pResults, const Box3<F32>* pBoxes, size_t count, 
+                                          const Matrix4<F32>& m)
+{
+  Simd::F32x4 row0 = Simd::Load(&m[0]);
+  Simd::F32x4 row1 = Simd::Load(&m[4]);
+  Simd::F32x4 row2 = Simd::Load(&m[8]);
+  Simd::F32x4 row3 = Simd::Load(&m[12]);
+  Simd::F32x4 absRow0 = Simd::Abs(row0);
+  Simd::F32x4 absRow1 = Simd::Abs(row1);
+  Simd::F32x4 absRow2 = Simd::Abs(row2);
+  E_ALIGN(16) F32 center[4];
+  E_ALIGN(16) F32 extents[4];
+  for (size_t i = 0; i < count; ++i)
+  {
+    const Box3<F32>& box = pBoxes[i];
+    if (box.IsEmpty())
+    {
+      pResults[i] = box;
+      continue;
+    }
+    Vector3<F32> c = box.GetCenter();
+    Vector3<F32> e = box.GetExtents();
+    Simd::F32x4 result = Simd::Mul(Simd::Splat(c.x), row0);
+    result = Simd::MulAdd(Simd::Splat(c.y), row1, result);
+    result = Simd::MulAdd(Simd::Splat(c.z), row2, result);
+    Simd::Store(center, Simd::Add(result, row3));
+    result = Simd::Mul(Simd::Splat(e.x), absRow0);
+    result = Simd::MulAdd(Simd::Splat(e.y), absRow1, result);
+    Simd::Store(extents, Simd::MulAdd(Simd::Splat(e.z), absRow2, result));
+    const F32 invW = IsEqual(center[3], 0.0f) ? 1.0f : 1.0f / center[3];
+    pResults[i].SetCenterAndExtents(Vector3<F32>(center[0] * invW, center[1] * invW, center[2] * invW), 
+                                    Vector3<F32>(extents[0], extents[1], extents[2]));
+  }
+}
+
+template <>
+inline void Batch<F32>::TransformPointArray(Vector3<F32>* pResults, const Vector3<F32>* pPoints, size_t count, 
+                                            const Matrix4<F32>& m)
+{
+  const bool isAffine = m.IsAffine();
+  Simd::F32x4 m0 = Simd::Splat(m[0]), m1 = Simd::Splat(m[1]), m2 = Simd::Splat(m[2]), m3 = Simd::Splat(m[3]);
+  Simd::F32x4 m4 = Simd::Splat(m[4]), m5 = Simd::Splat(m[5]), m6 = Simd::Splat(m[6]), m7 = Simd::Splat(m[7]);
+  Simd::F32x4 m8 = Simd::Splat(m[8]), m9 = Simd::Splat(m[9]), m10 = Simd::Splat(m[10]), m11 = Simd::Splat(m[11]);
+  Simd::F32x4 m12 = Simd::Splat(m[12]), m13 = Simd::Splat(m[13]), m14 = Simd::Splat(m[14]), m15 = Simd::Splat(m[15]);
+  Simd::F32x4 one = Simd::Splat(1.0f);
+  Simd::F32x4 epsilon = Simd::Splat(Epsilon<F32>::Get());
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    Simd::F32x4 x, y, z;
+    Simd::LoadXyz4(&pPoints[i].x, x, y, z);
+    Simd::F32x4 resultX = Simd::Add(Simd::MulAdd(z, m8, Simd::MulAdd(y, m4, Simd::Mul(x, m0))), m12);
+    Simd::F32x4 resultY = Simd::Add(Simd::MulAdd(z, m9, Simd::MulAdd(y, m5, Simd::Mul(x, m1))), m13);
+    Simd::F32x4 resultZ = Simd::Add(Simd::MulAdd(z, m10, Simd::MulAdd(y, m6, Simd::Mul(x, m2))), m14);
+    if (!isAffine)
+    {
+      Simd::F32x4 w = Simd::Add(Simd::MulAdd(z, m11, Simd::MulAdd(y, m7, Simd::Mul(x, m3))), m15);
+      Simd::F32x4 invW = Simd::Div(one, Simd::Select(Simd::LessEqual(Simd::Abs(w), epsilon), one, w));
+      resultX = Simd::Mul(resultX, invW);
+      resultY = Simd::Mul(resultY, invW);
+      resultZ = Simd::Mul(resultZ, invW);
+    }
+    Simd::StoreXyz4(&pResults[i].x, resultX, resultY, resultZ);
+  }
+  for (; i < count; ++i) pResults[i] = Matrix4<F32>::TransformPoint(m, pPoints[i]);
+}
+
+template <>
+inline void Batch<F32>::TransformPointArray(F32** pResults, const F32* const* pComponents, size_t count, 
+                                            const Matrix4<F32>& m)
+{
+  const bool isAffine = m.IsAffine();
+  Simd::F32x4 m0 = Simd::Splat(m[0]), m1 = Simd::Splat(m[1]), m2 = Simd::Splat(m[2]), m3 = Simd::Splat(m[3]);
+  Simd::F32x4 m4 = Simd::Splat(m[4]), m5 = Simd::Splat(m[5]), m6 = Simd::Splat(m[6]), m7 = Simd::Splat(m[7]);
+  Simd::F32x4 m8 = Simd::Splat(m[8]), m9 = Simd::Splat(m[9]), m10 = Simd::Splat(m[10]), m11 = Simd::Splat(m[11]);
+  Simd::F32x4 m12 = Simd::Splat(m[12]), m13 = Simd::Splat(m[13]), m14 = Simd::Splat(m[14]), m15 = Simd::Splat(m[15]);
+  Simd::F32x4 one = Simd::Splat(1.0f);
+  Simd::F32x4 epsilon = Simd::Splat(Epsilon<F32>::Get());
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pComponents[0] + i);
+    Simd::F32x4 y = Simd::Load(pComponents[1] + i);
+    Simd::F32x4 z = Simd::Load(pComponents[2] + i);
+    Simd::F32x4 resultX = Simd::Add(Simd::MulAdd(z, m8, Simd::MulAdd(y, m4, Simd::Mul(x, m0))), m12);
+    Simd::F32x4 resultY = Simd::Add(Simd::MulAdd(z, m9, Simd::MulAdd(y, m5, Simd::Mul(x, m1))), m13);
+    Simd::F32x4 resultZ = Simd::Add(Simd::MulAdd(z, m10, Simd::MulAdd(y, m6, Simd::Mul(x, m2))), m14);
+    if (!isAffine)
+    {
+      Simd::F32x4 w = Simd::Add(Simd::MulAdd(z, m11, Simd::MulAdd(y, m7, Simd::Mul(x, m3))), m15);
+      Simd::F32x4 invW = Simd::Div(one, Simd::Select(Simd::LessEqual(Simd::Abs(w), epsilon), one, w));
+      resultX = Simd::Mul(resultX, invW);
+      resultY = Simd::Mul(resultY, invW);
+      resultZ = Simd::Mul(resultZ, invW);
+    }
+    Simd::Store(pResults[0] + i, resultX);
+    Simd::Store(pResults[1] + i, resultY);
+    Simd::Store(pResults[2] + i, resultZ);
+  }
+  for (; i < count; ++i)
+  {
+    Vector3<F32> p = Matrix4<F32>::TransformPoint(m, Vector3<F32>(pComponents[0][i], pComponents[1][i], 
+                                                                  pComponents[2][i]));
+    pResults[0][i] = p.x;
+    pResults[1][i] = p.y;
+    pResults[2][i] = p.z;
+  }
+}
+#endif
+}
+}
+
+#endif
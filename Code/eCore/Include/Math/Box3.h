@@ -46,6 +46,8 @@ Please note that this class has the following usage contract:
 
 1. Floating point types are expected to be used with this class: F32, D64.
 2. SetPoints count must be greater than 0.
+3. Transform expects an affine matrix: the center is transformed as a point and the extents by the absolute values of
+the rotation and scale part (Arvo's method), which gives the tightest box enclosing the transformed box.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <class T>
 class Box3
@@ -61,6 +63,8 @@ public:
   Vector3<T>	GetBackBottomRight() const;
   Vector3<T>	GetBackTopLeft() const;
   Vector3<T>	GetBackTopRight() const;
+  Vector3<T>	GetCenter() const;
+  Vector3<T>	GetExtents() const;
   Vector3<T>	GetFrontBottomLeft() const;
   Vector3<T>	GetFrontBottomRight() const;
   Vector3<T>	GetFrontTopLeft() const;
@@ -68,7 +72,9 @@ public:
   Vector3<T>	GetMax() const;
   Vector3<T>	GetMin() const;
   bool		    IsContained(const Vector3<T>& point) const;
+  bool		    IsEmpty() const;
   bool		    IsOverlapped(const Box3& box) const;
+  void        SetCenterAndExtents(const Vector3<T>& center, const Vector3<T>& extents);
   void        SetPoints(const Vector3<T>* pPoints, U32 count);
 
   // Methods
@@ -106,11 +112,11 @@ Box3 accessors
 template <typename T>
 inline bool Box3<T>::AddBox(const Box3& other)
 {
-  // If other is empty
-  if (other.mExtends.x != -1)
+  // If other is not empty
+  if (!other.IsEmpty())
   {
     // If this is empty
-    if (mExtends.x == -1)
+    if (IsEmpty())
     {
       *this = other;
       return true;
@@ -120,8 +126,8 @@ inline bool Box3<T>::AddBox(const Box3& other)
       Vector3<T> max = mCenter + mExtents;
       Vector3<T> min = mCenter - mExtents;      
 
-      Vector3<T> newMax = Vector3<T>::Max(max, other.mCenter + other.mExtends);
-      Vector3<T> newMin = Vector3<T>::Max(min, other.mCenter - other.mExtends);
+      Vector3<T> newMax = Vector3<T>::Max(max, other.mCenter + other.mExtents);
+      Vector3<T> newMin = Vector3<T>::Min(min, other.mCenter - other.mExtents);
 
       mCenter   = (newMax + newMin) * static_cast<T>(0.5);
       mExtents  = (newMax - newMin) * static_cast<T>(0.5);
@@ -137,7 +143,7 @@ inline bool Box3<T>::AddBox(const Box3& other)
 template <typename T>
 inline bool Box3<T>::AddPoint(const Vector3<T>& point)
 {
-  if (mExtents.x == -1 )
+  if (IsEmpty())
   {
     mCenter = point;
     mExtents.SetZero();
@@ -150,7 +156,7 @@ inline bool Box3<T>::AddPoint(const Vector3<T>& point)
     Vector3<T> min = mCenter - mExtents;      
 
     Vector3<T> newMax = Vector3<T>::Max(max, point);
-    Vector3<T> newMin = Vector3<T>::Max(min, point);
+    Vector3<T> newMin = Vector3<T>::Min(min, point);
 
     mCenter   = (newMax + newMin) * static_cast<T>(0.5);
     mExtents  = (newMax - newMin) * static_cast<T>(0.5);
@@ -183,6 +189,18 @@ inline Vector3<T> Box3<T>::GetBackTopRight() const
   return mCenter + mExtents;
 }
 
+template <class T>
+inline Vector3<T> Box3<T>::GetCenter() const	
+{ 
+  return mCenter;
+}
+
+template <class T>
+inline Vector3<T> Box3<T>::GetExtents() const	
+{ 
+  return mExtents;
+}
+
 template <class T>
 inline Vector3<T> Box3<T>::GetFrontBottomLeft() const
 { 
@@ -226,6 +244,12 @@ inline bool Box3<T>::IsContained(const Vector3<T>& point) const
   return (Math::Abs(distance.x) <= mExtents.x && Math::Abs(distance.y) <= mExtents.y && Math::Abs(distance.z) <= mExtents.z);
 }
 
+template <class T>
+inline bool Box3<T>::IsEmpty() const
+{
+  return mExtents.x == static_cast<T>(-1);
+}
+
 template <class T>
 inline bool Box3<T>::IsOverlapped(const Box3& box) const
 {
@@ -234,14 +258,24 @@ inline bool Box3<T>::IsOverlapped(const Box3& box) const
   return (Math::Abs(distance.x) <= extends.x && Math::Abs(distance.y) <= extends.y && Math::Abs(distance.z) <= extends.z);
 }
 
+template <typename T>
+inline void Box3<T>::SetCenterAndExtents(const Vector3<T>& center, const Vector3<T>& extents)
+{
+  mCenter   = center;
+  mExtents  = extents;
+}
+
 template <typename T>
 inline void Box3<T>::SetPoints(const Vector3<T>* pPoints, U32 count)
 {
+  E_ASSERT_MSG(count > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
   Vector3<T> max, min;
   max = min = pPoints[0];
 
   for (U32 i = 1; i < count; ++i)
   {
+    const Vector3<T>& point = pPoints[i];
+
     // Recalculate max min
     if (point.x > max.x)	max.x = point.x;
     if (point.y > max.y)	max.y = point.y;
@@ -260,18 +294,16 @@ inline void Box3<T>::SetPoints(const Vector3<T>* pPoints, U32 count)
 Box3 methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-void Transform(const Matrix4<T>& matrix)
+template <class T>
+inline void Box3<T>::Transform(const Matrix4<T>& matrix)
 {
-  Box3<T> result;
-  result.PushPoint(matrix.Transform(GetBackBottomLeft()));
-  result.PushPoint(matrix.Transform(GetBackBottomRigth()));
-  result.PushPoint(matrix.Transform(GetBackTopLeft()));
-  result.PushPoint(matrix.Transform(GetBackTopRightLeft()));
-  result.PushPoint(matrix.Transform(GetFrontBottomLeft()));
-  result.PushPoint(matrix.Transform(GetFrontBottomRigth()));
-  result.PushPoint(matrix.Transform(GetFrontTopLeft()));
-  result.PushPoint(matrix.Transform(GetFrontTopRightLeft()));
-  (*this) = result;
+  if (IsEmpty()) return;
+  Vector3<T> center = Matrix4<T>::TransformPoint(matrix, mCenter);
+  mExtents = Vector3<T>(
+    Math::Abs(matrix[0]) * mExtents.x + Math::Abs(matrix[4]) * mExtents.y + Math::Abs(matrix[8]) * mExtents.z,
+    Math::Abs(matrix[1]) * mExtents.x + Math::Abs(matrix[5]) * mExtents.y + Math::Abs(matrix[9]) * mExtents.z,
+    Math::Abs(matrix[2]) * mExtents.x + Math::Abs(matrix[6]) * mExtents.y + Math::Abs(matrix[10]) * mExtents.z);
+  mCenter = center;
 }
 }
 
@@ -0,0 +1,644 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Bvh.h
+This file defines the Bvh class: a bounding volume hierarchy over Box3 bounds for ray, closest point and overlap 
+queries.
+*/
+
+#ifndef E_MATH_BVH_H
+#define E_MATH_BVH_H
+
+#include <Base.h>
+#include <Assertion/Assert.h>
+#include <Containers/DynamicArray.h>
+#include <Math/Box3.h>
+#include <Math/Comparison.h>
+#include <Math/Vector3.h>
+#include <algorithm>
+#include <limits>
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_BVH_PRIMITIVE_COUNT_VALUE  "Primitive count (%d) exceeds the U32 range"
+#define E_ASSERT_MSG_BVH_PRIMITIVE_VALUE        "Primitive index (%d) must be smaller than the primitive count (%d)"
+#define E_ASSERT_MSG_BVH_EMPTY_BOUNDS           "Primitive bounds cannot be empty"
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh
+
+Please note that this class has the following usage contract: 
+
+1. Floating point types are expected to be used with this class: F32, D64.
+2. The hierarchy only knows the primitive bounds: primitives are identified by their index in the bounds array given 
+to Build and queries call back with those indices for the exact tests. Primitive bounds cannot be empty.
+3. Build uses the surface area heuristic (SAH) evaluated on kBinCount centroid bins per axis. Nodes are stored in a 
+single array: sibling nodes are contiguous and children always follow their parent, so refits are a backwards pass.
+4. RayCast returns the closest hit with 0 <= lambda < maxLambda. The intersect function signature must be
+bool (U32 primitive, T& lambda) and direction does not need to be normalized (lambda is in direction units).
+5. FindClosestPoint function signature must be T (U32 primitive, Vector3<T>& closestPoint) and return the squared 
+distance from the query point to closestPoint (e.g. DistancePointTriangleSquared).
+6. FindOverlaps calls function(U32 primitive) for every primitive whose bounds overlap the box (touching counts).
+7. Refit keeps the hierarchy topology: it is cheap but query performance degrades when the primitives move far from
+where they were at build time. Refit(primitive, bounds) only updates the nodes above that primitive.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class Bvh
+{
+public:
+  static const U32  kBinCount = 16;
+  static const U32  kMaxDepth = 64;
+  static const U32  kMaxLeafSize = 8;
+
+  Bvh() {}
+  Bvh(const Box3<T>* pBounds, size_t count);
+
+  // Accessors
+  Box3<T>           GetBounds() const;
+  size_t            GetNodeCount() const { return mNodes.GetSize(); }
+  size_t            GetPrimitiveCount() const { return mIndices.GetSize(); }
+  bool              IsEmpty() const { return mNodes.GetSize() == 0; }
+
+  // Methods
+  void              Build(const Box3<T>* pBounds, size_t count);
+  void              Clear();
+  template <typename Function>
+  bool              FindClosestPoint(const Vector3<T>& point, Function function, U32& primitive, 
+                                     Vector3<T>& closestPoint, T& distanceSquared) const;
+  template <typename Function>
+  size_t            FindOverlaps(const Box3<T>& box, Function function) const;
+  template <typename Function>
+  bool              RayCast(const Vector3<T>& origin, const Vector3<T>& direction, T maxLambda, Function intersect, 
+                            U32& primitive, T& lambda) const;
+  void              Refit(const Box3<T>* pBounds);
+  void              Refit(U32 primitive, const Box3<T>& bounds);
+
+private:
+  // Leaf nodes (count > 0) own the primitive slots [offset, offset + count), inner nodes (count == 0) have their 
+  // children at offset and offset + 1. For F32 a node is 32 bytes.
+  struct Node
+  {
+    Vector3<T>      min;
+    U32             offset;
+    Vector3<T>      max;
+    U32             count;
+  };
+
+  struct Bounds
+  {
+    Vector3<T>      min;
+    Vector3<T>      max;
+  };
+
+  struct StackEntry
+  {
+    U32             node;
+    T               distance;
+  };
+
+  Containers::DynamicArray<Node>    mNodes;
+  Containers::DynamicArray<Bounds>  mBounds;    // Primitive bounds in slot (leaf) order
+  Containers::DynamicArray<U32>     mIndices;   // Primitive index of each slot
+  Containers::DynamicArray<U32>     mSlots;     // Slot of each primitive
+  Containers::DynamicArray<U32>     mLeaves;    // Leaf node of each primitive
+  Containers::DynamicArray<U32>     mParents;   // Parent of each node
+
+  static T          GetDistanceSquared(const Vector3<T>& point, const Vector3<T>& min, const Vector3<T>& max);
+  static T          GetSurfaceArea(const Vector3<T>& min, const Vector3<T>& max);
+  static bool       IntersectRay(const Node& node, const Vector3<T>& origin, const Vector3<T>& inverseDirection, 
+                                 T maxLambda, T& lambda);
+  static bool       IsIdentical(const Vector3<T>& a, const Vector3<T>& b);
+  static bool       Overlaps(const Vector3<T>& minA, const Vector3<T>& maxA, const Vector3<T>& minB, 
+                             const Vector3<T>& maxB);
+  void              UpdateNode(U32 index);
+
+  // Relying on default copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Bvh<T>::Bvh(const Box3<T>* pBounds, size_t count)
+{
+  Build(pBounds, count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Box3<T> Bvh<T>::GetBounds() const
+{
+  if (IsEmpty()) return Box3<T>();
+  return Box3<T>(mNodes[0].min, mNodes[0].max);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+void Bvh<T>::Build(const Box3<T>* pBounds, size_t count)
+{
+  E_ASSERT_MSG(count <= 0xFFFFFFFF, E_ASSERT_MSG_BVH_PRIMITIVE_COUNT_VALUE, count);
+  Clear();
+  if (count == 0) return;
+
+  // Primitive bounds and centroids are kept in slot order (the order mIndices is partitioned into)
+  Containers::DynamicArray<Bounds> bounds(count);
+  Containers::DynamicArray<Vector3<T> > centroids(count);
+  mIndices.Resize(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    E_ASSERT_MSG(!pBounds[i].IsEmpty(), E_ASSERT_MSG_BVH_EMPTY_BOUNDS);
+    bounds[i].min = pBounds[i].GetMin();
+    bounds[i].max = pBounds[i].GetMax();
+    centroids[i] = (bounds[i].min + bounds[i].max) * static_cast<T>(0.5);
+    mIndices[i] = static_cast<U32>(i);
+  }
+
+  struct Range
+  {
+    U32 node;
+    U32 begin;
+    U32 end;
+    U32 depth;
+  };
+  struct Bin
+  {
+    Vector3<T> min;
+    Vector3<T> max;
+    U32 count;
+  };
+  Containers::DynamicArray<Node> nodes(2 * count - 1);
+  Range stack[kMaxDepth + 1];
+  U32 stackSize = 1;
+  U32 nodeCount = 1;
+  stack[0].node = 0;
+  stack[0].begin = 0;
+  stack[0].end = static_cast<U32>(count);
+  stack[0].depth = 0;
+  U32* pIndices = mIndices.GetPtr();
+  while (stackSize > 0)
+  {
+    const Range range = stack[--stackSize];
+    Node& node = nodes[range.node];
+    const U32 rangeCount = range.end - range.begin;
+    node.min = bounds[pIndices[range.begin]].min;
+    node.max = bounds[pIndices[range.begin]].max;
+    Vector3<T> centroidMin = centroids[pIndices[range.begin]];
+    Vector3<T> centroidMax = centroidMin;
+    for (U32 i = range.begin + 1; i < range.end; ++i)
+    {
+      node.min = Vector3<T>::Min(node.min, bounds[pIndices[i]].min);
+      node.max = Vector3<T>::Max(node.max, bounds[pIndices[i]].max);
+      centroidMin = Vector3<T>::Min(centroidMin, centroids[pIndices[i]]);
+      centroidMax = Vector3<T>::Max(centroidMax, centroids[pIndices[i]]);
+    }
+    node.offset = range.begin;
+    node.count = rangeCount;
+    if (rangeCount == 1) continue;
+
+    // Best SAH split plane over the bins of every axis. Costs are relative to the node area and to the cost of 
+    // intersecting a primitive (a node traversal costs the same as a primitive intersection).
+    const T nodeArea = GetSurfaceArea(node.min, node.max);
+    const Vector3<T> centroidExtent = centroidMax - centroidMin;
+    T bestCost = std::numeric_limits<T>::max();
+    U32 bestAxis = 0;
+    U32 bestBin = 0;
+    for (U32 axis = 0; axis < 3; ++axis)
+    {
+      if (centroidExtent[axis] <= static_cast<T>(0)) continue;
+      const T scale = static_cast<T>(kBinCount) / centroidExtent[axis];
+      Bin bins[kBinCount];
+      for (U32 i = 0; i < kBinCount; ++i) bins[i].count = 0;
+      for (U32 i = range.begin; i < range.end; ++i)
+      {
+        const U32 primitive = pIndices[i];
+        U32 bin = Math::Min(static_cast<U32>((centroids[primitive][axis] - centroidMin[axis]) * scale), kBinCount - 1);
+        Bin& target = bins[bin];
+        target.min = (target.count == 0) ? bounds[primitive].min : Vector3<T>::Min(target.min, bounds[primitive].min);
+        target.max = (target.count == 0) ? bounds[primitive].max : Vector3<T>::Max(target.max, bounds[primitive].max);
+        ++target.count;
+      }
+      // Left side costs (bins [0, i]) are swept forwards and combined with the right side (bins (i, kBinCount)) ones
+      // swept backwards
+      T leftCosts[kBinCount - 1];
+      Vector3<T> min, max;
+      U32 sideCount = 0;
+      for (U32 i = 0; i < kBinCount - 1; ++i)
+      {
+        if (bins[i].count > 0)
+        {
+          min = (sideCount == 0) ? bins[i].min : Vector3<T>::Min(min, bins[i].min);
+          max = (sideCount == 0) ? bins[i].max : Vector3<T>::Max(max, bins[i].max);
+          sideCount += bins[i].count;
+        }
+        leftCosts[i] = (sideCount == 0) ? static_cast<T>(0) : GetSurfaceArea(min, max) * sideCount;
+      }
+      sideCount = 0;
+      for (U32 i = kBinCount - 1; i > 0; --i)
+      {
+        if (bins[i].count > 0)
+        {
+          min = (sideCount == 0) ? bins[i].min : Vector3<T>::Min(min, bins[i].min);
+          max = (sideCount == 0) ? bins[i].max : Vector3<T>::Max(max, bins[i].max);
+          sideCount += bins[i].count;
+        }
+        if (sideCount == 0 || sideCount == rangeCount) continue;
+        T cost = leftCosts[i - 1] + GetSurfaceArea(min, max) * sideCount;
+        if (cost < bestCost)
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestBin = i;
+        }
+      }
+    }
+
+    // Leaf when splitting does not pay off, unless the leaf would be too large
+    const bool hasSplit = bestCost < std::numeric_limits<T>::max();
+    const T splitCost = static_cast<T>(1) + (nodeArea > static_cast<T>(0) ? bestCost / nodeArea : bestCost);
+    if (rangeCount <= kMaxLeafSize && (!hasSplit || splitCost >= static_cast<T>(rangeCount))) continue;
+
+    // Primitives whose centroid bin is below bestBin go to the left child. Degenerate ranges (all centroids equal)
+    // and ranges too deep for the traversal stacks are split at the object median instead.
+    U32 middle = range.begin + rangeCount / 2;
+    if (hasSplit && range.depth < kMaxDepth / 2)
+    {
+      const T scale = static_cast<T>(kBinCount) / centroidExtent[bestAxis];
+      U32* pFirst = pIndices + range.begin;
+      U32* pLast = pIndices + range.end;
+      while (pFirst < pLast)
+      {
+        U32 bin = Math::Min(static_cast<U32>((centroids[*pFirst][bestAxis] - centroidMin[bestAxis]) * scale), 
+                            kBinCount - 1);
+        if (bin < bestBin) ++pFirst;
+        else std::swap(*pFirst, *--pLast);
+      }
+      middle = static_cast<U32>(pFirst - pIndices);
+    }
+    else
+    {
+      U32 axis = (centroidExtent.x >= centroidExtent.y && centroidExtent.x >= centroidExtent.z) ? 0 : 
+                 (centroidExtent.y >= centroidExtent.z ? 1 : 2);
+      const Vector3<T>* pCentroids = centroids.GetPtr();
+      std::nth_element(pIndices + range.begin, pIndices + middle, pIndices + range.end, 
+                       [pCentroids, axis](U32 a, U32 b) { return pCentroids[a][axis] < pCentroids[b][axis]; });
+    }
+
+    E_ASSERT(stackSize + 2 <= kMaxDepth + 1);
+    node.offset = nodeCount;
+    node.count = 0;
+    Range left = { nodeCount, range.begin, middle, range.depth + 1 };
+    Range right = { nodeCount + 1, middle, range.end, range.depth + 1 };
+    nodeCount += 2;
+    stack[stackSize++] = right;
+    stack[stackSize++] = left;
+  }
+  Containers::DynamicArray<Node>(nodes.GetPtr(), nodeCount).Swap(mNodes);
+
+  // Slot order lookups
+  mBounds.Resize(count);
+  mSlots.Resize(count);
+  mLeaves.Resize(count);
+  mParents.Resize(nodeCount);
+  mParents[0] = 0;
+  for (U32 i = 0; i < nodeCount; ++i)
+  {
+    const Node& node = mNodes[i];
+    if (node.count == 0)
+    {
+      mParents[node.offset] = i;
+      mParents[node.offset + 1] = i;
+      continue;
+    }
+    for (U32 slot = node.offset; slot < node.offset + node.count; ++slot)
+    {
+      mBounds[slot] = bounds[mIndices[slot]];
+      mSlots[mIndices[slot]] = slot;
+      mLeaves[mIndices[slot]] = i;
+    }
+  }
+}
+
+template <typename T>
+inline void Bvh<T>::Clear()
+{
+  mNodes.Resize(0);
+  mBounds.Resize(0);
+  mIndices.Resize(0);
+  mSlots.Resize(0);
+  mLeaves.Resize(0);
+  mParents.Resize(0);
+}
+
+template <typename T>
+template <typename Function>
+bool Bvh<T>::FindClosestPoint(const Vector3<T>& point, Function function, U32& primitive, Vector3<T>& closestPoint, 
+                              T& distanceSquared) const
+{
+  if (IsEmpty()) return false;
+  bool found = false;
+  T bestDistance = std::numeric_limits<T>::max();
+  StackEntry stack[kMaxDepth];
+  U32 stackSize = 0;
+  U32 index = 0;
+  for (;;)
+  {
+    const Node& node = mNodes[index];
+    if (node.count > 0)
+    {
+      for (U32 slot = node.offset; slot < node.offset + node.count; ++slot)
+      {
+        if (GetDistanceSquared(point, mBounds[slot].min, mBounds[slot].max) >= bestDistance) continue;
+        Vector3<T> candidatePoint;
+        T candidateDistance = function(mIndices[slot], candidatePoint);
+        if (candidateDistance < bestDistance)
+        {
+          bestDistance = candidateDistance;
+          primitive = mIndices[slot];
+          closestPoint = candidatePoint;
+          found = true;
+        }
+      }
+    }
+    else
+    {
+      // Nearest child first, the other one is visited later if it can still hold a closer point
+      U32 nearChild = node.offset;
+      U32 farChild = node.offset + 1;
+      T nearDistance = GetDistanceSquared(point, mNodes[nearChild].min, mNodes[nearChild].max);
+      T farDistance = GetDistanceSquared(point, mNodes[farChild].min, mNodes[farChild].max);
+      if (farDistance < nearDistance)
+      {
+        std::swap(nearChild, farChild);
+        std::swap(nearDistance, farDistance);
+      }
+      if (nearDistance < bestDistance)
+      {
+        if (farDistance < bestDistance)
+        {
+          stack[stackSize].node = farChild;
+          stack[stackSize++].distance = farDistance;
+        }
+        index = nearChild;
+        continue;
+      }
+    }
+    while (stackSize > 0 && stack[stackSize - 1].distance >= bestDistance) --stackSize;
+    if (stackSize == 0) break;
+    index = stack[--stackSize].node;
+  }
+  if (found) distanceSquared = bestDistance;
+  return found;
+}
+
+template <typename T>
+template <typename Function>
+size_t Bvh<T>::FindOverlaps(const Box3<T>& box, Function function) const
+{
+  if (IsEmpty() || box.IsEmpty()) return 0;
+  const Vector3<T> min = box.GetMin();
+  const Vector3<T> max = box.GetMax();
+  size_t overlapCount = 0;
+  U32 stack[kMaxDepth];
+  U32 stackSize = 0;
+  U32 index = 0;
+  if (!Overlaps(mNodes[0].min, mNodes[0].max, min, max)) return 0;
+  for (;;)
+  {
+    const Node& node = mNodes[index];
+    if (node.count > 0)
+    {
+      for (U32 slot = node.offset; slot < node.offset + node.count; ++slot)
+      {
+        if (!Overlaps(mBounds[slot].min, mBounds[slot].max, min, max)) continue;
+        function(mIndices[slot]);
+        ++overlapCount;
+      }
+    }
+    else
+    {
+      bool overlapsFirst = Overlaps(mNodes[node.offset].min, mNodes[node.offset].max, min, max);
+      bool overlapsSecond = Overlaps(mNodes[node.offset + 1].min, mNodes[node.offset + 1].max, min, max);
+      if (overlapsFirst || overlapsSecond)
+      {
+        if (overlapsFirst && overlapsSecond) stack[stackSize++] = node.offset + 1;
+        index = overlapsFirst ? node.offset : node.offset + 1;
+        continue;
+      }
+    }
+    if (stackSize == 0) break;
+    index = stack[--stackSize];
+  }
+  return overlapCount;
+}
+
+template <typename T>
+template <typename Function>
+bool Bvh<T>::RayCast(const Vector3<T>& origin, const Vector3<T>& direction, T maxLambda, Function intersect, 
+                     U32& primitive, T& lambda) const
+{
+  if (IsEmpty()) return false;
+  // Zero direction components give infinite inverses, which the slab test handles
+  const Vector3<T> inverseDirection(static_cast<T>(1) / direction.x, static_cast<T>(1) / direction.y, 
+                                    static_cast<T>(1) / direction.z);
+  bool found = false;
+  T bestLambda = maxLambda;
+  T nodeLambda;
+  StackEntry stack[kMaxDepth];
+  U32 stackSize = 0;
+  U32 index = 0;
+  if (!IntersectRay(mNodes[0], origin, inverseDirection, bestLambda, nodeLambda)) return false;
+  for (;;)
+  {
+    const Node& node = mNodes[index];
+    if (node.count > 0)
+    {
+      for (U32 slot = node.offset; slot < node.offset + node.count; ++slot)
+      {
+        T candidateLambda;
+        if (!intersect(mIndices[slot], candidateLambda)) continue;
+        if (candidateLambda < static_cast<T>(0) || candidateLambda >= bestLambda) continue;
+        bestLambda = candidateLambda;
+        primitive = mIndices[slot];
+        found = true;
+      }
+    }
+    else
+    {
+      // Front to back: the farther child is visited later if nothing closer than its entry point was hit
+      U32 nearChild = node.offset;
+      U32 farChild = node.offset + 1;
+      T nearLambda, farLambda;
+      bool hitsNear = IntersectRay(mNodes[nearChild], origin, inverseDirection, bestLambda, nearLambda);
+      bool hitsFar = IntersectRay(mNodes[farChild], origin, inverseDirection, bestLambda, farLambda);
+      if (hitsNear && hitsFar)
+      {
+        if (farLambda < nearLambda)
+        {
+          std::swap(nearChild, farChild);
+          std::swap(nearLambda, farLambda);
+        }
+        stack[stackSize].node = farChild;
+        stack[stackSize++].distance = farLambda;
+        index = nearChild;
+        continue;
+      }
+      if (hitsNear || hitsFar)
+      {
+        index = hitsNear ? nearChild : farChild;
+        continue;
+      }
+    }
+    while (stackSize > 0 && stack[stackSize - 1].distance >= bestLambda) --stackSize;
+    if (stackSize == 0) break;
+    index = stack[--stackSize].node;
+  }
+  if (found) lambda = bestLambda;
+  return found;
+}
+
+template <typename T>
+void Bvh<T>::Refit(const Box3<T>* pBounds)
+{
+  for (size_t slot = 0; slot < mBounds.GetSize(); ++slot)
+  {
+    E_ASSERT_MSG(!pBounds[mIndices[slot]].IsEmpty(), E_ASSERT_MSG_BVH_EMPTY_BOUNDS);
+    mBounds[slot].min = pBounds[mIndices[slot]].GetMin();
+    mBounds[slot].max = pBounds[mIndices[slot]].GetMax();
+  }
+  // Children follow their parents
+  for (size_t i = mNodes.GetSize(); i > 0; --i) UpdateNode(static_cast<U32>(i - 1));
+}
+
+template <typename T>
+void Bvh<T>::Refit(U32 primitive, const Box3<T>& bounds)
+{
+  E_ASSERT_MSG(primitive < mSlots.GetSize(), E_ASSERT_MSG_BVH_PRIMITIVE_VALUE, primitive, mSlots.GetSize());
+  E_ASSERT_MSG(!bounds.IsEmpty(), E_ASSERT_MSG_BVH_EMPTY_BOUNDS);
+  mBounds[mSlots[primitive]].min = bounds.GetMin();
+  mBounds[mSlots[primitive]].max = bounds.GetMax();
+  // Walk up while the node bounds change
+  U32 index = mLeaves[primitive];
+  for (;;)
+  {
+    const Vector3<T> min = mNodes[index].min;
+    const Vector3<T> max = mNodes[index].max;
+    UpdateNode(index);
+    // Exact comparison: Vector3::operator== uses an epsilon, so many small moves would never reach the parents
+    if (index == 0 || (IsIdentical(mNodes[index].min, min) && IsIdentical(mNodes[index].max, max))) break;
+    index = mParents[index];
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline T Bvh<T>::GetDistanceSquared(const Vector3<T>& point, const Vector3<T>& min, const Vector3<T>& max)
+{
+  const Vector3<T> delta = Vector3<T>::Max(Vector3<T>::Max(min - point, point - max), Vector3<T>::ZeroVector());
+  return delta.GetLengthSquared();
+}
+
+template <typename T>
+inline T Bvh<T>::GetSurfaceArea(const Vector3<T>& min, const Vector3<T>& max)
+{
+  const Vector3<T> size = max - min;
+  return static_cast<T>(2) * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+// Slab test, lambda is the entry point (0 when the origin is inside)
+template <typename T>
+inline bool Bvh<T>::IntersectRay(const Node& node, const Vector3<T>& origin, const Vector3<T>& inverseDirection, 
+                                 T maxLambda, T& lambda)
+{
+  T lambdaX0 = (node.min.x - origin.x) * inverseDirection.x;
+  T lambdaX1 = (node.max.x - origin.x) * inverseDirection.x;
+  T lambdaY0 = (node.min.y - origin.y) * inverseDirection.y;
+  T lambdaY1 = (node.max.y - origin.y) * inverseDirection.y;
+  T lambdaZ0 = (node.min.z - origin.z) * inverseDirection.z;
+  T lambdaZ1 = (node.max.z - origin.z) * inverseDirection.z;
+  T entry = Math::Max(Math::Max(Math::Min(lambdaX0, lambdaX1), Math::Min(lambdaY0, lambdaY1)), 
+                      Math::Max(Math::Min(lambdaZ0, lambdaZ1), static_cast<T>(0)));
+  T exit = Math::Min(Math::Min(Math::Max(lambdaX0, lambdaX1), Math::Max(lambdaY0, lambdaY1)), 
+                     Math::Min(Math::Max(lambdaZ0, lambdaZ1), maxLambda));
+  lambda = entry;
+  return entry <= exit;
+}
+
+template <typename T>
+inline bool Bvh<T>::IsIdentical(const Vector3<T>& a, const Vector3<T>& b)
+{
+  return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+template <typename T>
+inline bool Bvh<T>::Overlaps(const Vector3<T>& minA, const Vector3<T>& maxA, const Vector3<T>& minB, 
+                             const Vector3<T>& maxB)
+{
+  return minA.x <= maxB.x && minB.x <= maxA.x && minA.y <= maxB.y && minB.y <= maxA.y && minA.z <= maxB.z && 
+         minB.z <= maxA.z;
+}
+
+template <typename T>
+inline void Bvh<T>::UpdateNode(U32 index)
+{
+  Node& node = mNodes[index];
+  if (node.count == 0)
+  {
+    node.min = Vector3<T>::Min(mNodes[node.offset].min, mNodes[node.offset + 1].min);
+    node.max = Vector3<T>::Max(mNodes[node.offset].max, mNodes[node.offset + 1].max);
+    return;
+  }
+  node.min = mBounds[node.offset].min;
+  node.max = mBounds[node.offset].max;
+  for (U32 slot = node.offset + 1; slot < node.offset + node.count; ++slot)
+  {
+    node.min = Vector3<T>::Min(node.min, mBounds[slot].min);
+    node.max = Vector3<T>::Max(node.max, mBounds[slot].max);
+  }
+}
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Bvh types
+----------------------------------------------------------------------------------------------------------------------*/
+typedef Math::Bvh<F32> Bvhf;
+typedef Math::Bvh<D64> Bvhd;
+}
+
+#endif
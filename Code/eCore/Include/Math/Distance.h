@@ -31,6 +31,7 @@ This file defines distance related utility functions.
 #define E3_DISTANCE_H
 
 #include "Math.h"
+#include "Vector3.h"
 
 namespace E
 {
@@ -58,16 +59,7 @@ T DistancePointTriangle(const Vector3<T>& p, const Vector3<T>& x0, const Vector3
 template <class T>
 T DistancePointTriangleSquared(const Vector3<T>& p, const Vector3<T>& x0, const Vector3<T>& x1, const Vector3<T>& x2, Vector3<T>& closestPoint);
 
-template <class T>
-bool IntersectRayBox3(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Box3<T>& box, T& outLambda)
-
-template <class T>
-bool IntersectRayTriangle(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Vector3<T>& x0, const Vector3<T>& x1, const Vector3<T>& x2, T& outLambda, bool faceCulling = false);
-
-template <class T>
-bool IntersectRaySphere(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Vector3<T>& sphereCenter, T sphereRadius, T& outLambda);
-
-  /*----------------------------------------------------------------------------------------------------------------------
+/*----------------------------------------------------------------------------------------------------------------------
 Math functions
 ----------------------------------------------------------------------------------------------------------------------*/
 
@@ -92,7 +84,7 @@ inline Vector3<T> ClosestPointToSegment(const Vector3<T>& p, const Vector3<T>& x
     return x1;
 
   const T b = c1 / c2;
-  Vector3<T> Pb = x0 + b * v;
+  Vector3<T> Pb = x0 + v * b;
   return Pb;
 }
 
@@ -105,9 +97,9 @@ http://www.allegro.cc/forums/thread/589720
 template <class T>
 inline T DistancePointLine(const Vector3<T>& p, const Vector3<T>& x0, const Vector3<T>& x1)
 {
-  Vector3<T> x1 = p - x0;
-  Vector3<T> x2 = x1 - x0;
-  return std::sqrt(Vector3<T>::Cross(x1,x2).GetLengthSquared() / x2.GetLengthSquared());
+  Vector3<T> v0 = p - x0;
+  Vector3<T> v1 = x1 - x0;
+  return std::sqrt(Vector3<T>::Cross(v0, v1).GetLengthSquared() / v1.GetLengthSquared());
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -120,7 +112,7 @@ template <class T>
 inline T DistancePointSegment(const Vector3<T>& p, const Vector3<T>& x0, const Vector3<T>& x1)
 {
   Vector3<T> closestPoint = ClosestPointToSegment(p, x0, x1);
-  return (p - closestPoint).Module();
+  return (p - closestPoint).GetLength();
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -370,7 +362,7 @@ T DistancePointTriangleSquared(const Vector3<T>& point, const Vector3<T>& x0, co
     sqrDistance = static_cast<T>(0);
   }
 
-  closestPoint = x0 + s * edge0 + t * edge1;
+  closestPoint = x0 + edge0 * s + edge1 * t;
 
   return sqrDistance;
 }
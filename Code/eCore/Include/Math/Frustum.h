@@ -0,0 +1,338 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Frustum.h
+This file defines the Frustum class: the six planes of a view-projection volume used for visibility culling.
+*/
+
+#ifndef E_MATH_FRUSTUM_H
+#define E_MATH_FRUSTUM_H
+
+#include <Base.h>
+#include <Math/Box3.h>
+#include <Math/Matrix4.h>
+#include <Math/Plane.h>
+#include <Math/Simd.h>
+#include <Math/Sphere.h>
+#include <Memory/Memory.h>
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Frustum
+
+Please note that this class has the following usage contract: 
+
+1. Floating point types are expected to be used with this class: F32, D64.
+2. Planes are extracted from a row vector view-projection matrix (as the ones built by Projection.h) with a [0, 1] 
+clip space depth range. Plane normals are normalized and point inwards.
+3. IsVisible tests are conservative: bounds intersecting or inside the frustum are visible, and some bounds close to 
+the frustum edges but outside of it may be reported as visible too. Empty boxes and spheres are never visible.
+4. Cull writes a visibility bitmask (bit i % 32 of word i / 32 set if object i is visible) with room for count bits,
+(count + 31) / 32 words, and returns the visible object count. The F32 version tests 4 bounds at a time with SSE when 
+E_SIMD_SSE is defined and gives the same results as IsVisible.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class Frustum
+{
+public:
+  enum PlaneType
+  {
+    ePlaneLeft,
+    ePlaneRight,
+    ePlaneBottom,
+    ePlaneTop,
+    ePlaneNear,
+    ePlaneFar,
+    ePlaneCount
+  };
+
+  Frustum();
+  explicit Frustum(const Matrix4<T>& viewProjection);
+
+  // Accessors
+  const Plane<T>&   GetPlane(PlaneType type) const;
+  bool              IsVisible(const Box3<T>& box) const;
+  bool              IsVisible(const Sphere<T>& sphere) const;
+  bool              IsVisible(const Vector3<T>& point) const;
+  void              Set(const Matrix4<T>& viewProjection);
+
+  // Methods
+  size_t            Cull(U32* pVisibilityMask, const Box3<T>* pBoxes, size_t count) const;
+  size_t            Cull(U32* pVisibilityMask, const Sphere<T>* pSpheres, size_t count) const;
+
+  static size_t     GetMaskWordCount(size_t count) { return (count + 31) / 32; }
+  static bool       IsVisible(const U32* pVisibilityMask, size_t index);
+
+private:
+  Plane<T>          mPlanes[ePlaneCount];
+
+  // Relying on default copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Frustum initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Frustum<T>::Frustum()
+{
+  Set(Matrix4<T>::Identity());
+}
+
+template <typename T>
+inline Frustum<T>::Frustum(const Matrix4<T>& viewProjection)
+{
+  Set(viewProjection);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Frustum accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline const Plane<T>& Frustum<T>::GetPlane(PlaneType type) const
+{
+  E_ASSERT_MSG(type < ePlaneCount, E_ASSERT_MSG_MATH_OUT_OF_BOUNDS_VALUE);
+  return mPlanes[type];
+}
+
+template <typename T>
+inline bool Frustum<T>::IsVisible(const Box3<T>& box) const
+{
+  if (box.IsEmpty()) return false;
+  const Vector3<T> center = box.GetCenter();
+  const Vector3<T> extents = box.GetExtents();
+  for (U32 i = 0; i < ePlaneCount; ++i)
+  {
+    const Vector3<T>& normal = mPlanes[i].GetNormal();
+    T distance = normal.x * center.x + normal.y * center.y + normal.z * center.z + mPlanes[i].GetDistance();
+    T radius = Math::Abs(normal.x) * extents.x + Math::Abs(normal.y) * extents.y + Math::Abs(normal.z) * extents.z;
+    if (distance + radius < static_cast<T>(0)) return false;
+  }
+  return true;
+}
+
+template <typename T>
+inline bool Frustum<T>::IsVisible(const Sphere<T>& sphere) const
+{
+  if (sphere.GetRadius() < static_cast<T>(0)) return false;
+  const Vector3<T>& origin = sphere.GetOrigin();
+  for (U32 i = 0; i < ePlaneCount; ++i)
+  {
+    const Vector3<T>& normal = mPlanes[i].GetNormal();
+    T distance = normal.x * origin.x + normal.y * origin.y + normal.z * origin.z + mPlanes[i].GetDistance();
+    if (distance + sphere.GetRadius() < static_cast<T>(0)) return false;
+  }
+  return true;
+}
+
+template <typename T>
+inline bool Frustum<T>::IsVisible(const Vector3<T>& point) const
+{
+  for (U32 i = 0; i < ePlaneCount; ++i)
+  {
+    if (mPlanes[i].GetDistanceToPoint(point) < static_cast<T>(0)) return false;
+  }
+  return true;
+}
+
+template <typename T>
+inline bool Frustum<T>::IsVisible(const U32* pVisibilityMask, size_t index)
+{
+  return (pVisibilityMask[index / 32] & (1u << (index % 32))) != 0;
+}
+
+// Clip space conditions for p * viewProjection = (x, y, z, w): -w <= x <= w, -w <= y <= w and 0 <= z <= w. Each 
+// condition is a plane built from the matrix columns (column i dot p + m(3, i)).
+template <typename T>
+inline void Frustum<T>::Set(const Matrix4<T>& m)
+{
+  mPlanes[ePlaneLeft]   = Plane<T>(m[3] + m[0], m[7] + m[4], m[11] + m[8], m[15] + m[12]);
+  mPlanes[ePlaneRight]  = Plane<T>(m[3] - m[0], m[7] - m[4], m[11] - m[8], m[15] - m[12]);
+  mPlanes[ePlaneBottom] = Plane<T>(m[3] + m[1], m[7] + m[5], m[11] + m[9], m[15] + m[13]);
+  mPlanes[ePlaneTop]    = Plane<T>(m[3] - m[1], m[7] - m[5], m[11] - m[9], m[15] - m[13]);
+  mPlanes[ePlaneNear]   = Plane<T>(m[2], m[6], m[10], m[14]);
+  mPlanes[ePlaneFar]    = Plane<T>(m[3] - m[2], m[7] - m[6], m[11] - m[10], m[15] - m[14]);
+  for (U32 i = 0; i < ePlaneCount; ++i) mPlanes[i].Normalize();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Frustum methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline size_t Frustum<T>::Cull(U32* pVisibilityMask, const Box3<T>* pBoxes, size_t count) const
+{
+  Memory::Zero(pVisibilityMask, GetMaskWordCount(count));
+  size_t visibleCount = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (!IsVisible(pBoxes[i])) continue;
+    pVisibilityMask[i / 32] |= 1u << (i % 32);
+    ++visibleCount;
+  }
+  return visibleCount;
+}
+
+template <typename T>
+inline size_t Frustum<T>::Cull(U32* pVisibilityMask, const Sphere<T>* pSpheres, size_t count) const
+{
+  Memory::Zero(pVisibilityMask, GetMaskWordCount(count));
+  size_t visibleCount = 0;
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (!IsVisible(pSpheres[i])) continue;
+    pVisibilityMask[i / 32] |= 1u << (i % 32);
+    ++visibleCount;
+  }
+  return visibleCount;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Frustum F32 specializations (SSE)
+
+Bounds are tested 4 at a time against one plane per step, with the components of the 4 bounds in separate registers:
+a Box3 is 2 xyz triplets (center and extents) and a Sphere is 4 floats (origin and radius). Groups of 4 bounds are 
+left as soon as all of them are outside a plane. Each group gives 4 bits of the mask (32 is a multiple of 4).
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SIMD_SSE
+template <>
+inline size_t Frustum<F32>::Cull(U32* pVisibilityMask, const Box3<F32>* pBoxes, size_t count) const
+{
+  static_assert(sizeof(Box3<F32>) == 6 * sizeof(F32), "Unexpected bounding volume layout");
+  static const U8 kBitCount[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+  Memory::Zero(pVisibilityMask, GetMaskWordCount(count));
+  Simd::F32x4 planes[ePlaneCount][7];
+  for (U32 i = 0; i < ePlaneCount; ++i)
+  {
+    const Vector3<F32>& normal = mPlanes[i].GetNormal();
+    planes[i][0] = Simd::Splat(normal.x);
+    planes[i][1] = Simd::Splat(normal.y);
+    planes[i][2] = Simd::Splat(normal.z);
+    planes[i][3] = Simd::Splat(mPlanes[i].GetDistance());
+    planes[i][4] = Simd::Splat(Math::Abs(normal.x));
+    planes[i][5] = Simd::Splat(Math::Abs(normal.y));
+    planes[i][6] = Simd::Splat(Math::Abs(normal.z));
+  }
+  Simd::F32x4 zero = Simd::Splat(0.0f);
+  size_t visibleCount = 0;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    // Center and extents of boxes (0, 1) and (2, 3)
+    Simd::F32x4 x01, y01, z01, x23, y23, z23;
+    const F32* pValues = reinterpret_cast<const F32*>(pBoxes + i);
+    Simd::LoadXyz4(pValues, x01, y01, z01);
+    Simd::LoadXyz4(pValues + 12, x23, y23, z23);
+    Simd::F32x4 centerX = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(2, 0, 2, 0));
+    Simd::F32x4 centerY = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(2, 0, 2, 0));
+    Simd::F32x4 centerZ = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(2, 0, 2, 0));
+    Simd::F32x4 extentsX = _mm_shuffle_ps(x01, x23, _MM_SHUFFLE(3, 1, 3, 1));
+    Simd::F32x4 extentsY = _mm_shuffle_ps(y01, y23, _MM_SHUFFLE(3, 1, 3, 1));
+    Simd::F32x4 extentsZ = _mm_shuffle_ps(z01, z23, _MM_SHUFFLE(3, 1, 3, 1));
+    // Empty boxes have negative extents
+    Simd::F32x4 outside = Simd::Less(extentsX, zero);
+    for (U32 j = 0; j < ePlaneCount && Simd::GetMask(outside) != 0xF; ++j)
+    {
+      Simd::F32x4 distance = Simd::MulAdd(centerZ, planes[j][2], 
+                                          Simd::MulAdd(centerY, planes[j][1], Simd::Mul(centerX, planes[j][0])));
+      distance = Simd::Add(distance, planes[j][3]);
+      Simd::F32x4 radius = Simd::MulAdd(extentsZ, planes[j][6], 
+                                        Simd::MulAdd(extentsY, planes[j][5], Simd::Mul(extentsX, planes[j][4])));
+      outside = Simd::Or(outside, Simd::Less(Simd::Add(distance, radius), zero));
+    }
+    U32 visibleBits = ~Simd::GetMask(outside) & 0xF;
+    pVisibilityMask[i / 32] |= visibleBits << (i % 32);
+    visibleCount += kBitCount[visibleBits];
+  }
+  for (; i < count; ++i)
+  {
+    if (!IsVisible(pBoxes[i])) continue;
+    pVisibilityMask[i / 32] |= 1u << (i % 32);
+    ++visibleCount;
+  }
+  return visibleCount;
+}
+
+template <>
+inline size_t Frustum<F32>::Cull(U32* pVisibilityMask, const Sphere<F32>* pSpheres, size_t count) const
+{
+  static_assert(sizeof(Sphere<F32>) == 4 * sizeof(F32), "Unexpected bounding volume layout");
+  static const U8 kBitCount[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+  Memory::Zero(pVisibilityMask, GetMaskWordCount(count));
+  Simd::F32x4 planes[ePlaneCount][4];
+  for (U32 i = 0; i < ePlaneCount; ++i)
+  {
+    const Vector3<F32>& normal = mPlanes[i].GetNormal();
+    planes[i][0] = Simd::Splat(normal.x);
+    planes[i][1] = Simd::Splat(normal.y);
+    planes[i][2] = Simd::Splat(normal.z);
+    planes[i][3] = Simd::Splat(mPlanes[i].GetDistance());
+  }
+  Simd::F32x4 zero = Simd::Splat(0.0f);
+  size_t visibleCount = 0;
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    const F32* pValues = reinterpret_cast<const F32*>(pSpheres + i);
+    Simd::F32x4 x = Simd::Load(pValues);
+    Simd::F32x4 y = Simd::Load(pValues + 4);
+    Simd::F32x4 z = Simd::Load(pValues + 8);
+    Simd::F32x4 radius = Simd::Load(pValues + 12);
+    Simd::Transpose(x, y, z, radius);
+    // Empty spheres have a negative radius
+    Simd::F32x4 outside = Simd::Less(radius, zero);
+    for (U32 j = 0; j < ePlaneCount && Simd::GetMask(outside) != 0xF; ++j)
+    {
+      Simd::F32x4 distance = Simd::MulAdd(z, planes[j][2], Simd::MulAdd(y, planes[j][1], Simd::Mul(x, planes[j][0])));
+      distance = Simd::Add(distance, planes[j][3]);
+      outside = Simd::Or(outside, Simd::Less(Simd::Add(distance, radius), zero));
+    }
+    U32 visibleBits = ~Simd::GetMask(outside) & 0xF;
+    pVisibilityMask[i / 32] |= visibleBits << (i % 32);
+    visibleCount += kBitCount[visibleBits];
+  }
+  for (; i < count; ++i)
+  {
+    if (!IsVisible(pSpheres[i])) continue;
+    pVisibilityMask[i / 32] |= 1u << (i % 32);
+    ++visibleCount;
+  }
+  return visibleCount;
+}
+#endif
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Frustum types
+----------------------------------------------------------------------------------------------------------------------*/
+typedef Math::Frustum<F32> Frustumf;
+typedef Math::Frustum<D64> Frustumd;
+}
+
+#endif
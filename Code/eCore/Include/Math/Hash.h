@@ -83,13 +83,13 @@ template <typename IntegerType>
 struct SimpleHash { static IntegerType Hash(IntegerType key); };
 
 /*----------------------------------------------------------------------------------------------------------------------
-Djb2 specializations
+Djb2 specializations (any char array, that is String as well as FileSystem::Path)
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template <>
-struct Djb2<String>
+template <size_t Size>
+struct Djb2<Text::CharArray<char, Size> >
 {
-  static U32 Hash(const String& key)
+  static U32 Hash(const Text::CharArray<char, Size>& key)
   {
     U32 hash = 5381;
     for (U32 i = 0; i < key.GetLength(); ++i) hash = ((hash << 5) + hash) + key[i];
@@ -98,13 +98,13 @@ struct Djb2<String>
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
-Fnv32 specializations
+Fnv32 specializations (any char array, that is String as well as FileSystem::Path)
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template <>
-struct Fnv32<String>
+template <size_t Size>
+struct Fnv32<Text::CharArray<char, Size> >
 {
-  static U32 Hash(const String& key)
+  static U32 Hash(const Text::CharArray<char, Size>& key)
   {
     U32 hash = 2166136261;
     for (U32 i = 0; i < key.GetLength(); ++i) hash = (hash ^ key[i]) * 16777619;
@@ -47,13 +47,13 @@ Please note that Math utility functions have the following usage contract:
 1. Floating point types are expected to be used with all the functions: F32, D64.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <class T>
-bool IntersectRayBox3(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Box3<T>& box, T& outLambda)
+bool IntersectRayBox3(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Box3<T>& box, T& outLambda);
 
-  template <class T>
+template <class T>
 bool IntersectRayTriangle(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Vector3<T>& x0, const Vector3<T>& x1, const Vector3<T>& x2, T& outLambda, bool faceCulling = false);
 
 template <class T>
-bool IntersectRaySphere(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Vector3<T>& sphereCenter, T sphereRadius, T& outLambda);
+bool IntersectRaySphere(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Sphere<T>& sphere, T& outLambda);
 
 /*----------------------------------------------------------------------------------------------------------------------
 Math functions
@@ -75,8 +75,8 @@ bool IntersectRayBox3(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirectio
   char quadrant[3]; 
   Vector3<T> candidatePlane;
   Vector3<T> hitPoint;
-  const Vector3<T>& boxMax = box.GetMax();
-  const Vector3<T>& boxMin = box.GetMin();
+  const Vector3<T> boxMax = box.GetMax();
+  const Vector3<T> boxMin = box.GetMin();
 
   // Find candidate planes; this loop can be avoided if rays cast all from the eye (assume perpsective view)
   for (U32 i = 0; i < 3; ++i)
@@ -118,7 +118,7 @@ bool IntersectRayBox3(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirectio
   }
 
   // Get largest of the maxT's for final choice of intersection
-  I32 whichPlane = 0;
+  U32 whichPlane = 0;
   for (U32 i = 1; i < 3; i++)
     if (maxT[whichPlane] < maxT[i])
       whichPlane = i;
@@ -132,7 +132,7 @@ bool IntersectRayBox3(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirectio
     if (whichPlane != i)
     {
       hitPoint[i] = rayOrigin[i] + maxT[whichPlane] * rayDirection[i];
-      if (hitPoint[i] < minB[i] || hitPoint[i] > boxMax[i])
+      if (hitPoint[i] < boxMin[i] || hitPoint[i] > boxMax[i])
         return false;
     }
     else
@@ -197,7 +197,7 @@ Performs a ray intersection test with a triangle defined by x0, x1 and x2 and re
 http://www.cs.lth.se/home/Tomas_Akenine_Moller/code/
 ----------------------------------------------------------------------------------------------------------------------*/
 template <class T>
-bool IntersectRayTriangle(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Vector3<T>& x0, const Vector3<T>& x1, const Vector3<T>& x2, T& outLambda, bool faceCulling = false)
+bool IntersectRayTriangle(const Vector3<T>& rayOrigin, const Vector3<T>& rayDirection, const Vector3<T>& x0, const Vector3<T>& x1, const Vector3<T>& x2, T& outLambda, bool faceCulling)
 {
   // Find vectors for two edges sharing x0
   Vector3<T> edge0 = x1 - x0;
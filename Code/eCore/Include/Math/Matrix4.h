@@ -31,6 +31,7 @@ This file defines a 4x4 matrix class.
 #define E_MATRIX4_H
 
 #include "Vector3.h"
+#include "Vector4.h"
 
 namespace E
 {
@@ -58,9 +59,12 @@ M = ( Rx  Ux  Fx )
     ( Rz  Uz  Fz )
 
 7. Operator *= does NOT perform a matrix multiplication but a matrix element per element multiplication.
+8. Matrix4 is 16 byte aligned. The F32 version uses SSE when E_SIMD_SSE is defined (see Simd.h): operators, 
+transpose, inverse and vector transforms work on whole rows. Results match the scalar version within floating point 
+tolerance (the inverse uses a different cofactor expansion).
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
-class Matrix4
+class E_ALIGN(16) Matrix4
 {
 public:
   Matrix4();
@@ -131,6 +135,7 @@ public:
   static Matrix4    Identity();
   static Matrix4    Invert(const Matrix4& m);
   static Vector3<T> RotateVector(const Matrix4& m, const Vector3<T>& scalar);
+  static Vector4<T> Transform(const Matrix4& m, const Vector4<T>& v);
   static Vector3<T> TransformPoint(const Matrix4& m, const Vector3<T>& p);
   static Matrix4    Transpose(const Matrix4& m);
 
@@ -888,6 +893,16 @@ inline Vector3<T> Matrix4<T>::RotateVector(const Matrix4& m, const Vector3<T>& v
     m[2] * v.x + m[6] * v.y + m[10] * v.z);
 }
 
+template <typename T>
+inline Vector4<T> Matrix4<T>::Transform(const Matrix4& m, const Vector4<T>& v)
+{
+  return Vector4<T>(	
+    m[0] * v.x + m[4] * v.y +  m[8] * v.z + m[12] * v.w,
+    m[1] * v.x + m[5] * v.y +  m[9] * v.z + m[13] * v.w,
+    m[2] * v.x + m[6] * v.y + m[10] * v.z + m[14] * v.w,
+    m[3] * v.x + m[7] * v.y + m[11] * v.z + m[15] * v.w);
+}
+
 template <typename T>
 inline Vector3<T> Matrix4<T>::TransformPoint(const Matrix4& m, const Vector3<T>& p)
 {
@@ -908,6 +923,215 @@ inline Matrix4<T> Matrix4<T>::Transpose(const Matrix4& m)
     m[2], m[6], m[10], m[14],
     m[3], m[7], m[11], m[15]);
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+Matrix4 F32 specializations (SSE)
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SIMD_SSE
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator+(const Matrix4& other) const
+{
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(result.m + i, Simd::Add(Simd::Load(m + i), Simd::Load(other.m + i)));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator-() const
+{
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(result.m + i, Simd::Negate(Simd::Load(m + i)));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator-(const Matrix4& other) const
+{
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(result.m + i, Simd::Sub(Simd::Load(m + i), Simd::Load(other.m + i)));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator*(const Matrix4& other) const
+{
+  Simd::F32x4 row0 = Simd::Load(other.m);
+  Simd::F32x4 row1 = Simd::Load(other.m + 4);
+  Simd::F32x4 row2 = Simd::Load(other.m + 8);
+  Simd::F32x4 row3 = Simd::Load(other.m + 12);
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(result.m + i, Simd::Transform(Simd::Load(m + i), row0, row1, row2, row3));
+  return result;
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::operator*(F32 scalar) const
+{
+  Simd::F32x4 scalarValue = Simd::Splat(scalar);
+  Matrix4<F32> result;
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(result.m + i, Simd::Mul(Simd::Load(m + i), scalarValue));
+  return result;
+}
+
+template <>
+inline Matrix4<F32>& Matrix4<F32>::operator*=(const Matrix4& other)
+{
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(m + i, Simd::Mul(Simd::Load(m + i), Simd::Load(other.m + i)));
+  return (*this);
+}
+
+template <>
+inline Matrix4<F32>& Matrix4<F32>::operator*=(F32 scalar)
+{
+  Simd::F32x4 scalarValue = Simd::Splat(scalar);
+  for (U32 i = 0; i < 16; i += 4) Simd::Store(m + i, Simd::Mul(Simd::Load(m + i), scalarValue));
+  return (*this);
+}
+
+template <>
+inline Matrix4<F32> Matrix4<F32>::Transpose(const Matrix4& m)
+{
+  Simd::F32x4 row0 = Simd::Load(&m[0]);
+  Simd::F32x4 row1 = Simd::Load(&m[4]);
+  Simd::F32x4 row2 = Simd::Load(&m[8]);
+  Simd::F32x4 row3 = Simd::Load(&m[12]);
+  Simd::Transpose(row0, row1, row2, row3);
+  Matrix4<F32> result;
+  Simd::Store(&result[0], row0);
+  Simd::Store(&result[4], row1);
+  Simd::Store(&result[8], row2);
+  Simd::Store(&result[12], row3);
+  return result;
+}
+
+template <>
+inline void Matrix4<F32>::Transpose()
+{
+  *this = Transpose(*this);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Invert (SSE)
+
+Implementation based on Intel's "Streaming SIMD Extensions - Inverse of 4x4 Matrix" (AP-928). The cofactors are 
+computed on the transposed matrix with the 2x2 sub-determinant products shuffled across lanes, so the result equals
+the scalar inverse within floating point tolerance.
+----------------------------------------------------------------------------------------------------------------------*/
+template <>
+inline Matrix4<F32> Matrix4<F32>::Invert(const Matrix4& m)
+{
+  // Load the transposed matrix with rows 1 and 3 rotated by two lanes
+  Simd::F32x4 row0 = Simd::Load(&m[0]);
+  Simd::F32x4 row1 = Simd::Load(&m[4]);
+  Simd::F32x4 row2 = Simd::Load(&m[8]);
+  Simd::F32x4 row3 = Simd::Load(&m[12]);
+  Simd::Transpose(row0, row1, row2, row3);
+  row1 = _mm_shuffle_ps(row1, row1, 0x4E);
+  row3 = _mm_shuffle_ps(row3, row3, 0x4E);
+  Simd::F32x4 minor0, minor1, minor2, minor3, tmp;
+
+  tmp = _mm_mul_ps(row2, row3);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+  minor0 = _mm_mul_ps(row1, tmp);
+  minor1 = _mm_mul_ps(row0, tmp);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+  minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp), minor0);
+  minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor1);
+  minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+  tmp = _mm_mul_ps(row1, row2);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+  minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor0);
+  minor3 = _mm_mul_ps(row0, tmp);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+  minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp));
+  minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor3);
+  minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+  tmp = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+  row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+  minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor0);
+  minor2 = _mm_mul_ps(row0, tmp);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+  minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp));
+  minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp), minor2);
+  minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+  tmp = _mm_mul_ps(row0, row1);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+  minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor2);
+  minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp), minor3);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+  minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp), minor2);
+  minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp));
+
+  tmp = _mm_mul_ps(row0, row3);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+  minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp));
+  minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor2);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+  minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp), minor1);
+  minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp));
+
+  tmp = _mm_mul_ps(row0, row2);
+  tmp = _mm_shuffle_ps(tmp, tmp, 0xB1);
+  minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp), minor1);
+  minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp));
+  tmp = _mm_shuffle_ps(tmp, tmp, 0x4E);
+  minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp));
+  minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp), minor3);
+
+  // Determinant (see Matrix4<T>::Invert about the zero comparison)
+  F32 det = Simd::Dot(row0, minor0);
+  if (det == 0.0f)
+  {
+    E_ASSERT_ALWAYS(E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+    return m;
+  }
+  Simd::F32x4 invDet = Simd::Splat(1.0f / det);
+  Matrix4<F32> inverse;
+  Simd::Store(&inverse[0], Simd::Mul(minor0, invDet));
+  Simd::Store(&inverse[4], Simd::Mul(minor1, invDet));
+  Simd::Store(&inverse[8], Simd::Mul(minor2, invDet));
+  Simd::Store(&inverse[12], Simd::Mul(minor3, invDet));
+  return inverse;
+}
+
+template <>
+inline Vector3<F32> Matrix4<F32>::RotateVector(const Matrix4& m, const Vector3<F32>& v)
+{
+  Simd::F32x4 result = Simd::Mul(Simd::Splat(v.x), Simd::Load(&m[0]));
+  result = Simd::MulAdd(Simd::Splat(v.y), Simd::Load(&m[4]), result);
+  result = Simd::MulAdd(Simd::Splat(v.z), Simd::Load(&m[8]), result);
+  E_ALIGN(16) F32 resultValues[4];
+  Simd::Store(resultValues, result);
+  return Vector3<F32>(resultValues[0], resultValues[1], resultValues[2]);
+}
+
+template <>
+inline Vector4<F32> Matrix4<F32>::Transform(const Matrix4& m, const Vector4<F32>& v)
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Transform(
+    Simd::Load(&v.x), Simd::Load(&m[0]), Simd::Load(&m[4]), Simd::Load(&m[8]), Simd::Load(&m[12])));
+  return result;
+}
+
+template <>
+inline Vector3<F32> Matrix4<F32>::TransformPoint(const Matrix4& m, const Vector3<F32>& p)
+{
+  Simd::F32x4 result = Simd::Mul(Simd::Splat(p.x), Simd::Load(&m[0]));
+  result = Simd::MulAdd(Simd::Splat(p.y), Simd::Load(&m[4]), result);
+  result = Simd::MulAdd(Simd::Splat(p.z), Simd::Load(&m[8]), result);
+  result = Simd::Add(result, Simd::Load(&m[12]));
+  E_ALIGN(16) F32 resultValues[4];
+  Simd::Store(resultValues, result);
+  const F32 w = resultValues[3];
+  const F32 invW = IsEqual(w, 0.0f) ? 1.0f : 1.0f / w;
+  return Vector3<F32>(resultValues[0] * invW, resultValues[1] * invW, resultValues[2] * invW);
+}
+#endif
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
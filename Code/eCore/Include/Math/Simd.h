@@ -0,0 +1,243 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Simd.h
+This file defines the SIMD helpers used by the F32 specializations of the math classes.
+*/
+
+#ifndef E_MATH_SIMD_H
+#define E_MATH_SIMD_H
+
+#include <Base.h>
+
+#ifdef E_SIMD_SSE
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#endif
+#ifdef E_SIMD_AVX
+#include <immintrin.h>
+#endif
+
+#ifdef E_SIMD_SSE
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Simd
+
+Please note that these namespace methods have the following usage contract:
+
+1. Methods are thin wrappers over SSE intrinsics working on 4 F32 lanes. They are only defined when E_SIMD_SSE is 
+defined (always on x64, /arch:SSE2 or above on x86).
+2. Methods taking more than three vectors take them by reference (x86 can only pass three aligned values by value).
+3. Load and Store do not require aligned addresses: the math types are declared 16 byte aligned, but the library 
+allocators do not guarantee this alignment for heap arrays. Unaligned loads have no penalty on aligned addresses.
+4. Operations follow the same evaluation order as the scalar code whenever possible (e.g. MulAdd does not use FMA)
+so that results match the scalar versions. Horizontal reductions (Dot) may differ in the last bits.
+5. The F32x8 type and its methods (8 F32 lanes) are only defined when E_SIMD_AVX is defined (/arch:AVX or above). 
+MinMax uses them when available and two F32x4 accumulators otherwise, so it always reduces 8 values per iteration.
+----------------------------------------------------------------------------------------------------------------------*/
+namespace Simd
+{
+  typedef __m128 F32x4;
+
+  E_FORCE_INLINE F32x4  Abs(F32x4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+  E_FORCE_INLINE F32x4  Add(F32x4 a, F32x4 b) { return _mm_add_ps(a, b); }
+  E_FORCE_INLINE F32x4  Div(F32x4 a, F32x4 b) { return _mm_div_ps(a, b); }
+  E_FORCE_INLINE F32    Dot(F32x4 a, F32x4 b);
+  E_FORCE_INLINE I32    GetMask(F32x4 mask) { return _mm_movemask_ps(mask); }
+  E_FORCE_INLINE F32x4  Less(F32x4 a, F32x4 b) { return _mm_cmplt_ps(a, b); }
+  E_FORCE_INLINE F32x4  LessEqual(F32x4 a, F32x4 b) { return _mm_cmple_ps(a, b); }
+  E_FORCE_INLINE F32x4  Load(const F32* p) { return _mm_loadu_ps(p); }
+  E_FORCE_INLINE F32x4  Load(F32 x, F32 y, F32 z, F32 w) { return _mm_setr_ps(x, y, z, w); }
+  E_FORCE_INLINE void   LoadXyz4(const F32* p, F32x4& x, F32x4& y, F32x4& z);
+  E_FORCE_INLINE F32x4  Max(F32x4 a, F32x4 b) { return _mm_max_ps(a, b); }
+  E_FORCE_INLINE F32x4  Min(F32x4 a, F32x4 b) { return _mm_min_ps(a, b); }
+  E_FORCE_INLINE void   MinMax(const F32* p, size_t count, F32& min, F32& max);
+  E_FORCE_INLINE F32x4  Mul(F32x4 a, F32x4 b) { return _mm_mul_ps(a, b); }
+  E_FORCE_INLINE F32x4  MulAdd(F32x4 a, F32x4 b, F32x4 c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+  E_FORCE_INLINE F32x4  Negate(F32x4 a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+  E_FORCE_INLINE F32x4  Or(F32x4 a, F32x4 b) { return _mm_or_ps(a, b); }
+  E_FORCE_INLINE F32    ReduceMax(F32x4 a);
+  E_FORCE_INLINE F32    ReduceMin(F32x4 a);
+  E_FORCE_INLINE F32x4  Select(F32x4 mask, F32x4 a, F32x4 b);
+  E_FORCE_INLINE F32x4  Splat(F32 scalar) { return _mm_set1_ps(scalar); }
+  template <int i>
+  E_FORCE_INLINE F32x4  Splat(F32x4 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(i, i, i, i)); }
+  E_FORCE_INLINE F32x4  Sqrt(F32x4 a) { return _mm_sqrt_ps(a); }
+  E_FORCE_INLINE void   Store(F32* p, F32x4 a) { _mm_storeu_ps(p, a); }
+  E_FORCE_INLINE void   StoreXyz4(F32* p, const F32x4& x, const F32x4& y, const F32x4& z);
+  E_FORCE_INLINE F32x4  Sub(F32x4 a, F32x4 b) { return _mm_sub_ps(a, b); }
+  E_FORCE_INLINE F32x4  Transform(F32x4 v, const F32x4& row0, const F32x4& row1, const F32x4& row2, const F32x4& row3);
+  E_FORCE_INLINE void   Transpose(F32x4& row0, F32x4& row1, F32x4& row2, F32x4& row3);
+
+#ifdef E_SIMD_AVX
+  typedef __m256 F32x8;
+
+  E_FORCE_INLINE F32x8  Combine(F32x4 low, F32x4 high);
+  E_FORCE_INLINE F32x4  GetHigh(F32x8 a) { return _mm256_extractf128_ps(a, 1); }
+  E_FORCE_INLINE F32x4  GetLow(F32x8 a) { return _mm256_castps256_ps128(a); }
+  E_FORCE_INLINE F32x8  Load8(const F32* p) { return _mm256_loadu_ps(p); }
+  E_FORCE_INLINE F32x8  Max(F32x8 a, F32x8 b) { return _mm256_max_ps(a, b); }
+  E_FORCE_INLINE F32x8  Min(F32x8 a, F32x8 b) { return _mm256_min_ps(a, b); }
+#endif
+
+/*----------------------------------------------------------------------------------------------------------------------
+Simd methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+E_FORCE_INLINE F32 Dot(F32x4 a, F32x4 b)
+{
+  F32x4 product = _mm_mul_ps(a, b);
+  F32x4 sum = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+  sum = _mm_add_ss(sum, _mm_movehl_ps(sum, sum));
+  return _mm_cvtss_f32(sum);
+}
+
+#ifdef E_SIMD_AVX
+E_FORCE_INLINE F32x8 Combine(F32x4 low, F32x4 high)
+{
+  return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+}
+#endif
+
+// Minimum and maximum of count (> 0) values, 8 values per iteration
+E_FORCE_INLINE void MinMax(const F32* p, size_t count, F32& min, F32& max)
+{
+  size_t i = 0;
+  F32x4 minValue = _mm_set1_ps(p[0]);
+  F32x4 maxValue = minValue;
+#ifdef E_SIMD_AVX
+  if (count >= 8)
+  {
+    F32x8 minValue8 = Load8(p);
+    F32x8 maxValue8 = minValue8;
+    for (i = 8; i + 8 <= count; i += 8)
+    {
+      F32x8 value = Load8(p + i);
+      minValue8 = Min(value, minValue8);
+      maxValue8 = Max(value, maxValue8);
+    }
+    minValue = _mm_min_ps(GetLow(minValue8), GetHigh(minValue8));
+    maxValue = _mm_max_ps(GetLow(maxValue8), GetHigh(maxValue8));
+  }
+#else
+  if (count >= 8)
+  {
+    F32x4 minValue1 = _mm_loadu_ps(p + 4);
+    F32x4 maxValue1 = minValue1;
+    minValue = maxValue = _mm_loadu_ps(p);
+    for (i = 8; i + 8 <= count; i += 8)
+    {
+      F32x4 value0 = _mm_loadu_ps(p + i);
+      F32x4 value1 = _mm_loadu_ps(p + i + 4);
+      minValue = _mm_min_ps(value0, minValue);
+      maxValue = _mm_max_ps(value0, maxValue);
+      minValue1 = _mm_min_ps(value1, minValue1);
+      maxValue1 = _mm_max_ps(value1, maxValue1);
+    }
+    minValue = _mm_min_ps(minValue, minValue1);
+    maxValue = _mm_max_ps(maxValue, maxValue1);
+  }
+#endif
+  for (; i + 4 <= count; i += 4)
+  {
+    F32x4 value = _mm_loadu_ps(p + i);
+    minValue = _mm_min_ps(value, minValue);
+    maxValue = _mm_max_ps(value, maxValue);
+  }
+  min = ReduceMin(minValue);
+  max = ReduceMax(maxValue);
+  for (; i < count; ++i)
+  {
+    if (p[i] < min) min = p[i];
+    if (p[i] > max) max = p[i];
+  }
+}
+
+E_FORCE_INLINE F32 ReduceMax(F32x4 a)
+{
+  F32x4 result = _mm_max_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+  result = _mm_max_ss(result, _mm_movehl_ps(result, result));
+  return _mm_cvtss_f32(result);
+}
+
+E_FORCE_INLINE F32 ReduceMin(F32x4 a)
+{
+  F32x4 result = _mm_min_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+  result = _mm_min_ss(result, _mm_movehl_ps(result, result));
+  return _mm_cvtss_f32(result);
+}
+
+// Loads 4 consecutive xyz triplets (12 F32) into one vector per component
+E_FORCE_INLINE void LoadXyz4(const F32* p, F32x4& x, F32x4& y, F32x4& z)
+{
+  F32x4 a = _mm_loadu_ps(p);      // x0 y0 z0 x1
+  F32x4 b = _mm_loadu_ps(p + 4);  // y1 z1 x2 y2
+  F32x4 c = _mm_loadu_ps(p + 8);  // z2 x3 y3 z3
+  F32x4 xy = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+  F32x4 yz = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1)); // y0 z0 y1 z1
+  x = _mm_shuffle_ps(a, xy, _MM_SHUFFLE(2, 0, 3, 0));
+  y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+  z = _mm_shuffle_ps(yz, c, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+// Takes the lanes of a where mask is set and the lanes of b otherwise
+E_FORCE_INLINE F32x4 Select(F32x4 mask, F32x4 a, F32x4 b)
+{
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Stores one vector per component as 4 consecutive xyz triplets (12 F32)
+E_FORCE_INLINE void StoreXyz4(F32* p, const F32x4& x, const F32x4& y, const F32x4& z)
+{
+  F32x4 xy = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0)); // x0 x2 y0 y2
+  F32x4 zx = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0)); // z0 z2 x1 x3
+  F32x4 yz = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1)); // y1 y3 z1 z3
+  _mm_storeu_ps(p, _mm_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0)));
+  _mm_storeu_ps(p + 4, _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)));
+  _mm_storeu_ps(p + 8, _mm_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+E_FORCE_INLINE void Transpose(F32x4& row0, F32x4& row1, F32x4& row2, F32x4& row3)
+{
+  _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+}
+
+// Row vector times a row-major matrix: v.x * row0 + v.y * row1 + v.z * row2 + v.w * row3
+E_FORCE_INLINE F32x4 Transform(F32x4 v, const F32x4& row0, const F32x4& row1, const F32x4& row2, const F32x4& row3)
+{
+  F32x4 result = _mm_mul_ps(Splat<0>(v), row0);
+  result = _mm_add_ps(result, _mm_mul_ps(Splat<1>(v), row1));
+  result = _mm_add_ps(result, _mm_mul_ps(Splat<2>(v), row2));
+  return _mm_add_ps(result, _mm_mul_ps(Splat<3>(v), row3));
+}
+}
+}
+}
+#endif
+
+#endif
@@ -95,7 +95,7 @@ inline bool Sphere<T>::AddPoint(const Vector3<T>& point)
 {
   if (mRadius < 0)
   {
-    mOrigin = v;
+    mOrigin = point;
     mRadius = 0;
     return true;
   }
@@ -106,7 +106,7 @@ inline bool Sphere<T>::AddPoint(const Vector3<T>& point)
     {
       r = Math::Sqrt(r);
       mOrigin += (point - mOrigin) * static_cast<T>(0.5) * (static_cast<T>(1) - mRadius / r);
-      mRadius +- static_cast<T>(0.5) * (r - mRadius);
+      mRadius += static_cast<T>(0.5) * (r - mRadius);
       return true;
     }
   }
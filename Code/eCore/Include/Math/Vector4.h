@@ -31,6 +31,7 @@ This file defines the Vector4 class.
 #define E_VECTOR4_H
 
 #include "Comparison.h"
+#include "Simd.h"
 #include <Assertion/Assert.h>
 
 namespace E
@@ -45,9 +46,12 @@ Please note that this class has the following usage contract:
 1. Floating point types are expected to be used with this class: F32, D64.
 2. GetLength and Normalize are not supported on the I32 version.
 3. MaxMin count must be greater than 0.
+4. Vector4 is 16 byte aligned. The F32 version uses SSE when E_SIMD_SSE is defined (see Simd.h). Results match the 
+scalar version except for Dot, GetLength and GetLengthSquared, which may differ in the last bits (different summation 
+order).
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
-struct Vector4
+struct E_ALIGN(16) Vector4
 {
   Vector4();
   Vector4(T scalar);
@@ -486,6 +490,220 @@ inline Vector4<T> Vector4<T>::ZeroVector()
   static Vector4<T> sZeroVector;
   return sZeroVector;
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4 F32 specializations (SSE)
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SIMD_SSE
+template <>
+inline Vector4<F32> Vector4<F32>::operator+(const Vector4& other) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Add(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator+(F32 scalar) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Add(Simd::Load(&x), Simd::Splat(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator+=(const Vector4& other)
+{
+  Simd::Store(&x, Simd::Add(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator+=(F32 scalar)
+{
+  Simd::Store(&x, Simd::Add(Simd::Load(&x), Simd::Splat(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator-() const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Negate(Simd::Load(&x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator-(const Vector4& other) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Sub(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator-(F32 scalar) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Sub(Simd::Load(&x), Simd::Splat(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator-=(const Vector4& other)
+{
+  Simd::Store(&x, Simd::Sub(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator-=(F32 scalar)
+{
+  Simd::Store(&x, Simd::Sub(Simd::Load(&x), Simd::Splat(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator*(const Vector4& other) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Mul(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator*(F32 scalar) const
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Mul(Simd::Load(&x), Simd::Splat(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator*=(const Vector4& other)
+{
+  Simd::Store(&x, Simd::Mul(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator*=(F32 scalar)
+{
+  Simd::Store(&x, Simd::Mul(Simd::Load(&x), Simd::Splat(scalar)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator/(const Vector4& other) const
+{
+  E_ASSERT_MSG(
+    !IsEqual(other.x, 0.0f) && !IsEqual(other.y, 0.0f) && !IsEqual(other.z, 0.0f) && !IsEqual(other.w, 0.0f), 
+    E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Div(Simd::Load(&x), Simd::Load(&other.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::operator/(F32 scalar) const
+{
+  E_ASSERT_MSG(!IsEqual(scalar, 0.0f), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Div(Simd::Load(&x), Simd::Splat(scalar)));
+  return result;
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator/=(const Vector4& other)
+{
+  E_ASSERT_MSG(
+    !IsEqual(other.x, 0.0f) && !IsEqual(other.y, 0.0f) && !IsEqual(other.z, 0.0f) && !IsEqual(other.w, 0.0f), 
+    E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Simd::Store(&x, Simd::Div(Simd::Load(&x), Simd::Load(&other.x)));
+  return (*this);
+}
+
+template <>
+inline Vector4<F32>& Vector4<F32>::operator/=(F32 scalar)
+{
+  E_ASSERT_MSG(!IsEqual(scalar, 0.0f), E_ASSERT_MSG_MATH_NON_ZERO_VALUE);
+  Simd::Store(&x, Simd::Div(Simd::Load(&x), Simd::Splat(scalar)));
+  return (*this);
+}
+
+template <>
+inline F32 Vector4<F32>::GetLengthSquared() const
+{
+  Simd::F32x4 v = Simd::Load(&x);
+  return Simd::Dot(v, v);
+}
+
+template <>
+inline F32 Vector4<F32>::Dot(const Vector4& a, const Vector4& b)
+{
+  return Simd::Dot(Simd::Load(&a.x), Simd::Load(&b.x));
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::Max(const Vector4& a, const Vector4& b)
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Max(Simd::Load(&a.x), Simd::Load(&b.x)));
+  return result;
+}
+
+template <>
+inline Vector4<F32> Vector4<F32>::Min(const Vector4& a, const Vector4& b)
+{
+  Vector4<F32> result;
+  Simd::Store(&result.x, Simd::Min(Simd::Load(&a.x), Simd::Load(&b.x)));
+  return result;
+}
+
+template <>
+inline void Vector4<F32>::MinMax(Vector4& min, Vector4& max, const Vector4<F32>* pSource, const U32 count)
+{
+  E_ASSERT_MSG(count > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
+  // 8 wide reduction: two vectors per iteration, folded at the end
+  Simd::F32x4 minValue = Simd::Load(&pSource[0].x);
+  Simd::F32x4 maxValue = minValue;
+  U32 i = 1;
+#ifdef E_SIMD_AVX
+  Simd::F32x8 minValue8 = Simd::Combine(minValue, minValue);
+  Simd::F32x8 maxValue8 = minValue8;
+  for (; i + 2 <= count; i += 2)
+  {
+    Simd::F32x8 value = Simd::Load8(&pSource[i].x);
+    minValue8 = Simd::Min(value, minValue8);
+    maxValue8 = Simd::Max(value, maxValue8);
+  }
+  minValue = Simd::Min(Simd::GetLow(minValue8), Simd::GetHigh(minValue8));
+  maxValue = Simd::Max(Simd::GetLow(maxValue8), Simd::GetHigh(maxValue8));
+#else
+  Simd::F32x4 minValue1 = minValue;
+  Simd::F32x4 maxValue1 = minValue;
+  for (; i + 2 <= count; i += 2)
+  {
+    Simd::F32x4 value0 = Simd::Load(&pSource[i].x);
+    Simd::F32x4 value1 = Simd::Load(&pSource[i + 1].x);
+    minValue = Simd::Min(value0, minValue);
+    maxValue = Simd::Max(value0, maxValue);
+    minValue1 = Simd::Min(value1, minValue1);
+    maxValue1 = Simd::Max(value1, maxValue1);
+  }
+  minValue = Simd::Min(minValue, minValue1);
+  maxValue = Simd::Max(maxValue, maxValue1);
+#endif
+  if (i < count)
+  {
+    Simd::F32x4 value = Simd::Load(&pSource[i].x);
+    minValue = Simd::Min(value, minValue);
+    maxValue = Simd::Max(value, maxValue);
+  }
+  Simd::Store(&min.x, minValue);
+  Simd::Store(&max.x, maxValue);
+}
+#endif
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,874 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file VectorStream.h
+This file defines the Vector3Stream and Vector4Stream classes. They store vectors as structures of arrays (one array 
+per component) for bulk processing.
+*/
+
+#ifndef E_MATH_VECTOR_STREAM_H
+#define E_MATH_VECTOR_STREAM_H
+
+#include <Base.h>
+#include <Math/Simd.h>
+#include <Math/Vector3.h>
+#include <Math/Vector4.h>
+#include <Memory/Memory.h>
+#include <Assertion/Assert.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+VectorStream assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_VECTOR_STREAM_INDEX_VALUE  "Index value (%d) must be smaller than size (%d)"
+#define E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE   "Stream size (%d) must be equal to size (%d)"
+
+namespace E
+{
+namespace Math
+{
+/*----------------------------------------------------------------------------------------------------------------------
+StreamLanes
+
+Please note that this class has the following usage contract: 
+
+1. StreamLanes is the storage shared by the vector streams: laneCount arrays of the same size allocated in a single
+block. Every lane starts on a kAlignment boundary and its capacity is a multiple of kGranularity elements, so SIMD 
+kernels can use full width aligned loads on every lane.
+2. Resize does not keep the lane content (as DynamicArray::Resize) and only reallocates when the capacity is exceeded.
+Lane elements are zero after a reallocation.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, size_t laneCount>
+class StreamLanes
+{
+public:
+  static const size_t kAlignment = 32;
+  static const size_t kGranularity = 8;
+
+  StreamLanes();
+  StreamLanes(const StreamLanes& other);
+  ~StreamLanes();
+
+  StreamLanes&  operator=(const StreamLanes& other);
+
+  // Accessors
+  size_t        GetCapacity() const { return mCapacity; }
+  T*            GetLane(size_t lane) { return mpLanes[lane]; }
+  const T*      GetLane(size_t lane) const { return mpLanes[lane]; }
+  size_t        GetSize() const { return mSize; }
+
+  // Methods
+  void          Resize(size_t size);
+
+private:
+  U8*           mpBuffer;
+  T*            mpLanes[laneCount];
+  size_t        mSize;
+  size_t        mCapacity;
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector3Stream
+
+Please note that this class has the following usage contract: 
+
+1. Floating point types are expected to be used with this class: F32, D64.
+2. Kernels give the same results as the per element Vector3 methods (Dot, Cross, GetLength, GetLengthSquared and 
+Normalize) except that Normalize leaves zero length vectors unchanged instead of asserting. The F32 versions process
+4 vectors at a time with SSE when E_SIMD_SSE is defined and MinMax reduces 8 values per iteration.
+3. Cross and Dot streams must have the same size. The Cross result stream may be one of the source streams.
+4. Resize does not keep the stream content.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class Vector3Stream
+{
+public:
+  Vector3Stream();
+  explicit Vector3Stream(size_t size);
+  Vector3Stream(const Vector3<T>* pSource, size_t count);
+
+  // Accessors
+  Vector3<T>    Get(size_t index) const;
+  void          GetLengths(T* pResults) const;
+  void          GetLengthsSquared(T* pResults) const;
+  size_t        GetSize() const { return mLanes.GetSize(); }
+  T*            GetX() { return mLanes.GetLane(0); }
+  const T*      GetX() const { return mLanes.GetLane(0); }
+  T*            GetY() { return mLanes.GetLane(1); }
+  const T*      GetY() const { return mLanes.GetLane(1); }
+  T*            GetZ() { return mLanes.GetLane(2); }
+  const T*      GetZ() const { return mLanes.GetLane(2); }
+  bool          IsEmpty() const { return mLanes.GetSize() == 0; }
+  void          MinMax(Vector3<T>& min, Vector3<T>& max) const;
+  void          Set(size_t index, const Vector3<T>& v);
+
+  // Methods
+  void          Copy(const Vector3<T>* pSource, size_t count);
+  void          CopyTo(Vector3<T>* pTarget) const;
+  void          Normalize();
+  void          Resize(size_t size) { mLanes.Resize(size); }
+
+  static void   Cross(Vector3Stream& result, const Vector3Stream& a, const Vector3Stream& b);
+  static void   Dot(T* pResults, const Vector3Stream& a, const Vector3Stream& b);
+
+private:
+  StreamLanes<T, 3> mLanes;
+
+  // Relying on StreamLanes copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4Stream
+
+Please note that this class has the following usage contract: 
+
+1. Floating point types are expected to be used with this class: F32, D64.
+2. Kernels give the same results as the per element scalar Vector4 methods (Dot, GetLength, GetLengthSquared and 
+Normalize) except that Normalize leaves zero length vectors unchanged instead of asserting. The SSE versions of the 
+Vector4<F32> methods may differ in the last bits (see Vector4). The F32 versions process 4 vectors at a time with SSE 
+when E_SIMD_SSE is defined and MinMax reduces 8 values per iteration.
+3. Dot streams must have the same size.
+4. Resize does not keep the stream content.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T>
+class Vector4Stream
+{
+public:
+  Vector4Stream();
+  explicit Vector4Stream(size_t size);
+  Vector4Stream(const Vector4<T>* pSource, size_t count);
+
+  // Accessors
+  Vector4<T>    Get(size_t index) const;
+  void          GetLengths(T* pResults) const;
+  void          GetLengthsSquared(T* pResults) const;
+  size_t        GetSize() const { return mLanes.GetSize(); }
+  T*            GetW() { return mLanes.GetLane(3); }
+  const T*      GetW() const { return mLanes.GetLane(3); }
+  T*            GetX() { return mLanes.GetLane(0); }
+  const T*      GetX() const { return mLanes.GetLane(0); }
+  T*            GetY() { return mLanes.GetLane(1); }
+  const T*      GetY() const { return mLanes.GetLane(1); }
+  T*            GetZ() { return mLanes.GetLane(2); }
+  const T*      GetZ() const { return mLanes.GetLane(2); }
+  bool          IsEmpty() const { return mLanes.GetSize() == 0; }
+  void          MinMax(Vector4<T>& min, Vector4<T>& max) const;
+  void          Set(size_t index, const Vector4<T>& v);
+
+  // Methods
+  void          Copy(const Vector4<T>* pSource, size_t count);
+  void          CopyTo(Vector4<T>* pTarget) const;
+  void          Normalize();
+  void          Resize(size_t size) { mLanes.Resize(size); }
+
+  static void   Dot(T* pResults, const Vector4Stream& a, const Vector4Stream& b);
+
+private:
+  StreamLanes<T, 4> mLanes;
+
+  // Relying on StreamLanes copy constructor and assignment operator
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+StreamLanes initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t laneCount>
+inline StreamLanes<T, laneCount>::StreamLanes()
+  : mpBuffer(nullptr)
+  , mSize(0)
+  , mCapacity(0)
+{
+  for (size_t i = 0; i < laneCount; ++i) mpLanes[i] = nullptr;
+}
+
+template <typename T, size_t laneCount>
+inline StreamLanes<T, laneCount>::StreamLanes(const StreamLanes& other)
+  : mpBuffer(nullptr)
+  , mSize(0)
+  , mCapacity(0)
+{
+  for (size_t i = 0; i < laneCount; ++i) mpLanes[i] = nullptr;
+  *this = other;
+}
+
+template <typename T, size_t laneCount>
+inline StreamLanes<T, laneCount>::~StreamLanes()
+{
+  Resize(0);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+StreamLanes operators
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, size_t laneCount>
+inline StreamLanes<T, laneCount>& StreamLanes<T, laneCount>::operator=(const StreamLanes& other)
+{
+  if (this != &other)
+  {
+    Resize(other.mSize);
+    for (size_t i = 0; i < laneCount; ++i) Memory::Copy(mpLanes[i], other.mpLanes[i], mSize);
+  }
+  return *this;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+StreamLanes methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Resize(0) releases the memory.
+template <typename T, size_t laneCount>
+inline void StreamLanes<T, laneCount>::Resize(size_t size)
+{
+  if (size == 0 || size > mCapacity)
+  {
+    if (mpBuffer != nullptr) Memory::Destroy(mpBuffer, mCapacity * sizeof(T) * laneCount + kAlignment);
+    mpBuffer = nullptr;
+    mCapacity = 0;
+    for (size_t i = 0; i < laneCount; ++i) mpLanes[i] = nullptr;
+    if (size > 0)
+    {
+      mCapacity = (size + kGranularity - 1) & ~(kGranularity - 1);
+      const size_t bufferSize = mCapacity * sizeof(T) * laneCount + kAlignment;
+      mpBuffer = Memory::Create<U8>(bufferSize);
+      Memory::Zero(mpBuffer, bufferSize);
+      size_t address = (reinterpret_cast<size_t>(mpBuffer) + kAlignment - 1) & ~(kAlignment - 1);
+      for (size_t i = 0; i < laneCount; ++i) mpLanes[i] = reinterpret_cast<T*>(address) + i * mCapacity;
+    }
+  }
+  mSize = size;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector3Stream initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Vector3Stream<T>::Vector3Stream()
+{
+}
+
+template <typename T>
+inline Vector3Stream<T>::Vector3Stream(size_t size)
+{
+  mLanes.Resize(size);
+}
+
+template <typename T>
+inline Vector3Stream<T>::Vector3Stream(const Vector3<T>* pSource, size_t count)
+{
+  Copy(pSource, count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector3Stream accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Vector3<T> Vector3Stream<T>::Get(size_t index) const
+{
+  E_ASSERT_MSG(index < GetSize(), E_ASSERT_MSG_VECTOR_STREAM_INDEX_VALUE, index, GetSize());
+  return Vector3<T>(GetX()[index], GetY()[index], GetZ()[index]);
+}
+
+template <typename T>
+inline void Vector3Stream<T>::GetLengths(T* pResults) const
+{
+  const T* pX = GetX();
+  const T* pY = GetY();
+  const T* pZ = GetZ();
+  for (size_t i = 0; i < GetSize(); ++i) pResults[i] = Math::Sqrt(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i]);
+}
+
+template <typename T>
+inline void Vector3Stream<T>::GetLengthsSquared(T* pResults) const
+{
+  const T* pX = GetX();
+  const T* pY = GetY();
+  const T* pZ = GetZ();
+  for (size_t i = 0; i < GetSize(); ++i) pResults[i] = pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i];
+}
+
+template <typename T>
+inline void Vector3Stream<T>::MinMax(Vector3<T>& min, Vector3<T>& max) const
+{
+  E_ASSERT_MSG(GetSize() > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
+  for (size_t lane = 0; lane < 3; ++lane)
+  {
+    const T* pLane = mLanes.GetLane(lane);
+    min[lane] = max[lane] = pLane[0];
+    for (size_t i = 1; i < GetSize(); ++i)
+    {
+      if (pLane[i] > max[lane]) max[lane] = pLane[i];
+      if (pLane[i] < min[lane]) min[lane] = pLane[i];
+    }
+  }
+}
+
+template <typename T>
+inline void Vector3Stream<T>::Set(size_t index, const Vector3<T>& v)
+{
+  E_ASSERT_MSG(index < GetSize(), E_ASSERT_MSG_VECTOR_STREAM_INDEX_VALUE, index, GetSize());
+  GetX()[index] = v.x;
+  GetY()[index] = v.y;
+  GetZ()[index] = v.z;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector3Stream methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void Vector3Stream<T>::Copy(const Vector3<T>* pSource, size_t count)
+{
+  mLanes.Resize(count);
+  T* pX = GetX();
+  T* pY = GetY();
+  T* pZ = GetZ();
+  for (size_t i = 0; i < count; ++i)
+  {
+    pX[i] = pSource[i].x;
+    pY[i] = pSource[i].y;
+    pZ[i] = pSource[i].z;
+  }
+}
+
+template <typename T>
+inline void Vector3Stream<T>::CopyTo(Vector3<T>* pTarget) const
+{
+  const T* pX = GetX();
+  const T* pY = GetY();
+  const T* pZ = GetZ();
+  for (size_t i = 0; i < GetSize(); ++i) pTarget[i] = Vector3<T>(pX[i], pY[i], pZ[i]);
+}
+
+template <typename T>
+inline void Vector3Stream<T>::Normalize()
+{
+  T* pX = GetX();
+  T* pY = GetY();
+  T* pZ = GetZ();
+  for (size_t i = 0; i < GetSize(); ++i)
+  {
+    T length = Math::Sqrt(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i]);
+    if (IsEqual(length, static_cast<T>(0)) || IsEqual(length, static_cast<T>(1))) continue;
+    T invLength = static_cast<T>(1) / length;
+    pX[i] *= invLength;
+    pY[i] *= invLength;
+    pZ[i] *= invLength;
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector3Stream static methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void Vector3Stream<T>::Cross(Vector3Stream& result, const Vector3Stream& a, const Vector3Stream& b)
+{
+  E_ASSERT_MSG(a.GetSize() == b.GetSize(), E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE, b.GetSize(), a.GetSize());
+  if (&result != &a && &result != &b) result.Resize(a.GetSize());
+  for (size_t i = 0; i < a.GetSize(); ++i)
+  {
+    result.Set(i, Vector3<T>::Cross(a.Get(i), b.Get(i)));
+  }
+}
+
+template <typename T>
+inline void Vector3Stream<T>::Dot(T* pResults, const Vector3Stream& a, const Vector3Stream& b)
+{
+  E_ASSERT_MSG(a.GetSize() == b.GetSize(), E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE, b.GetSize(), a.GetSize());
+  const T* pAX = a.GetX();
+  const T* pAY = a.GetY();
+  const T* pAZ = a.GetZ();
+  const T* pBX = b.GetX();
+  const T* pBY = b.GetY();
+  const T* pBZ = b.GetZ();
+  for (size_t i = 0; i < a.GetSize(); ++i) pResults[i] = pAX[i] * pBX[i] + pAY[i] * pBY[i] + pAZ[i] * pBZ[i];
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4Stream initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Vector4Stream<T>::Vector4Stream()
+{
+}
+
+template <typename T>
+inline Vector4Stream<T>::Vector4Stream(size_t size)
+{
+  mLanes.Resize(size);
+}
+
+template <typename T>
+inline Vector4Stream<T>::Vector4Stream(const Vector4<T>* pSource, size_t count)
+{
+  Copy(pSource, count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4Stream accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline Vector4<T> Vector4Stream<T>::Get(size_t index) const
+{
+  E_ASSERT_MSG(index < GetSize(), E_ASSERT_MSG_VECTOR_STREAM_INDEX_VALUE, index, GetSize());
+  return Vector4<T>(GetX()[index], GetY()[index], GetZ()[index], GetW()[index]);
+}
+
+template <typename T>
+inline void Vector4Stream<T>::GetLengths(T* pResults) const
+{
+  const T* pX = GetX();
+  const T* pY = GetY();
+  const T* pZ = GetZ();
+  const T* pW = GetW();
+  for (size_t i = 0; i < GetSize(); ++i)
+  {
+    pResults[i] = Math::Sqrt(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i] + pW[i] * pW[i]);
+  }
+}
+
+template <typename T>
+inline void Vector4Stream<T>::GetLengthsSquared(T* pResults) const
+{
+  const T* pX = GetX();
+  const T* pY = GetY();
+  const T* pZ = GetZ();
+  const T* pW = GetW();
+  for (size_t i = 0; i < GetSize(); ++i) pResults[i] = pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i] + pW[i] * pW[i];
+}
+
+template <typename T>
+inline void Vector4Stream<T>::MinMax(Vector4<T>& min, Vector4<T>& max) const
+{
+  E_ASSERT_MSG(GetSize() > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
+  for (size_t lane = 0; lane < 4; ++lane)
+  {
+    const T* pLane = mLanes.GetLane(lane);
+    min[lane] = max[lane] = pLane[0];
+    for (size_t i = 1; i < GetSize(); ++i)
+    {
+      if (pLane[i] > max[lane]) max[lane] = pLane[i];
+      if (pLane[i] < min[lane]) min[lane] = pLane[i];
+    }
+  }
+}
+
+template <typename T>
+inline void Vector4Stream<T>::Set(size_t index, const Vector4<T>& v)
+{
+  E_ASSERT_MSG(index < GetSize(), E_ASSERT_MSG_VECTOR_STREAM_INDEX_VALUE, index, GetSize());
+  GetX()[index] = v.x;
+  GetY()[index] = v.y;
+  GetZ()[index] = v.z;
+  GetW()[index] = v.w;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4Stream methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void Vector4Stream<T>::Copy(const Vector4<T>* pSource, size_t count)
+{
+  mLanes.Resize(count);
+  for (size_t i = 0; i < count; ++i) 
+  {
+    GetX()[i] = pSource[i].x;
+    GetY()[i] = pSource[i].y;
+    GetZ()[i] = pSource[i].z;
+    GetW()[i] = pSource[i].w;
+  }
+}
+
+template <typename T>
+inline void Vector4Stream<T>::CopyTo(Vector4<T>* pTarget) const
+{
+  for (size_t i = 0; i < GetSize(); ++i) pTarget[i] = Get(i);
+}
+
+template <typename T>
+inline void Vector4Stream<T>::Normalize()
+{
+  T* pX = GetX();
+  T* pY = GetY();
+  T* pZ = GetZ();
+  T* pW = GetW();
+  for (size_t i = 0; i < GetSize(); ++i)
+  {
+    T length = Math::Sqrt(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i] + pW[i] * pW[i]);
+    if (IsEqual(length, static_cast<T>(0)) || IsEqual(length, static_cast<T>(1))) continue;
+    T invLength = static_cast<T>(1) / length;
+    pX[i] *= invLength;
+    pY[i] *= invLength;
+    pZ[i] *= invLength;
+    pW[i] *= invLength;
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Vector4Stream static methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T>
+inline void Vector4Stream<T>::Dot(T* pResults, const Vector4Stream& a, const Vector4Stream& b)
+{
+  E_ASSERT_MSG(a.GetSize() == b.GetSize(), E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE, b.GetSize(), a.GetSize());
+  const T* pAX = a.GetX();
+  const T* pAY = a.GetY();
+  const T* pAZ = a.GetZ();
+  const T* pAW = a.GetW();
+  const T* pBX = b.GetX();
+  const T* pBY = b.GetY();
+  const T* pBZ = b.GetZ();
+  const T* pBW = b.GetW();
+  for (size_t i = 0; i < a.GetSize(); ++i)
+  {
+    pResults[i] = pAX[i] * pBX[i] + pAY[i] * pBY[i] + pAZ[i] * pBZ[i] + pAW[i] * pBW[i];
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VectorStream F32 specializations (SSE)
+
+Lane capacities are multiples of 8 elements, so the kernels writing to stream lanes (Normalize, Cross) process the 
+last partial group of 4 with SIMD too. Kernels writing to external arrays process the remainder with scalar code.
+----------------------------------------------------------------------------------------------------------------------*/
+#ifdef E_SIMD_SSE
+template <>
+inline void Vector3Stream<F32>::GetLengths(F32* pResults) const
+{
+  const F32* pX = GetX();
+  const F32* pY = GetY();
+  const F32* pZ = GetZ();
+  size_t i = 0;
+  for (; i + 4 <= GetSize(); i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pX + i);
+    Simd::F32x4 y = Simd::Load(pY + i);
+    Simd::F32x4 z = Simd::Load(pZ + i);
+    Simd::Store(pResults + i, Simd::Sqrt(Simd::MulAdd(z, z, Simd::MulAdd(y, y, Simd::Mul(x, x)))));
+  }
+  for (; i < GetSize(); ++i) pResults[i] = Math::Sqrt(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i]);
+}
+
+template <>
+inline void Vector3Stream<F32>::GetLengthsSquared(F32* pResults) const
+{
+  const F32* pX = GetX();
+  const F32* pY = GetY();
+  const F32* pZ = GetZ();
+  size_t i = 0;
+  for (; i + 4 <= GetSize(); i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pX + i);
+    Simd::F32x4 y = Simd::Load(pY + i);
+    Simd::F32x4 z = Simd::Load(pZ + i);
+    Simd::Store(pResults + i, Simd::MulAdd(z, z, Simd::MulAdd(y, y, Simd::Mul(x, x))));
+  }
+  for (; i < GetSize(); ++i) pResults[i] = pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i];
+}
+
+template <>
+inline void Vector3Stream<F32>::MinMax(Vector3<F32>& min, Vector3<F32>& max) const
+{
+  E_ASSERT_MSG(GetSize() > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
+  Simd::MinMax(GetX(), GetSize(), min.x, max.x);
+  Simd::MinMax(GetY(), GetSize(), min.y, max.y);
+  Simd::MinMax(GetZ(), GetSize(), min.z, max.z);
+}
+
+template <>
+inline void Vector3Stream<F32>::Copy(const Vector3<F32>* pSource, size_t count)
+{
+  mLanes.Resize(count);
+  F32* pX = GetX();
+  F32* pY = GetY();
+  F32* pZ = GetZ();
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    Simd::F32x4 x, y, z;
+    Simd::LoadXyz4(&pSource[i].x, x, y, z);
+    Simd::Store(pX + i, x);
+    Simd::Store(pY + i, y);
+    Simd::Store(pZ + i, z);
+  }
+  for (; i < count; ++i)
+  {
+    pX[i] = pSource[i].x;
+    pY[i] = pSource[i].y;
+    pZ[i] = pSource[i].z;
+  }
+}
+
+template <>
+inline void Vector3Stream<F32>::CopyTo(Vector3<F32>* pTarget) const
+{
+  const F32* pX = GetX();
+  const F32* pY = GetY();
+  const F32* pZ = GetZ();
+  size_t i = 0;
+  for (; i + 4 <= GetSize(); i += 4)
+  {
+    Simd::StoreXyz4(&pTarget[i].x, Simd::Load(pX + i), Simd::Load(pY + i), Simd::Load(pZ + i));
+  }
+  for (; i < GetSize(); ++i) pTarget[i] = Vector3<F32>(pX[i], pY[i], pZ[i]);
+}
+
+template <>
+inline void Vector3Stream<F32>::Normalize()
+{
+  F32* pX = GetX();
+  F32* pY = GetY();
+  F32* pZ = GetZ();
+  Simd::F32x4 one = Simd::Splat(1.0f);
+  Simd::F32x4 epsilon = Simd::Splat(Epsilon<F32>::Get());
+  for (size_t i = 0; i < GetSize(); i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pX + i);
+    Simd::F32x4 y = Simd::Load(pY + i);
+    Simd::F32x4 z = Simd::Load(pZ + i);
+    Simd::F32x4 length = Simd::Sqrt(Simd::MulAdd(z, z, Simd::MulAdd(y, y, Simd::Mul(x, x))));
+    // Zero and unit length vectors are left unchanged
+    Simd::F32x4 invLength = Simd::Div(one, Simd::Select(Simd::LessEqual(Simd::Abs(length), epsilon), one, length));
+    invLength = Simd::Select(Simd::LessEqual(Simd::Abs(Simd::Sub(length, one)), epsilon), one, invLength);
+    Simd::Store(pX + i, Simd::Mul(x, invLength));
+    Simd::Store(pY + i, Simd::Mul(y, invLength));
+    Simd::Store(pZ + i, Simd::Mul(z, invLength));
+  }
+}
+
+template <>
+inline void Vector3Stream<F32>::Cross(Vector3Stream& result, const Vector3Stream& a, const Vector3Stream& b)
+{
+  E_ASSERT_MSG(a.GetSize() == b.GetSize(), E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE, b.GetSize(), a.GetSize());
+  if (&result != &a && &result != &b) result.Resize(a.GetSize());
+  for (size_t i = 0; i < a.GetSize(); i += 4)
+  {
+    Simd::F32x4 ax = Simd::Load(a.GetX() + i);
+    Simd::F32x4 ay = Simd::Load(a.GetY() + i);
+    Simd::F32x4 az = Simd::Load(a.GetZ() + i);
+    Simd::F32x4 bx = Simd::Load(b.GetX() + i);
+    Simd::F32x4 by = Simd::Load(b.GetY() + i);
+    Simd::F32x4 bz = Simd::Load(b.GetZ() + i);
+    Simd::Store(result.GetX() + i, Simd::Sub(Simd::Mul(ay, bz), Simd::Mul(az, by)));
+    Simd::Store(result.GetY() + i, Simd::Sub(Simd::Mul(az, bx), Simd::Mul(ax, bz)));
+    Simd::Store(result.GetZ() + i, Simd::Sub(Simd::Mul(ax, by), Simd::Mul(ay, bx)));
+  }
+}
+
+template <>
+inline void Vector3Stream<F32>::Dot(F32* pResults, const Vector3Stream& a, const Vector3Stream& b)
+{
+  E_ASSERT_MSG(a.GetSize() == b.GetSize(), E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE, b.GetSize(), a.GetSize());
+  const F32* pAX = a.GetX();
+  const F32* pAY = a.GetY();
+  const F32* pAZ = a.GetZ();
+  const F32* pBX = b.GetX();
+  const F32* pBY = b.GetY();
+  const F32* pBZ = b.GetZ();
+  size_t i = 0;
+  for (; i + 4 <= a.GetSize(); i += 4)
+  {
+    Simd::F32x4 result = Simd::Mul(Simd::Load(pAX + i), Simd::Load(pBX + i));
+    result = Simd::MulAdd(Simd::Load(pAY + i), Simd::Load(pBY + i), result);
+    Simd::Store(pResults + i, Simd::MulAdd(Simd::Load(pAZ + i), Simd::Load(pBZ + i), result));
+  }
+  for (; i < a.GetSize(); ++i) pResults[i] = pAX[i] * pBX[i] + pAY[i] * pBY[i] + pAZ[i] * pBZ[i];
+}
+
+template <>
+inline void Vector4Stream<F32>::GetLengths(F32* pResults) const
+{
+  const F32* pX = GetX();
+  const F32* pY = GetY();
+  const F32* pZ = GetZ();
+  const F32* pW = GetW();
+  size_t i = 0;
+  for (; i + 4 <= GetSize(); i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pX + i);
+    Simd::F32x4 y = Simd::Load(pY + i);
+    Simd::F32x4 z = Simd::Load(pZ + i);
+    Simd::F32x4 w = Simd::Load(pW + i);
+    Simd::Store(pResults + i, Simd::Sqrt(Simd::MulAdd(w, w, Simd::MulAdd(z, z, Simd::MulAdd(y, y, Simd::Mul(x, x))))));
+  }
+  for (; i < GetSize(); ++i)
+  {
+    pResults[i] = Math::Sqrt(pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i] + pW[i] * pW[i]);
+  }
+}
+
+template <>
+inline void Vector4Stream<F32>::GetLengthsSquared(F32* pResults) const
+{
+  const F32* pX = GetX();
+  const F32* pY = GetY();
+  const F32* pZ = GetZ();
+  const F32* pW = GetW();
+  size_t i = 0;
+  for (; i + 4 <= GetSize(); i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pX + i);
+    Simd::F32x4 y = Simd::Load(pY + i);
+    Simd::F32x4 z = Simd::Load(pZ + i);
+    Simd::F32x4 w = Simd::Load(pW + i);
+    Simd::Store(pResults + i, Simd::MulAdd(w, w, Simd::MulAdd(z, z, Simd::MulAdd(y, y, Simd::Mul(x, x)))));
+  }
+  for (; i < GetSize(); ++i) pResults[i] = pX[i] * pX[i] + pY[i] * pY[i] + pZ[i] * pZ[i] + pW[i] * pW[i];
+}
+
+template <>
+inline void Vector4Stream<F32>::MinMax(Vector4<F32>& min, Vector4<F32>& max) const
+{
+  E_ASSERT_MSG(GetSize() > 0, E_ASSERT_MSG_MATH_GREATER_THAN_ZERO_VALUE);
+  Simd::MinMax(GetX(), GetSize(), min.x, max.x);
+  Simd::MinMax(GetY(), GetSize(), min.y, max.y);
+  Simd::MinMax(GetZ(), GetSize(), min.z, max.z);
+  Simd::MinMax(GetW(), GetSize(), min.w, max.w);
+}
+
+template <>
+inline void Vector4Stream<F32>::Copy(const Vector4<F32>* pSource, size_t count)
+{
+  mLanes.Resize(count);
+  F32* pX = GetX();
+  F32* pY = GetY();
+  F32* pZ = GetZ();
+  F32* pW = GetW();
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(&pSource[i].x);
+    Simd::F32x4 y = Simd::Load(&pSource[i + 1].x);
+    Simd::F32x4 z = Simd::Load(&pSource[i + 2].x);
+    Simd::F32x4 w = Simd::Load(&pSource[i + 3].x);
+    Simd::Transpose(x, y, z, w);
+    Simd::Store(pX + i, x);
+    Simd::Store(pY + i, y);
+    Simd::Store(pZ + i, z);
+    Simd::Store(pW + i, w);
+  }
+  for (; i < count; ++i)
+  {
+    pX[i] = pSource[i].x;
+    pY[i] = pSource[i].y;
+    pZ[i] = pSource[i].z;
+    pW[i] = pSource[i].w;
+  }
+}
+
+template <>
+inline void Vector4Stream<F32>::CopyTo(Vector4<F32>* pTarget) const
+{
+  const F32* pX = GetX();
+  const F32* pY = GetY();
+  const F32* pZ = GetZ();
+  const F32* pW = GetW();
+  size_t i = 0;
+  for (; i + 4 <= GetSize(); i += 4)
+  {
+    Simd::F32x4 v0 = Simd::Load(pX + i);
+    Simd::F32x4 v1 = Simd::Load(pY + i);
+    Simd::F32x4 v2 = Simd::Load(pZ + i);
+    Simd::F32x4 v3 = Simd::Load(pW + i);
+    Simd::Transpose(v0, v1, v2, v3);
+    Simd::Store(&pTarget[i].x, v0);
+    Simd::Store(&pTarget[i + 1].x, v1);
+    Simd::Store(&pTarget[i + 2].x, v2);
+    Simd::Store(&pTarget[i + 3].x, v3);
+  }
+  for (; i < GetSize(); ++i) pTarget[i] = Vector4<F32>(pX[i], pY[i], pZ[i], pW[i]);
+}
+
+template <>
+inline void Vector4Stream<F32>::Normalize()
+{
+  F32* pX = GetX();
+  F32* pY = GetY();
+  F32* pZ = GetZ();
+  F32* pW = GetW();
+  Simd::F32x4 one = Simd::Splat(1.0f);
+  Simd::F32x4 epsilon = Simd::Splat(Epsilon<F32>::Get());
+  for (size_t i = 0; i < GetSize(); i += 4)
+  {
+    Simd::F32x4 x = Simd::Load(pX + i);
+    Simd::F32x4 y = Simd::Load(pY + i);
+    Simd::F32x4 z = Simd::Load(pZ + i);
+    Simd::F32x4 w = Simd::Load(pW + i);
+    Simd::F32x4 length = Simd::Sqrt(Simd::MulAdd(w, w, Simd::MulAdd(z, z, Simd::MulAdd(y, y, Simd::Mul(x, x)))));
+    // Zero and unit length vectors are left unchanged
+    Simd::F32x4 invLength = Simd::Div(one, Simd::Select(Simd::LessEqual(Simd::Abs(length), epsilon), one, length));
+    invLength = Simd::Select(Simd::LessEqual(Simd::Abs(Simd::Sub(length, one)), epsilon), one, invLength);
+    Simd::Store(pX + i, Simd::Mul(x, invLength));
+    Simd::Store(pY + i, Simd::Mul(y, invLength));
+    Simd::Store(pZ + i, Simd::Mul(z, invLength));
+    Simd::Store(pW + i, Simd::Mul(w, invLength));
+  }
+}
+
+template <>
+inline void Vector4Stream<F32>::Dot(F32* pResults, const Vector4Stream& a, const Vector4Stream& b)
+{
+  E_ASSERT_MSG(a.GetSize() == b.GetSize(), E_ASSERT_MSG_VECTOR_STREAM_SIZE_VALUE, b.GetSize(), a.GetSize());
+  const F32* pAX = a.GetX();
+  const F32* pAY = a.GetY();
+  const F32* pAZ = a.GetZ();
+  const F32* pAW = a.GetW();
+  const F32* pBX = b.GetX();
+  const F32* pBY = b.GetY();
+  const F32* pBZ = b.GetZ();
+  const F32* pBW = b.GetW();
+  size_t i = 0;
+  for (; i + 4 <= a.GetSize(); i += 4)
+  {
+    Simd::F32x4 result = Simd::Mul(Simd::Load(pAX + i), Simd::Load(pBX + i));
+    result = Simd::MulAdd(Simd::Load(pAY + i), Simd::Load(pBY + i), result);
+    result = Simd::MulAdd(Simd::Load(pAZ + i), Simd::Load(pBZ + i), result);
+    Simd::Store(pResults + i, Simd::MulAdd(Simd::Load(pAW + i), Simd::Load(pBW + i), result));
+  }
+  for (; i < a.GetSize(); ++i)
+  {
+    pResults[i] = pAX[i] * pBX[i] + pAY[i] * pBY[i] + pAZ[i] * pBZ[i] + pAW[i] * pBW[i];
+  }
+}
+#endif
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+VectorStream types
+----------------------------------------------------------------------------------------------------------------------*/
+typedef Math::Vector3Stream<F32> Vector3Streamf;
+typedef Math::Vector3Stream<D64> Vector3Streamd;
+typedef Math::Vector4Stream<F32> Vector4Streamf;
+typedef Math::Vector4Stream<D64> Vector4Streamd;
+}
+
+#endif
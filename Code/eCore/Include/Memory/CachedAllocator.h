@@ -0,0 +1,242 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file CachedAllocator.h
+This file defines the CachedAllocator class. CachedAllocator implements a general purpose allocator based on size class
+pools and per thread block caches.
+*/
+
+#ifndef E3_CACHED_ALLOCATOR_H
+#define E3_CACHED_ALLOCATOR_H
+
+#include "PoolAllocator.h"
+#include <Threads/ThreadLocal.h>
+
+namespace E
+{
+namespace Memory
+{
+/*----------------------------------------------------------------------------------------------------------------------
+CachedAllocator
+
+Please note that this class has the following usage contract:
+
+1. CachedAllocator is thread-safe. Each thread caches up to kMaxCachedBlockCount free blocks per size class so most
+Allocate / Deallocate calls neither lock nor reach the heap. Blocks move between the thread caches and the shared size
+class pools in batches of kBatchBlockCount.
+2. Size classes range from 32 to 4096 bytes (powers of 2) including a 16 byte block header. Bigger allocations are
+forwarded to the parent allocator (global allocator by default).
+3. Since IAllocator::Deallocate does not supply the allocation size, the block header stores the block size class.
+Allocations are 16 byte aligned (as long as the parent allocator is).
+4. Memory can be deallocated from any thread. Flush returns the calling thread cached blocks to the size class pools
+(e.g. before a worker thread ends).
+5. Thread caches and pool pages are only released on destruction. SetParentAllocator MUST be called before any
+allocation.
+----------------------------------------------------------------------------------------------------------------------*/
+class CachedAllocator : public IAllocator
+{
+public:
+  static const U32 kBatchBlockCount = 32;
+  static const U32 kMaxCachedBlockCount = 64;
+
+  CachedAllocator();
+  ~CachedAllocator();
+
+  // Accessors
+  IAllocator*       GetParentAllocator() const;
+  void              SetParentAllocator(IAllocator* p);
+
+  // Methods
+  void*             Allocate(size_t size, const Tag tag = IAllocator::eTagNew);
+  void              Deallocate(void* p, const Tag tag = IAllocator::eTagDelete);
+  void              Flush();
+
+private:
+  static const U32 kSizeClassCount = 8;
+  static const U32 kMinBlockSize = 32;
+  static const U32 kMaxBlockSize = kMinBlockSize << (kSizeClassCount - 1);
+  static const U32 kHeaderSize = 16;
+  static const U32 kLargeSizeClass = 0xffffffff;
+
+  struct Header
+  {
+    U32             sizeClass;
+  };
+
+  struct ThreadCache
+  {
+    ThreadCache*    pNext;
+    void*           pBlockLists[kSizeClassCount];
+    U32             blockCounts[kSizeClassCount];
+  };
+
+  PoolAllocator     mPools[kSizeClassCount];
+  Threads::ThreadLocal mThreadCache;
+  Threads::Mutex    mMutex;
+  ThreadCache*      mpThreadCacheList;
+  IAllocator*       mpParentAllocator;
+
+  void              FlushBlocks(ThreadCache* pCache, U32 sizeClass, U32 count);
+  ThreadCache*      GetThreadCache();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(CachedAllocator)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+CachedAllocator initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline CachedAllocator::CachedAllocator()
+  : mpThreadCacheList(nullptr)
+  , mpParentAllocator(Global::GetAllocator())
+{
+  for (U32 i = 0; i < kSizeClassCount; ++i) mPools[i].SetBlockSize(kMinBlockSize << i);
+}
+
+inline CachedAllocator::~CachedAllocator()
+{
+  // Pool pages are released by the pools themselves
+  while (mpThreadCacheList)
+  {
+    ThreadCache* pCache = mpThreadCacheList;
+    mpThreadCacheList = pCache->pNext;
+    mpParentAllocator->Deallocate(pCache, IAllocator::eTagDelete);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+CachedAllocator accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline IAllocator* CachedAllocator::GetParentAllocator() const
+{
+  return mpParentAllocator;
+}
+
+inline void CachedAllocator::SetParentAllocator(IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  for (U32 i = 0; i < kSizeClassCount; ++i) mPools[i].SetParentAllocator(p);
+  mpParentAllocator = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+CachedAllocator methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void* CachedAllocator::Allocate(size_t size, const Tag tag)
+{
+  size_t totalSize = size + kHeaderSize;
+  if (totalSize > kMaxBlockSize)
+  {
+    U8* pMemory = static_cast<U8*>(mpParentAllocator->Allocate(totalSize, tag));
+    if (pMemory == nullptr) return nullptr;
+    reinterpret_cast<Header*>(pMemory)->sizeClass = kLargeSizeClass;
+    return pMemory + kHeaderSize;
+  }
+
+  U32 sizeClass = 0;
+  while ((static_cast<size_t>(kMinBlockSize) << sizeClass) < totalSize) ++sizeClass;
+
+  ThreadCache* pCache = GetThreadCache();
+  if (pCache->pBlockLists[sizeClass] == nullptr)
+  {
+    pCache->pBlockLists[sizeClass] = mPools[sizeClass].AllocateList(kBatchBlockCount);
+    pCache->blockCounts[sizeClass] = kBatchBlockCount;
+  }
+  void* pBlock = pCache->pBlockLists[sizeClass];
+  pCache->pBlockLists[sizeClass] = *static_cast<void**>(pBlock);
+  --pCache->blockCounts[sizeClass];
+
+  reinterpret_cast<Header*>(pBlock)->sizeClass = sizeClass;
+  return static_cast<U8*>(pBlock) + kHeaderSize;
+}
+
+inline void CachedAllocator::Deallocate(void* p, const Tag tag)
+{
+  if (p == nullptr) return;
+  U8* pBlock = static_cast<U8*>(p) - kHeaderSize;
+  U32 sizeClass = reinterpret_cast<Header*>(pBlock)->sizeClass;
+  if (sizeClass == kLargeSizeClass)
+  {
+    mpParentAllocator->Deallocate(pBlock, tag);
+    return;
+  }
+
+  ThreadCache* pCache = GetThreadCache();
+  *reinterpret_cast<void**>(pBlock) = pCache->pBlockLists[sizeClass];
+  pCache->pBlockLists[sizeClass] = pBlock;
+  if (++pCache->blockCounts[sizeClass] > kMaxCachedBlockCount) FlushBlocks(pCache, sizeClass, kBatchBlockCount);
+}
+
+/**
+Returns the calling thread cached blocks to the size class pools.
+@throw nothing.
+*/
+inline void CachedAllocator::Flush()
+{
+  ThreadCache* pCache = static_cast<ThreadCache*>(mThreadCache.Get());
+  if (pCache == nullptr) return;
+  for (U32 i = 0; i < kSizeClassCount; ++i) FlushBlocks(pCache, i, pCache->blockCounts[i]);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+CachedAllocator private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void CachedAllocator::FlushBlocks(ThreadCache* pCache, U32 sizeClass, U32 count)
+{
+  if (count == 0) return;
+  void* pFirst = pCache->pBlockLists[sizeClass];
+  void* pLast = pFirst;
+  for (U32 i = 1; i < count; ++i) pLast = *static_cast<void**>(pLast);
+  pCache->pBlockLists[sizeClass] = *static_cast<void**>(pLast);
+  pCache->blockCounts[sizeClass] -= count;
+  mPools[sizeClass].DeallocateList(pFirst, pLast, count);
+}
+
+inline CachedAllocator::ThreadCache* CachedAllocator::GetThreadCache()
+{
+  ThreadCache* pCache = static_cast<ThreadCache*>(mThreadCache.Get());
+  if (pCache) return pCache;
+
+  // First allocation from this thread
+  pCache = static_cast<ThreadCache*>(mpParentAllocator->Allocate(sizeof(ThreadCache), IAllocator::eTagNew));
+  for (U32 i = 0; i < kSizeClassCount; ++i)
+  {
+    pCache->pBlockLists[i] = nullptr;
+    pCache->blockCounts[i] = 0;
+  }
+  mThreadCache.Set(pCache);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  pCache->pNext = mpThreadCacheList;
+  mpThreadCacheList = pCache;
+  return pCache;
+}
+}
+}
+
+#endif
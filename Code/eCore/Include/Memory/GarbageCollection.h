@@ -32,14 +32,23 @@ The factory classes defined are:
   - GCUniquePtr: smart pointer holding a unique pointer of a heap allocated garbage collected object.
   - GCThisPtr: scoped smart pointer holding a unique pointer to a non-heap allocated garbage collected object.
   - GCWeakPtr: weak reference pointer to a GCUniquePtr.
+  - GCDeferredQueue: epoch tagged queue of collected objects pending destruction (deferred collection mode).
   - GCConcreteFactory: garbage collected version of ConcreteFactory.
   - GCGenericFactory: garbage collected version of GenericFactory.
+
+Both factories offer a locked mode (default) and a pooled mode (eGCFactoryModePooled) where counters and objects live in
+SlabPool blocks so that creation and collection from several threads do not serialize.
+
+Locked factories can also defer object destruction (eGCCollectionModeDeferred) to a safe point, where pending objects
+are destroyed in batches within a budget (see CollectGarbage).
 */
 
 #ifndef E3_GC_FACTORY_H
 #define E3_GC_FACTORY_H
 
 #include "Factory.h"
+#include "SlabPool.h"
+#include <Containers/Queue.h>
 #include <Threads/Atomic.h>
 #include <Threads/Lock.h>
 #include <SafeCast.h>
@@ -54,6 +63,36 @@ namespace E
 {
 namespace Memory
 {
+/*----------------------------------------------------------------------------------------------------------------------
+GCFactoryMode
+
+- eGCFactoryModeLocked: objects are allocated through the factory allocator and tracked in a live list, both protected
+by a mutex.
+- eGCFactoryModePooled: objects (GCConcreteFactory) and counters are allocated from SlabPool blocks, which also track
+the live objects, so Create and collection are lock-free (see the pooled GCConcreteFactory contract).
+----------------------------------------------------------------------------------------------------------------------*/
+enum GCFactoryMode
+{
+  eGCFactoryModeLocked,
+  eGCFactoryModePooled
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCCollectionMode
+
+- eGCCollectionModeImmediate: objects are destroyed as soon as their reference count reaches zero, by the thread which
+releases the last reference.
+- eGCCollectionModeDeferred: objects are queued when their reference count reaches zero and destroyed in batches by 
+CollectGarbage at a safe point (e.g. end of frame or a low priority ThreadPool task).
+
+Deferred collection is available in locked factories only (pooled factories recycle slots on collection).
+----------------------------------------------------------------------------------------------------------------------*/
+enum GCCollectionMode
+{
+  eGCCollectionModeImmediate,
+  eGCCollectionModeDeferred
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 IGarbageCollector
 
@@ -61,6 +100,9 @@ Please note that this macro has the following usage contract:
 
 1. Collect is called when the reference count of a used object reaches zero.
 2. Destroy is called to definitively destroy an object.
+3. A counter whose object has already been destroyed (detached counter, e.g. after a factory CleanUp) is deleted by its
+last reference unless it keeps its collector, in which case Collect is called with nullptr so that the collector can
+recycle the counter (pooled factories).
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
 class IGarbageCollector
@@ -233,19 +275,79 @@ private:
   template <typename U, typename CounterType>
   friend class GCWeakPtr;
 
+  // Allow pooled factories to reference their own counters
+  template <class U, GCFactoryMode Mode>
+  friend class GCConcreteFactory;
+  template <class U, typename IDType, GCFactoryMode Mode>
+  friend class GCGenericFactory;
+
   typedef GCCounter<T, CounterType> Counter;
 
   Counter*  mpCounter;
 
+  explicit  GCWeakPtr(Counter* pCounter);
   void      Swap(GCWeakPtr& other);
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
-GCConcreteFactory
+GCDeferredQueue
+
+Please note that this class has the following usage contract:
 
-This class is thread-safe.
+1. GCDeferredQueue holds collected objects (reference count reached zero) until they are destroyed at a safe point. 
+Each object is tagged with the epoch in which it was collected.
+2. AdvanceEpoch marks a safe point: Pop only returns objects collected in previous epochs, oldest first, so an object 
+is never destroyed in the same epoch its last reference was released.
+3. GCDeferredQueue is NOT thread-safe: factories protect it with their live list mutex.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <class T>
+class GCDeferredQueue
+{
+public:
+  static const size_t kUnlimitedBudget = static_cast<size_t>(-1);
+  static const size_t kBatchCount = 32;
+
+  GCDeferredQueue();
+
+  // Accessors
+  GCCollectionMode        GetCollectionMode() const;
+  U32                     GetEpoch() const;
+  size_t                  GetPendingCount() const;
+  void                    SetCollectionMode(GCCollectionMode mode);
+
+  // Methods
+  void                    AdvanceEpoch();
+  size_t                  Pop(T** ppBatch, size_t maxCount);
+  void                    Push(T* ptr);
+
+private:
+  struct PendingObject
+  {
+    T*                    ptr;
+    U32                   epoch;
+  };
+
+  Containers::Queue<PendingObject> mQueue;
+  GCCollectionMode        mCollectionMode;
+  U32                     mEpoch;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(GCDeferredQueue)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory
+
+Please note that this class has the following usage contract:
+
+1. This class is thread-safe.
+2. In deferred collection mode collected objects are destroyed by CollectGarbage, which destroys up to budget objects 
+collected before the last AdvanceEpoch call. Destruction happens on the calling thread, outside the live list critical
+section, in batches of GCDeferredQueue::kBatchCount objects.
+3. CleanUp and the destructor destroy every pending object regardless of its epoch.
+4. GetLiveCount returns the number of referenced objects, which excludes pending objects (see GetPendingCount). In 
+immediate collection mode it is the number of objects not yet destroyed.
+----------------------------------------------------------------------------------------------------------------------*/
+template <class T, GCFactoryMode Mode = eGCFactoryModeLocked>
 class GCConcreteFactory : public IGarbageCollector<T>
 {
 public:
@@ -256,10 +358,15 @@ public:
   ~GCConcreteFactory();
 
   const IAllocator*       GetAllocator() const;
+  GCCollectionMode        GetCollectionMode() const;
   size_t                  GetLiveCount() const;
+  size_t                  GetPendingCount() const;
   void                    SetAllocator(IAllocator* p);
+  void                    SetCollectionMode(GCCollectionMode mode);
 
+  void                    AdvanceEpoch();
   void                    CleanUp();
+  size_t                  CollectGarbage(size_t budget = GCDeferredQueue<T>::kUnlimitedBudget);
   Ref                     Create();
 
 private:
@@ -267,6 +374,7 @@ private:
 
   IAllocator*             mpAllocator;
   PtrList                 mLiveList;
+  GCDeferredQueue<T>      mDeferredQueue;
   mutable Threads::Mutex  mAllocatorMutex;
   mutable Threads::Mutex  mLiveListMutex;
   bool                    mCleaningUp;
@@ -277,12 +385,81 @@ private:
   E_DISABLE_COPY_AND_ASSSIGNMENT(GCConcreteFactory)
 };
 
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory (pooled)
+
+Please note that this class has the following usage contract:
+
+1. This class is thread-safe. Create and collection are lock-free except when the slab pool grows.
+2. Each object is constructed inside a SlabPool block next to its counter (a slot). The slot itself acts as the 
+counter collector, so collecting an object just destructs it and returns the slot to the calling thread cache.
+3. Live objects are tracked by the slab pool (no live list): GetLiveCount is exact only when no other thread is 
+creating or collecting objects.
+4. CleanUp destroys every live object and MUST NOT be called concurrently with Create. Slots still referenced after 
+CleanUp are detached (references compare equal to nullptr) and recycled when their last reference is released. CleanUp 
+may run while other threads release references: the slot state is claimed with a compare exchange, so each object is
+destroyed and each slot recycled exactly once.
+5. References MUST NOT outlive the factory, as slot memory is released on destruction.
+6. SetAllocator sets the slab parent allocator and MUST be called before the first Create. Flush returns the calling 
+thread cached slots (e.g. before a worker thread ends).
+----------------------------------------------------------------------------------------------------------------------*/
+template <class T>
+class GCConcreteFactory<T, eGCFactoryModePooled>
+{
+public:
+  typedef GCWeakPtr<T, A32> Ref;
+
+  GCConcreteFactory();
+  ~GCConcreteFactory();
+
+  const IAllocator*       GetAllocator() const;
+  size_t                  GetLiveCount() const;
+  void                    SetAllocator(IAllocator* p);
+
+  void                    CleanUp();
+  Ref                     Create();
+  void                    Flush();
+
+private:
+  typedef GCCounter<T, A32> Counter;
+
+  enum SlotState
+  {
+    eSlotStateFree,       // Zero so that never used blocks are free
+    eSlotStateLive,
+    eSlotStateDetaching,  // CleanUp is destroying the object
+    eSlotStateOrphaned,   // The last reference was released while detaching, CleanUp frees the slot
+    eSlotStateDetached
+  };
+
+  struct Slot : public IGarbageCollector<T>
+  {
+    Counter               counter;
+    GCConcreteFactory*    pFactory;
+    A32                   state;
+
+    void                  Collect(T* ptr) { pFactory->Release(this); }
+    void                  Destroy(T* ptr) { pFactory->Release(this); }
+  };
+
+  // The object is constructed right after the slot keeping the block alignment
+  static const size_t     kSlotSize = (sizeof(Slot) + 15) & ~static_cast<size_t>(15);
+
+  SlabPool                mSlabPool;
+  A32                     mDetachedCount;
+
+  void                    Free(Slot* pSlot);
+  void                    Release(Slot* pSlot);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(GCConcreteFactory)
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 GCGenericFactory
 
-This class is thread-safe.
+This class is thread-safe. Deferred collection follows the GCConcreteFactory contract.
 ----------------------------------------------------------------------------------------------------------------------*/
-template<class AbstractType, typename IDType = U32>
+template<class AbstractType, typename IDType = U32, GCFactoryMode Mode = eGCFactoryModeLocked>
 class GCGenericFactory : public IGarbageCollector<AbstractType>
 {
 public:
@@ -293,12 +470,18 @@ public:
   typedef GCWeakPtr<AbstractType, A32> Ref;
 
   GCGenericFactory();
+  ~GCGenericFactory();
 
   // Accessors
+  GCCollectionMode        GetCollectionMode() const;
   size_t                  GetLiveCount() const;
+  size_t                  GetPendingCount() const;
+  void                    SetCollectionMode(GCCollectionMode mode);
   
   // Methods
+  void                    AdvanceEpoch();
   void                    CleanUp();
+  size_t                  CollectGarbage(size_t budget = GCDeferredQueue<AbstractType>::kUnlimitedBudget);
   Ref                     Create(ConcreteTypeID typeID);
   void                    Register(IAbstractFactory* pAbstractFactory, ConcreteTypeID typeID);
   void                    Unregister(IAbstractFactory* pAbstractFactory);
@@ -309,6 +492,7 @@ private:
   
   Factory                 mFactory;
   PtrList                 mLiveList;
+  GCDeferredQueue<AbstractType> mDeferredQueue;
   mutable Threads::Mutex  mFactoryMutex;
   mutable Threads::Mutex  mLiveListMutex;
   bool                    mCleaningUp;
@@ -319,6 +503,76 @@ private:
   E_DISABLE_COPY_AND_ASSSIGNMENT(GCGenericFactory)
 };
 
+/*----------------------------------------------------------------------------------------------------------------------
+GCGenericFactory (pooled)
+
+Please note that this class has the following usage contract:
+
+1. Create and collection are thread-safe and lock-free except when the slab pool grows. Objects are still allocated
+by the registered factories, so their allocators should be thread-safe (e.g. CachedAllocator).
+2. Counters live in SlabPool blocks (slots) which also store the registered factory that created the object. The slot
+acts as the counter collector, so no pointer to factory map is required.
+3. Register and Unregister are NOT thread-safe: they MUST be called before / after concurrent object creation.
+4. Contract points 3 to 6 of the pooled GCConcreteFactory apply as well.
+----------------------------------------------------------------------------------------------------------------------*/
+template<class AbstractType, typename IDType>
+class GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>
+{
+public:
+  // Types
+  typedef IFactory<AbstractType> IAbstractFactory;
+  typedef typename FactoryIDTypeTraits<IDType>::Parameter ConcreteTypeID;
+  typedef GCWeakPtr<AbstractType, A32> Ref;
+
+  GCGenericFactory();
+  ~GCGenericFactory();
+
+  // Accessors
+  const IAllocator*       GetAllocator() const;
+  size_t                  GetLiveCount() const;
+  void                    SetAllocator(IAllocator* p);
+
+  // Methods
+  void                    CleanUp();
+  Ref                     Create(ConcreteTypeID typeID);
+  void                    Flush();
+  void                    Register(IAbstractFactory* pAbstractFactory, ConcreteTypeID typeID);
+  void                    Unregister(IAbstractFactory* pAbstractFactory);
+
+private:
+  typedef GCCounter<AbstractType, A32> Counter;
+  typedef Containers::Map<IDType, IAbstractFactory*> FactoryMap;
+
+  enum SlotState
+  {
+    eSlotStateFree,       // Zero so that never used blocks are free
+    eSlotStateLive,
+    eSlotStateDetaching,  // CleanUp is destroying the object
+    eSlotStateOrphaned,   // The last reference was released while detaching, CleanUp frees the slot
+    eSlotStateDetached
+  };
+
+  struct Slot : public IGarbageCollector<AbstractType>
+  {
+    Counter               counter;
+    GCGenericFactory*     pFactory;
+    IAbstractFactory*     pAbstractFactory;
+    A32                   state;
+
+    void                  Collect(AbstractType* ptr) { pFactory->Release(this); }
+    void                  Destroy(AbstractType* ptr) { pFactory->Release(this); }
+  };
+
+  FactoryMap              mFactoryMap;
+  SlabPool                mSlabPool;
+  A32                     mDetachedCount;
+
+  void                    Free(Slot* pSlot);
+  void                    Release(Slot* pSlot);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(GCGenericFactory)
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 GCUniquePtr initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -417,7 +671,16 @@ inline void GCUniquePtr<T, CounterType>::Reset()
   if (mpCounter) 
   {      
     mpCounter->pCollector->Destroy(mpCounter->ptr);
-    (mpCounter->count == 0) ? E_DELETE(mpCounter) : mpCounter->ptr = nullptr;
+    if (mpCounter->count == 0)
+    {
+      E_DELETE(mpCounter);
+    }
+    else
+    {
+      // Detach the counter: the last weak reference deletes it
+      mpCounter->ptr = nullptr;
+      mpCounter->pCollector = nullptr;
+    }
   }
   mpCounter = nullptr;
 }
@@ -518,6 +781,14 @@ inline GCWeakPtr<T, CounterType>::GCWeakPtr(const GCThisPtr<U, CounterType>& oth
   }
 }
 
+template <class T, typename CounterType>
+inline GCWeakPtr<T, CounterType>::GCWeakPtr(Counter* pCounter)
+  : mpCounter(pCounter)
+{
+  E_ASSERT_PTR(mpCounter);
+  ++(mpCounter->count);
+}
+
 template <class T, typename CounterType>
 inline GCWeakPtr<T, CounterType>::~GCWeakPtr()
 {
@@ -644,13 +915,14 @@ inline void GCWeakPtr<T, CounterType>::Reset()
     --(mpCounter->count);
     if (mpCounter->count == 0)
     { 
-      if (mpCounter->ptr == nullptr)
+      if (mpCounter->pCollector)
       {
-        E_DELETE(mpCounter);
+        // Pooled collectors also recycle detached counters (nullptr)
+        mpCounter->pCollector->Collect(mpCounter->ptr);
       }
-      else if (mpCounter->pCollector)
+      else if (mpCounter->ptr == nullptr)
       {
-        mpCounter->pCollector->Collect(mpCounter->ptr);
+        E_DELETE(mpCounter);
       }
     }
     mpCounter = nullptr;
@@ -670,64 +942,209 @@ inline void GCWeakPtr<T, CounterType>::Swap(GCWeakPtr& other)
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
-GCConcreteFactory initialization & finalization
+GCDeferredQueue initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T>
+inline GCDeferredQueue<T>::GCDeferredQueue()
+  : mCollectionMode(eGCCollectionModeImmediate)
+  , mEpoch(0) {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCDeferredQueue accessors
 ----------------------------------------------------------------------------------------------------------------------*/
 
 template <class T>
-inline GCConcreteFactory<T>::GCConcreteFactory() 
+inline GCCollectionMode GCDeferredQueue<T>::GetCollectionMode() const
+{
+  return mCollectionMode;
+}
+
+template <class T>
+inline U32 GCDeferredQueue<T>::GetEpoch() const
+{
+  return mEpoch;
+}
+
+template <class T>
+inline size_t GCDeferredQueue<T>::GetPendingCount() const
+{
+  return mQueue.GetCount();
+}
+
+template <class T>
+inline void GCDeferredQueue<T>::SetCollectionMode(GCCollectionMode mode)
+{
+  mCollectionMode = mode;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCDeferredQueue methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T>
+inline void GCDeferredQueue<T>::AdvanceEpoch()
+{
+  ++mEpoch;
+}
+
+/**
+Pops the oldest objects collected before the current epoch.
+@param ppBatch the array receiving the popped objects.
+@param maxCount the maximum number of objects to pop.
+@return the number of popped objects.
+@throw nothing.
+*/
+template <class T>
+inline size_t GCDeferredQueue<T>::Pop(T** ppBatch, size_t maxCount)
+{
+  size_t count = 0;
+  // Objects are queued in epoch order so the first current epoch object ends the pass
+  while (count < maxCount && !mQueue.IsEmpty() && mQueue.GetFront().epoch != mEpoch)
+  {
+    ppBatch[count++] = mQueue.GetFront().ptr;
+    mQueue.Pop();
+  }
+  return count;
+}
+
+template <class T>
+inline void GCDeferredQueue<T>::Push(T* ptr)
+{
+  PendingObject pendingObject = { ptr, mEpoch };
+  mQueue.Push(pendingObject);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T, GCFactoryMode Mode>
+inline GCConcreteFactory<T, Mode>::GCConcreteFactory() 
   : mpAllocator(Memory::Global::GetAllocator())
   , mCleaningUp(false) {}
 
-template <class T>
-inline GCConcreteFactory<T>::~GCConcreteFactory()
+template <class T, GCFactoryMode Mode>
+inline GCConcreteFactory<T, Mode>::~GCConcreteFactory()
 { 
   E_ASSERT_MSG(mLiveList.IsEmpty(), E_ASSERT_MSG_MEMORY_FACTORY_NOT_EMPTY_CONCRETE_TYPE_FACTORY);
+  // Pending objects are no longer referenced
+  mDeferredQueue.AdvanceEpoch();
+  CollectGarbage();
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
 GCConcreteFactory accessors
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template <class T>
-inline const IAllocator* GCConcreteFactory<T>::GetAllocator() const
+template <class T, GCFactoryMode Mode>
+inline const IAllocator* GCConcreteFactory<T, Mode>::GetAllocator() const
 {
   // [Critical section]
   Threads::Lock l(mAllocatorMutex);
   return mpAllocator;
 }
 
-template <class T>
-inline size_t GCConcreteFactory<T>::GetLiveCount() const
+template <class T, GCFactoryMode Mode>
+inline GCCollectionMode GCConcreteFactory<T, Mode>::GetCollectionMode() const
+{
+  // [Critical section]
+  Threads::Lock l(mLiveListMutex);
+  return mDeferredQueue.GetCollectionMode();
+}
+
+template <class T, GCFactoryMode Mode>
+inline size_t GCConcreteFactory<T, Mode>::GetLiveCount() const
 {
   // [Critical section]
   Threads::Lock l(mLiveListMutex);
   return mLiveList.GetCount();
 }
 
-template <class T>
-inline void GCConcreteFactory<T>::SetAllocator(IAllocator* p)
+template <class T, GCFactoryMode Mode>
+inline size_t GCConcreteFactory<T, Mode>::GetPendingCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mLiveListMutex);
+  return mDeferredQueue.GetPendingCount();
+}
+
+template <class T, GCFactoryMode Mode>
+inline void GCConcreteFactory<T, Mode>::SetAllocator(IAllocator* p)
 {
   // [Critical section]
   Threads::Lock l(mAllocatorMutex);
   mpAllocator = p;
 }
 
+template <class T, GCFactoryMode Mode>
+inline void GCConcreteFactory<T, Mode>::SetCollectionMode(GCCollectionMode mode)
+{
+  // [Critical section]
+  Threads::Lock l(mLiveListMutex);
+  mDeferredQueue.SetCollectionMode(mode);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 GCConcreteFactory methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template <class T>
-inline void GCConcreteFactory<T>::CleanUp()
+template <class T, GCFactoryMode Mode>
+inline void GCConcreteFactory<T, Mode>::AdvanceEpoch()
 {
   // [Critical section]
   Threads::Lock l(mLiveListMutex);
-  mCleaningUp = true;
-  mLiveList.Clear();
-  mCleaningUp = false;
+  mDeferredQueue.AdvanceEpoch();
 }
 
-template <class T>
-inline typename GCConcreteFactory<T>::Ref GCConcreteFactory<T>::Create()
+template <class T, GCFactoryMode Mode>
+inline void GCConcreteFactory<T, Mode>::CleanUp()
+{
+  // [Critical section]
+  {
+    Threads::Lock l(mLiveListMutex);
+    mCleaningUp = true;
+    mLiveList.Clear();
+    mCleaningUp = false;
+    mDeferredQueue.AdvanceEpoch();
+  }
+  CollectGarbage();
+}
+
+/**
+Destroys pending objects collected before the current epoch (deferred collection mode), oldest first.
+@param budget the maximum number of objects to destroy.
+@return the number of destroyed objects.
+@throw nothing.
+*/
+template <class T, GCFactoryMode Mode>
+inline size_t GCConcreteFactory<T, Mode>::CollectGarbage(size_t budget)
+{
+  T* batch[GCDeferredQueue<T>::kBatchCount];
+  size_t destroyedCount = 0;
+  while (destroyedCount < budget)
+  {
+    size_t count;
+    // [Critical section]
+    {
+      Threads::Lock l(mLiveListMutex);
+      count = mDeferredQueue.Pop(batch, Math::Min<size_t>(budget - destroyedCount, E_ELEMENT_COUNT(batch)));
+    }
+    if (count == 0) break;
+
+    // Destruction happens outside the live list critical section so that it does not stall Create or Collect
+    // [Critical section]
+    {
+      Threads::Lock l(mAllocatorMutex);
+      for (size_t i = 0; i < count; ++i) E_DELETE(batch[i], 1, mpAllocator, IAllocator::eTagFactoryDelete);
+    }
+    destroyedCount += count;
+  }
+  return destroyedCount;
+}
+
+template <class T, GCFactoryMode Mode>
+inline typename GCConcreteFactory<T, Mode>::Ref GCConcreteFactory<T, Mode>::Create()
 {
   T* ptr;
   // [Critical section]
@@ -748,8 +1165,8 @@ inline typename GCConcreteFactory<T>::Ref GCConcreteFactory<T>::Create()
 GCConcreteFactory private methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template <class T>
-inline void GCConcreteFactory<T>::Collect(T* ptr)
+template <class T, GCFactoryMode Mode>
+inline void GCConcreteFactory<T, Mode>::Collect(T* ptr)
 {
   // [Critical section]
   Threads::Lock l(mLiveListMutex);
@@ -765,47 +1182,216 @@ inline void GCConcreteFactory<T>::Collect(T* ptr)
   E_ASSERT_ALWAYS(E_ASSERT_MSG_MEMORY_FACTORY_NOT_OWNED_OBJECT);
 }
 
-template <class T>
-inline void GCConcreteFactory<T>::Destroy(T* ptr)
+template <class T, GCFactoryMode Mode>
+inline void GCConcreteFactory<T, Mode>::Destroy(T* ptr)
 {
+  E_ASSERT(ptr);
+  // Collect and CleanUp call Destroy (through the live list) within the live list critical section
+  if (!mCleaningUp && mDeferredQueue.GetCollectionMode() == eGCCollectionModeDeferred)
+  {
+    mDeferredQueue.Push(ptr);
+    return;
+  }
   // [Critical section]
   Threads::Lock l(mAllocatorMutex);
-  E_ASSERT(ptr);
   E_DELETE(ptr, 1, mpAllocator, IAllocator::eTagFactoryDelete);
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory (pooled) initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T>
+inline GCConcreteFactory<T, eGCFactoryModePooled>::GCConcreteFactory()
+  : mSlabPool(kSlotSize + sizeof(T))
+  , mDetachedCount(0) {}
+
+template <class T>
+inline GCConcreteFactory<T, eGCFactoryModePooled>::~GCConcreteFactory()
+{ 
+  E_ASSERT_MSG(GetLiveCount() == 0, E_ASSERT_MSG_MEMORY_FACTORY_NOT_EMPTY_CONCRETE_TYPE_FACTORY);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory (pooled) accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T>
+inline const IAllocator* GCConcreteFactory<T, eGCFactoryModePooled>::GetAllocator() const
+{
+  return mSlabPool.GetParentAllocator();
+}
+
+template <class T>
+inline size_t GCConcreteFactory<T, eGCFactoryModePooled>::GetLiveCount() const
+{
+  return mSlabPool.GetAllocatedCount() - mDetachedCount.Get();
+}
+
+template <class T>
+inline void GCConcreteFactory<T, eGCFactoryModePooled>::SetAllocator(IAllocator* p)
+{
+  mSlabPool.SetParentAllocator(p);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory (pooled) methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T>
+inline void GCConcreteFactory<T, eGCFactoryModePooled>::CleanUp()
+{
+  for (U32 i = 0, count = mSlabPool.GetBlockCount(); i < count; ++i)
+  {
+    Slot* pSlot = static_cast<Slot*>(mSlabPool.GetBlock(i));
+    // A live slot whose last reference is being released is claimed by either Release or CleanUp, never both
+    if (pSlot->state.Get() != eSlotStateLive || 
+        pSlot->state.CompareExchange(eSlotStateLive, eSlotStateDetaching) != eSlotStateLive) continue;
+
+    pSlot->counter.ptr->~T();
+    pSlot->counter.ptr = nullptr;
+    // Keep the slot until its last reference is released (unless it was released while detaching)
+    ++mDetachedCount;
+    if (pSlot->state.CompareExchange(eSlotStateDetaching, eSlotStateDetached) != eSlotStateDetaching)
+    {
+      --mDetachedCount;
+      Free(pSlot);
+    }
+  }
+}
+
+template <class T>
+inline typename GCConcreteFactory<T, eGCFactoryModePooled>::Ref GCConcreteFactory<T, eGCFactoryModePooled>::Create()
+{
+  Slot* pSlot = new (mSlabPool.Allocate(kSlotSize + sizeof(T))) Slot();
+  pSlot->pFactory = this;
+  pSlot->counter.ptr = new (reinterpret_cast<U8*>(pSlot) + kSlotSize) T();
+  pSlot->counter.pCollector = pSlot;
+  pSlot->state = eSlotStateLive;
+  return Ref(&pSlot->counter);
+}
+
+template <class T>
+inline void GCConcreteFactory<T, eGCFactoryModePooled>::Flush()
+{
+  mSlabPool.Flush();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCConcreteFactory (pooled) private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <class T>
+inline void GCConcreteFactory<T, eGCFactoryModePooled>::Free(Slot* pSlot)
+{
+  // The state MUST be cleared before the block is returned so that CleanUp skips free blocks
+  pSlot->state = eSlotStateFree;
+  pSlot->~Slot();
+  mSlabPool.Deallocate(pSlot);
+}
+
+template <class T>
+inline void GCConcreteFactory<T, eGCFactoryModePooled>::Release(Slot* pSlot)
+{
+  for (;;)
+  {
+    switch (pSlot->state.Get())
+    {
+    case eSlotStateLive:
+      if (pSlot->state.CompareExchange(eSlotStateLive, eSlotStateFree) != eSlotStateLive) break;
+      pSlot->counter.ptr->~T();
+      Free(pSlot);
+      return;
+    case eSlotStateDetaching:
+      // CleanUp is destroying the object and frees the slot when done
+      if (pSlot->state.CompareExchange(eSlotStateDetaching, eSlotStateOrphaned) != eSlotStateDetaching) break;
+      return;
+    default:
+      E_ASSERT(pSlot->state.Get() == eSlotStateDetached);
+      --mDetachedCount;
+      Free(pSlot);
+      return;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 GCGenericFactory initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template<class AbstractType, typename IDType>
-inline GCGenericFactory<AbstractType, IDType>::GCGenericFactory() : mCleaningUp(false) {}
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline GCGenericFactory<AbstractType, IDType, Mode>::GCGenericFactory() : mCleaningUp(false) {}
+
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline GCGenericFactory<AbstractType, IDType, Mode>::~GCGenericFactory()
+{
+  // Pending objects are no longer referenced
+  mDeferredQueue.AdvanceEpoch();
+  CollectGarbage();
+}
 
 /*----------------------------------------------------------------------------------------------------------------------
 GCGenericFactory accessors
 ----------------------------------------------------------------------------------------------------------------------*/
 
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline GCCollectionMode GCGenericFactory<AbstractType, IDType, Mode>::GetCollectionMode() const
+{
+  // [Critical section]
+  Threads::Lock l(mLiveListMutex);
+  return mDeferredQueue.GetCollectionMode();
+}
+
 // Gets a list of current live objects
-template<class AbstractType, typename IDType>
-inline size_t GCGenericFactory<AbstractType, IDType>::GetLiveCount() const
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline size_t GCGenericFactory<AbstractType, IDType, Mode>::GetLiveCount() const
 {
+  // The live list excludes pending objects, which are still counted by the wrapped factory until collected
   // [Critical section]
-  Threads::Lock l(mFactoryMutex);
-  return mFactory.GetLiveCount();
+  Threads::Lock l(mLiveListMutex);
+  return mLiveList.GetCount();
+}
+
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline size_t GCGenericFactory<AbstractType, IDType, Mode>::GetPendingCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mLiveListMutex);
+  return mDeferredQueue.GetPendingCount();
+}
+
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::SetCollectionMode(GCCollectionMode mode)
+{
+  // [Critical section]
+  Threads::Lock l(mLiveListMutex);
+  mDeferredQueue.SetCollectionMode(mode);
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
 GCGenericFactory methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template<class AbstractType, typename IDType>
-inline void GCGenericFactory<AbstractType, IDType>::CleanUp()
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::AdvanceEpoch()
 {
   // [Critical section]
   Threads::Lock l(mLiveListMutex);
-  mCleaningUp = true;
-  mLiveList.Clear();
-  mCleaningUp = false;
+  mDeferredQueue.AdvanceEpoch();
+}
+
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::CleanUp()
+{
+  // [Critical section]
+  {
+    Threads::Lock l(mLiveListMutex);
+    mCleaningUp = true;
+    mLiveList.Clear();
+    mCleaningUp = false;
+    mDeferredQueue.AdvanceEpoch();
+  }
+  CollectGarbage();
   #ifdef E_DEBUG
   // [Critical section]
   {
@@ -815,8 +1401,33 @@ inline void GCGenericFactory<AbstractType, IDType>::CleanUp()
   #endif
 }
 
-template<class AbstractType, typename IDType>
-inline typename GCGenericFactory<AbstractType, IDType>::Ref GCGenericFactory<AbstractType, IDType>::Create(ConcreteTypeID typeID)
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline size_t GCGenericFactory<AbstractType, IDType, Mode>::CollectGarbage(size_t budget)
+{
+  AbstractType* batch[GCDeferredQueue<AbstractType>::kBatchCount];
+  size_t destroyedCount = 0;
+  while (destroyedCount < budget)
+  {
+    size_t count;
+    // [Critical section]
+    {
+      Threads::Lock l(mLiveListMutex);
+      count = mDeferredQueue.Pop(batch, Math::Min<size_t>(budget - destroyedCount, E_ELEMENT_COUNT(batch)));
+    }
+    if (count == 0) break;
+
+    // [Critical section]
+    {
+      Threads::Lock l(mFactoryMutex);
+      for (size_t i = 0; i < count; ++i) mFactory.Destroy(batch[i]);
+    }
+    destroyedCount += count;
+  }
+  return destroyedCount;
+}
+
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline typename GCGenericFactory<AbstractType, IDType, Mode>::Ref GCGenericFactory<AbstractType, IDType, Mode>::Create(ConcreteTypeID typeID)
 {
   Ptr ptr;
   // [Critical section]
@@ -830,16 +1441,16 @@ inline typename GCGenericFactory<AbstractType, IDType>::Ref GCGenericFactory<Abs
   return *mLiveList.GetBack();
 }
 
-template<class AbstractType, typename IDType>
-inline void GCGenericFactory<AbstractType, IDType>::Register(IAbstractFactory* pAbstractFactory, ConcreteTypeID typeID)
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::Register(IAbstractFactory* pAbstractFactory, ConcreteTypeID typeID)
 {
   // [Critical section]
   Threads::Lock l(mFactoryMutex);
   mFactory.Register(pAbstractFactory, typeID);
 }
 
-template<class AbstractType, typename IDType>
-inline void GCGenericFactory<AbstractType, IDType>::Unregister(IAbstractFactory* pAbstractFactory)
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::Unregister(IAbstractFactory* pAbstractFactory)
 {
   // [Critical section]
   Threads::Lock l(mFactoryMutex);
@@ -850,8 +1461,8 @@ inline void GCGenericFactory<AbstractType, IDType>::Unregister(IAbstractFactory*
 GCGenericFactory private methods
 ----------------------------------------------------------------------------------------------------------------------*/
 
-template<class AbstractType, typename IDType>
-inline void GCGenericFactory<AbstractType, IDType>::Collect(AbstractType* ptr)
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::Collect(AbstractType* ptr)
 {
   // [Critical section]
   Threads::Lock l(mLiveListMutex);
@@ -867,13 +1478,182 @@ inline void GCGenericFactory<AbstractType, IDType>::Collect(AbstractType* ptr)
   E_ASSERT_ALWAYS(E_ASSERT_MSG_MEMORY_FACTORY_NOT_OWNED_OBJECT);
 }
 
-template<class AbstractType, typename IDType>
-inline void GCGenericFactory<AbstractType, IDType>::Destroy(AbstractType* ptr)
+template<class AbstractType, typename IDType, GCFactoryMode Mode>
+inline void GCGenericFactory<AbstractType, IDType, Mode>::Destroy(AbstractType* ptr)
 {
+  // Collect and CleanUp call Destroy (through the live list) within the live list critical section
+  if (!mCleaningUp && mDeferredQueue.GetCollectionMode() == eGCCollectionModeDeferred)
+  {
+    mDeferredQueue.Push(ptr);
+    return;
+  }
   // [Critical section]
   Threads::Lock l(mFactoryMutex);
   mFactory.Destroy(ptr);
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCGenericFactory (pooled) initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template<class AbstractType, typename IDType>
+inline GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::GCGenericFactory() 
+  : mSlabPool(sizeof(Slot))
+  , mDetachedCount(0) {}
+
+template<class AbstractType, typename IDType>
+inline GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::~GCGenericFactory()
+{ 
+  E_ASSERT_MSG(GetLiveCount() == 0, E_ASSERT_MSG_MEMORY_FACTORY_NOT_EMPTY_CONCRETE_TYPE_FACTORY);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCGenericFactory (pooled) accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template<class AbstractType, typename IDType>
+inline const IAllocator* GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::GetAllocator() const
+{
+  return mSlabPool.GetParentAllocator();
+}
+
+template<class AbstractType, typename IDType>
+inline size_t GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::GetLiveCount() const
+{
+  return mSlabPool.GetAllocatedCount() - mDetachedCount.Get();
+}
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::SetAllocator(IAllocator* p)
+{
+  mSlabPool.SetParentAllocator(p);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCGenericFactory (pooled) methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::CleanUp()
+{
+  for (U32 i = 0, count = mSlabPool.GetBlockCount(); i < count; ++i)
+  {
+    Slot* pSlot = static_cast<Slot*>(mSlabPool.GetBlock(i));
+    // A live slot whose last reference is being released is claimed by either Release or CleanUp, never both
+    if (pSlot->state.Get() != eSlotStateLive || 
+        pSlot->state.CompareExchange(eSlotStateLive, eSlotStateDetaching) != eSlotStateLive) continue;
+
+    pSlot->pAbstractFactory->Destroy(pSlot->counter.ptr);
+    pSlot->counter.ptr = nullptr;
+    // Keep the slot until its last reference is released (unless it was released while detaching)
+    ++mDetachedCount;
+    if (pSlot->state.CompareExchange(eSlotStateDetaching, eSlotStateDetached) != eSlotStateDetaching)
+    {
+      --mDetachedCount;
+      Free(pSlot);
+    }
+  }
+}
+
+template<class AbstractType, typename IDType>
+inline typename GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Ref 
+  GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Create(ConcreteTypeID typeID)
+{
+  typename FactoryMap::ConstIterator cit = mFactoryMap.Find(typeID);
+  if (cit == mFactoryMap.GetEnd()) 
+  {
+    E_ASSERT_ALWAYS(E_ASSERT_MSG_MEMORY_FACTORY_UNKNOWN_CONCRETE_TYPE_FACTORY);
+    return Ref();
+  }
+
+  Slot* pSlot = new (mSlabPool.Allocate(sizeof(Slot))) Slot();
+  pSlot->pFactory = this;
+  pSlot->pAbstractFactory = (*cit).second;
+  pSlot->counter.ptr = pSlot->pAbstractFactory->Create();
+  E_ASSERT_PTR(pSlot->counter.ptr);
+  pSlot->counter.pCollector = pSlot;
+  pSlot->state = eSlotStateLive;
+  return Ref(&pSlot->counter);
+}
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Flush()
+{
+  mSlabPool.Flush();
+}
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Register(IAbstractFactory* pAbstractFactory, 
+                                                                                   ConcreteTypeID typeID)
+{
+  E_ASSERT_MSG(pAbstractFactory, E_ASSERT_MSG_MEMORY_FACTORY_NULL_CONCRETE_TYPE_FACTORY);
+  E_ASSERT_MSG(mFactoryMap.Find(typeID) == mFactoryMap.GetEnd(), E_ASSERT_MSG_MEMORY_FACTORY_EXISTING_CONCRETE_TYPE_FACTORY);
+  mFactoryMap.Insert(typeID, pAbstractFactory);
+}
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Unregister(IAbstractFactory* pAbstractFactory)
+{
+  E_ASSERT_MSG(pAbstractFactory, E_ASSERT_MSG_MEMORY_FACTORY_NULL_CONCRETE_TYPE_FACTORY);
+  typename FactoryMap::Iterator it = mFactoryMap.GetBegin();
+  for(; it != mFactoryMap.GetEnd(); ++it)
+  {
+    if ((*it).second == pAbstractFactory)
+      break;
+  }
+
+  if (it != mFactoryMap.GetEnd())
+  {
+#ifdef E_DEBUG
+    for (U32 i = 0, count = mSlabPool.GetBlockCount(); i < count; ++i)
+    {
+      const Slot* pSlot = static_cast<const Slot*>(mSlabPool.GetBlock(i));
+      E_ASSERT_MSG(pSlot->state.Get() != eSlotStateLive || pSlot->pAbstractFactory != pAbstractFactory, 
+                   E_ASSERT_MSG_MEMORY_FACTORY_NOT_EMPTY_CONCRETE_TYPE_FACTORY);
+    }
+#endif
+    mFactoryMap.Remove(it);
+  }
+  // else : Do nothing (see GenericFactory::Unregister).
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+GCGenericFactory (pooled) private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Free(Slot* pSlot)
+{
+  // The state MUST be cleared before the block is returned so that CleanUp skips free blocks
+  pSlot->state = eSlotStateFree;
+  pSlot->~Slot();
+  mSlabPool.Deallocate(pSlot);
+}
+
+template<class AbstractType, typename IDType>
+inline void GCGenericFactory<AbstractType, IDType, eGCFactoryModePooled>::Release(Slot* pSlot)
+{
+  for (;;)
+  {
+    switch (pSlot->state.Get())
+    {
+    case eSlotStateLive:
+      if (pSlot->state.CompareExchange(eSlotStateLive, eSlotStateFree) != eSlotStateLive) break;
+      pSlot->pAbstractFactory->Destroy(pSlot->counter.ptr);
+      Free(pSlot);
+      return;
+    case eSlotStateDetaching:
+      // CleanUp is destroying the object and frees the slot when done
+      if (pSlot->state.CompareExchange(eSlotStateDetaching, eSlotStateOrphaned) != eSlotStateDetaching) break;
+      return;
+    default:
+      E_ASSERT(pSlot->state.Get() == eSlotStateDetached);
+      --mDetachedCount;
+      Free(pSlot);
+      return;
+    }
+  }
+}
 }
 }
 
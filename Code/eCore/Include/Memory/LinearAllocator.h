@@ -0,0 +1,217 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file LinearAllocator.h
+This file defines the LinearAllocator class. LinearAllocator implements a linear (bump pointer) arena allocator intended
+for per frame allocations.
+*/
+
+#ifndef E3_LINEAR_ALLOCATOR_H
+#define E3_LINEAR_ALLOCATOR_H
+
+#include "Allocator.h"
+#include <Assertion/Assert.h>
+#include <Math/Comparison.h>
+#include <Threads/Atomic.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+LinearAllocator assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_LINEAR_ALLOCATOR_SIZE_VALUE "Size value (%d) must be smaller than 4GB"
+
+namespace E
+{
+namespace Memory
+{
+/*----------------------------------------------------------------------------------------------------------------------
+LinearAllocator
+
+Please note that this class has the following usage contract:
+
+1. Allocate is thread-safe and lock-free (compare and exchange of the arena offset). Allocations are 16 byte aligned.
+2. Deallocate does nothing for arena memory: all the arena memory is released at once by Reset (typically once per
+frame). Reset, SetParentAllocator and SetSize are NOT thread-safe.
+3. Allocations which do not fit in the arena are forwarded to the parent allocator (global allocator by default) and
+counted as overflows. An overflow means the arena size must be increased in order to avoid heap allocations. Overflow
+allocations are over-allocated to keep the alignment, storing the parent allocation right before the returned memory.
+4. Objects allocated from the arena MUST not be used after Reset (their destructors are not called by Reset).
+----------------------------------------------------------------------------------------------------------------------*/
+class LinearAllocator : public IAllocator
+{
+public:
+  LinearAllocator();
+  explicit LinearAllocator(size_t size);
+  ~LinearAllocator();
+
+  // Accessors
+  U32               GetOverflowCount() const;
+  IAllocator*       GetParentAllocator() const;
+  size_t            GetSize() const;
+  size_t            GetUsedSize() const;
+  void              SetParentAllocator(IAllocator* p);
+  void              SetSize(size_t size);
+
+  // Methods
+  void*             Allocate(size_t size, const Tag tag = IAllocator::eTagNew);
+  void              Deallocate(void* p, const Tag tag = IAllocator::eTagDelete);
+  void              Reset();
+
+private:
+  static const size_t kAlignment = 16;
+
+  IAllocator*       mpParentAllocator;
+  void*             mpMemory;   // Parent allocation
+  U8*               mpBuffer;   // Aligned arena start
+  size_t            mSize;
+  A32               mOffset;
+  A32               mOverflowCount;
+
+  void              Destroy();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(LinearAllocator)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+LinearAllocator initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline LinearAllocator::LinearAllocator()
+  : mpParentAllocator(Global::GetAllocator())
+  , mpMemory(nullptr)
+  , mpBuffer(nullptr)
+  , mSize(0)
+{
+}
+
+inline LinearAllocator::LinearAllocator(size_t size)
+  : mpParentAllocator(Global::GetAllocator())
+  , mpMemory(nullptr)
+  , mpBuffer(nullptr)
+  , mSize(0)
+{
+  SetSize(size);
+}
+
+inline LinearAllocator::~LinearAllocator()
+{
+  Destroy();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LinearAllocator accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline U32 LinearAllocator::GetOverflowCount() const
+{
+  return mOverflowCount.Get();
+}
+
+inline IAllocator* LinearAllocator::GetParentAllocator() const
+{
+  return mpParentAllocator;
+}
+
+inline size_t LinearAllocator::GetSize() const
+{
+  return mSize;
+}
+
+inline size_t LinearAllocator::GetUsedSize() const
+{
+  return Math::Min(static_cast<size_t>(mOffset.Get()), mSize);
+}
+
+inline void LinearAllocator::SetParentAllocator(IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  size_t size = mSize;
+  Destroy();
+  mpParentAllocator = p;
+  SetSize(size);
+}
+
+inline void LinearAllocator::SetSize(size_t size)
+{
+  E_ASSERT_MSG(size < 0xffffffff, E_ASSERT_MSG_LINEAR_ALLOCATOR_SIZE_VALUE, size);
+  Destroy();
+  if (size == 0) return;
+  mpMemory = mpParentAllocator->Allocate(size + kAlignment - 1, IAllocator::eTagArrayNew);
+  mpBuffer = reinterpret_cast<U8*>((reinterpret_cast<size_t>(mpMemory) + kAlignment - 1) & ~(kAlignment - 1));
+  mSize = size;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LinearAllocator methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void* LinearAllocator::Allocate(size_t size, const Tag tag)
+{
+  if (size == 0) return nullptr;
+  size_t alignedSize = (size + kAlignment - 1) & ~(kAlignment - 1);
+  U32 offset = mOffset.Get();
+  while (offset + alignedSize <= mSize)
+  {
+    U32 original = mOffset.CompareExchange(offset, offset + static_cast<U32>(alignedSize));
+    if (original == offset) return mpBuffer + offset;
+    offset = original;
+  }
+  ++mOverflowCount;
+  void* pMemory = mpParentAllocator->Allocate(size + sizeof(void*) + kAlignment - 1, tag);
+  if (pMemory == nullptr) return nullptr;
+  U8* p = reinterpret_cast<U8*>((reinterpret_cast<size_t>(pMemory) + sizeof(void*) + kAlignment - 1) & ~(kAlignment - 1));
+  reinterpret_cast<void**>(p)[-1] = pMemory;
+  return p;
+}
+
+inline void LinearAllocator::Deallocate(void* p, const Tag tag)
+{
+  if (p == nullptr) return;
+  // Arena memory is released on Reset
+  if (p >= mpBuffer && p < mpBuffer + mSize) return;
+  mpParentAllocator->Deallocate(static_cast<void**>(p)[-1], tag);
+}
+
+inline void LinearAllocator::Reset()
+{
+  mOffset = 0;
+  mOverflowCount = 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LinearAllocator private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void LinearAllocator::Destroy()
+{
+  if (mpMemory) mpParentAllocator->Deallocate(mpMemory, IAllocator::eTagArrayDelete);
+  mpMemory = nullptr;
+  mpBuffer = nullptr;
+  mSize = 0;
+  Reset();
+}
+}
+}
+
+#endif
@@ -65,6 +65,8 @@ delete object construction / destruction method in order to control memory alloc
 the total size. For this purpose Zero can be used in combination with the E_ELEMENT_COUNT macro e.g:
 Zero(a, E_ELEMENT_COUNT(a)).
 3. Destructs requires a valid pointer.
+4. MoveAssign behaves as Copy for POD types (memcpy) while it move-assigns non-POD types, leaving source objects in 
+their moved-from state. Take note that Move just moves memory (memmove) for both POD and non-POD types.
 ----------------------------------------------------------------------------------------------------------------------*/
 namespace Memory
 {
@@ -83,6 +85,8 @@ inline bool IsEqual(const T* ptrA, const T* ptrB, size_t count = 1) { return (me
 template <typename T>
 inline void Move(T* pTarget, const T* pSource, size_t count = 1) { memmove(pTarget, pSource, sizeof(T) * count); }
 template <typename T>
+T*          MoveAssign(T* pTarget, T* pSource, size_t count = 1);
+template <typename T>
 inline void Zero(T* pTarget, size_t count = 1) { memset(pTarget, 0, sizeof(T) * count); }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -130,6 +134,7 @@ struct MemoryHelper
   static T*   Create(size_t count, IAllocator* pAllocator, IAllocator::Tag tag);    
   static void Destroy(T* pObject, size_t count, IAllocator* pAllocator, IAllocator::Tag tag);
   static void Destruct(T* pObject, size_t count); 
+  static T*   MoveAssign(T* pTarget, T* pSource, size_t count);
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -159,6 +164,11 @@ struct MemoryHelper<T, true>
   }
 
   static void Destruct(T* /*pObject*/, size_t /*count*/) {}
+
+  static T* MoveAssign(T* pTarget, T* pSource, size_t count)
+  {
+    return Copy(pTarget, pSource, count);
+  }
 };
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -211,6 +221,15 @@ struct MemoryHelper<T, false>
     T* pEnd = pObject + count;
     while (pEnd > pObject) (--pEnd)->~T();
   }
+
+  static T* MoveAssign(T* pTarget, T* pSource, size_t count)
+  { 
+    E_ASSERT_MSG(pSource != nullptr && pTarget != nullptr || !count, E_ASSERT_MSG_MEMORY_INVALID_READ_MEMORY_ADDRESS, count);
+    T* pTargetEnd = pTarget + count;
+    while (pTarget != pTargetEnd) *pTarget++ = std::move(*pSource++);
+    // Return ptr start position
+    return pTarget - count;
+  }
 };
 }
 
@@ -247,6 +266,12 @@ inline void Memory::Destruct(T* pObject, size_t count)
 {
   return Memory::MemoryHelper<T>::Destruct(pObject, count);
 }
+
+template <typename T>
+inline T* Memory::MoveAssign(T* pTarget, T* pSource, size_t count)
+{ 
+  return Memory::MemoryHelper<T>::MoveAssign(pTarget, pSource, count);
+}
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
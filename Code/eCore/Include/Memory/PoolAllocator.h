@@ -0,0 +1,321 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file PoolAllocator.h
+This file defines the PoolAllocator class. PoolAllocator implements a fixed size block allocator.
+*/
+
+#ifndef E3_POOL_ALLOCATOR_H
+#define E3_POOL_ALLOCATOR_H
+
+#include "Allocator.h"
+#include <Assertion/Assert.h>
+#include <Threads/Mutex.h>
+#include <Threads/Lock.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+PoolAllocator assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_POOL_ALLOCATOR_BLOCK_SIZE_VALUE      "Block size and block count per page must be greater than 0"
+#define E_ASSERT_MSG_POOL_ALLOCATOR_PAGE_VALUE            "Block size can not be changed once pages have been allocated"
+
+namespace E
+{
+namespace Memory
+{
+/*----------------------------------------------------------------------------------------------------------------------
+PoolAllocator
+
+Please note that this class has the following usage contract:
+
+1. PoolAllocator is thread-safe.
+2. Blocks are carved from pages allocated from the parent allocator (global allocator by default). Pages are only
+released on Clear or destruction, so once the pool has grown to its steady state size there are no heap allocations.
+3. Allocations are 16 byte aligned. Allocations larger than the block size are not an error: they return nullptr so 
+callers can fall back to another allocator.
+4. AllocateList and DeallocateList move several blocks at once (linked through their first pointer) amortizing the lock
+cost. They are intended to be used by allocators caching blocks (see CachedAllocator).
+5. Clear releases all the pages: it MUST be called when no blocks are in use.
+----------------------------------------------------------------------------------------------------------------------*/
+class PoolAllocator : public IAllocator
+{
+public:
+  static const size_t kDefaultBlockCountPerPage = 256;
+
+  PoolAllocator();
+  PoolAllocator(size_t blockSize, size_t blockCountPerPage = kDefaultBlockCountPerPage);
+  ~PoolAllocator();
+
+  // Accessors
+  size_t            GetBlockCountPerPage() const;
+  size_t            GetBlockSize() const;
+  size_t            GetFreeBlockCount() const;
+  size_t            GetPageCount() const;
+  IAllocator*       GetParentAllocator() const;
+  void              SetBlockSize(size_t blockSize, size_t blockCountPerPage = kDefaultBlockCountPerPage);
+  void              SetParentAllocator(IAllocator* p);
+
+  // Methods
+  void*             Allocate(size_t size, const Tag tag = IAllocator::eTagNew);
+  void*             AllocateList(size_t count);
+  void              Clear();
+  void              Deallocate(void* p, const Tag tag = IAllocator::eTagDelete);
+  void              DeallocateList(void* pFirst, void* pLast, size_t count);
+  void              Reserve(size_t blockCount);
+
+private:
+  static const size_t kAlignment = 16;
+
+  struct Block
+  {
+    Block*          pNext;
+  };
+
+  struct Page
+  {
+    Page*           pNext;
+    void*           pMemory;  // Parent allocation
+  };
+
+  mutable Threads::Mutex mMutex;
+  IAllocator*       mpParentAllocator;
+  Page*             mpPageList;
+  Block*            mpFreeList;
+  size_t            mBlockSize;
+  size_t            mBlockCountPerPage;
+  size_t            mFreeBlockCount;
+  size_t            mPageCount;
+
+  void              AllocatePage();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(PoolAllocator)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+PoolAllocator initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline PoolAllocator::PoolAllocator()
+  : mpParentAllocator(Global::GetAllocator())
+  , mpPageList(nullptr)
+  , mpFreeList(nullptr)
+  , mBlockSize(kAlignment)
+  , mBlockCountPerPage(kDefaultBlockCountPerPage)
+  , mFreeBlockCount(0)
+  , mPageCount(0)
+{
+}
+
+inline PoolAllocator::PoolAllocator(size_t blockSize, size_t blockCountPerPage)
+  : mpParentAllocator(Global::GetAllocator())
+  , mpPageList(nullptr)
+  , mpFreeList(nullptr)
+  , mBlockSize(kAlignment)
+  , mBlockCountPerPage(kDefaultBlockCountPerPage)
+  , mFreeBlockCount(0)
+  , mPageCount(0)
+{
+  SetBlockSize(blockSize, blockCountPerPage);
+}
+
+inline PoolAllocator::~PoolAllocator()
+{
+  Clear();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PoolAllocator accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline size_t PoolAllocator::GetBlockCountPerPage() const
+{
+  return mBlockCountPerPage;
+}
+
+inline size_t PoolAllocator::GetBlockSize() const
+{
+  return mBlockSize;
+}
+
+inline size_t PoolAllocator::GetFreeBlockCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mFreeBlockCount;
+}
+
+inline size_t PoolAllocator::GetPageCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mPageCount;
+}
+
+inline IAllocator* PoolAllocator::GetParentAllocator() const
+{
+  return mpParentAllocator;
+}
+
+inline void PoolAllocator::SetBlockSize(size_t blockSize, size_t blockCountPerPage)
+{
+  E_ASSERT_MSG(blockSize > 0 && blockCountPerPage > 0, E_ASSERT_MSG_POOL_ALLOCATOR_BLOCK_SIZE_VALUE);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  E_ASSERT_MSG(mpPageList == nullptr, E_ASSERT_MSG_POOL_ALLOCATOR_PAGE_VALUE);
+  mBlockSize = (blockSize + kAlignment - 1) & ~(kAlignment - 1);
+  mBlockCountPerPage = blockCountPerPage;
+}
+
+inline void PoolAllocator::SetParentAllocator(IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  E_ASSERT_MSG(mpPageList == nullptr, E_ASSERT_MSG_POOL_ALLOCATOR_PAGE_VALUE);
+  mpParentAllocator = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PoolAllocator methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void* PoolAllocator::Allocate(size_t size, const Tag)
+{
+  if (size > mBlockSize) return nullptr;
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  if (mpFreeList == nullptr) AllocatePage();
+  Block* pBlock = mpFreeList;
+  mpFreeList = pBlock->pNext;
+  --mFreeBlockCount;
+  return pBlock;
+}
+
+/**
+Allocates several blocks at once.
+@param count the number of blocks to allocate.
+@return the first block. Blocks are linked through their first pointer (the last block links to nullptr).
+@throw nothing.
+*/
+inline void* PoolAllocator::AllocateList(size_t count)
+{
+  if (count == 0) return nullptr;
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  while (mFreeBlockCount < count) AllocatePage();
+  Block* pFirst = mpFreeList;
+  Block* pLast = pFirst;
+  for (size_t i = 1; i < count; ++i) pLast = pLast->pNext;
+  mpFreeList = pLast->pNext;
+  pLast->pNext = nullptr;
+  mFreeBlockCount -= count;
+  return pFirst;
+}
+
+inline void PoolAllocator::Clear()
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  while (mpPageList)
+  {
+    Page* pPage = mpPageList;
+    mpPageList = pPage->pNext;
+    mpParentAllocator->Deallocate(pPage->pMemory, IAllocator::eTagArrayDelete);
+  }
+  mpFreeList = nullptr;
+  mFreeBlockCount = 0;
+  mPageCount = 0;
+}
+
+inline void PoolAllocator::Deallocate(void* p, const Tag)
+{
+  if (p == nullptr) return;
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  Block* pBlock = static_cast<Block*>(p);
+  pBlock->pNext = mpFreeList;
+  mpFreeList = pBlock;
+  ++mFreeBlockCount;
+}
+
+/**
+Deallocates several blocks at once.
+@param pFirst the first block.
+@param pLast the last block.
+@param count the number of blocks linked from pFirst to pLast through their first pointer.
+@throw nothing.
+*/
+inline void PoolAllocator::DeallocateList(void* pFirst, void* pLast, size_t count)
+{
+  if (count == 0) return;
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  static_cast<Block*>(pLast)->pNext = mpFreeList;
+  mpFreeList = static_cast<Block*>(pFirst);
+  mFreeBlockCount += count;
+}
+
+/**
+Allocates pages till there are at least blockCount free blocks.
+@param blockCount the number of free blocks required.
+@throw nothing.
+*/
+inline void PoolAllocator::Reserve(size_t blockCount)
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  while (mFreeBlockCount < blockCount) AllocatePage();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PoolAllocator private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void PoolAllocator::AllocatePage()
+{
+  // The page header takes the first aligned slot so blocks keep the alignment
+  size_t headerSize = (sizeof(Page) + kAlignment - 1) & ~(kAlignment - 1);
+  void* pMemory = mpParentAllocator->Allocate(headerSize + mBlockSize * mBlockCountPerPage + kAlignment - 1, IAllocator::eTagArrayNew);
+  U8* pStart = reinterpret_cast<U8*>((reinterpret_cast<size_t>(pMemory) + kAlignment - 1) & ~(kAlignment - 1));
+  Page* pPage = reinterpret_cast<Page*>(pStart);
+  pPage->pMemory = pMemory;
+  pPage->pNext = mpPageList;
+  mpPageList = pPage;
+  ++mPageCount;
+
+  // Push the page blocks to the free list keeping the address order
+  U8* pBlocks = pStart + headerSize;
+  for (size_t i = mBlockCountPerPage; i-- > 0;)
+  {
+    Block* pBlock = reinterpret_cast<Block*>(pBlocks + i * mBlockSize);
+    pBlock->pNext = mpFreeList;
+    mpFreeList = pBlock;
+  }
+  mFreeBlockCount += mBlockCountPerPage;
+}
+}
+}
+
+#endif
@@ -0,0 +1,425 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SlabPool.h
+This file defines the SlabPool class. SlabPool implements a lock-free fixed size block pool with per thread block 
+caches. Blocks are addressed by index so that they can be enumerated (see GCConcreteFactory pooled mode).
+*/
+
+#ifndef E3_SLAB_POOL_H
+#define E3_SLAB_POOL_H
+
+#include "Allocator.h"
+#include <Assertion/Assert.h>
+#include <Threads/Atomic.h>
+#include <Threads/Mutex.h>
+#include <Threads/Lock.h>
+#include <Threads/ThreadLocal.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlabPool assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_SLAB_POOL_ALLOCATION_SIZE_VALUE  "Allocation size (%d) must be smaller or equal to the block size (%d)"
+#define E_ASSERT_MSG_SLAB_POOL_BLOCK_SIZE_VALUE       "Block size must be greater than 0 and block count per slab a multiple of the batch block count"
+#define E_ASSERT_MSG_SLAB_POOL_SLAB_VALUE             "Block size can not be changed once slabs have been allocated"
+#define E_ASSERT_MSG_SLAB_POOL_SLAB_COUNT_VALUE       "Maximum slab count (%d) exceeded"
+#define E_ASSERT_MSG_SLAB_POOL_INDEX_VALUE            "Block index (%d) must be smaller than the block count (%d)"
+
+namespace E
+{
+namespace Memory
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SlabPool
+
+Please note that this class has the following usage contract:
+
+1. SlabPool is thread-safe. Allocate and Deallocate are lock-free: each thread caches up to kMaxCachedBlockCount free 
+blocks and exchanges batches of kBatchBlockCount blocks with a shared lock-free batch stack. Only slab allocation (when
+every free block is in use) takes a lock.
+2. Blocks are carved from slabs allocated from the parent allocator (global allocator by default). Slabs are zeroed on 
+allocation and only released on destruction, so block memory always remains valid (stale reads on the shared stack 
+are harmless) and block content is zero until first written.
+3. Allocations are 16 byte aligned and MUST be smaller or equal to the block size. Each block is preceded by a 16 byte
+header holding its index and free list links (block content is preserved between Deallocate and Allocate).
+4. GetBlock / GetBlockCount allow enumerating every carved block (allocated or not). It is up to the user to tell apart 
+allocated blocks (e.g. by a state field which is zero on free blocks).
+5. GetAllocatedCount is exact only when no other thread is allocating or deallocating.
+6. Memory can be deallocated from any thread. Flush returns the calling thread cached blocks to the shared stack (e.g. 
+before a worker thread ends).
+7. SetBlockSize and SetParentAllocator MUST be called before any allocation.
+----------------------------------------------------------------------------------------------------------------------*/
+class SlabPool : public IAllocator
+{
+public:
+  static const U32 kBatchBlockCount = 32;
+  static const U32 kDefaultBlockCountPerSlab = 512;
+  static const U32 kMaxCachedBlockCount = 2 * kBatchBlockCount;
+  static const U32 kMaxSlabCount = 4096;
+
+  SlabPool();
+  SlabPool(size_t blockSize, U32 blockCountPerSlab = kDefaultBlockCountPerSlab);
+  ~SlabPool();
+
+  // Accessors
+  size_t            GetAllocatedCount() const;
+  void*             GetBlock(U32 index) const;
+  U32               GetBlockCount() const;
+  U32               GetBlockCountPerSlab() const;
+  size_t            GetBlockSize() const;
+  IAllocator*       GetParentAllocator() const;
+  U32               GetSlabCount() const;
+  void              SetBlockSize(size_t blockSize, U32 blockCountPerSlab = kDefaultBlockCountPerSlab);
+  void              SetParentAllocator(IAllocator* p);
+
+  // Methods
+  void*             Allocate(size_t size, const Tag tag = IAllocator::eTagNew);
+  void              Deallocate(void* p, const Tag tag = IAllocator::eTagDelete);
+  void              Flush();
+
+private:
+  static const U32  kAlignment = 16;
+  static const U32  kInvalidIndex = 0xffffffff;
+
+  struct BlockHeader
+  {
+    U32             index;
+    U32             nextIndex;        // Next block in the thread cache / batch
+    U32             nextBatchIndex;   // Next batch in the shared stack (batch first block only)
+    U32             batchCount;       // Batch block count (batch first block only)
+  };
+
+  struct Slab
+  {
+    void*           pMemory;          // Parent allocation
+    U8*             pBlocks;
+  };
+
+  struct ThreadCache
+  {
+    ThreadCache*    pNext;
+    U32             firstIndex;
+    U32             count;
+  };
+
+  // The shared stack head packs an ABA tag (high 32 bits) and the first batch block index (low 32 bits). It is kept 
+  // in its own cache line to avoid false sharing.
+  A64               mBatchStackHead;
+  U8                mBatchStackHeadPadding[64 - sizeof(A64)];
+  A32               mBatchStackBlockCount;
+  A32               mSlabCount;
+  Slab*             mpSlabs;
+  Threads::ThreadLocal mThreadCache;
+  mutable Threads::Mutex mMutex;
+  ThreadCache*      mpThreadCacheList;
+  IAllocator*       mpParentAllocator;
+  size_t            mBlockSize;
+  size_t            mBlockStride;
+  U32               mBlockCountPerSlab;
+
+  void              AllocateSlab(ThreadCache* pCache);
+  void              FlushBlocks(ThreadCache* pCache, U32 count);
+  BlockHeader*      GetBlockHeader(U32 index) const;
+  ThreadCache*      GetThreadCache();
+  bool              PopBatch(ThreadCache* pCache);
+  void              PushBatch(U32 firstIndex, U32 count);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(SlabPool)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlabPool initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline SlabPool::SlabPool()
+  : mBatchStackHead(kInvalidIndex)
+  , mpSlabs(nullptr)
+  , mpThreadCacheList(nullptr)
+  , mpParentAllocator(Global::GetAllocator())
+  , mBlockSize(kAlignment)
+  , mBlockStride(kAlignment + sizeof(BlockHeader))
+  , mBlockCountPerSlab(kDefaultBlockCountPerSlab)
+{
+}
+
+inline SlabPool::SlabPool(size_t blockSize, U32 blockCountPerSlab)
+  : mBatchStackHead(kInvalidIndex)
+  , mpSlabs(nullptr)
+  , mpThreadCacheList(nullptr)
+  , mpParentAllocator(Global::GetAllocator())
+  , mBlockSize(kAlignment)
+  , mBlockStride(kAlignment + sizeof(BlockHeader))
+  , mBlockCountPerSlab(kDefaultBlockCountPerSlab)
+{
+  SetBlockSize(blockSize, blockCountPerSlab);
+}
+
+inline SlabPool::~SlabPool()
+{
+  while (mpThreadCacheList)
+  {
+    ThreadCache* pCache = mpThreadCacheList;
+    mpThreadCacheList = pCache->pNext;
+    mpParentAllocator->Deallocate(pCache, IAllocator::eTagDelete);
+  }
+  if (mpSlabs)
+  {
+    for (U32 i = 0; i < mSlabCount.Get(); ++i) mpParentAllocator->Deallocate(mpSlabs[i].pMemory, IAllocator::eTagArrayDelete);
+    mpParentAllocator->Deallocate(mpSlabs, IAllocator::eTagArrayDelete);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlabPool accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline size_t SlabPool::GetAllocatedCount() const
+{
+  size_t freeCount = mBatchStackBlockCount.Get();
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    for (ThreadCache* pCache = mpThreadCacheList; pCache; pCache = pCache->pNext) freeCount += pCache->count;
+  }
+  return GetBlockCount() - freeCount;
+}
+
+inline void* SlabPool::GetBlock(U32 index) const
+{
+  E_ASSERT_MSG(index < GetBlockCount(), E_ASSERT_MSG_SLAB_POOL_INDEX_VALUE, index, GetBlockCount());
+  return GetBlockHeader(index) + 1;
+}
+
+inline U32 SlabPool::GetBlockCount() const
+{
+  return mSlabCount.Get() * mBlockCountPerSlab;
+}
+
+inline U32 SlabPool::GetBlockCountPerSlab() const
+{
+  return mBlockCountPerSlab;
+}
+
+inline size_t SlabPool::GetBlockSize() const
+{
+  return mBlockSize;
+}
+
+inline IAllocator* SlabPool::GetParentAllocator() const
+{
+  return mpParentAllocator;
+}
+
+inline U32 SlabPool::GetSlabCount() const
+{
+  return mSlabCount.Get();
+}
+
+inline void SlabPool::SetBlockSize(size_t blockSize, U32 blockCountPerSlab)
+{
+  E_ASSERT_MSG(blockSize > 0 && blockCountPerSlab > 0 && blockCountPerSlab % kBatchBlockCount == 0, E_ASSERT_MSG_SLAB_POOL_BLOCK_SIZE_VALUE);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  E_ASSERT_MSG(mSlabCount.Get() == 0, E_ASSERT_MSG_SLAB_POOL_SLAB_VALUE);
+  mBlockSize = (blockSize + kAlignment - 1) & ~(kAlignment - 1);
+  mBlockStride = mBlockSize + sizeof(BlockHeader);
+  mBlockCountPerSlab = blockCountPerSlab;
+}
+
+inline void SlabPool::SetParentAllocator(IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  E_ASSERT_MSG(mSlabCount.Get() == 0, E_ASSERT_MSG_SLAB_POOL_SLAB_VALUE);
+  mpParentAllocator = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlabPool methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void* SlabPool::Allocate(size_t size, const Tag)
+{
+  E_ASSERT_MSG(size <= mBlockSize, E_ASSERT_MSG_SLAB_POOL_ALLOCATION_SIZE_VALUE, size, mBlockSize);
+  ThreadCache* pCache = GetThreadCache();
+  if (pCache->count == 0 && !PopBatch(pCache))
+  {
+    // [Critical section]
+    Threads::Lock l(mMutex);
+    // Another thread may have allocated a slab meanwhile
+    if (!PopBatch(pCache)) AllocateSlab(pCache);
+  }
+  BlockHeader* pHeader = GetBlockHeader(pCache->firstIndex);
+  pCache->firstIndex = pHeader->nextIndex;
+  --pCache->count;
+  return pHeader + 1;
+}
+
+inline void SlabPool::Deallocate(void* p, const Tag)
+{
+  if (p == nullptr) return;
+  BlockHeader* pHeader = static_cast<BlockHeader*>(p) - 1;
+  ThreadCache* pCache = GetThreadCache();
+  pHeader->nextIndex = pCache->firstIndex;
+  pCache->firstIndex = pHeader->index;
+  if (++pCache->count > kMaxCachedBlockCount) FlushBlocks(pCache, kBatchBlockCount);
+}
+
+/**
+Returns the calling thread cached blocks to the shared stack.
+@throw nothing.
+*/
+inline void SlabPool::Flush()
+{
+  ThreadCache* pCache = static_cast<ThreadCache*>(mThreadCache.Get());
+  if (pCache) FlushBlocks(pCache, pCache->count);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SlabPool private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Allocates a new slab. The first slab batch goes straight to the given (empty) thread cache, as other threads could pop
+every batch pushed to the shared stack before the caller gets one.
+@param pCache the thread cache.
+@throw nothing.
+*/
+inline void SlabPool::AllocateSlab(ThreadCache* pCache)
+{
+  U32 slabIndex = mSlabCount.Get();
+  E_ASSERT_MSG(slabIndex < kMaxSlabCount, E_ASSERT_MSG_SLAB_POOL_SLAB_COUNT_VALUE, kMaxSlabCount);
+  if (mpSlabs == nullptr)
+  {
+    mpSlabs = static_cast<Slab*>(mpParentAllocator->Allocate(sizeof(Slab) * kMaxSlabCount, IAllocator::eTagArrayNew));
+  }
+
+  size_t slabSize = mBlockStride * mBlockCountPerSlab;
+  Slab& slab = mpSlabs[slabIndex];
+  slab.pMemory = mpParentAllocator->Allocate(slabSize + kAlignment - 1, IAllocator::eTagArrayNew);
+  // Headers take the 16 bytes before each block so blocks keep the alignment
+  slab.pBlocks = reinterpret_cast<U8*>((reinterpret_cast<size_t>(slab.pMemory) + kAlignment - 1) & ~(kAlignment - 1));
+  Memory::Zero(slab.pBlocks, slabSize);
+
+  // Link the slab blocks in address order and publish the slab before its blocks are pushed to the shared stack
+  U32 firstIndex = slabIndex * mBlockCountPerSlab;
+  for (U32 i = 0; i < mBlockCountPerSlab; ++i)
+  {
+    BlockHeader* pHeader = reinterpret_cast<BlockHeader*>(slab.pBlocks + i * mBlockStride);
+    pHeader->index = firstIndex + i;
+    pHeader->nextIndex = ((i + 1) % kBatchBlockCount == 0) ? kInvalidIndex : firstIndex + i + 1;
+  }
+  ++mSlabCount;
+  pCache->firstIndex = firstIndex;
+  pCache->count = kBatchBlockCount;
+  for (U32 i = kBatchBlockCount; i < mBlockCountPerSlab; i += kBatchBlockCount) PushBatch(firstIndex + i, kBatchBlockCount);
+}
+
+inline void SlabPool::FlushBlocks(ThreadCache* pCache, U32 count)
+{
+  if (count == 0) return;
+  U32 firstIndex = pCache->firstIndex;
+  BlockHeader* pLast = GetBlockHeader(firstIndex);
+  for (U32 i = 1; i < count; ++i) pLast = GetBlockHeader(pLast->nextIndex);
+  pCache->firstIndex = pLast->nextIndex;
+  pCache->count -= count;
+  pLast->nextIndex = kInvalidIndex;
+  PushBatch(firstIndex, count);
+}
+
+inline SlabPool::BlockHeader* SlabPool::GetBlockHeader(U32 index) const
+{
+  const Slab& slab = mpSlabs[index / mBlockCountPerSlab];
+  return reinterpret_cast<BlockHeader*>(slab.pBlocks + (index % mBlockCountPerSlab) * mBlockStride);
+}
+
+inline SlabPool::ThreadCache* SlabPool::GetThreadCache()
+{
+  ThreadCache* pCache = static_cast<ThreadCache*>(mThreadCache.Get());
+  if (pCache) return pCache;
+
+  // First allocation from this thread
+  pCache = static_cast<ThreadCache*>(mpParentAllocator->Allocate(sizeof(ThreadCache), IAllocator::eTagNew));
+  pCache->firstIndex = kInvalidIndex;
+  pCache->count = 0;
+  mThreadCache.Set(pCache);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  pCache->pNext = mpThreadCacheList;
+  mpThreadCacheList = pCache;
+  return pCache;
+}
+
+/**
+Pops a batch from the shared stack into an empty thread cache.
+@param pCache the thread cache.
+@return true if a batch was popped, false if the shared stack is empty.
+@throw nothing.
+*/
+inline bool SlabPool::PopBatch(ThreadCache* pCache)
+{
+  for (;;)
+  {
+    U64 head = mBatchStackHead.Get();
+    U32 firstIndex = static_cast<U32>(head);
+    if (firstIndex == kInvalidIndex) return false;
+    // The header may be concurrently popped and reused: the tag makes the exchange fail in that case
+    BlockHeader* pHeader = GetBlockHeader(firstIndex);
+    U32 count = pHeader->batchCount;
+    U64 newHead = (((head >> 32) + 1) << 32) | pHeader->nextBatchIndex;
+    if (mBatchStackHead.CompareExchange(head, newHead) == head)
+    {
+      mBatchStackBlockCount -= count;
+      pCache->firstIndex = firstIndex;
+      pCache->count = count;
+      return true;
+    }
+  }
+}
+
+/**
+Pushes a batch to the shared stack.
+@param firstIndex the batch first block index. Batch blocks are linked through their next index.
+@param count the number of blocks in the batch.
+@throw nothing.
+*/
+inline void SlabPool::PushBatch(U32 firstIndex, U32 count)
+{
+  BlockHeader* pHeader = GetBlockHeader(firstIndex);
+  pHeader->batchCount = count;
+  mBatchStackBlockCount += count;
+  for (;;)
+  {
+    U64 head = mBatchStackHead.Get();
+    pHeader->nextBatchIndex = static_cast<U32>(head);
+    U64 newHead = (((head >> 32) + 1) << 32) | firstIndex;
+    if (mBatchStackHead.CompareExchange(head, newHead) == head) return;
+  }
+}
+}
+}
+
+#endif
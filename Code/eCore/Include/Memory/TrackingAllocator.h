@@ -0,0 +1,434 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file TrackingAllocator.h
+This file defines the TrackingAllocator class and its AllocationSnapshot statistics class. TrackingAllocator is an
+IAllocator decorator recording allocation statistics per allocation tag.
+*/
+
+#ifndef E3_TRACKING_ALLOCATOR_H
+#define E3_TRACKING_ALLOCATOR_H
+
+#include "Allocator.h"
+#include <Assertion/Assert.h>
+#include <Serialization/ISerializer.h>
+#include <Threads/Atomic.h>
+#include <Threads/Lock.h>
+#include <Threads/Mutex.h>
+#include <Threads/ThreadLocal.h>
+#include <Time/Time.h>
+
+namespace E
+{
+namespace Memory
+{
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationStats
+----------------------------------------------------------------------------------------------------------------------*/
+struct AllocationStats
+{
+  AllocationStats()
+    : liveBytes(0)
+    , peakBytes(0)
+    , allocatedBytes(0)
+    , allocationCount(0)
+    , deallocationCount(0) {}
+
+  I64               liveBytes;
+  I64               peakBytes;
+  U64               allocatedBytes;
+  U64               allocationCount;
+  U64               deallocationCount;
+
+  inline friend Serialization::ISerializer& operator<<(Serialization::ISerializer& target, const AllocationStats& source)
+  {
+    E_FRIEND_SERIALIZE(liveBytes);
+    E_FRIEND_SERIALIZE(peakBytes);
+    E_FRIEND_SERIALIZE(allocatedBytes);
+    E_FRIEND_SERIALIZE(allocationCount);
+    E_FRIEND_SERIALIZE(deallocationCount);
+    return target;
+  }
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationSnapshot
+
+Please note that this class has the following usage contract:
+
+1. Statistics are recorded under the allocation tag (the one passed to Allocate) even if a different tag is passed to
+Deallocate.
+2. GetTime returns the time since the TrackingAllocator creation for snapshots and the elapsed time between both
+snapshots for diffs. Rates are computed over this time.
+3. Diff subtracts all the statistics but peakBytes, which keeps the newer snapshot value. The resulting liveBytes is
+the live bytes variation (it can be negative).
+4. Snapshots can be exported through any ISerializer (e.g. XmlSerializer). Only tags with allocations are exported.
+----------------------------------------------------------------------------------------------------------------------*/
+class AllocationSnapshot
+{
+public:
+  AllocationSnapshot() {}
+
+  // Accessors
+  D64                     GetAllocationRate(IAllocator::Tag tag) const;
+  D64                     GetAllocatedByteRate(IAllocator::Tag tag) const;
+  const AllocationStats&  GetStats(IAllocator::Tag tag) const;
+  AllocationStats         GetTotalStats() const;
+  TimeValue               GetTime() const;
+
+  // Methods
+  AllocationSnapshot      Diff(const AllocationSnapshot& older) const;
+
+  inline friend Serialization::ISerializer& operator<<(Serialization::ISerializer& target, const AllocationSnapshot& source)
+  {
+    target.BeginTag("time");
+    target << static_cast<I64>(source.mTime);
+    target.EndTag();
+    for (U32 i = 0; i < IAllocator::eTagCount; ++i)
+    {
+      if (source.mStats[i].allocationCount == 0 && source.mStats[i].liveBytes == 0) continue;
+      target.BeginTag("tag");
+      E_SERIALIZE(target, i, index);
+      E_SERIALIZE(target, source.mStats[i], stats);
+      target.EndTag();
+    }
+    return target;
+  }
+
+private:
+  AllocationStats         mStats[IAllocator::eTagCount];
+  TimeValue               mTime;
+
+  friend class TrackingAllocator;
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+TrackingAllocator
+
+Please note that this class has the following usage contract:
+
+1. TrackingAllocator forwards allocations to the parent allocator (global allocator by default) adding a 16 byte
+header (IAllocator::Deallocate does not supply the allocation size) and records live bytes, peak bytes, allocated bytes
+and allocation / deallocation counts per tag.
+2. TrackingAllocator is thread-safe and lock-free once a thread made its first allocation: counters are per thread and
+live bytes are published to shared atomic counters once the thread balance reaches kPublishByteCount. Hence peak bytes
+may be underestimated by up to kPublishByteCount per thread.
+3. GetSnapshot adds up all the thread counters without stopping them, so a snapshot taken while other threads allocate
+is approximate.
+4. SetParentAllocator MUST be called before any allocation. Memory MUST be deallocated through the same
+TrackingAllocator.
+----------------------------------------------------------------------------------------------------------------------*/
+class TrackingAllocator : public IAllocator
+{
+public:
+  static const I64 kPublishByteCount = 64 * 1024;
+
+  TrackingAllocator();
+  explicit TrackingAllocator(IAllocator* pParentAllocator);
+  ~TrackingAllocator();
+
+  // Accessors
+  IAllocator*       GetParentAllocator() const;
+  void              GetSnapshot(AllocationSnapshot& snapshot) const;
+  void              SetParentAllocator(IAllocator* p);
+
+  // Methods
+  void*             Allocate(size_t size, const Tag tag = IAllocator::eTagNew);
+  void              Deallocate(void* p, const Tag tag = IAllocator::eTagDelete);
+
+private:
+  static const size_t kHeaderSize = 16;
+
+  struct Header
+  {
+    U64             size;
+    U32             tag;
+  };
+
+  struct ThreadCounters
+  {
+    ThreadCounters* pNext;
+    I64             pendingBytes[eTagCount];
+    U64             allocatedBytes[eTagCount];
+    U64             allocationCount[eTagCount];
+    U64             deallocationCount[eTagCount];
+  };
+
+  A64               mLiveBytes[eTagCount];
+  A64               mPeakBytes[eTagCount];
+  Threads::ThreadLocal mThreadCounters;
+  mutable Threads::Mutex mMutex;
+  ThreadCounters*   mpThreadCountersList;
+  IAllocator*       mpParentAllocator;
+  TimeValue         mStartTime;
+
+  ThreadCounters*   GetThreadCounters();
+  void              Publish(ThreadCounters* pCounters, U32 tag);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(TrackingAllocator)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationSnapshot accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Gets the tag allocation count per second.
+@param tag the allocation tag.
+@return the allocation rate.
+@throw nothing.
+*/
+inline D64 AllocationSnapshot::GetAllocationRate(IAllocator::Tag tag) const
+{
+  D64 seconds = mTime.GetSeconds();
+  return (seconds > 0.0) ? mStats[tag].allocationCount / seconds : 0.0;
+}
+
+/**
+Gets the tag allocated bytes per second.
+@param tag the allocation tag.
+@return the allocated byte rate.
+@throw nothing.
+*/
+inline D64 AllocationSnapshot::GetAllocatedByteRate(IAllocator::Tag tag) const
+{
+  D64 seconds = mTime.GetSeconds();
+  return (seconds > 0.0) ? mStats[tag].allocatedBytes / seconds : 0.0;
+}
+
+inline const AllocationStats& AllocationSnapshot::GetStats(IAllocator::Tag tag) const
+{
+  return mStats[tag];
+}
+
+/**
+Gets the statistics of all the tags added up (peakBytes is the sum of the tag peaks).
+@return the total statistics.
+@throw nothing.
+*/
+inline AllocationStats AllocationSnapshot::GetTotalStats() const
+{
+  AllocationStats total;
+  for (U32 i = 0; i < IAllocator::eTagCount; ++i)
+  {
+    total.liveBytes += mStats[i].liveBytes;
+    total.peakBytes += mStats[i].peakBytes;
+    total.allocatedBytes += mStats[i].allocatedBytes;
+    total.allocationCount += mStats[i].allocationCount;
+    total.deallocationCount += mStats[i].deallocationCount;
+  }
+  return total;
+}
+
+inline TimeValue AllocationSnapshot::GetTime() const
+{
+  return mTime;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationSnapshot methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Gets the statistics variation between an older snapshot and this one.
+@param older the older snapshot.
+@return the diff snapshot.
+@throw nothing.
+*/
+inline AllocationSnapshot AllocationSnapshot::Diff(const AllocationSnapshot& older) const
+{
+  AllocationSnapshot diff;
+  for (U32 i = 0; i < IAllocator::eTagCount; ++i)
+  {
+    diff.mStats[i].liveBytes = mStats[i].liveBytes - older.mStats[i].liveBytes;
+    diff.mStats[i].peakBytes = mStats[i].peakBytes;
+    diff.mStats[i].allocatedBytes = mStats[i].allocatedBytes - older.mStats[i].allocatedBytes;
+    diff.mStats[i].allocationCount = mStats[i].allocationCount - older.mStats[i].allocationCount;
+    diff.mStats[i].deallocationCount = mStats[i].deallocationCount - older.mStats[i].deallocationCount;
+  }
+  diff.mTime = mTime - older.mTime;
+  return diff;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TrackingAllocator initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline TrackingAllocator::TrackingAllocator()
+  : mpThreadCountersList(nullptr)
+  , mpParentAllocator(Global::GetAllocator())
+  , mStartTime(Time::GetCpuTime())
+{
+}
+
+inline TrackingAllocator::TrackingAllocator(IAllocator* pParentAllocator)
+  : mpThreadCountersList(nullptr)
+  , mpParentAllocator(pParentAllocator)
+  , mStartTime(Time::GetCpuTime())
+{
+  E_ASSERT_PTR(pParentAllocator);
+}
+
+inline TrackingAllocator::~TrackingAllocator()
+{
+  while (mpThreadCountersList)
+  {
+    ThreadCounters* pCounters = mpThreadCountersList;
+    mpThreadCountersList = pCounters->pNext;
+    mpParentAllocator->Deallocate(pCounters, IAllocator::eTagDelete);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TrackingAllocator accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline IAllocator* TrackingAllocator::GetParentAllocator() const
+{
+  return mpParentAllocator;
+}
+
+inline void TrackingAllocator::GetSnapshot(AllocationSnapshot& snapshot) const
+{
+  for (U32 i = 0; i < eTagCount; ++i)
+  {
+    AllocationStats& stats = snapshot.mStats[i];
+    stats = AllocationStats();
+    stats.liveBytes = static_cast<I64>(mLiveBytes[i].Get());
+    stats.peakBytes = static_cast<I64>(mPeakBytes[i].Get());
+  }
+
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    for (ThreadCounters* pCounters = mpThreadCountersList; pCounters; pCounters = pCounters->pNext)
+    {
+      for (U32 i = 0; i < eTagCount; ++i)
+      {
+        AllocationStats& stats = snapshot.mStats[i];
+        stats.liveBytes += pCounters->pendingBytes[i];
+        stats.allocatedBytes += pCounters->allocatedBytes[i];
+        stats.allocationCount += pCounters->allocationCount[i];
+        stats.deallocationCount += pCounters->deallocationCount[i];
+      }
+    }
+  }
+
+  // Unpublished bytes may take the live bytes above the published peak
+  for (U32 i = 0; i < eTagCount; ++i)
+  {
+    AllocationStats& stats = snapshot.mStats[i];
+    if (stats.liveBytes > stats.peakBytes) stats.peakBytes = stats.liveBytes;
+  }
+  snapshot.mTime = Time::GetCpuTime() - mStartTime;
+}
+
+inline void TrackingAllocator::SetParentAllocator(IAllocator* p)
+{
+  E_ASSERT_PTR(p);
+  mpParentAllocator = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TrackingAllocator methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline void* TrackingAllocator::Allocate(size_t size, const Tag tag)
+{
+  U8* pMemory = static_cast<U8*>(mpParentAllocator->Allocate(size + kHeaderSize, tag));
+  Header* pHeader = reinterpret_cast<Header*>(pMemory);
+  pHeader->size = size;
+  pHeader->tag = tag;
+
+  ThreadCounters* pCounters = GetThreadCounters();
+  pCounters->allocatedBytes[tag] += size;
+  ++pCounters->allocationCount[tag];
+  pCounters->pendingBytes[tag] += size;
+  if (pCounters->pendingBytes[tag] >= kPublishByteCount) Publish(pCounters, tag);
+
+  return pMemory + kHeaderSize;
+}
+
+inline void TrackingAllocator::Deallocate(void* p, const Tag tag)
+{
+  if (p == nullptr) return;
+  U8* pMemory = static_cast<U8*>(p) - kHeaderSize;
+  Header* pHeader = reinterpret_cast<Header*>(pMemory);
+  U32 allocationTag = pHeader->tag;
+
+  ThreadCounters* pCounters = GetThreadCounters();
+  ++pCounters->deallocationCount[allocationTag];
+  pCounters->pendingBytes[allocationTag] -= static_cast<I64>(pHeader->size);
+  if (pCounters->pendingBytes[allocationTag] <= -kPublishByteCount) Publish(pCounters, allocationTag);
+
+  mpParentAllocator->Deallocate(pMemory, tag);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TrackingAllocator private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+inline TrackingAllocator::ThreadCounters* TrackingAllocator::GetThreadCounters()
+{
+  ThreadCounters* pCounters = static_cast<ThreadCounters*>(mThreadCounters.Get());
+  if (pCounters) return pCounters;
+
+  // First allocation from this thread
+  pCounters = static_cast<ThreadCounters*>(mpParentAllocator->Allocate(sizeof(ThreadCounters), IAllocator::eTagNew));
+  for (U32 i = 0; i < eTagCount; ++i)
+  {
+    pCounters->pendingBytes[i] = 0;
+    pCounters->allocatedBytes[i] = 0;
+    pCounters->allocationCount[i] = 0;
+    pCounters->deallocationCount[i] = 0;
+  }
+  mThreadCounters.Set(pCounters);
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  pCounters->pNext = mpThreadCountersList;
+  mpThreadCountersList = pCounters;
+  return pCounters;
+}
+
+inline void TrackingAllocator::Publish(ThreadCounters* pCounters, U32 tag)
+{
+  I64 bytes = pCounters->pendingBytes[tag];
+  pCounters->pendingBytes[tag] = 0;
+  // Two's complement addition handles negative balances
+  I64 liveBytes = static_cast<I64>(mLiveBytes[tag] += static_cast<U64>(bytes));
+  if (bytes <= 0) return;
+
+  U64 peakBytes = mPeakBytes[tag].Get();
+  while (liveBytes > static_cast<I64>(peakBytes))
+  {
+    U64 original = mPeakBytes[tag].CompareExchange(peakBytes, static_cast<U64>(liveBytes));
+    if (original == peakBytes) break;
+    peakBytes = original;
+  }
+}
+}
+}
+
+#endif
@@ -88,11 +88,25 @@ Platform detection (32 or 64 bit)
   #endif
 #endif
 
+/*----------------------------------------------------------------------------------------------------------------------
+Platform detection (SIMD instruction sets)
+
+SSE2 is always available on x64. On x86 it depends on the /arch compiler option.
+----------------------------------------------------------------------------------------------------------------------*/
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define E_PLATFORM_SIMD_SSE 1
+#endif
+#ifdef __AVX__
+  #define E_PLATFORM_SIMD_AVX 1
+#endif
+
 /*----------------------------------------------------------------------------------------------------------------------
 Macro definitions (null pointer)
 ----------------------------------------------------------------------------------------------------------------------*/
 
+#define E_PLATFORM_ALIGN(n) __declspec(align(n))
 #define E_PLATFORM_FORCE_INLINE __forceinline
+#define E_PLATFORM_THREAD_LOCAL __declspec(thread)
 
 /*----------------------------------------------------------------------------------------------------------------------
 Macro definitions (API export / import)
@@ -99,6 +99,8 @@ SharedPtr<Foo, Atomic<U32>> fooPtr2;     On destruction:    if (mpPtr)
 9. SharedPtr resolves assignment between static_cast convertible types in a transparent manner. However assignment 
 from other type raw pointers is not allowed.
 10. Copy construction or assignment from shared pointers with different counter types is not allowed.
+11. Move construction and assignment transfer the reference without touching the counter, leaving the other pointer 
+empty (like default constructed).
 
 Note: you can use the comparison operator against nullptr to check the SharedPtr validity.
 
@@ -112,6 +114,7 @@ class SharedPtr
 public:
   SharedPtr();
   SharedPtr(const SharedPtr& other);
+  SharedPtr(SharedPtr&& other);
   template <class U, class DeleterClassU>
   SharedPtr(const SharedPtr<U, CounterType, DeleterClassU>& other);
   template <class U>
@@ -120,6 +123,7 @@ public:
 
   // Operators
   SharedPtr&                  operator=(const SharedPtr& other);
+  SharedPtr&                  operator=(SharedPtr&& other);
   template <class U, class DeleterClassU>
   SharedPtr&                  operator=(const SharedPtr<U, CounterType, DeleterClassU>& other);
   SharedPtr&                  operator=(T* ptr);
@@ -168,6 +172,15 @@ inline SharedPtr<T, CounterType, DeleterClass>::SharedPtr(const SharedPtr& other
   if (mpPtr) ++mpCounter->count;
 }
 
+template <class T, typename CounterType, class DeleterClass>
+inline SharedPtr<T, CounterType, DeleterClass>::SharedPtr(SharedPtr&& other)
+  : mpPtr(other.mpPtr)
+  , mpCounter(other.mpCounter)
+{
+  other.mpPtr = nullptr;
+  other.mpCounter = nullptr;
+}
+
 template <class T, typename CounterType, class DeleterClass>
 template <class U, class DeleterClassU>
 inline SharedPtr<T, CounterType, DeleterClass>::SharedPtr(const SharedPtr<U, CounterType, DeleterClassU>& other)
@@ -203,6 +216,13 @@ inline SharedPtr<T, CounterType, DeleterClass>& SharedPtr<T, CounterType, Delete
   return *this;
 }
 
+template <class T, typename CounterType, class DeleterClass>
+inline SharedPtr<T, CounterType, DeleterClass>& SharedPtr<T, CounterType, DeleterClass>::operator=(SharedPtr&& other)
+{
+  SharedPtr(std::move(other)).Swap(*this);
+  return *this;
+}
+
 template <class T, typename CounterType, class DeleterClass>
 template <class U, class DeleterClassU>
 inline SharedPtr<T, CounterType, DeleterClass>& SharedPtr<T, CounterType, DeleterClass>::operator=(const SharedPtr<U, CounterType, DeleterClassU>& other)
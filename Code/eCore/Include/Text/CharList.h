@@ -49,6 +49,8 @@ Please note that this class has the following usage contract:
 it is not intended as a serialization class as it does not allow to recover the original type value. For string based 
 serialization use the ISerializer based class StringSerializer.
 3. EnsureSize preserves existing context while Reserve just ensures memory allocation (content is not preserved).
+4. Move construction and assignment take ownership of the other string memory. The moved-from string is left as a valid
+empty string without memory (GetPtr returns a shared empty string) until new content is appended.
 ----------------------------------------------------------------------------------------------------------------------*/
 template <typename T>
 class CharList
@@ -59,12 +61,14 @@ public:
 
   explicit CharList(size_t size = kDefaultMinSize);
   CharList(const CharList& other);  // Non-explicit to be used by friend operators
+  CharList(CharList&& other);
   CharList(const T* pStr);          // Non-explicit to be used by friend operators
   CharList(const T* pStr, size_t length);
   ~CharList();
 
   // Operators
   CharList&   operator=(const CharList& other);
+  CharList&   operator=(CharList&& other);
   T           operator[](size_t index) const;
   T&          operator[](size_t index);
 
@@ -124,7 +128,7 @@ private:
   void                AppendValue(U v);
   void                AppendEnding();
 
-  // Relying on default copy constructor and assignment operator
+  // This class defines copy & move constructors and assignment operators
   // Note that copy construction is allowed through CharList(const T* pStr)
 };
 
@@ -146,6 +150,12 @@ inline CharList<T>::CharList(const CharList& other)
   AppendEnding();
 }
 
+template <typename T>
+inline CharList<T>::CharList(CharList&& other)
+  : mList(std::move(other.mList))
+{
+}
+
 template <typename T>
 inline CharList<T>::CharList(const T* pStr)
 {
@@ -174,6 +184,13 @@ inline CharList<T>& CharList<T>::operator=(const CharList& other)
   return *this;
 }
 
+template <typename T>
+inline CharList<T>& CharList<T>::operator=(CharList&& other)
+{
+  mList = std::move(other.mList);
+  return *this;
+}
+
 template <typename T>
 inline T CharList<T>::operator[](size_t index) const
 {
@@ -192,7 +209,7 @@ inline bool CharList<T>::operator==(const CharList& other) const
   if (mList.GetCount() != other.mList.GetCount())
     return false;
 
-  return Memory::IsEqual(mList.GetPtr(), other.mList.GetPtr(), mList.GetCount() + 1);
+  return Memory::IsEqual(GetPtr(), other.GetPtr(), mList.GetCount() + 1);
 }
 
 template <typename T>
@@ -202,7 +219,7 @@ inline bool CharList<T>::operator==(const CharArray<T, OtherSize>& other) const
   if (mList.GetCount() != other.GetLength())
     return false;
 
-  return Memory::IsEqual(mList.GetPtr(), other.GetPtr(), mList.GetCount() + 1);
+  return Memory::IsEqual(GetPtr(), other.GetPtr(), mList.GetCount() + 1);
 }
 
 template <typename T>
@@ -212,7 +229,7 @@ inline bool CharList<T>::operator==(const T* pStr) const
   if (GetLength() != strLength)
     return false;
 
-  return Memory::IsEqual(mList.GetPtr(), pStr, mList.GetCount() + 1);
+  return Memory::IsEqual(GetPtr(), pStr, mList.GetCount() + 1);
 }
 
 template <typename T>
@@ -362,7 +379,10 @@ inline size_t CharList<T>::GetSize() const
 template <typename T>
 inline const T* CharList<T>::GetPtr() const
 {
-  return mList.GetPtr();
+  // Moved-from strings have no memory but must still be valid empty strings
+  static const T kEmptyString = 0;
+  const T* pStr = mList.GetPtr();
+  return pStr ? pStr : &kEmptyString;
 }
 
 template <typename T>
@@ -41,14 +41,52 @@ namespace E
 {
 namespace Threads
 {
+/*----------------------------------------------------------------------------------------------------------------------
+MemoryOrder
+
+- eMemoryOrderRelaxed: atomicity only, no ordering of the surrounding memory accesses.
+- eMemoryOrderAcquire: (loads) no read or write after the load can be moved before it.
+- eMemoryOrderRelease: (stores) no read or write before the store can be moved after it.
+- eMemoryOrderSequential: acquire / release plus a single total order of all sequential operations (a sequential store
+followed by a load is not reordered).
+----------------------------------------------------------------------------------------------------------------------*/
+enum MemoryOrder
+{
+  eMemoryOrderRelaxed,
+  eMemoryOrderAcquire,
+  eMemoryOrderRelease,
+  eMemoryOrderSequential
+};
+
+/**
+Emits a memory fence.
+@param order eMemoryOrderAcquire / eMemoryOrderRelease prevent compiler reordering (x86 / x64 hardware already orders
+them) and eMemoryOrderSequential emits a full memory barrier.
+@throw nothing.
+*/
+inline void AtomicFence(MemoryOrder order)
+{
+  if (order == eMemoryOrderSequential) Impl::FenceSequential();
+  else if (order != eMemoryOrderRelaxed) Impl::FenceAcquireRelease();
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Atomic
 
 Please note that this class has the following usage contract: 
 
-1. Template argument type must offer the required arithmetic operators.
+1. Template argument type must offer the required arithmetic (and bitwise for FetchAnd / FetchOr / FetchXor) operators.
 2. Only the operations provided through Atomic are thread-safe.
-3. U32 and U64 specializations implement lock-free methods to maximize performance.
+3. U32, U64, bool and pointer specializations implement lock-free methods to maximize performance. Any other type 
+falls back to a mutex per operation.
+4. CompareExchange stores the new value only if the current value equals the expected one and always returns the 
+original value (the exchange succeeded if the returned value equals the expected one).
+5. GetAcquire and SetRelease order the surrounding memory accesses: no read or write after GetAcquire can be moved 
+before it and no read or write before SetRelease can be moved after it. Load / Store take an explicit MemoryOrder: 
+Load accepts relaxed, acquire and sequential orders and Store relaxed, release and sequential ones.
+6. Read-modify-write methods (operators, CompareExchange, Exchange and Fetch methods) are sequentially consistent, as
+interlocked instructions are full barriers on x86 / x64. Fetch methods return the original value whereas arithmetic 
+operators return the new one.
 ----------------------------------------------------------------------------------------------------------------------*/	
 template <typename T>
 class Atomic
@@ -57,20 +95,31 @@ public:
   Atomic() : mX() {}
   Atomic(const T x) : mX(x) {}
 
-  Atomic&       operator=(const Atomic& other)        { Lock l(mMutex); mX = other.mX; return *this; }
+  Atomic&       operator=(const Atomic& other)        { T x = other.Get(); Lock l(mMutex); mX = x; return *this; }
   Atomic&       operator=(const T& x)                 { Lock l(mMutex); mX = x; return *this; }
-  bool          operator==(const Atomic& other) const { Lock l(mMutex); return mX == other.mX; }
+  bool          operator==(const Atomic& other) const { return Get() == other.Get(); }
   bool          operator==(const T& x) const          { Lock l(mMutex); return mX == x; }
-  bool          operator!=(const Atomic& other) const { Lock l(mMutex); return mX != other.mX; }
+  bool          operator!=(const Atomic& other) const { return Get() != other.Get(); }
   bool          operator!=(const T& x) const          { Lock l(mMutex); return mX != x; }
   T             operator+=(const T& x)                { Lock l(mMutex); mX += x; return mX; }
-  T&            operator++()                          { Lock l(mMutex); mX += 1; return mX; }
-  T             operator++(I32)                       { Lock l(mMutex); mX += 1; return mX; }
+  T             operator++()                          { Lock l(mMutex); mX += 1; return mX; }
+  T             operator++(I32)                       { Lock l(mMutex); T original = mX; mX += 1; return original; }
   T             operator-=(const T& x)                { Lock l(mMutex); mX -= x; return mX; }
-  T&            operator--()                          { Lock l(mMutex); mX -= 1; return mX; }
-  T             operator--(I32)                       { Lock l(mMutex); mX -= 1; return mX;  }
+  T             operator--()                          { Lock l(mMutex); mX -= 1; return mX; }
+  T             operator--(I32)                       { Lock l(mMutex); T original = mX; mX -= 1; return original; }
+  T             CompareExchange(const T& expected, const T& x) { Lock l(mMutex); T original = mX; if (mX == expected) mX = x; return original; }
+  T             Exchange(const T& x)                  { Lock l(mMutex); T original = mX; mX = x; return original; }
+  T             FetchAdd(const T& x)                  { Lock l(mMutex); T original = mX; mX += x; return original; }
+  T             FetchAnd(const T& x)                  { Lock l(mMutex); T original = mX; mX &= x; return original; }
+  T             FetchOr(const T& x)                   { Lock l(mMutex); T original = mX; mX |= x; return original; }
+  T             FetchSub(const T& x)                  { Lock l(mMutex); T original = mX; mX -= x; return original; }
+  T             FetchXor(const T& x)                  { Lock l(mMutex); T original = mX; mX ^= x; return original; }
   T             Get() const                           { Lock l(mMutex); return mX; }
-  T             Set(const T& x) const                 { Lock l(mMutex); mX = x; }
+  T             GetAcquire() const                    { return Get(); }
+  T             Load(MemoryOrder) const               { return Get(); }
+  void          Set(const T& x)                       { Lock l(mMutex); mX = x; }
+  void          SetRelease(const T& x)                { Set(x); }
+  void          Store(const T& x, MemoryOrder)        { Set(x); }
 
 private:
   mutable Mutex mMutex;
@@ -95,17 +144,36 @@ public:
   bool          operator!=(const U32 x) const         { return Impl::LoadRelaxed32(const_cast<U32*>(&mX)) != x; }
   U32			      operator+=(const U32 x)               { return Impl::AddRelaxed32(&mX, x) + x; }
   U32			      operator++()                          { return Impl::AddRelaxed32(&mX, 1) + 1; }
-  U32			      operator++(int)                       { return Impl::AddRelaxed32(&mX, 1) + 1; }
-  U32			      operator-=(const U32 x)               { return Impl::AddRelaxed32(&mX, -static_cast<I32>(x)) - 1; }
+  U32			      operator++(int)                       { return Impl::AddRelaxed32(&mX, 1); }
+  U32			      operator-=(const U32 x)               { return Impl::AddRelaxed32(&mX, -static_cast<I32>(x)) - x; }
   U32			      operator--()                          { return Impl::AddRelaxed32(&mX, -1) - 1; }
-  U32			      operator--(I32)                       { return Impl::AddRelaxed32(&mX, -1) - 1; }
+  U32			      operator--(I32)                       { return Impl::AddRelaxed32(&mX, -1); }
+  U32           CompareExchange(U32 expected, U32 x)  { return Impl::CompareExchange32(&mX, expected, x); }
+  U32           Exchange(const U32 x)                 { return Impl::Exchange32(&mX, x); }
+  U32           FetchAdd(const U32 x)                 { return Impl::AddRelaxed32(&mX, x); }
+  U32           FetchAnd(const U32 x)                 { return Impl::AndRelaxed32(&mX, x); }
+  U32           FetchOr(const U32 x)                  { return Impl::OrRelaxed32(&mX, x); }
+  U32           FetchSub(const U32 x)                 { return Impl::AddRelaxed32(&mX, -static_cast<I32>(x)); }
+  U32           FetchXor(const U32 x)                 { return Impl::XorRelaxed32(&mX, x); }
   U32			      Get() const                           { return Impl::LoadRelaxed32(const_cast<U32*>(&mX)); }
+  U32           GetAcquire() const                    { return Impl::LoadAcquire32(const_cast<U32*>(&mX)); }
+  U32           Load(MemoryOrder order) const         { return (order == eMemoryOrderRelaxed) ? Get() : GetAcquire(); }
   void          Set(const U32 x)                      { Impl::StoreRelaxed32(&mX, x); }
+  void          SetRelease(const U32 x)               { Impl::StoreRelease32(&mX, x); }
+  void          Store(const U32 x, MemoryOrder order);
 
 private:
   U32 mX;
 };
 
+inline void Atomic<U32>::Store(const U32 x, MemoryOrder order)
+{
+  // A locked exchange is the cheapest sequentially consistent store on x86 / x64
+  if (order == eMemoryOrderSequential) Impl::Exchange32(&mX, x);
+  else if (order == eMemoryOrderRelaxed) Set(x);
+  else SetRelease(x);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 Atomic<U64> specialization
 ----------------------------------------------------------------------------------------------------------------------*/	
@@ -124,16 +192,122 @@ public:
   bool          operator!=(const U64 x) const         { return Impl::LoadRelaxed64(const_cast<U64*>(&mX)) != x; }
   U64			      operator+=(const U64 x)               { return Impl::AddRelaxed64(&mX, x) + x; }
   U64			      operator++()                          { return Impl::AddRelaxed64(&mX, 1) + 1; }
-  U64			      operator++(int)                       { return Impl::AddRelaxed64(&mX, 1) + 1; }
-  U64			      operator-=(const U64 x)               { return Impl::AddRelaxed64(&mX, -static_cast<I64>(x)) - 1; }
+  U64			      operator++(int)                       { return Impl::AddRelaxed64(&mX, 1); }
+  U64			      operator-=(const U64 x)               { return Impl::AddRelaxed64(&mX, -static_cast<I64>(x)) - x; }
   U64			      operator--()                          { return Impl::AddRelaxed64(&mX, -1) - 1; }
-  U64			      operator--(I32)                       { return Impl::AddRelaxed64(&mX, -1) - 1; }
+  U64			      operator--(I32)                       { return Impl::AddRelaxed64(&mX, -1); }
+  U64           CompareExchange(U64 expected, U64 x)  { return Impl::CompareExchange64(&mX, expected, x); }
+  U64           Exchange(const U64 x)                 { return Impl::Exchange64(&mX, x); }
+  U64           FetchAdd(const U64 x)                 { return Impl::AddRelaxed64(&mX, x); }
+  U64           FetchAnd(const U64 x)                 { return Impl::AndRelaxed64(&mX, x); }
+  U64           FetchOr(const U64 x)                  { return Impl::OrRelaxed64(&mX, x); }
+  U64           FetchSub(const U64 x)                 { return Impl::AddRelaxed64(&mX, -static_cast<I64>(x)); }
+  U64           FetchXor(const U64 x)                 { return Impl::XorRelaxed64(&mX, x); }
   U64			      Get() const                           { return Impl::LoadRelaxed64(const_cast<U64*>(&mX)); }
+  U64           GetAcquire() const                    { return Impl::LoadAcquire64(const_cast<U64*>(&mX)); }
+  U64           Load(MemoryOrder order) const         { return (order == eMemoryOrderRelaxed) ? Get() : GetAcquire(); }
   void          Set(const U64 x)                      { Impl::StoreRelaxed64(&mX, x); }
+  void          SetRelease(const U64 x)               { Impl::StoreRelease64(&mX, x); }
+  void          Store(const U64 x, MemoryOrder order);
 
 private:
   U64 mX;
 };
+
+inline void Atomic<U64>::Store(const U64 x, MemoryOrder order)
+{
+  if (order == eMemoryOrderSequential) Impl::Exchange64(&mX, x);
+  else if (order == eMemoryOrderRelaxed) Set(x);
+  else SetRelease(x);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Atomic<bool> specialization
+
+The flag is stored in 32 bits so that the U32 implementation methods can be used.
+----------------------------------------------------------------------------------------------------------------------*/	
+template <>
+class Atomic<bool>
+{
+public:
+  Atomic() : mX(0) {}
+  Atomic(const bool x) : mX(x ? 1 : 0) {}
+
+  Atomic&       operator=(const Atomic& other)        { Impl::StoreRelaxed32(&mX, other.mX); return *this; }
+  Atomic&       operator=(const bool x)               { Set(x); return *this; }
+  bool          operator==(const Atomic& other) const { return Get() == other.Get(); }
+  bool          operator==(const bool x) const        { return Get() == x; }
+  bool          operator!=(const Atomic& other) const { return Get() != other.Get(); }
+  bool          operator!=(const bool x) const        { return Get() != x; }
+  bool          CompareExchange(bool expected, bool x) { return Impl::CompareExchange32(&mX, expected ? 1 : 0, x ? 1 : 0) != 0; }
+  bool          Exchange(const bool x)                { return Impl::Exchange32(&mX, x ? 1 : 0) != 0; }
+  bool          Get() const                           { return Impl::LoadRelaxed32(const_cast<U32*>(&mX)) != 0; }
+  bool          GetAcquire() const                    { return Impl::LoadAcquire32(const_cast<U32*>(&mX)) != 0; }
+  bool          Load(MemoryOrder order) const         { return (order == eMemoryOrderRelaxed) ? Get() : GetAcquire(); }
+  void          Set(const bool x)                     { Impl::StoreRelaxed32(&mX, x ? 1 : 0); }
+  void          SetRelease(const bool x)              { Impl::StoreRelease32(&mX, x ? 1 : 0); }
+  void          Store(const bool x, MemoryOrder order);
+
+private:
+  U32 mX;
+};
+
+inline void Atomic<bool>::Store(const bool x, MemoryOrder order)
+{
+  if (order == eMemoryOrderSequential) Exchange(x);
+  else if (order == eMemoryOrderRelaxed) Set(x);
+  else SetRelease(x);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Atomic<T*> specialization
+
+Arithmetic operators and FetchAdd / FetchSub work in elements (pointer arithmetic), hence T must be a complete type to
+use them.
+----------------------------------------------------------------------------------------------------------------------*/	
+template <typename T>
+class Atomic<T*>
+{
+public:
+  Atomic() : mpX(nullptr) {}
+  Atomic(T* const p) : mpX(p) {}
+
+  Atomic&       operator=(const Atomic& other)        { Set(other.Get()); return *this; }
+  Atomic&       operator=(T* const p)                 { Set(p); return *this; }
+  bool          operator==(const Atomic& other) const { return Get() == other.Get(); }
+  bool          operator==(const T* p) const          { return Get() == p; }
+  bool          operator!=(const Atomic& other) const { return Get() != other.Get(); }
+  bool          operator!=(const T* p) const          { return Get() != p; }
+  T*            operator+=(ptrdiff_t n)               { return FetchAdd(n) + n; }
+  T*            operator++()                          { return FetchAdd(1) + 1; }
+  T*            operator++(int)                       { return FetchAdd(1); }
+  T*            operator-=(ptrdiff_t n)               { return FetchSub(n) - n; }
+  T*            operator--()                          { return FetchSub(1) - 1; }
+  T*            operator--(I32)                       { return FetchSub(1); }
+  T*            CompareExchange(T* expected, T* p)    { return static_cast<T*>(Impl::CompareExchangePtr(GetObject(), expected, p)); }
+  T*            Exchange(T* const p)                  { return static_cast<T*>(Impl::ExchangePtr(GetObject(), p)); }
+  T*            FetchAdd(ptrdiff_t n)                 { return static_cast<T*>(Impl::AddRelaxedPtr(GetObject(), n * static_cast<ptrdiff_t>(sizeof(T)))); }
+  T*            FetchSub(ptrdiff_t n)                 { return FetchAdd(-n); }
+  T*            Get() const                           { return static_cast<T*>(Impl::LoadRelaxedPtr(GetObject())); }
+  T*            GetAcquire() const                    { return static_cast<T*>(Impl::LoadAcquirePtr(GetObject())); }
+  T*            Load(MemoryOrder order) const         { return (order == eMemoryOrderRelaxed) ? Get() : GetAcquire(); }
+  void          Set(T* const p)                       { Impl::StoreRelaxedPtr(GetObject(), p); }
+  void          SetRelease(T* const p)                { Impl::StoreReleasePtr(GetObject(), p); }
+  void          Store(T* const p, MemoryOrder order);
+
+private:
+  T* mpX;
+
+  void**        GetObject() const                     { return reinterpret_cast<void**>(const_cast<T**>(&mpX)); }
+};
+
+template <typename T>
+inline void Atomic<T*>::Store(T* const p, MemoryOrder order)
+{
+  if (order == eMemoryOrderSequential) Exchange(p);
+  else if (order == eMemoryOrderRelaxed) Set(p);
+  else SetRelease(p);
+}
 }
 /*----------------------------------------------------------------------------------------------------------------------
 Atomic types
@@ -143,4 +317,3 @@ typedef Threads::Atomic<U64> A64;
 }
 
 #endif
-
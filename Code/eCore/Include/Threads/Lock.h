@@ -25,7 +25,8 @@ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
 // $Author: $
 
 /** @file Lock.h
-This file defines a helper class, Lock, that can be used to lock mutexes in an exception-safe way.
+This file defines a helper class, Lock, that can be used to lock mutexes in an exception-safe way (and its ReadLock /
+WriteLock counterparts for shared mutexes).
 Lock class implements a RAII idiom ("rein acquisition is initialization") for mutexes. It is 
 strongly advised to use this helper class for locking mutexes rather than calling Mutex::Lock and 
 Mutex::Unlock directly.
@@ -35,6 +36,7 @@ Mutex::Unlock directly.
 #define E3_LOCK_H
 
 #include "Mutex.h"
+#include "SharedMutex.h"
 #include <Base.h>
 
 namespace E
@@ -54,6 +56,38 @@ private:
 	Mutex& mMutex;
 	E_DISABLE_COPY_AND_ASSSIGNMENT(Lock)
 };
+
+/*----------------------------------------------------------------------------------------------------------------------
+ReadLock
+
+Shared (reader) lock of a SharedMutex.
+----------------------------------------------------------------------------------------------------------------------*/	
+class ReadLock
+{
+public:
+	explicit ReadLock(SharedMutex& m) : mMutex(m) { mMutex.LockShared(); }
+	~ReadLock() { mMutex.UnlockShared(); }
+
+private:
+	SharedMutex& mMutex;
+	E_DISABLE_COPY_AND_ASSSIGNMENT(ReadLock)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+WriteLock
+
+Exclusive (writer) lock of a SharedMutex.
+----------------------------------------------------------------------------------------------------------------------*/	
+class WriteLock
+{
+public:
+	explicit WriteLock(SharedMutex& m) : mMutex(m) { mMutex.Lock(); }
+	~WriteLock() { mMutex.Unlock(); }
+
+private:
+	SharedMutex& mMutex;
+	E_DISABLE_COPY_AND_ASSSIGNMENT(WriteLock)
+};
 }
 }
 
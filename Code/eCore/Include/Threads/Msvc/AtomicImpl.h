@@ -42,10 +42,33 @@ namespace Impl
 {
   inline U32  AddRelaxed32(U32* pObject, I32 operand) { return _InterlockedExchangeAdd((long *) pObject, operand); }
   U64         AddRelaxed64(U64* pObject, I64 operand);
+  void*       AddRelaxedPtr(void** ppObject, ptrdiff_t operand);
+  inline U32  AndRelaxed32(U32* pObject, U32 operand) { return _InterlockedAnd((long *) pObject, operand); }
+  U64         AndRelaxed64(U64* pObject, U64 operand);
+  inline U32  CompareExchange32(U32* pObject, U32 expected, U32 desired) { return _InterlockedCompareExchange((long *) pObject, desired, expected); }
+  inline U64  CompareExchange64(U64* pObject, U64 expected, U64 desired) { return _InterlockedCompareExchange64((LONGLONG *) pObject, desired, expected); }
+  inline void* CompareExchangePtr(void** ppObject, void* expected, void* desired) { return _InterlockedCompareExchangePointer(ppObject, desired, expected); }
+  inline U32  Exchange32(U32* pObject, U32 desired) { return _InterlockedExchange((long *) pObject, desired); }
+  U64         Exchange64(U64* pObject, U64 desired);
+  inline void* ExchangePtr(void** ppObject, void* desired) { return _InterlockedExchangePointer(ppObject, desired); }
+  inline void FenceAcquireRelease() { _ReadWriteBarrier(); }
+  inline void FenceSequential() { MemoryBarrier(); }
+  inline U32  LoadAcquire32(U32* pObject) { U32 value = *static_cast<volatile U32*>(pObject); _ReadWriteBarrier(); return value; }
+  U64         LoadAcquire64(U64* pObject);
+  inline void* LoadAcquirePtr(void** ppObject) { void* value = *static_cast<void* volatile*>(ppObject); _ReadWriteBarrier(); return value; }
   inline U32  LoadRelaxed32(U32* pObject) { return *pObject; }
   U64         LoadRelaxed64(U64* pObject);             
+  inline void* LoadRelaxedPtr(void** ppObject) { return *ppObject; }
+  inline U32  OrRelaxed32(U32* pObject, U32 operand) { return _InterlockedOr((long *) pObject, operand); }
+  U64         OrRelaxed64(U64* pObject, U64 operand);
   inline void StoreRelaxed32(U32* pObject, U32 operand) { *pObject = operand; }
   void        StoreRelaxed64(U64* pObject, U64 operand);
+  inline void StoreRelaxedPtr(void** ppObject, void* operand) { *ppObject = operand; }
+  inline void StoreRelease32(U32* pObject, U32 operand) { _ReadWriteBarrier(); *static_cast<volatile U32*>(pObject) = operand; }
+  void        StoreRelease64(U64* pObject, U64 operand);
+  inline void StoreReleasePtr(void** ppObject, void* operand) { _ReadWriteBarrier(); *static_cast<void* volatile*>(ppObject) = operand; }
+  inline U32  XorRelaxed32(U32* pObject, U32 operand) { return _InterlockedXor((long *) pObject, operand); }
+  U64         XorRelaxed64(U64* pObject, U64 operand);
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -76,6 +99,121 @@ inline U64 Impl::AddRelaxed64(U64* pObject, I64 operand)
   #endif   
 }
 
+/*----------------------------------------------------------------------------------------------------------------------
+AddRelaxedPtr
+
+Pointer sized exchange add. Note that the operand is a byte offset.
+----------------------------------------------------------------------------------------------------------------------*/
+inline void* Impl::AddRelaxedPtr(void** ppObject, ptrdiff_t operand)
+{
+  #ifdef E_CPU_X64
+    return reinterpret_cast<void*>(_InterlockedExchangeAdd64((LONGLONG *) ppObject, operand));
+  #else
+    return reinterpret_cast<void*>(_InterlockedExchangeAdd((long *) ppObject, operand));
+  #endif
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AndRelaxed64 / Exchange64 / OrRelaxed64 / XorRelaxed64
+
+As with AddRelaxed64, 32-bit x86 lacks 64-bit interlocked instructions, so these are CAS loops returning the original
+value.
+----------------------------------------------------------------------------------------------------------------------*/
+inline U64 Impl::AndRelaxed64(U64* pObject, U64 operand)
+{ 
+  #ifdef E_CPU_X64
+    return _InterlockedAnd64((LONGLONG *) pObject, operand);
+  #else
+    U64 expected = *pObject;
+    for (;;)
+    {
+      U64 original = _InterlockedCompareExchange64((LONGLONG *) pObject, expected & operand, expected);
+      if (original == expected)
+        return original;
+      expected = original;
+    }
+  #endif   
+}
+
+inline U64 Impl::Exchange64(U64* pObject, U64 desired)
+{ 
+  #ifdef E_CPU_X64
+    return _InterlockedExchange64((LONGLONG *) pObject, desired);
+  #else
+    U64 expected = *pObject;
+    for (;;)
+    {
+      U64 original = _InterlockedCompareExchange64((LONGLONG *) pObject, desired, expected);
+      if (original == expected)
+        return original;
+      expected = original;
+    }
+  #endif   
+}
+
+inline U64 Impl::OrRelaxed64(U64* pObject, U64 operand)
+{ 
+  #ifdef E_CPU_X64
+    return _InterlockedOr64((LONGLONG *) pObject, operand);
+  #else
+    U64 expected = *pObject;
+    for (;;)
+    {
+      U64 original = _InterlockedCompareExchange64((LONGLONG *) pObject, expected | operand, expected);
+      if (original == expected)
+        return original;
+      expected = original;
+    }
+  #endif   
+}
+
+inline U64 Impl::XorRelaxed64(U64* pObject, U64 operand)
+{ 
+  #ifdef E_CPU_X64
+    return _InterlockedXor64((LONGLONG *) pObject, operand);
+  #else
+    U64 expected = *pObject;
+    for (;;)
+    {
+      U64 original = _InterlockedCompareExchange64((LONGLONG *) pObject, expected ^ operand, expected);
+      if (original == expected)
+        return original;
+      expected = original;
+    }
+  #endif   
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+LoadAcquire32 / StoreRelease32
+
+x86 / x64 loads already have acquire semantics and stores release semantics at the hardware level, so we only need to
+prevent the compiler from reordering memory accesses around them (_ReadWriteBarrier). FenceSequential emits a full 
+memory barrier which is required to order a store followed by a load (e.g. the Chase-Lev deque Pop method).
+
+The same applies to the 64-bit and pointer versions. On 32-bit x86 LoadRelaxed64 already uses a locked instruction 
+and StoreRelaxed64 a cmpxchg8b loop, so only the compiler barrier is added.
+----------------------------------------------------------------------------------------------------------------------*/
+inline U64 Impl::LoadAcquire64(U64* pObject)
+{ 
+  #ifdef E_CPU_X64
+    U64 value = *static_cast<volatile U64*>(pObject);
+  #else
+    U64 value = LoadRelaxed64(pObject);
+  #endif
+  _ReadWriteBarrier(); 
+  return value;
+}
+
+inline void Impl::StoreRelease64(U64* pObject, U64 operand)
+{ 
+  _ReadWriteBarrier();
+  #ifdef E_CPU_X64
+    *static_cast<volatile U64*>(pObject) = operand;
+  #else
+    StoreRelaxed64(pObject, operand);
+  #endif
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 LoadRelaxed64
 
@@ -0,0 +1,72 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SharedMutex.h
+This file declares a SharedMutex (reader-writer lock) class. As Mutex, it delegates the lock functionality in a 
+private implementation class that will have separate implementations (depending on OS). SharedMutexImpl.h contains the
+specific platform implementation.
+*/
+
+#ifndef E3_SHARED_MUTEX_H
+#define E3_SHARED_MUTEX_H
+
+#include <Base.h>
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SharedMutex
+
+SharedMutex allows either several concurrent readers (LockShared) or a single writer (Lock). It is intended for read 
+mostly data (e.g. resource registries) where a Mutex would serialize readers.
+
+Please note that this class has the following usage contract: 
+
+1. SharedMutex is NOT recursive (unlike Mutex): a thread must not lock it again, either shared or exclusively, while 
+holding it.
+2. A shared lock can not be upgraded to an exclusive one.
+3. It is strongly advised to use the ReadLock / WriteLock helpers (Lock.h) rather than calling the methods directly.
+----------------------------------------------------------------------------------------------------------------------*/	
+class SharedMutex
+{
+public:
+  E_API SharedMutex();
+  E_API ~SharedMutex();
+
+  E_API void Lock();
+  E_API void LockShared();
+  E_API void Unlock();
+  E_API void UnlockShared();
+
+private:
+  E_PIMPL mpImpl;
+  E_DISABLE_COPY_AND_ASSSIGNMENT(SharedMutex)
+};
+}
+}
+
+#endif
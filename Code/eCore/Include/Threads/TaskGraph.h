@@ -0,0 +1,181 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file TaskGraph.h
+This file declares the TaskGraph class. TaskGraph runs a directed acyclic graph of IRunnable items through a ThreadPool
+with no blocking waits between dependent items.
+*/
+
+#ifndef E3_TASK_GRAPH_H
+#define E3_TASK_GRAPH_H
+
+#include "IRunnable.h"
+#include "Atomic.h"
+#include "Mutex.h"
+#include "ConditionVariable.h"
+#include "Lock.h"
+#include "ThreadPool.h"
+#include <Containers/List.h>
+#include <Time/Time.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_TASK_GRAPH_CYCLE         "Task graph dependencies must not contain cycles"
+#define E_ASSERT_MSG_TASK_GRAPH_HANDLE_VALUE  "Task handle value (%d) must be smaller than task count (%d)"
+#define E_ASSERT_MSG_TASK_GRAPH_RUNNING       "Task graph cannot be modified or run while running"
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+IParallelForRunnable
+
+Parallel for body interface. Run is called once per batch with the [begin, end) index range of the batch, possibly from
+several threads at the same time.
+----------------------------------------------------------------------------------------------------------------------*/
+class IParallelForRunnable
+{
+public:
+  virtual       ~IParallelForRunnable() {}
+  virtual void  Run(U32 begin, U32 end) = 0;
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph
+
+Every task owns an atomic counter of unfinished dependencies. When a task finishes it decrements the counters of the
+tasks depending on it and adds the tasks reaching zero to the ThreadPool, so no thread ever blocks waiting for a
+dependency. The time spent by every task is recorded in order to report the critical path time (the longest dependency
+chain) of each run, which is the lower bound of the run time regardless of the number of threads.
+
+Please note that this class has the following usage contract:
+
+1. The graph MUST be built (AddTask, AddContinuation, AddParallelFor, DependsOn) while it is not running.
+2. DependsOn MUST not create cycles (checked by an assertion on Run).
+3. Run returns immediately. Either poll IsFinished, provide a completion item (run by the thread finishing the last
+task) or call Wait.
+4. Items MUST remain valid until the run finishes. Items of a graph can not be added to the ThreadPool by other means
+while the graph is running (ThreadPool requires pending items to be unique).
+5. A parallel for task splits [0, count) in batches of batchSize indices which are run concurrently. The task finishes
+when all its batches finish.
+6. If the ThreadPool rejects an item (maximum pending item count reached) the item is run by the calling thread.
+7. Wait MUST not be called from a task of the same graph. Destruction waits for the current run to finish.
+----------------------------------------------------------------------------------------------------------------------*/
+class TaskGraph
+{
+public:
+  typedef U32 Handle;
+
+  static const Handle kInvalidHandle;
+
+  E_API TaskGraph();
+  E_API ~TaskGraph();
+
+  // Accessors
+  E_API const Memory::IAllocator* GetAllocator() const;
+  E_API TimeValue                 GetCriticalPathTime() const;  // Gets the longest dependency chain time of the last run
+  E_API TimeValue                 GetRunTime() const;           // Gets the total time of the last run
+  E_API U32                       GetTaskCount() const;
+  E_API ThreadPool*               GetThreadPool() const;
+  E_API bool                      IsFinished() const;           // Returns true if the graph is not running
+  E_API void                      SetAllocator(Memory::IAllocator* p);
+  E_API void                      SetThreadPool(ThreadPool* p);
+
+  // Methods
+  E_API Handle                    AddContinuation(Handle task, IRunnable* pItem); // Adds a task depending on task
+  E_API Handle                    AddParallelFor(IParallelForRunnable* pBody, U32 count, U32 batchSize);
+  E_API Handle                    AddTask(IRunnable* pItem);
+  E_API void                      Clear();
+  E_API void                      DependsOn(Handle task, Handle dependency);  // Makes task wait for dependency
+  E_API void                      Run(IRunnable* pCompletionItem = nullptr);
+  E_API void                      Wait();
+
+private:
+  struct Task : public IRunnable
+  {
+    I32                           Run();
+
+    TaskGraph*                    pGraph;
+    IRunnable*                    pItem;
+    IParallelForRunnable*         pBody;
+    U32                           index;
+    U32                           dependencyCount;
+    U32                           firstSuccessor;
+    U32                           successorCount;
+    U32                           firstBatch;
+    U32                           batchCount;
+    I64                           startTime;
+    I64                           finishTime;
+    A32                           pendingDependencyCount;
+    A32                           pendingBatchCount;
+  };
+
+  struct Batch : public IRunnable
+  {
+    I32                           Run();
+
+    TaskGraph*                    pGraph;
+    U32                           task;
+    U32                           begin;
+    U32                           end;
+  };
+
+  typedef Containers::List<Task>  TaskList;
+  typedef Containers::List<Batch> BatchList;
+  typedef Containers::List<U32>   U32List;
+
+  mutable Mutex                   mMutex;
+  ConditionVariable               mFinishCondition;
+  TaskList                        mTaskList;
+  BatchList                       mBatchList;
+  U32List                         mEdgeFromList;          // Dependency edges (dependency -> task) in insertion order
+  U32List                         mEdgeToList;
+  U32List                         mSuccessorList;         // Successor indices grouped by task (built on Run)
+  U32List                         mOrderList;             // Topological order (built on Run)
+  Memory::IAllocator*             mpAllocator;
+  ThreadPool*                     mpThreadPool;
+  IRunnable*                      mpCompletionItem;
+  TimeValue                       mCriticalPathTime;
+  TimeValue                       mRunTime;
+  I64                             mStartTime;
+  A32                             mPendingTaskCount;
+  bool                            mRunningFlag;
+  bool                            mRunFlag;               // The graph has been run at least once
+
+  void                            Build();
+  void                            CompleteTask(Task& task);
+  void                            ExecuteTask(Task& task);
+  void                            Finish();
+  void                            Submit(IRunnable* pItem);
+  void                            WaitForThreadPoolItems();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(TaskGraph)
+};
+}
+}
+
+#endif
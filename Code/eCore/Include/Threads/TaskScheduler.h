@@ -0,0 +1,146 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file TaskScheduler.h
+This file declares the TaskScheduler class. TaskScheduler implements a work stealing scheduler for IRunnable items.
+*/
+
+#ifndef E3_TASK_SCHEDULER_H
+#define E3_TASK_SCHEDULER_H
+
+#include "IRunnable.h"
+#include "Atomic.h"
+#include "Mutex.h"
+#include "ConditionVariable.h"
+#include "Lock.h"
+#include "WorkStealingQueue.h"
+#include <Containers/List.h>
+#include <Containers/Queue.h>
+#include <Math/Comparison.h>
+#include <Memory/Memory.h>
+
+namespace E
+{
+namespace Threads
+{
+//Forward declarations
+class TaskScheduler;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Threads API methods
+
+Please note that this namespace methods have the same usage contract as the Threads::Global::GetThreadPool method: the
+process (executable / DLL) using the global task scheduler should call Threads::Global::GetTaskScheduler().CleanUp()
+before finalization in order to have a clean exit.
+----------------------------------------------------------------------------------------------------------------------*/
+namespace Global
+{
+  E_API TaskScheduler& GetTaskScheduler();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler
+
+TaskScheduler is the work stealing alternative to ThreadPool, aimed at large numbers of small items. Every worker
+thread owns a lock-free WorkStealingQueue: items added from a worker thread (e.g. an item spawning other items) are
+pushed into the worker local queue without locking. Items added from any other thread are pushed into a shared queue
+which workers drain in batches into their local queues. Idle workers steal from the other workers queues before going
+to sleep.
+
+This class is thread-safe.
+
+Please note that this class has the following usage contract:
+
+1. TaskScheduler does not create any threads on construction but on the first AddItem call.
+2. AddItem always succeeds (there is no maximum pending item count). The item MUST remain valid until it is run.
+3. Items are not guaranteed to run in any particular order.
+4. WaitForIdle waits for all added items (including the items added by running items) to complete. WaitForIdle MUST
+NOT be called from an item run by the scheduler (it would dead lock).
+5. SetWorkerCount and CleanUp wait for all pending items to complete before terminating the current workers. Items 
+added meanwhile from other threads are run by a new set of workers.
+6. CleanUp is called upon destruction.
+----------------------------------------------------------------------------------------------------------------------*/
+class TaskScheduler
+{
+public:
+  E_API TaskScheduler();
+  E_API ~TaskScheduler();
+
+  // Accessors
+  E_API const Memory::IAllocator* GetAllocator() const;
+  E_API U32                       GetPendingItemCount() const;  // Gets the current number of items waiting to be run
+  E_API U32                       GetUnfinishedItemCount() const; // Gets the current number of pending or running items
+  E_API U32                       GetWorkerCount() const;       // Gets the number of worker threads
+  E_API bool                      HasPendingItems() const;      // Returns true if there are items waiting to be run
+  E_API bool                      IsIdle() const;               // Returns true if there are no pending or running items
+  E_API void                      SetAllocator(Memory::IAllocator* p);
+  E_API void                      SetWorkerCount(U32 v);        // Sets the number of worker threads
+
+  // Methods
+  E_API bool                      AddItem(IRunnable* pItem);    // Schedules a IRunnable object for execution
+  E_API void                      CleanUp();                    // Waits for idle and terminates all worker threads
+  E_API void                      WaitForIdle();                // Makes the calling thread wait till all items finish
+
+private:
+  class Worker;
+
+  typedef Containers::List<Worker*>     WorkerList;
+  typedef Containers::Queue<IRunnable*> IRunnableQueue;
+
+  static const U32                kMaxSharedBatchCount;   // Maximum number of items taken from the shared queue at once
+
+  mutable Mutex                   mWorkerMutex;
+  mutable Mutex                   mSharedQueueMutex;
+  Mutex                           mSleepMutex;
+  ConditionVariable               mSleepCondition;
+  Mutex                           mIdleMutex;
+  ConditionVariable               mIdleCondition;
+  WorkerList                      mWorkerList;
+  IRunnableQueue                  mSharedQueue;           // Queue of items added from non worker threads
+  Memory::IAllocator*             mpAllocator;
+  A32                             mSharedItemCount;       // Shared queue count (allows checking the queue without locking)
+  A32                             mPendingItemCount;      // Added items not taken by any worker yet
+  A32                             mUnfinishedItemCount;   // Added items not completed yet
+  A32                             mSleepingWorkerCount;
+  A32                             mItemSequence;          // Increased every time items are published to the workers
+  A32                             mRunningFlag;
+  U32                             mWorkerCount;
+  bool                            mTerminationFlag;
+
+  void                            CreateWorkers();
+  void                            DestroyWorkers();
+  IRunnable*                      FindItem(Worker* pWorker);
+  void                            OnItemCompletion();
+  IRunnable*                      PopSharedItems(Worker* pWorker);
+  IRunnable*                      StealItem(Worker* pWorker);
+  bool                            WaitForItem(U32 itemSequence);
+  void                            WakeWorkers(bool all);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(TaskScheduler)
+};
+}
+}
+
+#endif
@@ -0,0 +1,69 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ThreadLocal.h
+This file declares a ThreadLocal class. By using a "pimpl" idiom, it delegates thread local storage functionality in a
+private implementation class that will have separate implementations (depending on OS). ThreadLocalImpl.h contains the
+specific platform implementation.
+*/
+
+#ifndef E3_THREAD_LOCAL_H
+#define E3_THREAD_LOCAL_H
+
+#include <Base.h>
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ThreadLocal
+
+ThreadLocal stores a pointer per thread and per instance (unlike E_THREAD_LOCAL static variables which are per thread
+only). 
+
+Please note that this class has the following usage contract: 
+
+1. Get returns nullptr for threads which did not call Set.
+2. ThreadLocal does not own the stored pointers: it is up to the user to release them.
+3. The number of ThreadLocal instances is limited by the OS (1088 in Windows).
+----------------------------------------------------------------------------------------------------------------------*/	
+class ThreadLocal
+{
+public:
+  E_API ThreadLocal();
+  E_API ~ThreadLocal();
+
+  E_API void* Get() const;
+  E_API void  Set(void* p);
+
+private:
+  E_PIMPL mpImpl;
+  E_DISABLE_COPY_AND_ASSSIGNMENT(ThreadLocal)
+};
+}
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file WorkStealingQueue.h
+This file defines the WorkStealingQueue class. WorkStealingQueue implements a fixed capacity Chase-Lev lock-free
+work stealing deque. Based on "Dynamic Circular Work-Stealing Deque" by David Chase and Yossi Lev (SPAA 2005) and
+"Correct and Efficient Work-Stealing for Weak Memory Models" by Le, Pop, Cohen and Zappa Nardelli (PPoPP 2013).
+*/
+
+#ifndef E3_WORK_STEALING_QUEUE_H
+#define E3_WORK_STEALING_QUEUE_H
+
+#include "Atomic.h"
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+WorkStealingQueue
+
+Please note that this class has the following usage contract:
+
+1. T MUST be a pointer type (nullptr is used to report an empty queue or a lost race).
+2. Capacity MUST be a power of 2.
+3. Push and Pop MUST only be called by the owner thread. Push and Pop work on the bottom end of the deque (LIFO) which
+favors cache locality for the owner thread.
+4. Steal can be called by any thread. Steal works on the top end of the deque (FIFO) taking the oldest item.
+5. Push returns false when the queue is full (the caller is responsible of handling the overflow).
+6. Steal returns nullptr both when the queue is empty and when another thread won the race for the same item.
+7. GetCount is an approximation when called from a thread other than the owner.
+----------------------------------------------------------------------------------------------------------------------*/
+template <typename T, U32 Capacity = 4096>
+class WorkStealingQueue
+{
+public:
+  WorkStealingQueue();
+  ~WorkStealingQueue();
+
+  // Accessors
+  U32               GetCapacity() const;
+  U32               GetCount() const;
+  bool              IsEmpty() const;
+
+  // Methods
+  T                 Pop();
+  bool              Push(T item);
+  T                 Steal();
+
+private:
+  static const U32  kMask = Capacity - 1;
+  // Top and bottom indices are kept in separate cache lines to avoid false sharing between the owner and the thieves
+  U32               mTop;
+  U8                mTopPadding[64 - sizeof(U32)];
+  U32               mBottom;
+  U8                mBottomPadding[64 - sizeof(U32)];
+  T                 mData[Capacity];
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(WorkStealingQueue)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+WorkStealingQueue initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, U32 Capacity>
+inline WorkStealingQueue<T, Capacity>::WorkStealingQueue()
+  : mTop(0)
+  , mBottom(0)
+{
+  static_assert(PodTypeTraits<T>::value, E_STATIC_ASSERT_MSG_TYPES_IS_POD(T));
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+}
+
+template <typename T, U32 Capacity>
+inline WorkStealingQueue<T, Capacity>::~WorkStealingQueue() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+WorkStealingQueue accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, U32 Capacity>
+inline U32 WorkStealingQueue<T, Capacity>::GetCapacity() const
+{
+  return Capacity;
+}
+
+template <typename T, U32 Capacity>
+inline U32 WorkStealingQueue<T, Capacity>::GetCount() const
+{
+  I32 count = static_cast<I32>(Impl::LoadAcquire32(const_cast<U32*>(&mBottom)) - Impl::LoadAcquire32(const_cast<U32*>(&mTop)));
+  return (count > 0) ? static_cast<U32>(count) : 0;
+}
+
+template <typename T, U32 Capacity>
+inline bool WorkStealingQueue<T, Capacity>::IsEmpty() const
+{
+  return GetCount() == 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+WorkStealingQueue methods
+
+Note that indices are unsigned and allowed to wrap around, so index distances are always computed as signed
+differences.
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename T, U32 Capacity>
+inline T WorkStealingQueue<T, Capacity>::Pop()
+{
+  U32 bottom = Impl::LoadRelaxed32(&mBottom) - 1;
+  Impl::StoreRelaxed32(&mBottom, bottom);
+  // The bottom store MUST be visible before reading the top index (store-load ordering requires a full fence)
+  Impl::FenceSequential();
+  U32 top = Impl::LoadAcquire32(&mTop);
+  if (static_cast<I32>(bottom - top) < 0)
+  {
+    // Empty queue: restore bottom
+    Impl::StoreRelaxed32(&mBottom, top);
+    return nullptr;
+  }
+  T item = mData[bottom & kMask];
+  if (bottom != top) return item;
+
+  // Last item: race against thieves by incrementing the top index
+  if (Impl::CompareExchange32(&mTop, top, top + 1) != top) item = nullptr;
+  Impl::StoreRelaxed32(&mBottom, top + 1);
+  return item;
+}
+
+template <typename T, U32 Capacity>
+inline bool WorkStealingQueue<T, Capacity>::Push(T item)
+{
+  U32 bottom = Impl::LoadRelaxed32(&mBottom);
+  U32 top = Impl::LoadAcquire32(&mTop);
+  if (static_cast<I32>(bottom - top) >= static_cast<I32>(Capacity)) return false;
+  mData[bottom & kMask] = item;
+  // The item MUST be visible before publishing the new bottom index
+  Impl::StoreRelease32(&mBottom, bottom + 1);
+  return true;
+}
+
+template <typename T, U32 Capacity>
+inline T WorkStealingQueue<T, Capacity>::Steal()
+{
+  U32 top = Impl::LoadAcquire32(&mTop);
+  Impl::FenceSequential();
+  U32 bottom = Impl::LoadAcquire32(&mBottom);
+  if (static_cast<I32>(bottom - top) <= 0) return nullptr;
+  T item = mData[top & kMask];
+  // Claim the item. Failure means either the owner popped the last item or another thief got it first.
+  return (Impl::CompareExchange32(&mTop, top, top + 1) == top) ? item : nullptr;
+}
+}
+}
+
+#endif
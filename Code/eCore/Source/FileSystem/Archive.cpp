@@ -33,6 +33,14 @@ This file defines file system utility functions to work with files and directori
 
 #include <CorePch.h>
 #include <fstream>
+#ifdef WIN32
+#include "Win32/ArchiveImpl.h"
+#endif
+
+/*----------------------------------------------------------------------------------------------------------------------
+Archive assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_ARCHIVE_NOT_MAPPED   "Archive must be open in eOpenModeMap mode"
 
 namespace E
 {
@@ -43,8 +51,10 @@ Archive initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/	
 
 Archive::Archive()
+  : mPosition(0)
+  , mSize(0)
+  , mpImpl(new Impl())
 {
-
 }
 
 Archive::~Archive()
@@ -56,9 +66,66 @@ Archive::~Archive()
 Archive accessors
 ----------------------------------------------------------------------------------------------------------------------*/	
 
+const U8* Archive::GetData() const
+{
+  E_ASSERT_MSG(IsMapped(), E_ASSERT_MSG_ARCHIVE_NOT_MAPPED);
+  return mpImpl->GetData();
+}
+
+const Path& Archive::GetPath() const
+{
+  return mFilePath;
+}
+
+size_t Archive::GetPosition()
+{
+  if (IsMapped()) return mPosition;
+  return static_cast<size_t>(mFileStream.tellg());
+}
+
+size_t Archive::GetResidentSize(size_t offset, size_t length) const
+{
+  // Ranges are clamped to the file end like views
+  if (offset > mSize) return 0;
+  return mpImpl->GetResidentSize(offset, Math::Min(length, mSize - offset));
+}
+
+size_t Archive::GetSize() const
+{
+  return mSize;
+}
+
+Archive::View Archive::GetView(size_t offset, size_t length) const
+{
+  E_ASSERT_MSG(IsMapped(), E_ASSERT_MSG_ARCHIVE_NOT_MAPPED);
+  // Views are clamped to the file end (offset + length could also wrap around)
+  if (!IsMapped() || offset > mSize) return View();
+  return View(mpImpl->GetData() + offset, Math::Min(length, mSize - offset));
+}
+
+bool Archive::IsMapped() const
+{
+  return mpImpl->IsOpen();
+}
+
 bool Archive::IsOpen() const
 {
-  return mFileStream.is_open();
+  return mFileStream.is_open() || mpImpl->IsOpen();
+}
+
+void Archive::SetPosition(size_t position)
+{
+  if (IsMapped())
+  {
+    // Seeking past the file end stops at it, so Read and ReadView never go past the mapping
+    mPosition = Math::Min(position, mSize);
+  }
+  else
+  {
+    mFileStream.clear();
+    mFileStream.seekg(position);
+    mFileStream.seekp(position);
+  }
 }
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -67,37 +134,91 @@ Archive methods
 
 void Archive::Close()
 {
-  mFileStream.close();
+  if (mFileStream.is_open()) mFileStream.close();
+  mpImpl->Close();
   mFilePath.Clear();
+  mPosition = 0;
+  mSize = 0;
 }
 
-bool Archive::Open(const Path& filePath, OpenMode openMode /* = eOpenModeRead */)
+bool Archive::Open(const Path& filePath, OpenMode openMode /* = eOpenModeRead */, 
+                   AccessPattern accessPattern /* = eAccessPatternNormal */)
 {
   E_ASSERT(filePath.GetLength());
-  if (openMode == eOpenModeRead)
+  Close();
+  if (openMode == eOpenModeMap)
+  {
+    if (!mpImpl->Open(filePath, accessPattern)) return false;
+    mSize = mpImpl->GetSize();
+  }
+  else if (openMode == eOpenModeRead)
   {
-    mFileStream.open(filePath.GetPtr(), std::ios::in);
+    mFileStream.open(filePath.GetPtr(), std::ios::in | std::ios::binary);
+    if (!mFileStream.is_open()) return false;
+    mFileStream.seekg(0, std::ios::end);
+    mSize = static_cast<size_t>(mFileStream.tellg());
+    mFileStream.seekg(0, std::ios::beg);
   }
   else if (openMode == eOpenModeWrite)
   {
-    mFileStream.open(filePath.GetPtr(), std::ios::out);
+    mFileStream.open(filePath.GetPtr(), std::ios::out | std::ios::binary);
   }
   else
   {
-    mFileStream.open(filePath.GetPtr(), std::ios::app);
+    mFileStream.open(filePath.GetPtr(), std::ios::app | std::ios::binary);
   }
 
-  return mFileStream.is_open();
+  if (!IsOpen()) return false;
+  mFilePath = filePath;
+  return true;
+}
+
+void Archive::Prefetch(size_t offset, size_t length) const
+{
+  if (offset > mSize) return;
+  mpImpl->Prefetch(offset, Math::Min(length, mSize - offset));
 }
 
 void Archive::Read(char* pTarget, size_t length)
 {
-  mFileStream.read(pTarget, length);
+  if (IsMapped())
+  {
+    // Short read at the file end, like the stream mode
+    length = Math::Min(length, mSize - mPosition);
+    Memory::Copy(pTarget, reinterpret_cast<const char*>(mpImpl->GetData() + mPosition), length);
+    mPosition += length;
+  }
+  else
+  {
+    mFileStream.read(pTarget, length);
+  }
+}
+
+Archive::View Archive::ReadView(size_t length)
+{
+  View view = GetView(mPosition, length);
+  mPosition += view.size;
+  return view;
+}
+
+void Archive::Release(size_t offset, size_t length) const
+{
+  if (offset > mSize) return;
+  mpImpl->Release(offset, Math::Min(length, mSize - offset));
 }
 
 void Archive::Write(const char* pSource, size_t length)
 {
   mFileStream.write(pSource, length);
 }
+
+/*----------------------------------------------------------------------------------------------------------------------
+Archive static methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+U64 Archive::GetPageFaultCount()
+{
+  return Impl::GetPageFaultCount();
+}
 }
 }
@@ -93,6 +93,11 @@ bool Directory::GetChildren(const Path& path, PathList& directoryList, U8 fileFl
   return Impl::GetChildren(path, directoryList, fileFlags);
 }
 
+bool Directory::GetChildren(const Path& path, PathList& pathList, InfoList& infoList, U8 fileFlags)
+{
+  return Impl::GetChildren(path, pathList, infoList, fileFlags);
+}
+
 Path Directory::GetParent(const Path& path)
 {
   return Impl::GetParent(path);
@@ -0,0 +1,562 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file IoQueue.cpp
+This file defines the IoQueue class.
+*/
+
+#include <CorePch.h>
+#ifdef WIN32
+#include "Win32/IoQueueImpl.h"
+#endif
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_IO_QUEUE_REQUEST_BUSY      "Request is already pending or in flight"
+#define E_ASSERT_MSG_IO_QUEUE_REQUEST_TARGET    "Request target buffer is nullptr"
+#define E_ASSERT_MSG_IO_QUEUE_IN_FLIGHT_COUNT   "In flight count must be in the [1, kMaxInFlightCount] range"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Reader
+
+A reader thread class of the eBackendThreadPool backend, which pulls pending requests from its IoQueue and reads them 
+through blocking Archive reads.
+
+Please note that this class has the following usage contract:
+
+1. SetQueue MUST be called before Start.
+2. The reader thread exits when the queue sets its termination flag, so destruction waits for the thread to finish.
+3. In flight reads are split in kReadChunkSize reads, checking the request cancel flag between them.
+----------------------------------------------------------------------------------------------------------------------*/
+class IoQueue::Reader : public Threads::IRunnable
+{
+public:
+  Reader();
+  ~Reader();
+
+  // Accessors
+  void                        SetQueue(IoQueue* pQueue);
+
+  // Methods
+  void                        Start();
+
+private:
+  static const size_t         kReadChunkSize;
+
+  IoQueue*                    mpQueue;
+  Threads::Thread             mThread;
+
+  Status                      Read(Request& request, size_t& readSize);
+  I32                         Run();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Reader)
+};
+
+const size_t IoQueue::Reader::kReadChunkSize = 1024 * 1024;
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Reader initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Known warning: passing this in the initializer list. In Reader construction, the Thread member gets a reference to
+// this as a IRunnable object (whose Run method is executed in Thread::Start).
+#pragma warning(push)
+#pragma warning (disable:4355)
+IoQueue::Reader::Reader()
+  : mpQueue(nullptr)
+  , mThread(*this)
+{
+}
+#pragma warning(pop)
+
+IoQueue::Reader::~Reader()
+{
+  // Destruction follows the queue termination flag being set, so the thread is about to exit its run
+  mThread.WaitForTermination();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Reader accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+void IoQueue::Reader::SetQueue(IoQueue* pQueue)
+{
+  mpQueue = pQueue;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Reader methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void IoQueue::Reader::Start()
+{
+  E_ASSERT_PTR(mpQueue);
+  mThread.SetName("IoQueue::Reader");
+  mThread.Start();
+}
+
+/**
+Reads a request into its target buffer.
+@param request the request to read.
+@param readSize gets the number of bytes read.
+@return the request final status.
+@throw nothing.
+*/
+IoQueue::Status IoQueue::Reader::Read(Request& request, size_t& readSize)
+{
+  readSize = 0;
+  Archive archive;
+  if (!archive.Open(request.filePath)) return eStatusFailed;
+  if (request.offset >= archive.GetSize()) return eStatusCompleted;
+
+  const size_t offset = static_cast<size_t>(request.offset);
+  const size_t size = Math::Min(request.size, archive.GetSize() - offset);
+  archive.SetPosition(offset);
+  while (readSize < size)
+  {
+    if (request.mCancelFlag.Get()) return eStatusCancelled;
+    const size_t length = Math::Min(size - readSize, kReadChunkSize);
+    archive.Read(reinterpret_cast<char*>(request.pTarget + readSize), length);
+    readSize += length;
+  }
+  return eStatusCompleted;
+}
+
+I32 IoQueue::Reader::Run()
+{
+  for (;;)
+  {
+    Request* pRequest = nullptr;
+    // [Critical section]
+    {
+      Threads::Lock l(mpQueue->mMutex);
+      while (!mpQueue->mTerminationFlag && (pRequest = mpQueue->PopPending()) == nullptr) 
+      {
+        mpQueue->mPendingCondition.Wait(mpQueue->mMutex);
+      }
+      if (pRequest == nullptr) return 0;
+    }
+    size_t readSize = 0;
+    const Status status = Read(*pRequest, readSize);
+    mpQueue->Complete(pRequest, status, readSize);
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Request initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+IoQueue::Request::Request()
+  : pTarget(nullptr)
+  , size(0)
+  , offset(0)
+  , pCompletion(nullptr)
+  , mpNext(nullptr)
+  , mpPrev(nullptr)
+  , mReadSize(0)
+  , mStatus(eStatusNone)
+  , mPriority(ePriorityNormal)
+{
+}
+
+IoQueue::Request::Request(const Path& filePath, U8* pTarget, size_t size, U64 offset /* = 0 */, 
+                          Threads::IRunnable* pCompletion /* = nullptr */)
+  : filePath(filePath)
+  , pTarget(pTarget)
+  , size(size)
+  , offset(offset)
+  , pCompletion(pCompletion)
+  , mpNext(nullptr)
+  , mpPrev(nullptr)
+  , mReadSize(0)
+  , mStatus(eStatusNone)
+  , mPriority(ePriorityNormal)
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Request accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+size_t IoQueue::Request::GetReadSize() const
+{
+  // The read size is written before the status is released
+  return IsDone() ? mReadSize : 0;
+}
+
+IoQueue::Status IoQueue::Request::GetStatus() const
+{
+  return static_cast<Status>(mStatus.GetAcquire());
+}
+
+bool IoQueue::Request::IsDone() const
+{
+  return GetStatus() >= eStatusCompleted;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Known warning: passing this in the initializer list. The native backend gets a reference to this queue to pull its 
+// pending requests (not before they are submitted).
+#pragma warning(push)
+#pragma warning (disable:4355)
+IoQueue::IoQueue(Backend backend /* = eBackendNative */)
+  : mpPendingHeads()
+  , mpPendingTails()
+  , mpInFlightHead(nullptr)
+  , mpInFlightTail(nullptr)
+  , mpThreadPool(&Threads::Global::GetThreadPool())
+  , mBackend(backend)
+  , mInFlightCount(0)
+  , mMaxInFlightCount(kDefaultMaxInFlightCount)
+  , mPendingCount(0)
+  , mTerminationFlag(false)
+  , mpImpl(backend == eBackendNative ? new Impl(*this) : nullptr)
+{
+  if (mpImpl && !mpImpl->IsAvailable()) mBackend = eBackendThreadPool;
+}
+#pragma warning(pop)
+
+IoQueue::~IoQueue()
+{
+  CancelAll();
+  WaitForIdle();
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    mTerminationFlag = true;
+    mPendingCondition.Broadcast();
+  }
+  for (auto it = begin(mReaderList); it != end(mReaderList); ++it)
+  {
+    E_DELETE(*it, 1);
+  }
+  mReaderList.Clear();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+IoQueue::Backend IoQueue::GetBackend() const
+{
+  return mBackend;
+}
+
+U32 IoQueue::GetInFlightCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mInFlightCount;
+}
+
+U32 IoQueue::GetMaxInFlightCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mMaxInFlightCount;
+}
+
+U32 IoQueue::GetPendingCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mPendingCount;
+}
+
+bool IoQueue::IsIdle() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mPendingCount == 0 && mInFlightCount == 0;
+}
+
+void IoQueue::SetMaxInFlightCount(U32 v)
+{
+  E_ASSERT_MSG(v > 0 && v <= kMaxInFlightCount, E_ASSERT_MSG_IO_QUEUE_IN_FLIGHT_COUNT);
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    mMaxInFlightCount = v;
+    mPendingCondition.Broadcast();
+  }
+  if (mBackend == eBackendNative) mpImpl->Notify();
+}
+
+void IoQueue::SetThreadPool(Threads::ThreadPool* pThreadPool)
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  mpThreadPool = pThreadPool;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Cancels a request: pending requests are done (cancelled) on return whereas in flight reads are aborted (they may still
+complete).
+@param request the request to cancel.
+@return false if the request is already done (or not submitted), true otherwise.
+@throw nothing.
+*/
+bool IoQueue::Cancel(Request& request)
+{
+  Threads::IRunnable* pCompletion = nullptr;
+  Threads::ThreadPool* pThreadPool = nullptr;
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    const Status status = static_cast<Status>(request.mStatus.Get());
+    if (status == eStatusInProgress)
+    {
+      request.mCancelFlag = 1;
+      if (mBackend == eBackendNative) mpImpl->Notify();
+      return true;
+    }
+    if (status != eStatusPending) return false;
+    Unlink(mpPendingHeads[request.mPriority], mpPendingTails[request.mPriority], &request);
+    --mPendingCount;
+    pThreadPool = mpThreadPool;
+    pCompletion = Finish(&request, eStatusCancelled, 0);
+  }
+  Dispatch(pCompletion, pThreadPool);
+  return true;
+}
+
+void IoQueue::CancelAll()
+{
+  Containers::List<Threads::IRunnable*> completionList;
+  Threads::ThreadPool* pThreadPool = nullptr;
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    for (U32 i = 0; i < ePriorityCount; ++i)
+    {
+      while (mpPendingHeads[i])
+      {
+        Request* pRequest = mpPendingHeads[i];
+        Unlink(mpPendingHeads[i], mpPendingTails[i], pRequest);
+        --mPendingCount;
+        Threads::IRunnable* pCompletion = Finish(pRequest, eStatusCancelled, 0);
+        if (pCompletion) completionList.PushBack(pCompletion);
+      }
+    }
+    for (Request* pRequest = mpInFlightHead; pRequest; pRequest = pRequest->mpNext) pRequest->mCancelFlag = 1;
+    pThreadPool = mpThreadPool;
+  }
+  if (mBackend == eBackendNative) mpImpl->Notify();
+  for (auto it = begin(completionList); it != end(completionList); ++it) Dispatch(*it, pThreadPool);
+}
+
+void IoQueue::Submit(Request& request, Priority priority /* = ePriorityNormal */)
+{
+  Submit(&request, 1, priority);
+}
+
+/**
+Queues a batch of requests.
+@param pRequests the requests to queue.
+@param count the request count.
+@param priority the priority of the requests.
+@throw nothing (very rare STL exceptions).
+*/
+void IoQueue::Submit(Request* pRequests, size_t count, Priority priority /* = ePriorityNormal */)
+{
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    for (size_t i = 0; i < count; ++i)
+    {
+      Request& request = pRequests[i];
+      E_ASSERT_MSG(request.mStatus.Get() != eStatusPending && request.mStatus.Get() != eStatusInProgress, 
+                   E_ASSERT_MSG_IO_QUEUE_REQUEST_BUSY);
+      E_ASSERT_MSG(request.pTarget || request.size == 0, E_ASSERT_MSG_IO_QUEUE_REQUEST_TARGET);
+      request.mReadSize = 0;
+      request.mCancelFlag = 0;
+      request.mStatus = eStatusPending;
+      request.mPriority = priority;
+      Link(mpPendingHeads[priority], mpPendingTails[priority], &request);
+    }
+    mPendingCount += static_cast<U32>(count);
+
+    if (mBackend == eBackendThreadPool)
+    {
+      // Create enough readers to keep the maximum in flight count (reader threads are kept until destruction)
+      const U32 readerCount = Math::Min(mMaxInFlightCount, mInFlightCount + mPendingCount);
+      while (mReaderList.GetCount() < readerCount)
+      {
+        Reader* pReader = E_NEW(Reader, 1);
+        pReader->SetQueue(this);
+        mReaderList.PushBack(pReader);
+        pReader->Start();
+      }
+      mPendingCondition.Broadcast();
+    }
+  }
+  if (mBackend == eBackendNative) mpImpl->Notify();
+}
+
+void IoQueue::Wait(const Request& request)
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  for (;;)
+  {
+    const U32 status = request.mStatus.Get();
+    if (status != eStatusPending && status != eStatusInProgress) return;
+    mDoneCondition.Wait(mMutex);
+  }
+}
+
+void IoQueue::WaitForIdle()
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  while (mPendingCount || mInFlightCount) mDoneCondition.Wait(mMutex);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Finishes an in flight request (called from the I/O threads). The in flight slot is released once the completion is
+dispatched.
+@throw nothing (very rare STL exceptions).
+*/
+void IoQueue::Complete(Request* pRequest, Status status, size_t readSize)
+{
+  Threads::IRunnable* pCompletion = nullptr;
+  Threads::ThreadPool* pThreadPool = nullptr;
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    Unlink(mpInFlightHead, mpInFlightTail, pRequest);
+    pThreadPool = mpThreadPool;
+    pCompletion = Finish(pRequest, status, readSize);
+  }
+  Dispatch(pCompletion, pThreadPool);
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    E_ASSERT(mInFlightCount > 0);
+    --mInFlightCount;
+    // A reader may issue the next pending request
+    mPendingCondition.Signal();
+    mDoneCondition.Broadcast();
+  }
+}
+
+/**
+Runs a completion returned by Finish on the given thread pool (or on the calling thread).
+@throw nothing (very rare STL exceptions).
+*/
+void IoQueue::Dispatch(Threads::IRunnable* pCompletion, Threads::ThreadPool* pThreadPool)
+{
+  if (pCompletion == nullptr) return;
+  if (pThreadPool == nullptr || !pThreadPool->AddItem(pCompletion)) pCompletion->Run();
+}
+
+/**
+Sets the final status of a request [mMutex MUST be locked]. The request MUST NOT be accessed afterwards as its owner 
+may destroy it right away.
+@return the request completion runnable.
+@throw nothing.
+*/
+Threads::IRunnable* IoQueue::Finish(Request* pRequest, Status status, size_t readSize)
+{
+  Threads::IRunnable* pCompletion = pRequest->pCompletion;
+  pRequest->mReadSize = readSize;
+  pRequest->mStatus.SetRelease(status);
+  mDoneCondition.Broadcast();
+  return pCompletion;
+}
+
+/**
+Takes the highest priority pending request if the maximum in flight count has not been reached [mMutex MUST be 
+locked].
+@return the request to issue or nullptr if none.
+@throw nothing.
+*/
+IoQueue::Request* IoQueue::PopPending()
+{
+  if (mPendingCount == 0 || mInFlightCount >= mMaxInFlightCount) return nullptr;
+  for (I32 i = ePriorityCount - 1; i >= 0; --i)
+  {
+    Request* pRequest = mpPendingHeads[i];
+    if (pRequest)
+    {
+      Unlink(mpPendingHeads[i], mpPendingTails[i], pRequest);
+      --mPendingCount;
+      Link(mpInFlightHead, mpInFlightTail, pRequest);
+      ++mInFlightCount;
+      pRequest->mStatus = eStatusInProgress;
+      return pRequest;
+    }
+  }
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue static methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Appends a request to a request list [mMutex MUST be locked].
+@throw nothing.
+*/
+void IoQueue::Link(Request*& pHead, Request*& pTail, Request* pRequest)
+{
+  pRequest->mpNext = nullptr;
+  pRequest->mpPrev = pTail;
+  if (pTail) pTail->mpNext = pRequest;
+  else pHead = pRequest;
+  pTail = pRequest;
+}
+
+/**
+Removes a request from a request list [mMutex MUST be locked].
+@throw nothing.
+*/
+void IoQueue::Unlink(Request*& pHead, Request*& pTail, Request* pRequest)
+{
+  if (pRequest->mpPrev) pRequest->mpPrev->mpNext = pRequest->mpNext;
+  else pHead = pRequest->mpNext;
+  if (pRequest->mpNext) pRequest->mpNext->mpPrev = pRequest->mpPrev;
+  else pTail = pRequest->mpPrev;
+  pRequest->mpNext = nullptr;
+  pRequest->mpPrev = nullptr;
+}
+}
+}
@@ -0,0 +1,430 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Pack.cpp
+This file defines the Pack and PackWriter classes.
+*/
+
+#include <CorePch.h>
+#include <Math/Hash.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+Pack assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_PACK_ENTRY_INDEX     "Entry index is out of range"
+#define E_ASSERT_MSG_PACK_NOT_OPEN        "Pack is not open"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Pack auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+namespace
+{
+const size_t kCopyBufferSize = 1024 * 1024;
+const U32 kMinSlotCount = 16;
+const U8 kZeros[Pack::kAlignment] = {};
+
+// Turns a relative path into an entry path: '/' separators and no leading separators
+inline Path GetEntryPath(const Path& path)
+{
+  size_t start = 0;
+  while (start < path.GetLength() && (path[start] == '/' || path[start] == '\\')) ++start;
+  Path entryPath(path.GetPtr() + start, path.GetLength() - start);
+  for (size_t i = 0; i < entryPath.GetLength(); ++i) if (entryPath[i] == '\\') entryPath[i] = '/';
+  return entryPath;
+}
+
+inline U32 GetSlotCount(size_t entryCount)
+{
+  return Math::CeilPowerOf2(Math::Max(static_cast<U32>(entryCount * 2), kMinSlotCount));
+}
+
+// Returns the entry index or kInvalidIndex if the entry path is not found
+inline U32 FindEntry(const Pack::Slot* pSlots, U32 slotCount, const Pack::Entry* pEntries, const char* pNames, 
+                     const Path& entryPath, U32 hash)
+{
+  const U32 mask = slotCount - 1;
+  for (U32 i = hash & mask, probeCount = 0; probeCount < slotCount; i = (i + 1) & mask, ++probeCount)
+  {
+    const Pack::Slot& slot = pSlots[i];
+    if (slot.entryIndex == Pack::kInvalidIndex) break;
+    if (slot.hash != hash) continue;
+    const Pack::Entry& entry = pEntries[slot.entryIndex];
+    if (entry.nameLength == entryPath.GetLength() && 
+        Memory::IsEqual(pNames + entry.nameOffset, entryPath.GetPtr(), entryPath.GetLength())) 
+    {
+      return slot.entryIndex;
+    }
+  }
+  return Pack::kInvalidIndex;
+}
+
+inline void InsertSlot(Pack::Slot* pSlots, U32 slotCount, U32 hash, U32 entryIndex)
+{
+  const U32 mask = slotCount - 1;
+  U32 i = hash & mask;
+  while (pSlots[i].entryIndex != Pack::kInvalidIndex) i = (i + 1) & mask;
+  pSlots[i].hash = hash;
+  pSlots[i].entryIndex = entryIndex;
+}
+
+inline U64 GetAlignedSize(U64 size)
+{
+  return (size + Pack::kAlignment - 1) & ~static_cast<U64>(Pack::kAlignment - 1);
+}
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Pack initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+Pack::Pack()
+  : mpHeader(nullptr)
+  , mpSlots(nullptr)
+  , mpEntries(nullptr)
+  , mpNames(nullptr)
+{
+}
+
+Pack::~Pack()
+{
+  Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Pack accessors
+----------------------------------------------------------------------------------------------------------------------*/	
+
+const Archive& Pack::GetArchive() const
+{
+  return mArchive;
+}
+
+const Pack::Entry& Pack::GetEntry(size_t index) const
+{
+  E_ASSERT_MSG(index < GetEntryCount(), E_ASSERT_MSG_PACK_ENTRY_INDEX);
+  return mpEntries[index];
+}
+
+size_t Pack::GetEntryCount() const
+{
+  return mpHeader ? mpHeader->entryCount : 0;
+}
+
+const char* Pack::GetName(const Entry& entry) const
+{
+  E_ASSERT_MSG(IsOpen(), E_ASSERT_MSG_PACK_NOT_OPEN);
+  return mpNames + entry.nameOffset;
+}
+
+const Path& Pack::GetPath() const
+{
+  return mArchive.GetPath();
+}
+
+Archive::View Pack::GetView(const Entry& entry) const
+{
+  E_ASSERT_MSG(IsOpen(), E_ASSERT_MSG_PACK_NOT_OPEN);
+  return mArchive.GetView(static_cast<size_t>(entry.offset), static_cast<size_t>(entry.storedSize));
+}
+
+bool Pack::IsOpen() const
+{
+  return mpHeader != nullptr;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Pack methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+void Pack::Close()
+{
+  mArchive.Close();
+  mpHeader = nullptr;
+  mpSlots = nullptr;
+  mpEntries = nullptr;
+  mpNames = nullptr;
+}
+
+const Pack::Entry* Pack::Find(const Path& entryPath) const
+{
+  E_ASSERT_MSG(IsOpen(), E_ASSERT_MSG_PACK_NOT_OPEN);
+  const Path key = GetEntryPath(entryPath);
+  const U32 entryIndex = FindEntry(mpSlots, mpHeader->slotCount, mpEntries, mpNames, key, Math::Fnv32<Path>::Hash(key));
+  return entryIndex != kInvalidIndex ? &mpEntries[entryIndex] : nullptr;
+}
+
+bool Pack::Open(const Path& packPath, Archive::AccessPattern accessPattern /* = Archive::eAccessPatternRandom */)
+{
+  Close();
+  if (!mArchive.Open(packPath, Archive::eOpenModeMap, accessPattern)) return false;
+  if (mArchive.GetSize() < kAlignment) 
+  {
+    mArchive.Close();
+    return false;
+  }
+
+  if (!Load())
+  {
+    Close();
+    return false;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Pack private methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+// Sets up the table of contents pointers, checking the whole table so that lookups and views never go out of the pack
+// bounds
+bool Pack::Load()
+{
+  const Header& header = *reinterpret_cast<const Header*>(mArchive.GetData());
+  if (header.magic != kMagic || header.version != kVersion) return false;
+  if (header.slotCount < kMinSlotCount || (header.slotCount & (header.slotCount - 1)) != 0 || 
+      header.slotCount < static_cast<U64>(header.entryCount) * 2) return false;
+  const U64 fileSize = mArchive.GetSize();
+  const U64 tableSize = static_cast<U64>(header.slotCount) * sizeof(Slot) + 
+                        static_cast<U64>(header.entryCount) * sizeof(Entry);
+  if (header.tocOffset < kAlignment || header.tocOffset % kAlignment != 0 || header.tocOffset > fileSize || 
+      header.nameTableSize > fileSize || tableSize + header.nameTableSize > fileSize - header.tocOffset) return false;
+
+  mpHeader = &header;
+  mpSlots = reinterpret_cast<const Slot*>(mArchive.GetData() + header.tocOffset);
+  mpEntries = reinterpret_cast<const Entry*>(mpSlots + header.slotCount);
+  mpNames = reinterpret_cast<const char*>(mpEntries + header.entryCount);
+
+  for (U32 i = 0; i < header.slotCount; ++i)
+  {
+    if (mpSlots[i].entryIndex != kInvalidIndex && mpSlots[i].entryIndex >= header.entryCount) return false;
+  }
+  for (U32 i = 0; i < header.entryCount; ++i)
+  {
+    const Entry& entry = mpEntries[i];
+    if (entry.offset % kAlignment != 0 || entry.offset < kAlignment || entry.storedSize > header.tocOffset || 
+        entry.offset > header.tocOffset - entry.storedSize) return false;
+    if (static_cast<U64>(entry.nameOffset) + entry.nameLength >= header.nameTableSize || 
+        mpNames[entry.nameOffset + entry.nameLength] != 0) return false;
+  }
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackWriter initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+PackWriter::PackWriter()
+  : mPosition(0)
+{
+}
+
+PackWriter::~PackWriter()
+{
+  Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackWriter accessors
+----------------------------------------------------------------------------------------------------------------------*/	
+
+size_t PackWriter::GetEntryCount() const
+{
+  return mEntryList.GetCount();
+}
+
+bool PackWriter::IsOpen() const
+{
+  return mArchive.IsOpen();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackWriter methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+bool PackWriter::Add(const Path& entryPath, const U8* pData, size_t size)
+{
+  Pack::Entry* pEntry = AddEntry(entryPath, 0);
+  if (!pEntry) return false;
+  Write(pData, size);
+  EndEntry(*pEntry, size);
+  return true;
+}
+
+bool PackWriter::AddCompressed(const Path& entryPath, const U8* pData, size_t storedSize, size_t size, 
+                               U16 flags /* = 0 */)
+{
+  Pack::Entry* pEntry = AddEntry(entryPath, flags | Pack::eEntryFlagCompressed);
+  if (!pEntry) return false;
+  Write(pData, storedSize);
+  EndEntry(*pEntry, size);
+  return true;
+}
+
+bool PackWriter::AddDirectory(const Path& directoryPath)
+{
+  return AddChildren(directoryPath, directoryPath.GetLength() + 1);
+}
+
+bool PackWriter::AddFile(const Path& entryPath, const Path& filePath)
+{
+  Archive archive;
+  if (!archive.Open(filePath)) return false;
+  Pack::Entry* pEntry = AddEntry(entryPath, 0);
+  if (!pEntry) return false;
+
+  if (mBuffer.GetSize() == 0) mBuffer.Resize(kCopyBufferSize);
+  for (size_t offset = 0; offset < archive.GetSize(); offset += mBuffer.GetSize())
+  {
+    const size_t length = Math::Min(archive.GetSize() - offset, mBuffer.GetSize());
+    archive.Read(reinterpret_cast<char*>(mBuffer.GetPtr()), length);
+    Write(mBuffer.GetPtr(), length);
+  }
+  EndEntry(*pEntry, archive.GetSize());
+  return true;
+}
+
+bool PackWriter::Close()
+{
+  if (!IsOpen()) return false;
+
+  Pack::Header header;
+  header.magic = Pack::kMagic;
+  header.version = Pack::kVersion;
+  header.entryCount = static_cast<U32>(mEntryList.GetCount());
+  header.slotCount = static_cast<U32>(mSlotList.GetCount());
+  header.tocOffset = mPosition;
+  header.nameTableSize = mNameList.GetCount();
+  if (header.slotCount == 0)
+  {
+    header.slotCount = GetSlotCount(0);
+    Pack::Slot emptySlot = { 0, Pack::kInvalidIndex };
+    mSlotList = SlotList(header.slotCount, emptySlot);
+  }
+  Write(mSlotList.GetPtr(), mSlotList.GetCount() * sizeof(Pack::Slot));
+  Write(mEntryList.GetPtr(), mEntryList.GetCount() * sizeof(Pack::Entry));
+  Write(mNameList.GetPtr(), mNameList.GetCount());
+  // The header goes last so that an interrupted write leaves an invalid pack
+  mArchive.SetPosition(0);
+  mArchive.Write(reinterpret_cast<const char*>(&header), sizeof(header));
+  mArchive.Close();
+
+  mEntryList.Clear();
+  mNameList.Clear();
+  mSlotList.Clear();
+  mPosition = 0;
+  return true;
+}
+
+bool PackWriter::Open(const Path& packPath)
+{
+  Close();
+  if (!mArchive.Open(packPath, Archive::eOpenModeWrite)) return false;
+  // Header placeholder
+  Write(kZeros, Pack::kAlignment);
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+PackWriter private methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+bool PackWriter::AddChildren(const Path& directoryPath, size_t basePathLength)
+{
+  PathList pathList;
+  if (!Directory::GetChildren(directoryPath, pathList, File::eFlagFile)) return false;
+  for (auto it = begin(pathList); it != end(pathList); ++it)
+  {
+    if (!AddFile(it->GetPtr() + basePathLength, *it)) return false;
+  }
+
+  pathList.Clear();
+  if (!Directory::GetChildren(directoryPath, pathList, File::eFlagDirectory)) return false;
+  for (auto it = begin(pathList); it != end(pathList); ++it)
+  {
+    if (!AddChildren(*it, basePathLength)) return false;
+  }
+  return true;
+}
+
+Pack::Entry* PackWriter::AddEntry(const Path& entryPath, U16 flags)
+{
+  E_ASSERT_MSG(IsOpen(), E_ASSERT_MSG_PACK_NOT_OPEN);
+  const Path key = GetEntryPath(entryPath);
+  if (key.GetLength() == 0) return nullptr;
+  const U32 hash = Math::Fnv32<Path>::Hash(key);
+  if (FindEntry(mSlotList.GetPtr(), static_cast<U32>(mSlotList.GetCount()), mEntryList.GetPtr(), mNameList.GetPtr(), 
+                key, hash) != Pack::kInvalidIndex) return nullptr;
+
+  // Grow the slot table to keep it at most half full
+  const U32 entryIndex = static_cast<U32>(mEntryList.GetCount());
+  const U32 slotCount = GetSlotCount(entryIndex + 1);
+  if (slotCount != mSlotList.GetCount())
+  {
+    Pack::Slot emptySlot = { 0, Pack::kInvalidIndex };
+    SlotList slotList(slotCount, emptySlot);
+    for (auto it = begin(mSlotList); it != end(mSlotList); ++it)
+    {
+      if (it->entryIndex != Pack::kInvalidIndex) InsertSlot(slotList.GetPtr(), slotCount, it->hash, it->entryIndex);
+    }
+    mSlotList = std::move(slotList);
+  }
+  InsertSlot(mSlotList.GetPtr(), slotCount, hash, entryIndex);
+
+  Pack::Entry entry;
+  entry.offset = mPosition;
+  entry.storedSize = 0;
+  entry.size = 0;
+  entry.nameOffset = static_cast<U32>(mNameList.GetCount());
+  entry.nameLength = static_cast<U16>(key.GetLength());
+  entry.flags = flags;
+  mEntryList.PushBack(entry);
+  mNameList.PushBack(key.GetPtr(), key.GetLength() + 1);
+  return &mEntryList[entryIndex];
+}
+
+void PackWriter::EndEntry(Pack::Entry& entry, U64 size)
+{
+  entry.storedSize = mPosition - entry.offset;
+  entry.size = size;
+  Pad();
+}
+
+// Pads the pack up to the next multiple of kAlignment
+void PackWriter::Pad()
+{
+  Write(kZeros, static_cast<size_t>(GetAlignedSize(mPosition) - mPosition));
+}
+
+void PackWriter::Write(const void* pSource, size_t length)
+{
+  mArchive.Write(static_cast<const char*>(pSource), length);
+  mPosition += length;
+}
+}
+}
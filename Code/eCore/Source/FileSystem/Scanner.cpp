@@ -0,0 +1,461 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Scanner.cpp
+This file defines the Scanner class.
+*/
+
+#include <CorePch.h>
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_SCANNER_WORKER_COUNT   "Worker count must be in the [1, kMaxWorkerCount] range"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+namespace
+{
+// Cache file layout (native byte order): [CacheHeader] and listingCount times [CacheRecord] [Path characters] 
+// [infoCount File::Info values] [nameListSize bytes of zero terminated names]
+struct CacheHeader
+{
+  U32         magic;
+  U32         version;
+  U32         infoSize;     // sizeof(File::Info) of the build writing the cache
+  U32         listingCount;
+};
+
+struct CacheRecord
+{
+  Time::Date  lastWriteTime;
+  U32         pathLength;
+  U32         infoCount;
+  U32         nameListSize;
+};
+
+// Applies the Directory::GetChildren file flags filter
+inline bool IsMatch(U8 flags, U8 fileFlags)
+{
+  if (!(flags & fileFlags & File::eFlagAny)) return false;
+  if (fileFlags & File::eFlagReadOnly && !(flags & File::eFlagReadOnly)) return false;
+  return !(fileFlags & File::eFlagHidden && !(flags & File::eFlagHidden));
+}
+
+// Copies size bytes into pTarget, returns false if they go past the end of the data
+inline bool ReadCache(const U8*& pCurrent, const U8* pEnd, void* pTarget, size_t size)
+{
+  if (static_cast<size_t>(pEnd - pCurrent) < size) return false;
+  memcpy(pTarget, pCurrent, size);
+  pCurrent += size;
+  return true;
+}
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner::Worker
+
+A scan worker, which walks directories popped from the scanner task list, pushing their subdirectories back.
+
+Please note that this class has the following usage contract:
+
+1. SetScanner MUST be called before running the worker.
+2. Run returns once the task list is empty and no worker is walking a directory (which could add more tasks).
+3. Items, listings and directory counts are worker local during the scan (so walking needs no locking), the scanner 
+gathers them once all the workers are done.
+----------------------------------------------------------------------------------------------------------------------*/
+class Scanner::Worker : public Threads::IRunnable
+{
+public:
+  Worker();
+
+  // Accessors
+  void                        SetScanner(Scanner* pScanner);
+
+  // Methods
+  void                        Clear();
+  I32                         Run();
+
+  ItemList                    itemList;
+  ListingMap                  listingMap;
+  size_t                      reusedDirectoryCount;
+  size_t                      scannedDirectoryCount;
+
+private:
+  Scanner*                    mpScanner;
+  PathList                    mPathList;
+  TaskList                    mTaskList;                    // Subdirectories found walking the current task
+
+  void                        Walk(const Task& task);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Worker)
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner::Worker initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+Scanner::Worker::Worker()
+  : reusedDirectoryCount(0)
+  , scannedDirectoryCount(0)
+  , mpScanner(nullptr)
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner::Worker accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+void Scanner::Worker::SetScanner(Scanner* pScanner)
+{
+  mpScanner = pScanner;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner::Worker methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void Scanner::Worker::Clear()
+{
+  itemList.Clear();
+  listingMap.Clear();
+  reusedDirectoryCount = 0;
+  scannedDirectoryCount = 0;
+  mTaskList.Clear();
+}
+
+I32 Scanner::Worker::Run()
+{
+  E_ASSERT_PTR(mpScanner);
+  Scanner& scanner = *mpScanner;
+  bool isBusy = false;
+  Task task;
+  for (;;)
+  {
+    // [Critical section]
+    {
+      Threads::Lock l(scanner.mMutex);
+      if (isBusy)
+      {
+        // Hand over the subdirectories found walking the previous task
+        if (!mTaskList.IsEmpty())
+        {
+          scanner.mTaskList.PushBack(mTaskList);
+          mTaskList.Clear();
+          scanner.mTaskCondition.Broadcast();
+        }
+        --scanner.mBusyCount;
+        isBusy = false;
+      }
+      while (scanner.mTaskList.IsEmpty() && scanner.mBusyCount > 0) scanner.mTaskCondition.Wait(scanner.mMutex);
+      // Scan is over
+      if (scanner.mTaskList.IsEmpty())
+      {
+        scanner.mTaskCondition.Broadcast();
+        return 0;
+      }
+      // Depth first, which keeps the task list short
+      task = *scanner.mTaskList.GetBack();
+      scanner.mTaskList.PopBack();
+      ++scanner.mBusyCount;
+      isBusy = true;
+    }
+    Walk(task);
+  }
+}
+
+/**
+Lists a directory, taking its listing from the cache when the directory last write time did not change.
+@param task the directory to list.
+@throw nothing.
+*/
+void Scanner::Worker::Walk(const Task& task)
+{
+  Listing listing;
+  listing.lastWriteTime = task.lastWriteTime;
+  mPathList.Clear();
+
+  const Listing* pCachedListing = mpScanner->mListingMap.FindValue(task.path);
+  if (pCachedListing && Memory::IsEqual(&pCachedListing->lastWriteTime, &task.lastWriteTime))
+  {
+    listing.infoList = pCachedListing->infoList;
+    listing.nameList = pCachedListing->nameList;
+    Path childPath = task.path;
+    const char* pName = listing.nameList.GetPtr();
+    for (size_t i = 0; i < listing.infoList.GetCount(); ++i)
+    {
+      childPath.SetLength(task.path.GetLength());
+      childPath += pName;
+      pName += Text::GetLength(pName) + 1;
+      mPathList.PushBack(childPath);
+      // A subdirectory last write time changes along with its own entries, which the cached info does not account for
+      File::Info& info = listing.infoList[i];
+      if (info.flags & File::eFlagDirectory) File::GetInfo(childPath, info);
+    }
+    ++reusedDirectoryCount;
+  }
+  else
+  {
+    // Unreadable directories are neither cached nor walked
+    if (!Directory::GetChildren(task.path, mPathList, listing.infoList)) return;
+    for (auto it = begin(mPathList); it != end(mPathList); ++it)
+    {
+      listing.nameList.PushBack((*it).GetPtr() + task.path.GetLength(), (*it).GetLength() - task.path.GetLength());
+      listing.nameList.PushBack('\0');
+    }
+    ++scannedDirectoryCount;
+  }
+
+  for (size_t i = 0; i < mPathList.GetCount(); ++i)
+  {
+    const File::Info& info = listing.infoList[i];
+    if (IsMatch(info.flags, mpScanner->mFileFlags))
+    {
+      Item item;
+      item.path = mPathList[i];
+      item.info = info;
+      itemList.PushBack(item);
+    }
+    if ((info.flags & File::eFlagDirectory) && !(info.flags & File::eFlagLink))
+    {
+      Task childTask;
+      childTask.path = mPathList[i];
+      childTask.lastWriteTime = info.lastWriteTime;
+      mTaskList.PushBack(childTask);
+    }
+  }
+  listingMap.Insert(task.path, std::move(listing));
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+Scanner::Scanner()
+  : mpThreadPool(&Threads::Global::GetThreadPool())
+  , mReusedDirectoryCount(0)
+  , mScannedDirectoryCount(0)
+  , mBusyCount(0)
+  , mMaxWorkerCount(kDefaultMaxWorkerCount)
+  , mFileFlags(File::eFlagAny)
+{
+}
+
+Scanner::~Scanner()
+{
+  for (auto it = begin(mWorkerList); it != end(mWorkerList); ++it)
+  {
+    E_DELETE(*it, 1);
+  }
+  mWorkerList.Clear();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+size_t Scanner::GetCachedDirectoryCount() const
+{
+  return mListingMap.GetCount();
+}
+
+U32 Scanner::GetMaxWorkerCount() const
+{
+  return mMaxWorkerCount;
+}
+
+size_t Scanner::GetReusedDirectoryCount() const
+{
+  return mReusedDirectoryCount;
+}
+
+size_t Scanner::GetScannedDirectoryCount() const
+{
+  return mScannedDirectoryCount;
+}
+
+void Scanner::SetMaxWorkerCount(U32 v)
+{
+  E_ASSERT_MSG(v > 0 && v <= kMaxWorkerCount, E_ASSERT_MSG_SCANNER_WORKER_COUNT);
+  mMaxWorkerCount = v;
+}
+
+void Scanner::SetThreadPool(Threads::ThreadPool* pThreadPool)
+{
+  mpThreadPool = pThreadPool;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Scanner methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void Scanner::ClearCache()
+{
+  mListingMap.Clear();
+}
+
+bool Scanner::LoadCache(const Path& cachePath)
+{
+  Archive archive;
+  if (!archive.Open(cachePath, Archive::eOpenModeMap, Archive::eAccessPatternSequential)) return false;
+
+  const U8* pCurrent = archive.GetData();
+  const U8* pEnd = pCurrent + archive.GetSize();
+  CacheHeader header;
+  if (!ReadCache(pCurrent, pEnd, &header, sizeof(header)) || header.magic != kCacheMagic || 
+      header.version != kCacheVersion || header.infoSize != sizeof(File::Info)) return false;
+
+  ListingMap listingMap;
+  for (U32 i = 0; i < header.listingCount; ++i)
+  {
+    CacheRecord record;
+    if (!ReadCache(pCurrent, pEnd, &record, sizeof(record))) return false;
+    if (record.pathLength == 0 || record.pathLength >= E_INTERNAL_SETTING_PATH_SIZE) return false;
+    if (static_cast<size_t>(pEnd - pCurrent) < record.pathLength) return false;
+    Path path(reinterpret_cast<const char*>(pCurrent), record.pathLength);
+    pCurrent += record.pathLength;
+
+    Listing listing;
+    listing.lastWriteTime = record.lastWriteTime;
+    listing.infoList.Reserve(record.infoCount);
+    for (U32 j = 0; j < record.infoCount; ++j)
+    {
+      File::Info info;
+      if (!ReadCache(pCurrent, pEnd, &info, sizeof(info))) return false;
+      listing.infoList.PushBack(info);
+    }
+
+    // Names must be one non empty zero terminated name per info, fitting a Path once appended to the directory path
+    if (static_cast<size_t>(pEnd - pCurrent) < record.nameListSize) return false;
+    const char* pNames = reinterpret_cast<const char*>(pCurrent);
+    size_t nameCount = 0;
+    for (size_t start = 0, j = 0; j < record.nameListSize; ++j)
+    {
+      if (pNames[j] != 0) continue;
+      if (j == start || record.pathLength + j - start >= E_INTERNAL_SETTING_PATH_SIZE) return false;
+      start = j + 1;
+      ++nameCount;
+    }
+    if (nameCount != record.infoCount || (record.nameListSize && pNames[record.nameListSize - 1] != 0)) return false;
+    listing.nameList.PushBack(pNames, record.nameListSize);
+    pCurrent += record.nameListSize;
+
+    listingMap.Insert(std::move(path), std::move(listing));
+  }
+  if (pCurrent != pEnd) return false;
+
+  mListingMap.Swap(listingMap);
+  return true;
+}
+
+bool Scanner::SaveCache(const Path& cachePath) const
+{
+  Archive archive;
+  if (!archive.Open(cachePath, Archive::eOpenModeWrite)) return false;
+
+  CacheHeader header;
+  header.magic = kCacheMagic;
+  header.version = kCacheVersion;
+  header.infoSize = sizeof(File::Info);
+  header.listingCount = static_cast<U32>(mListingMap.GetCount());
+  archive.Write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (auto it = mListingMap.GetBegin(); it != mListingMap.GetEnd(); ++it)
+  {
+    const Path& path = (*it).first;
+    const Listing& listing = (*it).second;
+    CacheRecord record;
+    record.lastWriteTime = listing.lastWriteTime;
+    record.pathLength = static_cast<U32>(path.GetLength());
+    record.infoCount = static_cast<U32>(listing.infoList.GetCount());
+    record.nameListSize = static_cast<U32>(listing.nameList.GetCount());
+    archive.Write(reinterpret_cast<const char*>(&record), sizeof(record));
+    archive.Write(path.GetPtr(), path.GetLength());
+    archive.Write(reinterpret_cast<const char*>(listing.infoList.GetPtr()), listing.infoList.GetCount() * sizeof(File::Info));
+    archive.Write(listing.nameList.GetPtr(), listing.nameList.GetCount());
+  }
+  archive.Close();
+  return true;
+}
+
+bool Scanner::Scan(const Path& rootPath, ItemList& itemList, U8 fileFlags /* = File::eFlagAny */)
+{
+  itemList.Clear();
+  mReusedDirectoryCount = 0;
+  mScannedDirectoryCount = 0;
+
+  File::Info rootInfo;
+  if (!File::GetInfo(rootPath, rootInfo) || !(rootInfo.flags & File::eFlagDirectory)) return false;
+
+  Task rootTask;
+  rootTask.path = rootPath;
+  rootTask.lastWriteTime = rootInfo.lastWriteTime;
+  mTaskList.Clear();
+  mTaskList.PushBack(rootTask);
+  mBusyCount = 0;
+  mFileFlags = fileFlags;
+
+  // Workers are kept between scans (along with their buffers)
+  const U32 workerCount = mpThreadPool ? mMaxWorkerCount : 1;
+  while (mWorkerList.GetCount() < workerCount)
+  {
+    Worker* pWorker = E_NEW(Worker, 1);
+    pWorker->SetScanner(this);
+    mWorkerList.PushBack(pWorker);
+  }
+
+  // Worker 0 runs on the calling thread
+  U32 runCount = 1;
+  while (runCount < workerCount && mpThreadPool->AddItem(mWorkerList[runCount])) ++runCount;
+  mWorkerList[0]->Run();
+  for (U32 i = 1; i < runCount; ++i) mpThreadPool->WaitForItem(mWorkerList[i]);
+
+  // Gather the worker results, the listings of the walked directories becoming the new cache
+  size_t itemCount = 0;
+  for (U32 i = 0; i < runCount; ++i) itemCount += mWorkerList[i]->itemList.GetCount();
+  itemList.Reserve(itemCount);
+  ListingMap listingMap;
+  for (U32 i = 0; i < runCount; ++i)
+  {
+    Worker& worker = *mWorkerList[i];
+    itemList.PushBack(worker.itemList);
+    for (auto it = worker.listingMap.GetBegin(); it != worker.listingMap.GetEnd(); ++it)
+    {
+      listingMap.Insert(std::move((*it).first), std::move((*it).second));
+    }
+    mReusedDirectoryCount += worker.reusedDirectoryCount;
+    mScannedDirectoryCount += worker.scannedDirectoryCount;
+    worker.Clear();
+  }
+  mListingMap.Swap(listingMap);
+
+  return true;
+}
+}
+}
@@ -0,0 +1,220 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Watcher.cpp
+This file defines the Watcher class.
+*/
+
+#include <CorePch.h>
+#ifdef WIN32
+#include "Win32/WatcherImpl.h"
+#endif
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+namespace
+{
+// Merges a path change into its pending change (an addition followed by a removal is dropped by the caller)
+inline Watcher::Action Coalesce(Watcher::Action pendingAction, Watcher::Action action)
+{
+  if (pendingAction == Watcher::eActionRescan || action == Watcher::eActionRescan) return Watcher::eActionRescan;
+  if (pendingAction == Watcher::eActionAdded) return Watcher::eActionAdded;
+  return (action == Watcher::eActionRemoved) ? Watcher::eActionRemoved : Watcher::eActionModified;
+}
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Known warning: passing this in the initializer list. The watch service gets a reference to this watcher to hand it 
+// the changes (not before a watch is added).
+#pragma warning(push)
+#pragma warning (disable:4355)
+Watcher::Watcher()
+  : mDebounceTime(kDefaultDebounceTime)
+  , mNextWatchId(kInvalidWatchId + 1)
+  , mpImpl(new Impl(*this))
+{
+}
+#pragma warning(pop)
+
+Watcher::~Watcher()
+{
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+Watcher::ChangeEventCallback& Watcher::GetChangeEventCallback()
+{
+  return mChangeEventCallback;
+}
+
+TimeValue Watcher::GetDebounceTime() const
+{
+  return mDebounceTime;
+}
+
+size_t Watcher::GetPendingCount() const
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  return mChangeMap.GetCount();
+}
+
+size_t Watcher::GetWatchCount() const
+{
+  return mWatchIdList.GetCount();
+}
+
+bool Watcher::IsAvailable() const
+{
+  return mpImpl->IsAvailable();
+}
+
+void Watcher::SetDebounceTime(TimeValue tv)
+{
+  mDebounceTime = tv;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+U32 Watcher::AddWatch(const Path& directoryPath, bool isRecursive /* = true */)
+{
+  if (!IsAvailable() || !mpImpl->Add(mNextWatchId, directoryPath, isRecursive)) return kInvalidWatchId;
+  const U32 watchId = mNextWatchId;
+  if (++mNextWatchId == kInvalidWatchId) ++mNextWatchId;
+  mWatchIdList.PushBack(watchId);
+  return watchId;
+}
+
+size_t Watcher::Flush()
+{
+  return Raise(0);
+}
+
+bool Watcher::RemoveWatch(U32 watchId)
+{
+  if (!mWatchIdList.RemoveIfFast(watchId)) return false;
+  mpImpl->Remove(watchId);
+
+  // The watch service hands no more changes of the watch: drop the pending ones
+  PathList pathList;
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  for (auto it = mChangeMap.GetBegin(); it != mChangeMap.GetEnd(); ++it)
+  {
+    if ((*it).second.watchId == watchId) pathList.PushBack((*it).first);
+  }
+  for (auto it = begin(pathList); it != end(pathList); ++it) mChangeMap.RemoveIf(*it);
+  return true;
+}
+
+size_t Watcher::Update()
+{
+  return Raise(mDebounceTime);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Queues a change handed by the watch service, coalescing it with the pending change of the same path if any.
+@param watchId the watch which got the change.
+@param path the changed path.
+@param action the change.
+@throw nothing.
+*/
+void Watcher::Notify(U32 watchId, const Path& path, Action action)
+{
+  const TimeValue time = Time::GetCpuTime();
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  Change* pChange = mChangeMap.FindValue(path);
+  if (pChange == nullptr)
+  {
+    Change change;
+    change.time = time;
+    change.watchId = watchId;
+    change.action = action;
+    mChangeMap.Insert(path, change);
+  }
+  else if (pChange->action == eActionAdded && action == eActionRemoved)
+  {
+    mChangeMap.RemoveIf(path);
+  }
+  else
+  {
+    pChange->time = time;
+    pChange->watchId = watchId;
+    pChange->action = Coalesce(pChange->action, action);
+  }
+}
+
+/**
+Raises the pending changes which did not change for a given time.
+@param debounceTime the time a change must be pending for to be raised.
+@return the number of changes raised.
+@throw nothing.
+*/
+size_t Watcher::Raise(TimeValue debounceTime)
+{
+  ChangeEventList changeEventList;
+  // [Critical section]
+  {
+    Threads::Lock l(mMutex);
+    if (mChangeMap.IsEmpty()) return 0;
+    const TimeValue time = Time::GetCpuTime();
+    for (auto it = mChangeMap.GetBegin(); it != mChangeMap.GetEnd(); ++it)
+    {
+      const Change& change = (*it).second;
+      if (time - change.time < debounceTime) continue;
+      changeEventList.PushBack(ChangeEvent((*it).first, change.watchId, change.action));
+    }
+    for (auto it = begin(changeEventList); it != end(changeEventList); ++it) mChangeMap.RemoveIf((*it).path);
+  }
+
+  // Handlers run out of the lock (the watch service keeps queuing changes) and may remove watches
+  size_t count = 0;
+  for (auto it = begin(changeEventList); it != end(changeEventList); ++it)
+  {
+    if (!mWatchIdList.HasValue((*it).watchId)) continue;
+    mChangeEventCallback.Raise(*it);
+    ++count;
+  }
+  return count;
+}
+}
+}
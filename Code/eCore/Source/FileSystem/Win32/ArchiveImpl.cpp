@@ -0,0 +1,198 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ArchiveImpl.cpp
+This file defines the Windows version of the Archive::Impl class.
+*/
+
+#include <CorePch.h>
+#include "ArchiveImpl.h"
+#include <Math/Comparison.h>
+#include <psapi.h>
+
+// GetProcessMemoryInfo and QueryWorkingSetEx (psapi version 1)
+#pragma comment(lib, "psapi.lib")
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary definitions
+----------------------------------------------------------------------------------------------------------------------*/	
+
+// WIN32_MEMORY_RANGE_ENTRY and PrefetchVirtualMemory are only declared when targeting Windows 8
+struct MemoryRange
+{
+  PVOID   address;
+  SIZE_T  byteSize;
+};
+
+typedef BOOL (WINAPI *PrefetchVirtualMemoryFunction)(HANDLE, ULONG_PTR, MemoryRange*, ULONG);
+
+static const size_t kWorkingSetQueryPageCount = 1024;
+
+void          GetWinPath(const Path& path, WFilePath& wfilePath);
+size_t        GetPageSize();
+PrefetchVirtualMemoryFunction GetPrefetchVirtualMemory();
+
+/*----------------------------------------------------------------------------------------------------------------------
+Archive::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+Archive::Impl::Impl()
+  : mFileHandle(INVALID_HANDLE_VALUE)
+  , mMappingHandle(nullptr)
+  , mpData(nullptr)
+  , mSize(0)
+{
+}
+
+Archive::Impl::~Impl()
+{
+  Close();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Archive::Impl accessors
+----------------------------------------------------------------------------------------------------------------------*/	
+
+size_t Archive::Impl::GetResidentSize(size_t offset, size_t length) const
+{
+  if (mpData == nullptr || length == 0) return 0;
+  const size_t pageSize = GetPageSize();
+  const size_t firstPage = offset / pageSize;
+  const size_t endPage = (offset + length + pageSize - 1) / pageSize;
+  PSAPI_WORKING_SET_EX_INFORMATION pages[kWorkingSetQueryPageCount];
+  size_t residentPageCount = 0;
+  for (size_t page = firstPage; page < endPage; page += kWorkingSetQueryPageCount)
+  {
+    const size_t pageCount = Math::Min(endPage - page, kWorkingSetQueryPageCount);
+    for (size_t i = 0; i < pageCount; ++i) pages[i].VirtualAddress = const_cast<U8*>(mpData) + (page + i) * pageSize;
+    if (!::QueryWorkingSetEx(::GetCurrentProcess(), pages, static_cast<DWORD>(pageCount * sizeof(pages[0])))) return 0;
+    for (size_t i = 0; i < pageCount; ++i) if (pages[i].VirtualAttributes.Valid) ++residentPageCount;
+  }
+  return Math::Min(residentPageCount * pageSize, length);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Archive::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+void Archive::Impl::Close()
+{
+  if (mpData) ::UnmapViewOfFile(mpData);
+  if (mMappingHandle) ::CloseHandle(mMappingHandle);
+  if (mFileHandle != INVALID_HANDLE_VALUE) ::CloseHandle(mFileHandle);
+  mFileHandle = INVALID_HANDLE_VALUE;
+  mMappingHandle = nullptr;
+  mpData = nullptr;
+  mSize = 0;
+}
+
+bool Archive::Impl::Open(const Path& filePath, AccessPattern accessPattern)
+{
+  Close();
+  WFilePath wfilePath;
+  GetWinPath(filePath, wfilePath);
+  DWORD flags = FILE_ATTRIBUTE_NORMAL;
+  if (accessPattern == eAccessPatternSequential) flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+  else if (accessPattern == eAccessPatternRandom) flags |= FILE_FLAG_RANDOM_ACCESS;
+  mFileHandle = ::CreateFile(wfilePath.GetPtr(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+  if (mFileHandle == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER fileSize;
+  if (!::GetFileSizeEx(mFileHandle, &fileSize) || static_cast<U64>(fileSize.QuadPart) > static_cast<size_t>(-1))
+  {
+    Close();
+    return false;
+  }
+  // Empty files cannot be mapped
+  if (fileSize.QuadPart == 0) return true;
+
+  mMappingHandle = ::CreateFileMapping(mFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mMappingHandle) mpData = static_cast<const U8*>(::MapViewOfFile(mMappingHandle, FILE_MAP_READ, 0, 0, 0));
+  if (mpData == nullptr)
+  {
+    Close();
+    return false;
+  }
+  mSize = static_cast<size_t>(fileSize.QuadPart);
+  return true;
+}
+
+void Archive::Impl::Prefetch(size_t offset, size_t length) const
+{
+  if (mpData == nullptr || length == 0) return;
+  static const PrefetchVirtualMemoryFunction pPrefetchVirtualMemory = GetPrefetchVirtualMemory();
+  if (pPrefetchVirtualMemory)
+  {
+    MemoryRange range = { const_cast<U8*>(mpData) + offset, length };
+    if (pPrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0)) return;
+  }
+  // Fall back to faulting the pages in
+  const size_t pageSize = GetPageSize();
+  volatile U8 sum = 0;
+  for (size_t i = offset - offset % pageSize; i < offset + length; i += pageSize) sum += mpData[i];
+}
+
+void Archive::Impl::Release(size_t offset, size_t length) const
+{
+  if (mpData == nullptr || length == 0) return;
+  // Fails with ERROR_NOT_LOCKED after removing the pages from the working set
+  ::VirtualUnlock(const_cast<U8*>(mpData) + offset, length);
+}
+
+U64 Archive::Impl::GetPageFaultCount()
+{
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+  return counters.PageFaultCount;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+size_t GetPageSize()
+{
+  static size_t pageSize = 0;
+  if (pageSize == 0)
+  {
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+    pageSize = systemInfo.dwPageSize;
+  }
+  return pageSize;
+}
+
+PrefetchVirtualMemoryFunction GetPrefetchVirtualMemory()
+{
+  HMODULE module = ::GetModuleHandleW(L"kernel32.dll");
+  if (module == nullptr) return nullptr;
+  return reinterpret_cast<PrefetchVirtualMemoryFunction>(::GetProcAddress(module, "PrefetchVirtualMemory"));
+}
+}
+}
@@ -0,0 +1,79 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ArchiveImpl.h
+This file declares the Archive::Impl file mapping class for Windows.
+*/
+
+#ifndef E3_ARCHIVE_IMPL_H
+#define E3_ARCHIVE_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Archive::Impl
+
+Please note that this class has the following usage contract: 
+
+1. The file is opened with FILE_FLAG_SEQUENTIAL_SCAN or FILE_FLAG_RANDOM_ACCESS depending on the access pattern and 
+mapped with a single read only view (empty files are not mapped: GetData is nullptr).
+2. Prefetch uses PrefetchVirtualMemory when available (Windows 8 and later) and touches every page of the range 
+otherwise. Release uses VirtualUnlock, which removes unlocked pages from the working set.
+----------------------------------------------------------------------------------------------------------------------*/	
+class Archive::Impl : public Memory::ProxyAllocated
+{
+public:
+                      Impl();
+                      ~Impl();
+
+  // Accessors
+  const U8*           GetData() const { return mpData; }
+  size_t              GetResidentSize(size_t offset, size_t length) const;
+  size_t              GetSize() const { return mSize; }
+  bool                IsOpen() const { return mFileHandle != INVALID_HANDLE_VALUE; }
+
+  // Methods
+  void                Close();
+  bool                Open(const Path& filePath, AccessPattern accessPattern);
+  void                Prefetch(size_t offset, size_t length) const;
+  void                Release(size_t offset, size_t length) const;
+
+  // Static methods
+  static U64          GetPageFaultCount();
+
+private:
+  HANDLE              mFileHandle;
+  HANDLE              mMappingHandle;
+  const U8*           mpData;
+  size_t              mSize;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
@@ -229,6 +229,66 @@ bool Directory::Impl::GetChildren(const Path& path, PathList& pathList, U8 fileF
   return true;
 }
 
+bool Directory::Impl::GetChildren(const Path& path, PathList& pathList, InfoList& infoList, U8 fileFlags)
+{
+  E_ASSERT(path.GetLength() + kWinSelectAllTokenWstr.GetLength() <= E_INTERNAL_SETTING_PATH_SIZE);
+
+  WFilePath wfilePath;
+  GetWinPath(path, wfilePath);
+  wfilePath += kWinSelectAllTokenWstr;
+
+  // Basic info skips the short 8.3 name lookup and large fetch asks for bigger directory buffers per kernel call, so the
+  // whole listing, File::Info included, comes out of a few calls instead of one attributes query per child
+  WIN32_FIND_DATA fileData;
+  HANDLE handle = ::FindFirstFileEx(wfilePath.GetPtr(), FindExInfoBasic, &fileData, FindExSearchNameMatch, nullptr, 
+    FIND_FIRST_EX_LARGE_FETCH);
+  if (handle == INVALID_HANDLE_VALUE) return false;
+
+  FilePath childPath = path;
+  childPath += kWinSeparatorCharacter;
+  size_t childPathBaseLength = childPath.GetLength();
+  do
+  {
+    // Skip "." and ".." entries
+    const wchar_t* pFileName = fileData.cFileName;
+    if (pFileName[0] == L'.' && (pFileName[1] == 0 || pFileName[1] == L'.' && pFileName[2] == 0)) continue;
+
+    if (fileFlags & File::eFlagFile && !(fileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) || 
+      fileFlags & File::eFlagDirectory && (fileData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+    {
+      if (fileFlags & File::eFlagReadOnly && !(fileData.dwFileAttributes & FILE_ATTRIBUTE_READONLY) || 
+        fileFlags & File::eFlagHidden && !(fileData.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN)) continue;
+
+      // Each UTF-16 unit takes up to 3 UTF-8 bytes, skip names that might not fit
+      size_t fileNameLength = Text::GetLength(pFileName);
+      if (childPathBaseLength + fileNameLength * 3 >= E_INTERNAL_SETTING_PATH_SIZE) continue;
+
+      // Create and add child path
+      childPath.SetLength(childPathBaseLength + Text::WideToUtf8(&childPath[childPathBaseLength], pFileName, fileNameLength));
+      pathList.PushBack(childPath);
+      childPath.SetLength(childPathBaseLength);
+
+      // Create and add child info
+      File::Info fileInfo;
+      GetFileDate(fileData.ftCreationTime, fileInfo.creationTime);
+      GetFileDate(fileData.ftLastAccessTime, fileInfo.lastAccessTime);
+      GetFileDate(fileData.ftLastWriteTime, fileInfo.lastWriteTime);
+#ifdef E_CPU_X64
+      fileInfo.byteSize = fileData.nFileSizeHigh;
+      fileInfo.byteSize = fileInfo.byteSize << 32;
+#endif
+      fileInfo.byteSize += fileData.nFileSizeLow;
+      fileInfo.flags = GetFileFlags(fileData.dwFileAttributes);
+      infoList.PushBack(fileInfo);
+    }
+  } while (::FindNextFile(handle, &fileData));
+
+  DWORD errorCode = GetLastError();
+  ::FindClose(handle);
+
+  return errorCode == ERROR_NO_MORE_FILES;
+}
+
 Path Directory::Impl::GetParent(const Path& path)
 {
   Path parentDirectory = path;
@@ -368,6 +428,7 @@ U8 GetFileFlags(U32 winFileAttributes)
   U8 fileFlags = static_cast<U8>((winFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? File::eFlagDirectory : File::eFlagFile);
   if (winFileAttributes & FILE_ATTRIBUTE_READONLY) fileFlags |= File::eFlagReadOnly;
   if (winFileAttributes & FILE_ATTRIBUTE_HIDDEN) fileFlags |= File::eFlagHidden;
+  if (winFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) fileFlags |= File::eFlagLink;
 
   return fileFlags;
 }
@@ -71,6 +71,7 @@ namespace Impl
   bool 			IsEmpty(const Path& path);
   Path      GetBase();
   bool 	    GetChildren(const Path& path, PathList& directoryList, U8 fileFlags);
+  bool 	    GetChildren(const Path& path, PathList& pathList, InfoList& infoList, U8 fileFlags);
   Path      GetParent(const Path& path);
   bool      Create(const Path& path);
   bool      Destroy(const Path& path);
@@ -0,0 +1,229 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file IoQueueImpl.cpp
+This file defines the IoQueue::Impl implementation class for Windows.
+*/
+
+#include <CorePch.h>
+#include "IoQueueImpl.h"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary definitions
+----------------------------------------------------------------------------------------------------------------------*/	
+
+// Completion keys
+static const ULONG_PTR kNotifyKey = 0;
+static const ULONG_PTR kReadKey = 1;
+
+void GetWinPath(const Path& path, WFilePath& wfilePath);
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Impl constants
+----------------------------------------------------------------------------------------------------------------------*/	
+
+const DWORD IoQueue::Impl::kMaxReadSize = 64 * 1024 * 1024;
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+// Known warning: passing this in the initializer list. In Impl construction, the Thread member gets a reference to
+// this as a IRunnable object (whose Run method is executed in Thread::Start).
+#pragma warning(push)
+#pragma warning (disable:4355)
+IoQueue::Impl::Impl(IoQueue& queue)
+  : mQueue(queue)
+  , mPortHandle(::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1))
+  , mThread(*this)
+  , mFreeSlotCount(kMaxInFlightCount)
+{
+  for (U32 i = 0; i < kMaxInFlightCount; ++i)
+  {
+    mSlots[i].fileHandle = INVALID_HANDLE_VALUE;
+    mSlots[i].pRequest = nullptr;
+    mFreeSlots[i] = kMaxInFlightCount - 1 - i;
+  }
+  if (mPortHandle)
+  {
+    mThread.SetName("IoQueue::Impl");
+    mThread.Start();
+  }
+}
+#pragma warning(pop)
+
+IoQueue::Impl::~Impl()
+{
+  if (mPortHandle == nullptr) return;
+  mTerminationFlag = 1;
+  Notify();
+  mThread.WaitForTermination();
+  ::CloseHandle(mPortHandle);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+void IoQueue::Impl::Notify()
+{
+  ::PostQueuedCompletionStatus(mPortHandle, 0, kNotifyKey, nullptr);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Impl private methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+/**
+Cancels the in flight reads of the requests flagged by IoQueue::Cancel. Aborted reads complete with 
+ERROR_OPERATION_ABORTED.
+@throw nothing.
+*/
+void IoQueue::Impl::Abort()
+{
+  for (U32 i = 0; i < kMaxInFlightCount; ++i)
+  {
+    Slot& slot = mSlots[i];
+    if (slot.pRequest && slot.pRequest->mCancelFlag.Get()) ::CancelIoEx(slot.fileHandle, &slot.overlapped);
+  }
+}
+
+void IoQueue::Impl::Finish(Slot& slot, Status status)
+{
+  if (slot.fileHandle != INVALID_HANDLE_VALUE) ::CloseHandle(slot.fileHandle);
+  Request* pRequest = slot.pRequest;
+  const size_t readSize = slot.readSize;
+  slot.fileHandle = INVALID_HANDLE_VALUE;
+  slot.pRequest = nullptr;
+  mFreeSlots[mFreeSlotCount++] = static_cast<U32>(&slot - mSlots);
+  mQueue.Complete(pRequest, status, readSize);
+}
+
+/**
+Opens the pending requests files and issues their first reads while the queue maximum in flight count allows it.
+@throw nothing.
+*/
+void IoQueue::Impl::Issue()
+{
+  for (;;)
+  {
+    Request* pRequest = nullptr;
+    // [Critical section]
+    {
+      Threads::Lock l(mQueue.mMutex);
+      pRequest = mQueue.PopPending();
+    }
+    if (pRequest == nullptr) return;
+
+    E_ASSERT(mFreeSlotCount > 0);
+    Slot& slot = mSlots[mFreeSlots[--mFreeSlotCount]];
+    slot.pRequest = pRequest;
+    slot.readSize = 0;
+    slot.length = 0;
+
+    WFilePath wfilePath;
+    GetWinPath(pRequest->filePath, wfilePath);
+    slot.fileHandle = ::CreateFile(wfilePath.GetPtr(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 
+                                   FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (slot.fileHandle == INVALID_HANDLE_VALUE || 
+        ::CreateIoCompletionPort(slot.fileHandle, mPortHandle, kReadKey, 0) == nullptr)
+    {
+      Finish(slot, eStatusFailed);
+      continue;
+    }
+    Read(slot);
+  }
+}
+
+void IoQueue::Impl::OnCompletion(Slot& slot, DWORD transferredSize, DWORD error)
+{
+  slot.readSize += transferredSize;
+  if (error == ERROR_OPERATION_ABORTED) Finish(slot, eStatusCancelled);
+  else if (error == ERROR_HANDLE_EOF) Finish(slot, eStatusCompleted);
+  else if (error != ERROR_SUCCESS) Finish(slot, eStatusFailed);
+  else if (transferredSize < slot.length) Finish(slot, eStatusCompleted); // End of file
+  else Read(slot);
+}
+
+/**
+Issues the next read of a slot request (or finishes the request if there is nothing left to read).
+@throw nothing.
+*/
+void IoQueue::Impl::Read(Slot& slot)
+{
+  Request& request = *slot.pRequest;
+  if (request.mCancelFlag.Get())
+  {
+    Finish(slot, eStatusCancelled);
+    return;
+  }
+  const size_t remainingSize = request.size - slot.readSize;
+  if (remainingSize == 0)
+  {
+    Finish(slot, eStatusCompleted);
+    return;
+  }
+
+  const U64 position = request.offset + slot.readSize;
+  slot.length = static_cast<DWORD>(Math::Min(remainingSize, static_cast<size_t>(kMaxReadSize)));
+  ::ZeroMemory(&slot.overlapped, sizeof(slot.overlapped));
+  slot.overlapped.Offset = static_cast<DWORD>(position);
+  slot.overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+  // A completion packet is queued whether the read completes synchronously or not, except on immediate failure
+  if (!::ReadFile(slot.fileHandle, request.pTarget + slot.readSize, slot.length, nullptr, &slot.overlapped))
+  {
+    const DWORD error = ::GetLastError();
+    if (error != ERROR_IO_PENDING) OnCompletion(slot, 0, error);
+  }
+}
+
+I32 IoQueue::Impl::Run()
+{
+  for (;;)
+  {
+    Issue();
+    // IoQueue cancels and waits for all the requests before destroying the Impl
+    if (mTerminationFlag.Get() && mFreeSlotCount == kMaxInFlightCount) return 0;
+
+    DWORD transferredSize = 0;
+    ULONG_PTR key = 0;
+    OVERLAPPED* pOverlapped = nullptr;
+    const BOOL result = ::GetQueuedCompletionStatus(mPortHandle, &transferredSize, &key, &pOverlapped, INFINITE);
+    if (pOverlapped == nullptr)
+    {
+      // Notification
+      Abort();
+      continue;
+    }
+    Slot& slot = *CONTAINING_RECORD(pOverlapped, Slot, overlapped);
+    OnCompletion(slot, transferredSize, result ? ERROR_SUCCESS : ::GetLastError());
+  }
+}
+}
+}
@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file IoQueueImpl.h
+This file declares the IoQueue::Impl implementation class for Windows.
+*/
+
+#ifndef E3_IO_QUEUE_IMPL_H
+#define E3_IO_QUEUE_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+IoQueue::Impl
+
+IoQueue native backend based on an I/O completion port. A single service thread issues overlapped reads for the 
+pending requests (up to the queue maximum in flight count) and handles their completion packets.
+
+Please note that this class has the following usage contract: 
+
+1. Every in flight request takes a slot, holding its file handle and OVERLAPPED structure. Files are opened with
+FILE_FLAG_OVERLAPPED and FILE_FLAG_SEQUENTIAL_SCAN (no FILE_FLAG_NO_BUFFERING, which would require sector aligned 
+targets, offsets and sizes).
+2. Reads larger than kMaxReadSize are split, issuing the next read on the previous one completion.
+3. Notify wakes up the service thread to issue new pending requests and abort the flagged in flight ones (CancelIoEx
+is called from the service thread so file handles are never closed under its feet).
+4. Destruction waits for the in flight reads to finish: IoQueue MUST cancel them first.
+----------------------------------------------------------------------------------------------------------------------*/	
+class IoQueue::Impl : public Memory::ProxyAllocated, public Threads::IRunnable
+{
+public:
+                      explicit Impl(IoQueue& queue);
+                      ~Impl();
+
+  // Accessors
+  bool                IsAvailable() const { return mPortHandle != nullptr; }
+
+  // Methods
+  void                Notify();
+
+private:
+  struct Slot
+  {
+    OVERLAPPED        overlapped;
+    HANDLE            fileHandle;
+    Request*          pRequest;
+    size_t            readSize;     // Bytes read so far
+    DWORD             length;       // Bytes requested by the current read
+  };
+
+  static const DWORD  kMaxReadSize;
+
+  IoQueue&            mQueue;
+  HANDLE              mPortHandle;
+  Threads::Thread     mThread;
+  Slot                mSlots[kMaxInFlightCount];
+  U32                 mFreeSlots[kMaxInFlightCount]; // Free slot index stack
+  U32                 mFreeSlotCount;
+  A32                 mTerminationFlag;
+
+  void                Abort();
+  void                Finish(Slot& slot, Status status);
+  void                Issue();
+  void                OnCompletion(Slot& slot, DWORD transferredSize, DWORD error);
+  void                Read(Slot& slot);
+  I32                 Run();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
@@ -0,0 +1,315 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file WatcherImpl.cpp
+This file defines the Watcher::Impl implementation class for Windows.
+*/
+
+#include <CorePch.h>
+#include "WatcherImpl.h"
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary definitions
+----------------------------------------------------------------------------------------------------------------------*/	
+
+// Completion keys
+static const ULONG_PTR kNotifyKey = 0;
+static const ULONG_PTR kWatchKey = 1;
+
+static const char kWinSeparatorCharacter = '\\';
+
+void GetWinPath(const Path& path, WFilePath& wfilePath);
+
+static Watcher::Action GetAction(DWORD winAction)
+{
+  switch (winAction)
+  {
+  case FILE_ACTION_ADDED:
+  case FILE_ACTION_RENAMED_NEW_NAME:
+    return Watcher::eActionAdded;
+  case FILE_ACTION_REMOVED:
+  case FILE_ACTION_RENAMED_OLD_NAME:
+    return Watcher::eActionRemoved;
+  default:
+    return Watcher::eActionModified;
+  }
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher::Impl constants
+----------------------------------------------------------------------------------------------------------------------*/	
+
+const DWORD Watcher::Impl::kNotifyFilter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | 
+  FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_CREATION;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher::Impl initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+// Known warning: passing this in the initializer list. In Impl construction, the Thread member gets a reference to
+// this as a IRunnable object (whose Run method is executed in Thread::Start).
+#pragma warning(push)
+#pragma warning (disable:4355)
+Watcher::Impl::Impl(Watcher& watcher)
+  : mWatcher(watcher)
+  , mPortHandle(::CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1))
+  , mThread(*this)
+{
+  if (mPortHandle)
+  {
+    mThread.SetName("Watcher::Impl");
+    mThread.Start();
+  }
+}
+#pragma warning(pop)
+
+Watcher::Impl::~Impl()
+{
+  if (mPortHandle == nullptr) return;
+  mTerminationFlag = 1;
+  Notify();
+  mThread.WaitForTermination();
+  ::CloseHandle(mPortHandle);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher::Impl methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+bool Watcher::Impl::Add(U32 watchId, const Path& directoryPath, bool isRecursive)
+{
+  WFilePath wfilePath;
+  GetWinPath(directoryPath, wfilePath);
+  HANDLE directoryHandle = ::CreateFile(wfilePath.GetPtr(), FILE_LIST_DIRECTORY, 
+                                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, 
+                                        FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+  if (directoryHandle == INVALID_HANDLE_VALUE) return false;
+  if (::CreateIoCompletionPort(directoryHandle, mPortHandle, kWatchKey, 0) == nullptr)
+  {
+    ::CloseHandle(directoryHandle);
+    return false;
+  }
+
+  Watch* pWatch = E_NEW(Watch, 1);
+  pWatch->directoryHandle = directoryHandle;
+  pWatch->path = directoryPath;
+  pWatch->watchId = watchId;
+  pWatch->isRecursive = isRecursive ? TRUE : FALSE;
+  pWatch->isRemoved = false;
+  pWatch->isStopped = false;
+
+  Request request;
+  request.pWatch = pWatch;
+  request.watchId = watchId;
+  Send(request);
+  if (!request.result)
+  {
+    // Not a directory (or not readable)
+    ::CloseHandle(directoryHandle);
+    E_DELETE(pWatch, 1);
+  }
+  return request.result;
+}
+
+void Watcher::Impl::Remove(U32 watchId)
+{
+  Request request;
+  request.pWatch = nullptr;
+  request.watchId = watchId;
+  Send(request);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher::Impl private methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+/**
+Removes a watch: its read is aborted (the watch being destroyed on the read completion) unless it is stopped.
+@param watch the watch to remove.
+@throw nothing.
+*/
+void Watcher::Impl::Cancel(Watch& watch)
+{
+  watch.isRemoved = true;
+  if (watch.isStopped) Destroy(watch);
+  else ::CancelIoEx(watch.directoryHandle, &watch.overlapped);
+}
+
+void Watcher::Impl::Destroy(Watch& watch)
+{
+  ::CloseHandle(watch.directoryHandle);
+  mWatchList.RemoveIfFast(&watch);
+  Watch* pWatch = &watch;
+  E_DELETE(pWatch, 1);
+}
+
+void Watcher::Impl::Notify()
+{
+  ::PostQueuedCompletionStatus(mPortHandle, 0, kNotifyKey, nullptr);
+}
+
+void Watcher::Impl::OnCompletion(Watch& watch, DWORD transferredSize, DWORD error)
+{
+  if (watch.isRemoved)
+  {
+    Destroy(watch);
+    return;
+  }
+
+  if (error == ERROR_SUCCESS && transferredSize > 0)
+  {
+    Path childPath = watch.path;
+    childPath += kWinSeparatorCharacter;
+    const size_t childPathBaseLength = childPath.GetLength();
+    const U8* pCurrent = reinterpret_cast<const U8*>(watch.buffer);
+    for (;;)
+    {
+      const FILE_NOTIFY_INFORMATION& info = *reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(pCurrent);
+      const size_t fileNameLength = info.FileNameLength / sizeof(WCHAR);
+      // Each UTF-16 unit takes up to 3 UTF-8 bytes: changes of paths which might not fit are lost
+      if (childPathBaseLength + fileNameLength * 3 < E_INTERNAL_SETTING_PATH_SIZE)
+      {
+        childPath.SetLength(childPathBaseLength + 
+                            Text::WideToUtf8(&childPath[childPathBaseLength], info.FileName, fileNameLength));
+        mWatcher.Notify(watch.watchId, childPath, GetAction(info.Action));
+      }
+      else
+      {
+        mWatcher.Notify(watch.watchId, watch.path, eActionRescan);
+      }
+      if (info.NextEntryOffset == 0) break;
+      pCurrent += info.NextEntryOffset;
+    }
+  }
+  else
+  {
+    // No changes means the buffer overflowed, other errors mean the directory can not be read anymore
+    mWatcher.Notify(watch.watchId, watch.path, eActionRescan);
+    if (error != ERROR_SUCCESS && error != ERROR_NOTIFY_ENUM_DIR)
+    {
+      watch.isStopped = true;
+      return;
+    }
+  }
+
+  if (!Read(watch))
+  {
+    mWatcher.Notify(watch.watchId, watch.path, eActionRescan);
+    watch.isStopped = true;
+  }
+}
+
+/**
+Serves the add and remove requests, waking up the watcher thread waiting for them.
+@throw nothing.
+*/
+void Watcher::Impl::Process()
+{
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  if (mRequestList.IsEmpty()) return;
+  for (auto it = begin(mRequestList); it != end(mRequestList); ++it)
+  {
+    Request& request = **it;
+    if (request.pWatch)
+    {
+      request.result = Read(*request.pWatch);
+      if (request.result) mWatchList.PushBack(request.pWatch);
+    }
+    else
+    {
+      for (auto watchIt = begin(mWatchList); watchIt != end(mWatchList); ++watchIt)
+      {
+        if ((*watchIt)->watchId == request.watchId && !(*watchIt)->isRemoved)
+        {
+          Cancel(**watchIt);
+          break;
+        }
+      }
+      request.result = true;
+    }
+    request.isDone = true;
+  }
+  mRequestList.Clear();
+  mDoneCondition.Broadcast();
+}
+
+bool Watcher::Impl::Read(Watch& watch)
+{
+  ::ZeroMemory(&watch.overlapped, sizeof(watch.overlapped));
+  // A completion packet is queued whether the read completes synchronously or not, except on immediate failure
+  return ::ReadDirectoryChangesW(watch.directoryHandle, watch.buffer, kBufferSize, watch.isRecursive, kNotifyFilter, 
+                                 nullptr, &watch.overlapped, nullptr) != FALSE;
+}
+
+I32 Watcher::Impl::Run()
+{
+  bool isTerminating = false;
+  for (;;)
+  {
+    Process();
+    if (mTerminationFlag.Get() && !isTerminating)
+    {
+      isTerminating = true;
+      // Backwards as stopped watches are destroyed right away
+      for (size_t i = mWatchList.GetCount(); i-- > 0; )
+      {
+        if (!mWatchList[i]->isRemoved) Cancel(*mWatchList[i]);
+      }
+    }
+    if (isTerminating && mWatchList.IsEmpty()) return 0;
+
+    DWORD transferredSize = 0;
+    ULONG_PTR key = 0;
+    OVERLAPPED* pOverlapped = nullptr;
+    const BOOL result = ::GetQueuedCompletionStatus(mPortHandle, &transferredSize, &key, &pOverlapped, INFINITE);
+    // Notification
+    if (pOverlapped == nullptr) continue;
+    Watch& watch = *CONTAINING_RECORD(pOverlapped, Watch, overlapped);
+    OnCompletion(watch, transferredSize, result ? ERROR_SUCCESS : ::GetLastError());
+  }
+}
+
+/**
+Queues a request for the service thread, waiting for it to be done.
+@param request the request to serve.
+@throw nothing.
+*/
+void Watcher::Impl::Send(Request& request)
+{
+  request.isDone = false;
+  request.result = false;
+  // [Critical section]
+  Threads::Lock l(mMutex);
+  mRequestList.PushBack(&request);
+  Notify();
+  while (!request.isDone) mDoneCondition.Wait(mMutex);
+}
+}
+}
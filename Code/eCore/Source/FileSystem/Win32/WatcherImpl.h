@@ -0,0 +1,117 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file WatcherImpl.h
+This file declares the Watcher::Impl implementation class for Windows.
+*/
+
+#ifndef E3_WATCHER_IMPL_H
+#define E3_WATCHER_IMPL_H
+
+namespace E
+{
+namespace FileSystem
+{
+/*----------------------------------------------------------------------------------------------------------------------
+Watcher::Impl
+
+Watch service based on ReadDirectoryChangesW and an I/O completion port. A single service thread keeps an overlapped
+directory changes read in flight per watch, handing the changes read to the watcher.
+
+Please note that this class has the following usage contract: 
+
+1. Add and Remove are served by the service thread (so reads are always issued from it) and they return once done: no
+changes are handed to the watcher for a watch before Add returns or after Remove returns.
+2. Every watch has a kBufferSize change buffer (the ReadDirectoryChangesW limit for network shares). A read completing
+with no changes means the buffer overflowed, which is handed to the watcher as eActionRescan.
+3. A watch stops (no read in flight) when its directory can not be read anymore. Removed watches are destroyed once 
+their read is aborted.
+4. Destruction removes all the watches.
+----------------------------------------------------------------------------------------------------------------------*/	
+class Watcher::Impl : public Memory::ProxyAllocated, public Threads::IRunnable
+{
+public:
+                      explicit Impl(Watcher& watcher);
+                      ~Impl();
+
+  // Accessors
+  bool                IsAvailable() const { return mPortHandle != nullptr; }
+
+  // Methods
+  bool                Add(U32 watchId, const Path& directoryPath, bool isRecursive);
+  void                Remove(U32 watchId);
+
+private:
+  static const DWORD  kBufferSize = 64 * 1024;
+  static const DWORD  kNotifyFilter;
+
+  struct Watch
+  {
+    OVERLAPPED        overlapped;
+    HANDLE            directoryHandle;
+    Path              path;
+    U32               watchId;
+    BOOL              isRecursive;
+    bool              isRemoved;
+    bool              isStopped;    // No read in flight
+    DWORD             buffer[kBufferSize / sizeof(DWORD)];
+  };
+
+  // Add / Remove request, waited for by the watcher thread
+  struct Request
+  {
+    Watch*            pWatch;       // Watch to add (nullptr to remove)
+    U32               watchId;      // Watch to remove
+    bool              isDone;
+    bool              result;
+  };
+
+  typedef Containers::List<Request*> RequestList;
+  typedef Containers::List<Watch*> WatchList;
+
+  Watcher&                    mWatcher;
+  HANDLE                      mPortHandle;
+  Threads::Thread             mThread;
+  Threads::Mutex              mMutex;
+  Threads::ConditionVariable  mDoneCondition;   // Signaled when requests are done
+  RequestList                 mRequestList;
+  WatchList                   mWatchList;       // Service thread only
+  A32                         mTerminationFlag;
+
+  void                Cancel(Watch& watch);
+  void                Destroy(Watch& watch);
+  void                Notify();
+  void                OnCompletion(Watch& watch, DWORD transferredSize, DWORD error);
+  void                Process();
+  bool                Read(Watch& watch);
+  I32                 Run();
+  void                Send(Request& request);
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
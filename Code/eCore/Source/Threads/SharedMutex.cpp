@@ -0,0 +1,72 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SharedMutex.cpp
+This file defines the SharedMutex class.
+*/
+
+#include <CorePch.h>
+#ifdef WIN32
+#include "Win32/SharedMutexImpl.h"
+#endif
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SharedMutex initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/	
+
+Threads::SharedMutex::SharedMutex()
+: mpImpl(new Impl) {}
+
+Threads::SharedMutex::~SharedMutex() {}
+
+/*----------------------------------------------------------------------------------------------------------------------
+SharedMutex methods
+----------------------------------------------------------------------------------------------------------------------*/	
+
+void Threads::SharedMutex::Lock()
+{
+  mpImpl->Lock();
+}
+
+void Threads::SharedMutex::LockShared()
+{
+  mpImpl->LockShared();
+}
+
+void Threads::SharedMutex::Unlock()
+{
+  mpImpl->Unlock();
+}
+
+void Threads::SharedMutex::UnlockShared()
+{
+  mpImpl->UnlockShared();
+}
+}
+}
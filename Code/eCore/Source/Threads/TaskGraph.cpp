@@ -0,0 +1,444 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file TaskGraph.cpp
+This file defines the TaskGraph class.
+*/
+
+#include <CorePch.h>
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph constants
+----------------------------------------------------------------------------------------------------------------------*/
+const Threads::TaskGraph::Handle Threads::TaskGraph::kInvalidHandle = static_cast<Threads::TaskGraph::Handle>(-1);
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph::Task & TaskGraph::Batch methods
+
+Note that these are the actual items added to the ThreadPool. Every task and batch is a different object as ThreadPool
+requires pending items to be unique.
+----------------------------------------------------------------------------------------------------------------------*/
+
+I32 Threads::TaskGraph::Task::Run()
+{
+  pGraph->ExecuteTask(*this);
+  return 0;
+}
+
+I32 Threads::TaskGraph::Batch::Run()
+{
+  Task& t = pGraph->mTaskList[task];
+  t.pBody->Run(begin, end);
+  if (--t.pendingBatchCount == 0) pGraph->CompleteTask(t);
+  return 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+Threads::TaskGraph::TaskGraph()
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mpThreadPool(&Threads::Global::GetThreadPool())
+  , mpCompletionItem(nullptr)
+  , mStartTime(0)
+  , mRunningFlag(false)
+  , mRunFlag(false)
+{
+}
+
+Threads::TaskGraph::~TaskGraph()
+{
+  Wait();
+  WaitForThreadPoolItems();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const Memory::IAllocator* Threads::TaskGraph::GetAllocator() const
+{
+  return mpAllocator;
+}
+
+TimeValue Threads::TaskGraph::GetCriticalPathTime() const
+{
+  // [Critical section]
+  Lock l(mMutex);
+  return mCriticalPathTime;
+}
+
+TimeValue Threads::TaskGraph::GetRunTime() const
+{
+  // [Critical section]
+  Lock l(mMutex);
+  return mRunTime;
+}
+
+U32 Threads::TaskGraph::GetTaskCount() const
+{
+  return static_cast<U32>(mTaskList.GetCount());
+}
+
+Threads::ThreadPool* Threads::TaskGraph::GetThreadPool() const
+{
+  return mpThreadPool;
+}
+
+bool Threads::TaskGraph::IsFinished() const
+{
+  // [Critical section]
+  Lock l(mMutex);
+  return !mRunningFlag;
+}
+
+void Threads::TaskGraph::SetAllocator(Memory::IAllocator* p)
+{
+  E_ASSERT_MSG(IsFinished(), E_ASSERT_MSG_TASK_GRAPH_RUNNING);
+  mpAllocator = p;
+  mTaskList.SetAllocator(p);
+  mBatchList.SetAllocator(p);
+  mEdgeFromList.SetAllocator(p);
+  mEdgeToList.SetAllocator(p);
+  mSuccessorList.SetAllocator(p);
+  mOrderList.SetAllocator(p);
+}
+
+void Threads::TaskGraph::SetThreadPool(ThreadPool* p)
+{
+  E_ASSERT_PTR(p);
+  E_ASSERT_MSG(IsFinished(), E_ASSERT_MSG_TASK_GRAPH_RUNNING);
+  WaitForThreadPoolItems();
+  mpThreadPool = p;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Adds a task to be run after the given task.
+@param task the task to depend on.
+@param pItem the continuation item.
+@return the continuation task handle.
+@throw nothing.
+*/
+Threads::TaskGraph::Handle Threads::TaskGraph::AddContinuation(Handle task, IRunnable* pItem)
+{
+  Handle continuation = AddTask(pItem);
+  DependsOn(continuation, task);
+  return continuation;
+}
+
+/**
+Adds a parallel for task. The body is called for every batch of batchSize indices in [0, count).
+@param pBody the parallel for body.
+@param count the number of indices.
+@param batchSize the number of indices per batch.
+@return the task handle.
+@throw nothing.
+*/
+Threads::TaskGraph::Handle Threads::TaskGraph::AddParallelFor(IParallelForRunnable* pBody, U32 count, U32 batchSize)
+{
+  E_ASSERT_PTR(pBody);
+  E_ASSERT(batchSize > 0);
+  Handle task = AddTask(nullptr);
+  Task& t = mTaskList[task];
+  t.pBody = pBody;
+  t.firstBatch = static_cast<U32>(mBatchList.GetCount());
+  for (U32 begin = 0; begin < count; begin += batchSize)
+  {
+    Batch b;
+    b.pGraph = this;
+    b.task = task;
+    b.begin = begin;
+    b.end = Math::Min(begin + batchSize, count);
+    mBatchList.PushBack(b);
+  }
+  t.batchCount = static_cast<U32>(mBatchList.GetCount()) - t.firstBatch;
+  return task;
+}
+
+/**
+Adds a task. A task with a nullptr item does nothing but can be used to join dependencies.
+@param pItem the item to run.
+@return the task handle.
+@throw nothing.
+*/
+Threads::TaskGraph::Handle Threads::TaskGraph::AddTask(IRunnable* pItem)
+{
+  E_ASSERT_MSG(IsFinished(), E_ASSERT_MSG_TASK_GRAPH_RUNNING);
+  Task t;
+  t.pGraph = this;
+  t.pItem = pItem;
+  t.pBody = nullptr;
+  t.index = static_cast<U32>(mTaskList.GetCount());
+  t.dependencyCount = 0;
+  t.firstSuccessor = 0;
+  t.successorCount = 0;
+  t.firstBatch = 0;
+  t.batchCount = 0;
+  t.startTime = 0;
+  t.finishTime = 0;
+  mTaskList.PushBack(t);
+  return t.index;
+}
+
+/**
+Removes all the tasks.
+@throw nothing.
+*/
+void Threads::TaskGraph::Clear()
+{
+  E_ASSERT_MSG(IsFinished(), E_ASSERT_MSG_TASK_GRAPH_RUNNING);
+  WaitForThreadPoolItems();
+  mTaskList.Clear();
+  mBatchList.Clear();
+  mEdgeFromList.Clear();
+  mEdgeToList.Clear();
+  mSuccessorList.Clear();
+  mOrderList.Clear();
+  mRunFlag = false;
+}
+
+/**
+Makes a task wait for another task to finish before running.
+@param task the dependent task.
+@param dependency the task to wait for.
+@throw nothing.
+*/
+void Threads::TaskGraph::DependsOn(Handle task, Handle dependency)
+{
+  E_ASSERT_MSG(IsFinished(), E_ASSERT_MSG_TASK_GRAPH_RUNNING);
+  E_ASSERT_MSG(task < mTaskList.GetCount(), E_ASSERT_MSG_TASK_GRAPH_HANDLE_VALUE, task, mTaskList.GetCount());
+  E_ASSERT_MSG(dependency < mTaskList.GetCount(), E_ASSERT_MSG_TASK_GRAPH_HANDLE_VALUE, dependency, mTaskList.GetCount());
+  mEdgeFromList.PushBack(dependency);
+  mEdgeToList.PushBack(task);
+  ++mTaskList[task].dependencyCount;
+}
+
+/**
+Starts running the graph. Tasks without dependencies are added to the ThreadPool right away, the rest are added as
+their dependencies finish. This method does not block.
+@param pCompletionItem optional item run by the thread finishing the last task.
+@throw nothing.
+*/
+void Threads::TaskGraph::Run(IRunnable* pCompletionItem /* = nullptr */)
+{
+  {
+    // [Critical section]
+    Lock l(mMutex);
+    E_ASSERT_MSG(!mRunningFlag, E_ASSERT_MSG_TASK_GRAPH_RUNNING);
+    mRunningFlag = true;
+  }
+  // Items of the previous run may still be referenced by the ThreadPool (the pool releases them after they return)
+  WaitForThreadPoolItems();
+  Build();
+
+  mpCompletionItem = pCompletionItem;
+  mPendingTaskCount = static_cast<U32>(mTaskList.GetCount());
+  mStartTime = Time::GetCpuTime();
+  mRunFlag = true;
+  if (mTaskList.IsEmpty())
+  {
+    Finish();
+    return;
+  }
+  // Note that dependencyCount is never modified while running, so roots can be safely found while tasks complete
+  for (auto it = begin(mTaskList); it != end(mTaskList); ++it)
+  {
+    if ((*it).dependencyCount == 0) Submit(&(*it));
+  }
+}
+
+/**
+Makes the calling thread wait for the graph run to finish.
+@throw nothing.
+*/
+void Threads::TaskGraph::Wait()
+{
+  // [Critical section]
+  Lock l(mMutex);
+  while (mRunningFlag) mFinishCondition.Wait(mMutex);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskGraph private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Builds the successor lists from the dependency edges, finds a topological order (Kahn algorithm) and resets the task
+counters.
+@throw nothing.
+*/
+void Threads::TaskGraph::Build()
+{
+  U32 taskCount = static_cast<U32>(mTaskList.GetCount());
+  U32 edgeCount = static_cast<U32>(mEdgeFromList.GetCount());
+
+  // Successor lists (counting sort of the edges by dependency)
+  for (U32 i = 0; i < taskCount; ++i) mTaskList[i].successorCount = 0;
+  for (U32 i = 0; i < edgeCount; ++i) ++mTaskList[mEdgeFromList[i]].successorCount;
+  U32 offset = 0;
+  for (U32 i = 0; i < taskCount; ++i)
+  {
+    mTaskList[i].firstSuccessor = offset;
+    offset += mTaskList[i].successorCount;
+    mTaskList[i].successorCount = 0;
+  }
+  mSuccessorList.Clear();
+  for (U32 i = 0; i < edgeCount; ++i) mSuccessorList.PushBack(0);
+  for (U32 i = 0; i < edgeCount; ++i)
+  {
+    Task& t = mTaskList[mEdgeFromList[i]];
+    mSuccessorList[t.firstSuccessor + t.successorCount++] = mEdgeToList[i];
+  }
+
+  // Topological order. The pending dependency counters are used as scratch and reset afterwards.
+  mOrderList.Clear();
+  for (U32 i = 0; i < taskCount; ++i)
+  {
+    mTaskList[i].pendingDependencyCount = mTaskList[i].dependencyCount;
+    if (mTaskList[i].dependencyCount == 0) mOrderList.PushBack(i);
+  }
+  for (U32 i = 0; i < mOrderList.GetCount(); ++i)
+  {
+    const Task& t = mTaskList[mOrderList[i]];
+    for (U32 j = 0; j < t.successorCount; ++j)
+    {
+      U32 successor = mSuccessorList[t.firstSuccessor + j];
+      if (--mTaskList[successor].pendingDependencyCount == 0) mOrderList.PushBack(successor);
+    }
+  }
+  E_ASSERT_MSG(mOrderList.GetCount() == taskCount, E_ASSERT_MSG_TASK_GRAPH_CYCLE);
+
+  for (U32 i = 0; i < taskCount; ++i)
+  {
+    Task& t = mTaskList[i];
+    t.pendingDependencyCount = t.dependencyCount;
+    t.pendingBatchCount = t.batchCount;
+    t.startTime = 0;
+    t.finishTime = 0;
+  }
+}
+
+/**
+Releases the tasks depending on the given (finished) task.
+@param task the finished task.
+@throw nothing.
+*/
+void Threads::TaskGraph::CompleteTask(Task& task)
+{
+  task.finishTime = Time::GetCpuTime();
+  for (U32 i = 0; i < task.successorCount; ++i)
+  {
+    Task& successor = mTaskList[mSuccessorList[task.firstSuccessor + i]];
+    if (--successor.pendingDependencyCount == 0) Submit(&successor);
+  }
+  if (--mPendingTaskCount == 0) Finish();
+}
+
+void Threads::TaskGraph::ExecuteTask(Task& task)
+{
+  task.startTime = Time::GetCpuTime();
+  if (task.pBody)
+  {
+    // The parallel for task completes when its last batch finishes
+    if (task.batchCount == 0) CompleteTask(task);
+    for (U32 i = 0; i < task.batchCount; ++i) Submit(&mBatchList[task.firstBatch + i]);
+    return;
+  }
+  if (task.pItem) task.pItem->Run();
+  CompleteTask(task);
+}
+
+/**
+Computes the run statistics and signals the run completion. The critical path is the longest chain of task times
+following the topological order.
+@throw nothing.
+*/
+void Threads::TaskGraph::Finish()
+{
+  I64 now = Time::GetCpuTime();
+  I64 criticalPathTime = 0;
+  U32 taskCount = static_cast<U32>(mTaskList.GetCount());
+  if (taskCount)
+  {
+    // Task start times are reused to accumulate the longest path reaching every task
+    for (U32 i = 0; i < taskCount; ++i)
+    {
+      Task& t = mTaskList[i];
+      t.finishTime -= t.startTime;
+      t.startTime = 0;
+    }
+    for (U32 i = 0; i < taskCount; ++i)
+    {
+      Task& t = mTaskList[mOrderList[i]];
+      I64 pathTime = t.startTime + t.finishTime;
+      criticalPathTime = Math::Max(criticalPathTime, pathTime);
+      for (U32 j = 0; j < t.successorCount; ++j)
+      {
+        Task& successor = mTaskList[mSuccessorList[t.firstSuccessor + j]];
+        successor.startTime = Math::Max(successor.startTime, pathTime);
+      }
+    }
+  }
+
+  if (mpCompletionItem) mpCompletionItem->Run();
+
+  // [Critical section]
+  Lock l(mMutex);
+  mCriticalPathTime = criticalPathTime;
+  mRunTime = now - mStartTime;
+  mRunningFlag = false;
+  mFinishCondition.Broadcast();
+}
+
+void Threads::TaskGraph::Submit(IRunnable* pItem)
+{
+  if (!mpThreadPool->AddItem(pItem)) pItem->Run();
+}
+
+/**
+Waits for the ThreadPool to release the items of the previous run. ThreadPool keeps track of an item till the item
+returns, which may happen after the graph run has finished.
+@throw nothing.
+*/
+void Threads::TaskGraph::WaitForThreadPoolItems()
+{
+  if (!mRunFlag) return;
+  for (auto it = begin(mTaskList); it != end(mTaskList); ++it) mpThreadPool->WaitForItem(&(*it));
+  for (auto it = begin(mBatchList); it != end(mBatchList); ++it) mpThreadPool->WaitForItem(&(*it));
+}
+}
+}
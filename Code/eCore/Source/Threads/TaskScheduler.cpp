@@ -0,0 +1,514 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file TaskScheduler.cpp
+This file defines the TaskScheduler class.
+*/
+
+#include <CorePch.h>
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler::Worker
+
+A working thread class which owns a WorkStealingQueue and runs the items found through its TaskScheduler. Unlike
+ThreadPoolWorker, items are not assigned to the worker: the worker pulls them from its own queue, the scheduler shared
+queue or other workers queues. ThreadPoolWorker can not be reused for this purpose as it blocks till a single item is
+assigned to it and has no queue other threads could steal from.
+
+Please note that this class has the following usage contract:
+
+1. SetScheduler MUST be called before Start.
+2. The worker thread exits when the scheduler sets its termination flag, so destruction waits for the thread to finish.
+3. Running workers steal from the other workers queues: all of them MUST be terminated before destroying any.
+----------------------------------------------------------------------------------------------------------------------*/
+class TaskScheduler::Worker : public IRunnable
+{
+public:
+  typedef WorkStealingQueue<IRunnable*> IRunnableQueue;
+
+  Worker();
+  ~Worker();
+
+  // Accessors
+  IRunnableQueue&             GetQueue();
+  U32                         GetIndex() const;
+  TaskScheduler*              GetScheduler() const;
+  void                        SetScheduler(TaskScheduler* pScheduler, U32 index);
+
+  // Methods
+  U32                         GenerateRandom();
+  void                        Start();
+  void                        WaitForTermination();
+
+  static E_THREAD_LOCAL Worker* spCurrent;  // Worker running in the calling thread (nullptr if none)
+
+private:
+  TaskScheduler*              mpScheduler;
+  Thread                      mThread;
+  IRunnableQueue              mQueue;
+  U32                         mIndex;
+  U32                         mRandomState;
+
+  I32                         Run();
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Worker)
+};
+
+E_THREAD_LOCAL TaskScheduler::Worker* TaskScheduler::Worker::spCurrent = nullptr;
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler::Worker initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Known warning: passing this in the initializer list. In Worker construction, the Thread member gets a reference to
+// this as a IRunnable object (whose Run method is executed in Thread::Start).
+#pragma warning(push)
+#pragma warning (disable:4355)
+TaskScheduler::Worker::Worker()
+  : mpScheduler(nullptr)
+  , mThread(*this)
+  , mIndex(0)
+  , mRandomState(0)
+{
+}
+#pragma warning(pop)
+
+TaskScheduler::Worker::~Worker()
+{
+  // Destruction follows the scheduler termination flag being set, so the thread is about to exit its run
+  mThread.WaitForTermination();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler::Worker accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+TaskScheduler::Worker::IRunnableQueue& TaskScheduler::Worker::GetQueue() { return mQueue; }
+
+U32 TaskScheduler::Worker::GetIndex() const { return mIndex; }
+
+TaskScheduler* TaskScheduler::Worker::GetScheduler() const { return mpScheduler; }
+
+void TaskScheduler::Worker::SetScheduler(TaskScheduler* pScheduler, U32 index)
+{
+  mpScheduler = pScheduler;
+  mIndex = index;
+  // Xorshift state MUST be non zero
+  mRandomState = 2463534242u + index * 2654435761u;
+  if (mRandomState == 0) mRandomState = 1;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler::Worker methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Generates a pseudo random number (xorshift32) used to select steal victims.
+@return a pseudo random number.
+@throw nothing.
+*/
+U32 TaskScheduler::Worker::GenerateRandom()
+{
+  mRandomState ^= mRandomState << 13;
+  mRandomState ^= mRandomState >> 17;
+  mRandomState ^= mRandomState << 5;
+  return mRandomState;
+}
+
+void TaskScheduler::Worker::Start()
+{
+  E_ASSERT_PTR(mpScheduler);
+  mThread.Start();
+}
+
+void TaskScheduler::Worker::WaitForTermination()
+{
+  mThread.WaitForTermination();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler::Worker private methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Working thread run code. This method finds and executes IRunnable items. When no items are found it blocks till new
+items are published.
+@return 0.
+@throw nothing (very rare STL exceptions).
+*/
+I32 TaskScheduler::Worker::Run()
+{
+  spCurrent = this;
+  for (;;)
+  {
+    // The sequence is read before looking for items so that any item published afterwards prevents the worker sleep
+    U32 itemSequence = mpScheduler->mItemSequence.Get();
+    IRunnable* pItem = mpScheduler->FindItem(this);
+    if (pItem)
+    {
+      pItem->Run();
+      mpScheduler->OnItemCompletion();
+    }
+    else if (!mpScheduler->WaitForItem(itemSequence)) break;
+  }
+  spCurrent = nullptr;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler constants
+----------------------------------------------------------------------------------------------------------------------*/
+const U32 Threads::TaskScheduler::kMaxSharedBatchCount = 32;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Threads::Global methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+Threads::TaskScheduler& Threads::Global::GetTaskScheduler() { return Singleton<Threads::TaskScheduler>::GetInstance(); }
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+Threads::TaskScheduler::TaskScheduler()
+  : mpAllocator(Memory::Global::GetAllocator())
+  , mWorkerCount(Threads::Thread::GetProcessorCount())
+  , mTerminationFlag(false)
+{
+}
+
+Threads::TaskScheduler::~TaskScheduler()
+{
+  CleanUp();
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+const Memory::IAllocator* Threads::TaskScheduler::GetAllocator() const
+{
+  // [Critical section]
+  Lock l(mWorkerMutex);
+  return mpAllocator;
+}
+
+U32 Threads::TaskScheduler::GetPendingItemCount() const
+{
+  return mPendingItemCount.Get();
+}
+
+U32 Threads::TaskScheduler::GetUnfinishedItemCount() const
+{
+  return mUnfinishedItemCount.Get();
+}
+
+U32 Threads::TaskScheduler::GetWorkerCount() const
+{
+  // [Critical section]
+  Lock l(mWorkerMutex);
+  return mWorkerCount;
+}
+
+bool Threads::TaskScheduler::HasPendingItems() const
+{
+  return mPendingItemCount != 0;
+}
+
+bool Threads::TaskScheduler::IsIdle() const
+{
+  return mUnfinishedItemCount == 0;
+}
+
+void Threads::TaskScheduler::SetAllocator(Memory::IAllocator* p)
+{
+  // [Critical section]
+  Lock l(mWorkerMutex);
+  DestroyWorkers();
+  mpAllocator = p;
+  mWorkerList.SetAllocator(p);
+  // [Critical section]
+  Lock sl(mSharedQueueMutex);
+  mSharedQueue.SetAllocator(p);
+}
+
+void Threads::TaskScheduler::SetWorkerCount(U32 v)
+{
+  E_ASSERT(v > 0);
+  // [Critical section]
+  Lock l(mWorkerMutex);
+  DestroyWorkers();
+  mWorkerCount = v;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+/**
+Schedules the given item for execution. If called from one of this scheduler worker threads the item is pushed into the
+worker own queue (lock-free), otherwise it is pushed into the shared queue.
+@param pItem the item to run.
+@return true (there is no maximum pending item count).
+@throw nothing (very rare STL exceptions).
+*/
+bool Threads::TaskScheduler::AddItem(IRunnable* pItem)
+{
+  E_ASSERT_PTR(pItem);
+  Worker* pWorker = Worker::spCurrent;
+  if (pWorker && pWorker->GetScheduler() == this)
+  {
+    // The item being run keeps the scheduler busy, so the workers can not be terminated meanwhile. Counters MUST be 
+    // increased before the item becomes visible to the workers.
+    ++mUnfinishedItemCount;
+    ++mPendingItemCount;
+    if (!pWorker->GetQueue().Push(pItem))
+    {
+      // [Critical section]
+      Lock l(mSharedQueueMutex);
+      mSharedQueue.Push(pItem);
+      ++mSharedItemCount;
+    }
+  }
+  else
+  {
+    // The running flag is checked with the shared queue locked as DestroyWorkers clears it with the same lock once 
+    // idle: items are either added before (and waited for) or after the workers termination (and new ones created)
+    for (;;)
+    {
+      {
+        // [Critical section]
+        Lock l(mSharedQueueMutex);
+        if (mRunningFlag != 0)
+        {
+          ++mUnfinishedItemCount;
+          ++mPendingItemCount;
+          mSharedQueue.Push(pItem);
+          ++mSharedItemCount;
+          break;
+        }
+      }
+      // Lazily create the workers
+      // [Critical section]
+      Lock l(mWorkerMutex);
+      if (mRunningFlag == 0) CreateWorkers();
+    }
+  }
+  WakeWorkers(false);
+  return true;
+}
+
+/**
+Waits for all pending items to complete and terminates all worker threads.
+@throw nothing (very rare STL exceptions).
+*/
+void Threads::TaskScheduler::CleanUp()
+{
+  // [Critical section]
+  Lock l(mWorkerMutex);
+  DestroyWorkers();
+}
+
+/**
+Makes the calling thread wait for all added items to complete.
+@throw nothing.
+*/
+void Threads::TaskScheduler::WaitForIdle()
+{
+  // [Critical section]
+  Lock l(mIdleMutex);
+  while (mUnfinishedItemCount != 0) mIdleCondition.Wait(mIdleMutex);
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TaskScheduler private methods
+
+Note that CreateWorkers and DestroyWorkers MUST be called with the worker mutex locked.
+----------------------------------------------------------------------------------------------------------------------*/
+
+void Threads::TaskScheduler::CreateWorkers()
+{
+  // All workers are created before starting any of them as running workers iterate the worker list to steal items
+  mWorkerList.Reserve(mWorkerCount);
+  for (U32 i = 0; i < mWorkerCount; ++i)
+  {
+    Worker* pWorker = E_NEW(Worker, 1, mpAllocator);
+    pWorker->SetScheduler(this, i);
+    mWorkerList.PushBack(pWorker);
+  }
+  for (auto it = begin(mWorkerList); it != end(mWorkerList); ++it) (*it)->Start();
+  mRunningFlag = 1;
+}
+
+void Threads::TaskScheduler::DestroyWorkers()
+{
+  if (mRunningFlag == 0) return;
+  // Stop accepting items once idle (AddItem calls from non worker threads wait for the worker mutex from then on)
+  for (;;)
+  {
+    WaitForIdle();
+    // [Critical section]
+    Lock l(mSharedQueueMutex);
+    if (mUnfinishedItemCount == 0)
+    {
+      mRunningFlag = 0;
+      break;
+    }
+  }
+  // [Critical section]
+  {
+    Lock l(mSleepMutex);
+    mTerminationFlag = true;
+    mSleepCondition.Broadcast();
+  }
+  // Workers are destroyed once all of them terminated as they may be stealing from each other till then
+  for (auto it = begin(mWorkerList); it != end(mWorkerList); ++it) (*it)->WaitForTermination();
+  for (auto it = begin(mWorkerList); it != end(mWorkerList); ++it)
+  {
+    E_DELETE(*it, 1, mpAllocator);
+  }
+  mWorkerList.Clear();
+  mTerminationFlag = false;
+}
+
+/**
+Finds an item to run for the given worker: first from the worker own queue, then from the shared queue and finally by
+stealing from other workers.
+@param pWorker the calling worker.
+@return the item to run or nullptr if none was found.
+@throw nothing.
+*/
+Threads::IRunnable* Threads::TaskScheduler::FindItem(Worker* pWorker)
+{
+  IRunnable* pItem = pWorker->GetQueue().Pop();
+  if (!pItem && mSharedItemCount != 0) pItem = PopSharedItems(pWorker);
+  if (!pItem) pItem = StealItem(pWorker);
+  if (pItem) --mPendingItemCount;
+  return pItem;
+}
+
+void Threads::TaskScheduler::OnItemCompletion()
+{
+  if (--mUnfinishedItemCount == 0)
+  {
+    // [Critical section]
+    Lock l(mIdleMutex);
+    mIdleCondition.Broadcast();
+  }
+}
+
+/**
+Takes a batch of items from the shared queue. The first item is returned and the rest are pushed into the worker queue
+(which is empty at this point, so it can not overflow) in order to amortize the shared queue lock.
+@param pWorker the calling worker.
+@return the item to run or nullptr if the shared queue is empty.
+@throw nothing.
+*/
+Threads::IRunnable* Threads::TaskScheduler::PopSharedItems(Worker* pWorker)
+{
+  // [Critical section]
+  Lock l(mSharedQueueMutex);
+  U32 count = static_cast<U32>(mSharedQueue.GetCount());
+  if (count == 0) return nullptr;
+
+  // Take a fair share of the queue so other workers can get items too (never more than the queued items)
+  U32 batchCount = Math::Min(kMaxSharedBatchCount, count / static_cast<U32>(mWorkerList.GetCount()) + 1);
+  batchCount = Math::Min(batchCount, count);
+  IRunnable* pItem = mSharedQueue.GetFront();
+  mSharedQueue.Pop();
+  for (U32 i = 1; i < batchCount; ++i)
+  {
+    pWorker->GetQueue().Push(mSharedQueue.GetFront());
+    mSharedQueue.Pop();
+  }
+  mSharedItemCount -= batchCount;
+  // The rest of the batch can be stolen by sleeping workers
+  if (batchCount > 1) WakeWorkers(true);
+  return pItem;
+}
+
+/**
+Steals an item from other workers. Victims are visited starting from a random one to spread contention.
+@param pWorker the calling worker.
+@return the stolen item or nullptr if none was found.
+@throw nothing.
+*/
+Threads::IRunnable* Threads::TaskScheduler::StealItem(Worker* pWorker)
+{
+  U32 workerCount = static_cast<U32>(mWorkerList.GetCount());
+  if (workerCount < 2) return nullptr;
+  U32 start = pWorker->GenerateRandom() % workerCount;
+  for (U32 i = 0; i < workerCount; ++i)
+  {
+    Worker* pVictim = mWorkerList[(start + i) % workerCount];
+    if (pVictim == pWorker) continue;
+    IRunnable* pItem = pVictim->GetQueue().Steal();
+    if (pItem) return pItem;
+  }
+  return nullptr;
+}
+
+/**
+Puts the calling worker to sleep till new items are published or termination is requested.
+@param itemSequence the item sequence read by the worker before looking for items.
+@return false if the worker must terminate, true otherwise.
+@throw nothing.
+*/
+bool Threads::TaskScheduler::WaitForItem(U32 itemSequence)
+{
+  // [Critical section]
+  Lock l(mSleepMutex);
+  ++mSleepingWorkerCount;
+  while (!mTerminationFlag && mItemSequence == itemSequence) mSleepCondition.Wait(mSleepMutex);
+  --mSleepingWorkerCount;
+  return !mTerminationFlag;
+}
+
+/**
+Publishes new items, waking up sleeping workers if any. Note that interlocked operations imply a full fence, so either a
+sleeping worker sees the item sequence increase or this thread sees the sleeping worker count increase.
+@param all true to wake up all sleeping workers, false to wake up one of them.
+@throw nothing.
+*/
+void Threads::TaskScheduler::WakeWorkers(bool all)
+{
+  ++mItemSequence;
+  if (mSleepingWorkerCount != 0)
+  {
+    // [Critical section]
+    Lock l(mSleepMutex);
+    if (all) mSleepCondition.Broadcast();
+    else mSleepCondition.Signal();
+  }
+}
+}
+}
@@ -47,6 +47,10 @@ processes. This class is a wrapper on the critical section type which is around
 that critical sections do not require to enter the kernel every time they are used (while Windows Mutex does):
 http://preshing.com/20111124/always-use-a-lightweight-mutex/
 
+The critical section is initialized with a spin count: on multi-processor systems a contended Lock spins up to 
+kSpinCount times in user mode before waiting on the kernel event. Engine critical sections are short, so the owner 
+usually releases the lock while spinning and the context switch is avoided (the same value the Windows heap uses).
+
 Please note that this class has the following usage contract: 
 
 1. MutexImpl implements a recursive mutex: if a mutex is locked N times, it will have to be unlocked also N times.
@@ -54,7 +58,9 @@ Please note that this class has the following usage contract:
 class Mutex::Impl : public Memory::ProxyAllocated
 {
 public:
-        Impl()   { InitializeCriticalSection(&mWinCriticalSection); }
+  static const DWORD kSpinCount = 4000;
+
+        Impl()   { InitializeCriticalSectionAndSpinCount(&mWinCriticalSection, kSpinCount); }
         ~Impl()  { DeleteCriticalSection(&mWinCriticalSection); }
 
   void  Lock()   { EnterCriticalSection(&mWinCriticalSection); }
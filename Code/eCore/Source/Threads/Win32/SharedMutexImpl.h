@@ -0,0 +1,62 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file SharedMutexImpl.h
+This file contains the declaration of the SharedMutexImpl implementation class for Windows.
+*/
+
+#ifndef E3_SHARED_MUTEX_IMPL_H
+#define E3_SHARED_MUTEX_IMPL_H
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+SharedMutexImpl
+
+SharedMutexImpl is a wrapper on a Windows slim reader/writer lock (SRWLOCK, Vista or later). A SRW lock is pointer 
+sized, needs no destruction and, like critical sections, spins briefly in user mode before waiting on a kernel keyed 
+event, so uncontended and short critical sections never enter the kernel.
+----------------------------------------------------------------------------------------------------------------------*/	
+class SharedMutex::Impl : public Memory::ProxyAllocated
+{
+public:
+        Impl()          { InitializeSRWLock(&mWinSRWLock); }
+
+  void  Lock()          { AcquireSRWLockExclusive(&mWinSRWLock); }
+  void  LockShared()    { AcquireSRWLockShared(&mWinSRWLock); }
+  void  Unlock()        { ReleaseSRWLockExclusive(&mWinSRWLock); }
+  void  UnlockShared()  { ReleaseSRWLockShared(&mWinSRWLock); }
+
+private:
+  SRWLOCK	mWinSRWLock;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
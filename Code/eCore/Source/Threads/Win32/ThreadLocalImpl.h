@@ -0,0 +1,62 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file ThreadLocalImpl.h
+This file contains the declaration of the ThreadLocalImpl implementation class for Windows.
+*/
+
+#ifndef E3_THREAD_LOCAL_IMPL_H
+#define E3_THREAD_LOCAL_IMPL_H
+
+namespace E
+{
+namespace Threads
+{
+/*----------------------------------------------------------------------------------------------------------------------
+ThreadLocalImpl
+
+ThreadLocalImpl is a wrapper on a Windows TLS (thread local storage) index.
+----------------------------------------------------------------------------------------------------------------------*/	
+class ThreadLocal::Impl : public Memory::ProxyAllocated
+{
+public:
+        Impl()                { mIndex = TlsAlloc(); E_ASSERT(mIndex != TLS_OUT_OF_INDEXES); }
+        ~Impl()               { TlsFree(mIndex); }
+
+  void* Get() const           { return TlsGetValue(mIndex); }
+  void  Set(void* p)          { TlsSetValue(mIndex, p); }
+
+private:
+  DWORD	mIndex;
+
+  E_DISABLE_COPY_AND_ASSSIGNMENT(Impl)
+};
+}
+}
+
+#endif
@@ -52,26 +52,47 @@ This file defines includes all the headers required by the Utilities test applic
 #include <EventSystem/Event.h>
 #include <Containers/DynamicArray.h>
 #include <Containers/List.h>
+#include <Containers/SmallList.h>
 #include <Containers/Map.h>
+#include <Containers/FlatHashMap.h>
+#include <Containers/ConcurrentMap.h>
+#include <Containers/ConcurrentQueue.h>
 #include <Containers/Queue.h>
 #include <Containers/Stack.h>
 #include <Containers/Array.h>
+#include <FileSystem/Archive.h>
 #include <FileSystem/File.h>
+#include <FileSystem/IoQueue.h>
+#include <FileSystem/Pack.h>
+#include <FileSystem/Scanner.h>
+#include <FileSystem/Watcher.h>
 #include <Math/Random.h>
 #include <Math/Hash.h>
 #include <Math/Algorithm.h>
+#include <Math/Batch.h>
 #include <Math/Vector2.h>
 #include <Math/Vector3.h>
 #include <Math/Vector4.h>
+#include <Math/VectorStream.h>
 #include <Math/Matrix4.h>
 #include <Math/Quaternion.h>
+#include <Math/Intersection.h>
+#include <Math/Distance.h>
+#include <Math/Bvh.h>
+#include <Math/Projection.h>
+#include <Math/Frustum.h>
+#include <Memory/CachedAllocator.h>
 #include <Memory/Factory.h>
 #include <Memory/GarbageCollection.h>
+#include <Memory/LinearAllocator.h>
+#include <Memory/TrackingAllocator.h>
 #include <Serialization/ByteSerializer.h>
 #include <Serialization/StringSerializer.h>
 #include <Serialization/XmlSerializer.h>
 #include <Singleton.h>
 #include <Text/String.h>
+#include <Threads/TaskGraph.h>
+#include <Threads/TaskScheduler.h>
 #include <Threads/ThreadPool.h>
 #include <Threads/Atomic.h>
 #include <Time/Timer.h>
@@ -86,6 +107,8 @@ This file defines includes all the headers required by the Utilities test applic
 #include <vector>
 #include <algorithm>
 #include <map>
+#include <unordered_map>
+#include <string>
 #include <queue>
 
 /*----------------------------------------------------------------------------------------------------------------------
@@ -102,13 +125,22 @@ This file defines includes all the headers required by the Utilities test applic
 #include "Test/Serialization/Serialization.h"
 #include "Test/Math/Hash.h"
 #include "Test/Containers/Map.h"
+#include "Test/Containers/FlatHashMap.h"
+#include "Test/Containers/ConcurrentMap.h"
+#include "Test/Containers/ConcurrentQueue.h"
 #include "Test/Containers/Queue.h"
 #include "Test/Containers/Stack.h"
+#include "Test/FileSystem/Archive.h"
 #include "Test/FileSystem/File.h"
+#include "Test/FileSystem/IoQueue.h"
+#include "Test/FileSystem/Pack.h"
+#include "Test/FileSystem/Scanner.h"
+#include "Test/FileSystem/Watcher.h"
 #include "Test/Time/Time.h"
 #include "Test/Math/Vector.h"
 #include "Test/Math/Matrix.h"
 #include "Test/Math/Quaternion.h"
+#include "Test/Math/Bvh.h"
 #include "Test/Memory/Allocator.h"
 #include "Test/Memory/Factory.h"
 #include "Test/Memory/GarbageCollection.h"
@@ -72,12 +72,16 @@ void main()
     Test::StringBuffer::Run();
     Test::Hash::Run();
     Test::Map::Run();
+    Test::FlatHashMap::Run();
     Test::Queue::Run();
+    Test::ConcurrentQueue::Run();
+    Test::ConcurrentMap::Run();
     Test::Stack::Run();
     Test::Time::Run();
     Test::Vector::Run();
     Test::Matrix::Run();
     Test::Quaternion::Run();
+    Test::Bvh::Run();
     Test::Serialization::Run();
     Test::Thread::Run();
     Test::Event::Run();
@@ -87,6 +91,11 @@ void main()
     Test::Allocator::Run();
     Test::Algorithm::Run();
     Test::File::Run();
+    Test::Archive::Run();
+    Test::IoQueue::Run();
+    Test::Pack::Run();
+    Test::Scanner::Run();
+    Test::Watcher::Run();
     Test::WeakPtr::Run();
     Test::GarbageCollection::Run();
     Test::ConditionVariable::Run();
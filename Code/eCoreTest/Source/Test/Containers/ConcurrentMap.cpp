@@ -0,0 +1,262 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file E::Containers::ConcurrentMap.cpp
+This file defines E::Containers::ConcurrentMap test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Mutex + Map combination exposing the ConcurrentMap interface for comparison purposes
+class LockedMap
+{
+public:
+  bool Find(U32 key, U32& value) const
+  {
+    E::Threads::Lock l(mMutex);
+    const U32* pValue = mMap.FindValue(key);
+    if (pValue == nullptr) return false;
+    value = *pValue;
+    return true;
+  }
+
+  bool Insert(U32 key, U32 value)
+  {
+    E::Threads::Lock l(mMutex);
+    size_t count = mMap.GetCount();
+    mMap.Insert(key, value);
+    return mMap.GetCount() != count;
+  }
+
+private:
+  mutable E::Threads::Mutex         mMutex;
+  E::Containers::Map<U32, U32>      mMap;
+};
+
+template <typename MapType>
+struct MapUser : public E::Threads::IRunnable
+{
+  MapUser() : pMap(nullptr), keyCount(0), operationCount(0), writePercentage(0), seed(0), hitCount(0) {}
+
+  I32 Run()
+  {
+    // Simple LCG so threads do not contend on the global random generator
+    U32 random = seed;
+    U32 value = 0;
+    for (U32 i = 0; i < operationCount; ++i)
+    {
+      random = random * 1664525 + 1013904223;
+      U32 key = (random >> 8) % keyCount;
+      if ((random & 0xff) % 100 < writePercentage) pMap->Insert(key, i);
+      else if (pMap->Find(key, value)) ++hitCount;
+    }
+    return 0;
+  }
+
+  MapType*  pMap;
+  U32       keyCount;
+  U32       operationCount;
+  U32       writePercentage;
+  U32       seed;
+  U32       hitCount;
+};
+
+template <typename MapType>
+TimeValue RunMapUsers(MapType& map, U32 threadCount, U32 keyCount, U32 operationCount, U32 writePercentage)
+{
+  E::Containers::List<MapUser<MapType>> userList(threadCount, MapUser<MapType>());
+  E::Containers::List<E::Threads::Thread*> threadList;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    userList[i].pMap = &map;
+    userList[i].keyCount = keyCount;
+    userList[i].operationCount = operationCount / threadCount;
+    userList[i].writePercentage = writePercentage;
+    userList[i].seed = i + 1;
+    threadList.PushBack(new E::Threads::Thread(userList[i]));
+  }
+
+  E::Time::Timer t;
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  TimeValue elapsed = t.GetElapsed();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+  return elapsed;
+}
+
+struct ResourceCreator : public E::Threads::IRunnable
+{
+  ResourceCreator() : pMap(nullptr), pCreationCount(nullptr), keyCount(0) {}
+
+  I32 Run()
+  {
+    for (U32 i = 0; i < keyCount; ++i)
+    {
+      E::String name;
+      name.Print("Resource%u", i);
+      // Every thread requests the same resources: each one must be created only once
+      U32 id = pMap->FindOrCreate(name, [&]() { ++(*pCreationCount); return i; });
+      E_ASSERT(id == i);
+      pMap->Update(name, [](U32& useCount) { ++useCount; });
+    }
+    return 0;
+  }
+
+  E::Containers::ConcurrentMap<E::String, U32>* pMap;
+  E::A32*                                       pCreationCount;
+  U32                                           keyCount;
+};
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test::ConcurrentMap methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::ConcurrentMap::Run()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentMap::Run]" << std::endl;
+    E::Time::Timer t;
+
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::ConcurrentMap::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::ConcurrentMap::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::ConcurrentMap::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentMap::RunFunctionalityTest]" << std::endl;
+
+    // Single thread
+    E::Containers::ConcurrentMap<U32, U32> map;
+    E_ASSERT(map.IsEmpty());
+    for (U32 i = 0; i < 1000; ++i) map.Insert(i, i);
+    E_ASSERT(map.GetCount() == 1000);
+    U32 value = 0;
+    E_ASSERT(map.Find(10, value) && value == 10);
+    value = map.FindOrInsert(10, 0);
+    E_ASSERT(value == 10);
+    value = map.FindOrInsert(1000, 1000);
+    E_ASSERT(value == 1000);
+    map.Update(1000, [](U32& v) { v *= 2; });
+    E_ASSERT(map.Find(1000, value) && value == 2000);
+    map.RemoveIf(1000);
+    E_ASSERT(!map.HasKey(1000) && map.GetCount() == 1000);
+    U64 sum = 0;
+    map.ForEach([&](U32 key, U32 v) { sum += key + v; });
+    E_ASSERT(sum == 999 * 1000);
+    map.Clear();
+    E_ASSERT(map.IsEmpty());
+
+    // Several threads creating and updating the same resources
+    const U32 kThreadCount = 8;
+    const U32 kKeyCount = 1000;
+    E::Containers::ConcurrentMap<E::String, U32> resourceMap;
+    E::A32 creationCount;
+    E::Containers::List<ResourceCreator> creatorList(kThreadCount, ResourceCreator());
+    E::Containers::List<E::Threads::Thread*> threadList;
+    for (U32 i = 0; i < kThreadCount; ++i)
+    {
+      creatorList[i].pMap = &resourceMap;
+      creatorList[i].pCreationCount = &creationCount;
+      creatorList[i].keyCount = kKeyCount;
+      threadList.PushBack(new E::Threads::Thread(creatorList[i]));
+    }
+    for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+    for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+    for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+
+    E_ASSERT(creationCount.Get() == kKeyCount && resourceMap.GetCount() == kKeyCount);
+    // Each value was created as its index and increased once per thread
+    U64 valueSum = 0;
+    resourceMap.ForEach([&](const E::String&, U32 v) { valueSum += v; });
+    E_ASSERT(valueSum == static_cast<U64>(kKeyCount) * (kKeyCount - 1) / 2 + kKeyCount * kThreadCount);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::ConcurrentMap::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentMap::RunPerformanceTest]" << std::endl;
+
+    const U32 kKeyCount = 1 << 16;
+    const U32 kOperationCount = 1 << 24;
+    const U32 kThreadCounts[] = { 1, 4, 16 };
+    const U32 kWritePercentages[] = { 0, 10 };
+
+    E::Containers::ConcurrentMap<U32, U32> concurrentMap;
+    LockedMap lockedMap;
+    for (U32 i = 0; i < kKeyCount; ++i)
+    {
+      concurrentMap.Insert(i, i);
+      lockedMap.Insert(i, i);
+    }
+
+    std::cout << "Keys: " << kKeyCount << " Operations: " << kOperationCount << std::endl << std::endl;
+    for (U32 w = 0; w < E_ELEMENT_COUNT(kWritePercentages); ++w)
+    {
+      for (U32 t = 0; t < E_ELEMENT_COUNT(kThreadCounts); ++t)
+      {
+        D64 concurrentTime = RunMapUsers(concurrentMap, kThreadCounts[t], kKeyCount, kOperationCount, kWritePercentages[w]).GetMilliseconds();
+        D64 lockedTime = RunMapUsers(lockedMap, kThreadCounts[t], kKeyCount, kOperationCount, kWritePercentages[w]).GetMilliseconds();
+        std::cout << kThreadCounts[t] << " threads (" << kWritePercentages[w] << "% writes)\tConcurrentMap: " 
+          << concurrentTime << " ms (" << kOperationCount / concurrentTime / 1000.0 << " Mops/s)\tMutex + Map: " 
+          << lockedTime << " ms (" << kOperationCount / lockedTime / 1000.0 << " Mops/s)" << std::endl;
+      }
+    }
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,281 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file E::Containers::ConcurrentQueue.cpp
+This file defines E::Containers::ConcurrentQueue test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Mutex + Queue combination exposing the ConcurrentQueue interface for comparison purposes
+template <typename T>
+class LockedQueue
+{
+public:
+  explicit LockedQueue(size_t size) : mSize(size) { mQueue.Reserve(size); }
+
+  bool Pop(T& value)
+  {
+    E::Threads::Lock l(mMutex);
+    if (mQueue.IsEmpty()) return false;
+    value = mQueue.GetFront();
+    mQueue.Pop();
+    return true;
+  }
+
+  bool Push(const T& value)
+  {
+    E::Threads::Lock l(mMutex);
+    if (mQueue.GetCount() >= mSize) return false;
+    mQueue.Push(value);
+    return true;
+  }
+
+private:
+  E::Threads::Mutex         mMutex;
+  E::Containers::Queue<T>   mQueue;
+  size_t                    mSize;
+};
+
+template <typename QueueType>
+struct Producer : public E::Threads::IRunnable
+{
+  Producer() : pQueue(nullptr), first(0), count(0) {}
+
+  I32 Run()
+  {
+    for (U32 i = first; i < first + count; ++i) while (!pQueue->Push(i));
+    return 0;
+  }
+
+  QueueType*  pQueue;
+  U32         first;
+  U32         count;
+};
+
+template <typename QueueType>
+struct Consumer : public E::Threads::IRunnable
+{
+  Consumer() : pQueue(nullptr), pPoppedCount(nullptr), totalCount(0), sum(0) {}
+
+  I32 Run()
+  {
+    U32 value = 0;
+    while (*pPoppedCount != totalCount)
+    {
+      if (pQueue->Pop(value))
+      {
+        sum += value;
+        ++(*pPoppedCount);
+      }
+    }
+    return 0;
+  }
+
+  QueueType*  pQueue;
+  E::A32*     pPoppedCount;
+  U32         totalCount;
+  U64         sum;
+};
+
+/**
+Pushes itemCount values through the queue using the given number of producer and consumer threads and checks every
+value is popped exactly once (by checking the popped value sum).
+@return the elapsed time.
+*/
+template <typename QueueType>
+TimeValue RunProducerConsumerTest(QueueType& queue, U32 producerCount, U32 consumerCount, U32 itemCount)
+{
+  E::A32 poppedCount;
+  E::Containers::List<Producer<QueueType>> producerList(producerCount, Producer<QueueType>());
+  E::Containers::List<Consumer<QueueType>> consumerList(consumerCount, Consumer<QueueType>());
+  E::Containers::List<E::Threads::Thread*> threadList;
+
+  U32 countPerProducer = itemCount / producerCount;
+  for (U32 i = 0; i < producerCount; ++i)
+  {
+    producerList[i].pQueue = &queue;
+    producerList[i].first = i * countPerProducer;
+    producerList[i].count = countPerProducer;
+    threadList.PushBack(new E::Threads::Thread(producerList[i]));
+  }
+  for (U32 i = 0; i < consumerCount; ++i)
+  {
+    consumerList[i].pQueue = &queue;
+    consumerList[i].pPoppedCount = &poppedCount;
+    consumerList[i].totalCount = countPerProducer * producerCount;
+    threadList.PushBack(new E::Threads::Thread(consumerList[i]));
+  }
+
+  E::Time::Timer t;
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  TimeValue elapsed = t.GetElapsed();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+
+  U64 n = countPerProducer * producerCount;
+  U64 sum = 0;
+  for (U32 i = 0; i < consumerCount; ++i) sum += consumerList[i].sum;
+  E_ASSERT(sum == n * (n - 1) / 2);
+  return elapsed;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+TestList methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::ConcurrentQueue::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::ConcurrentQueue::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::ConcurrentQueue::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::ConcurrentQueue::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentQueue::RunFunctionalityTest]" << std::endl;
+
+    /*-----------------------------------------------------------------
+    Single thread
+    -----------------------------------------------------------------*/
+    E::Containers::ConcurrentQueue<U32> mpmcQueue(16);
+    E::Containers::ConcurrentQueue<U32, E::Containers::eConcurrentQueueModeMpsc> mpscQueue(16);
+    E::Containers::ConcurrentQueue<U32, E::Containers::eConcurrentQueueModeSpsc> spscQueue;
+    U32 value = 0;
+    // No storage before Resize
+    {
+      E::Containers::ConcurrentQueue<U32> emptyMpmcQueue;
+      E_ASSERT(!emptyMpmcQueue.Push(0) && !emptyMpmcQueue.Pop(value) && emptyMpmcQueue.IsEmpty());
+      E_ASSERT(!spscQueue.Push(0) && !spscQueue.Pop(value) && spscQueue.IsEmpty());
+    }
+    spscQueue.Resize(16);
+    E_ASSERT(mpmcQueue.GetSize() == 16 && mpscQueue.GetSize() == 16 && spscQueue.GetSize() == 16);
+    E_ASSERT(mpmcQueue.IsEmpty() && mpscQueue.IsEmpty() && spscQueue.IsEmpty());
+
+    E_ASSERT(!mpmcQueue.Pop(value) && !mpscQueue.Pop(value) && !spscQueue.Pop(value));
+    // Several rounds check index wrap around
+    for (U32 round = 0; round < 4; ++round)
+    {
+      for (U32 i = 0; i < 16; ++i) E_ASSERT(mpmcQueue.Push(i) && mpscQueue.Push(i) && spscQueue.Push(i));
+      E_ASSERT(!mpmcQueue.Push(16) && !mpscQueue.Push(16) && !spscQueue.Push(16));
+      E_ASSERT(mpmcQueue.GetCount() == 16 && mpscQueue.GetCount() == 16 && spscQueue.GetCount() == 16);
+      for (U32 i = 0; i < 16; ++i)
+      {
+        E_ASSERT(mpmcQueue.Pop(value) && value == i);
+        E_ASSERT(mpscQueue.Pop(value) && value == i);
+        E_ASSERT(spscQueue.Pop(value) && value == i);
+      }
+      E_ASSERT(mpmcQueue.IsEmpty() && mpscQueue.IsEmpty() && spscQueue.IsEmpty());
+    }
+
+    // Allocator change keeps the size
+    mpmcQueue.SetAllocator(Memory::Global::GetAllocator());
+    E_ASSERT(mpmcQueue.GetSize() == 16 && mpmcQueue.IsEmpty());
+
+    /*-----------------------------------------------------------------
+    Multiple threads
+    -----------------------------------------------------------------*/
+    const U32 kItemCount = 1 << 16;
+    E::Containers::ConcurrentQueue<U32> mpmcBigQueue(1024);
+    E::Containers::ConcurrentQueue<U32, E::Containers::eConcurrentQueueModeMpsc> mpscBigQueue(1024);
+    E::Containers::ConcurrentQueue<U32, E::Containers::eConcurrentQueueModeSpsc> spscBigQueue(1024);
+    RunProducerConsumerTest(mpmcBigQueue, 4, 4, kItemCount);
+    RunProducerConsumerTest(mpscBigQueue, 4, 1, kItemCount);
+    RunProducerConsumerTest(spscBigQueue, 1, 1, kItemCount);
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::ConcurrentQueue::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::ConcurrentQueue::RunPerformanceTest]" << std::endl;
+
+    const U32 kItemCount = 1 << 20;
+    const U32 kQueueSize = 1024;
+    const U32 kThreadCounts[] = { 1, 2, 4, 8 };
+
+    std::cout << "Items: " << kItemCount << " Queue size: " << kQueueSize << std::endl << std::endl;
+    {
+      E::Containers::ConcurrentQueue<U32, E::Containers::eConcurrentQueueModeSpsc> spscQueue(kQueueSize);
+      LockedQueue<U32> lockedQueue(kQueueSize);
+      D64 spscTime = RunProducerConsumerTest(spscQueue, 1, 1, kItemCount).GetMilliseconds();
+      D64 lockedTime = RunProducerConsumerTest(lockedQueue, 1, 1, kItemCount).GetMilliseconds();
+      std::cout << "1P/1C  SPSC: " << spscTime << " ms\tMutex + Queue: " << lockedTime << " ms" << std::endl;
+    }
+    for (U32 i = 0; i < E_ELEMENT_COUNT(kThreadCounts); ++i)
+    {
+      U32 n = kThreadCounts[i];
+      E::Containers::ConcurrentQueue<U32, E::Containers::eConcurrentQueueModeMpsc> mpscQueue(kQueueSize);
+      LockedQueue<U32> lockedQueue(kQueueSize);
+      D64 mpscTime = RunProducerConsumerTest(mpscQueue, n, 1, kItemCount).GetMilliseconds();
+      D64 lockedTime = RunProducerConsumerTest(lockedQueue, n, 1, kItemCount).GetMilliseconds();
+      std::cout << n << "P/1C  MPSC: " << mpscTime << " ms\tMutex + Queue: " << lockedTime << " ms" << std::endl;
+    }
+    for (U32 i = 0; i < E_ELEMENT_COUNT(kThreadCounts); ++i)
+    {
+      U32 n = kThreadCounts[i];
+      E::Containers::ConcurrentQueue<U32> mpmcQueue(kQueueSize);
+      LockedQueue<U32> lockedQueue(kQueueSize);
+      D64 mpmcTime = RunProducerConsumerTest(mpmcQueue, n, n, kItemCount).GetMilliseconds();
+      D64 lockedTime = RunProducerConsumerTest(lockedQueue, n, n, kItemCount).GetMilliseconds();
+      std::cout << n << "P/" << n << "C  MPMC: " << mpmcTime << " ms\tMutex + Queue: " << lockedTime << " ms" << std::endl;
+    }
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
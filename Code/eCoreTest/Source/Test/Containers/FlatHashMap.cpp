@@ -0,0 +1,247 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file E::Containers::FlatHashMap.cpp
+This file defines E::Containers::FlatHashMap test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+template <typename MapType>
+D64 TimeMapInsert(MapType& map, const std::vector<U32>& keys)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) map.Insert(keys[i], keys[i]);
+  return t.GetElapsed().GetMilliseconds();
+}
+
+template <typename MapType>
+D64 TimeMapFind(const MapType& map, const std::vector<U32>& keys, U32& hitCount)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) if (map.FindPair(keys[i])) ++hitCount;
+  return t.GetElapsed().GetMilliseconds();
+}
+
+template <typename MapType>
+D64 TimeMapRemove(MapType& map, const std::vector<U32>& keys)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) map.RemoveIf(keys[i]);
+  return t.GetElapsed().GetMilliseconds();
+}
+
+D64 TimeMapInsert(std::unordered_map<U32, U32>& map, const std::vector<U32>& keys)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) map.insert(std::make_pair(keys[i], keys[i]));
+  return t.GetElapsed().GetMilliseconds();
+}
+
+D64 TimeMapFind(const std::unordered_map<U32, U32>& map, const std::vector<U32>& keys, U32& hitCount)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) if (map.find(keys[i]) != map.end()) ++hitCount;
+  return t.GetElapsed().GetMilliseconds();
+}
+
+D64 TimeMapRemove(std::unordered_map<U32, U32>& map, const std::vector<U32>& keys)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) map.erase(keys[i]);
+  return t.GetElapsed().GetMilliseconds();
+}
+
+template <typename MapType>
+void PrintMapTimes(const char* pName, MapType& map, const std::vector<U32>& keys, const std::vector<U32>& missingKeys)
+{
+  U32 hitCount = 0;
+  D64 insertTime = TimeMapInsert(map, keys);
+  D64 findTime = TimeMapFind(map, keys, hitCount);
+  D64 missTime = TimeMapFind(map, missingKeys, hitCount);
+  D64 removeTime = TimeMapRemove(map, keys);
+  E_ASSERT(hitCount == keys.size());
+  std::cout << pName << "\tinsert: " << insertTime << " ms\tfind: " << findTime << " ms\tfind (missing): " << missTime 
+    << " ms\tremove: " << removeTime << " ms" << std::endl;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test::FlatHashMap methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::FlatHashMap::Run()
+{
+  try
+  {
+    std::cout << "[Test::FlatHashMap::Run]" << std::endl;
+    E::Time::Timer t;
+
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::FlatHashMap::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::FlatHashMap::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::FlatHashMap::RunFunctionalityTest()
+{
+  try
+  {
+    std::cout << "[Test::FlatHashMap::RunFunctionalityTest]" << std::endl;
+
+    // Random insertion / removal compared against std::map (checks removal never breaks a probe sequence)
+    E::Containers::FlatHashMap<U32, U32> map;
+    std::map<U32, U32> stdMap;
+    Math::Global::GetRandom().SetSeed(1234);
+    for (U32 i = 0; i < 100000; ++i)
+    {
+      U32 key = Math::Global::GetRandom().GetU32(4096);
+      if (Math::Global::GetRandom().GetU32(3) == 0)
+      {
+        bool isRemoved = map.RemoveIf(key);
+        bool isRemovedStd = stdMap.erase(key) != 0;
+        E_ASSERT(isRemoved == isRemovedStd);
+      }
+      else
+      {
+        map.Insert(key, i);
+        stdMap[key] = i;
+      }
+    }
+    E_ASSERT(map.GetCount() == stdMap.size());
+    E_ASSERT(map.GetCount() <= map.GetSize() - map.GetSize() / 8);
+    for (auto stdIt = begin(stdMap); stdIt != end(stdMap); ++stdIt)
+    {
+      E_ASSERT(map.HasKey((*stdIt).first) && map[(*stdIt).first] == (*stdIt).second);
+    }
+    U32 hitCount = 0;
+    for (auto it = begin(map); it != end(map); ++it)
+    {
+      E_ASSERT(stdMap.find((*it).first) != stdMap.end());
+      ++hitCount;
+    }
+    E_ASSERT(hitCount == map.GetCount());
+
+    // Copy, compact and resize
+    E::Containers::FlatHashMap<U32, U32> mapCopy(map);
+    E_ASSERT(mapCopy.GetCount() == map.GetCount());
+    mapCopy.Compact();
+    E_ASSERT(mapCopy.GetSize() <= map.GetSize());
+    mapCopy.Resize(mapCopy.GetSize() * 4);
+    for (auto stdIt = begin(stdMap); stdIt != end(stdMap); ++stdIt)
+    {
+      E_ASSERT(*mapCopy.FindValue((*stdIt).first) == (*stdIt).second);
+    }
+    while (!mapCopy.IsEmpty()) mapCopy.Remove(mapCopy.GetBegin());
+    mapCopy.Resize(0);
+    E_ASSERT(!mapCopy.HasKey(1));
+    mapCopy.Insert(1, 1);
+    E_ASSERT(mapCopy.GetCount() == 1 && mapCopy[1] == 1);
+
+    // Non-POD keys and values
+    E::Containers::FlatHashMap<E::String, E::String> strMap;
+    E::String key;
+    for (U32 i = 0; i < 1000; ++i)
+    {
+      key.Print("Key%u", i);
+      strMap.Insert(key, key + "Value");
+    }
+    strMap.Emplace("Emplaced", "Value");
+    E_ASSERT(strMap["Emplaced"] == "Value");
+    for (U32 i = 0; i < 1000; i += 2)
+    {
+      key.Print("Key%u", i);
+      strMap.RemoveIf(key);
+    }
+    for (U32 i = 1; i < 1000; i += 2)
+    {
+      key.Print("Key%u", i);
+      E_ASSERT(strMap[key] == key + "Value");
+    }
+    E_ASSERT(strMap.GetCount() == 501);
+    strMap.Clear();
+    E_ASSERT(strMap.IsEmpty() && !strMap.HasKey("Emplaced"));
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
+
+bool Test::FlatHashMap::RunPerformanceTest()
+{
+  try
+  {
+    std::cout << "[Test::FlatHashMap::RunPerformanceTest]" << std::endl;
+
+    // Key counts filling the maps close to their max occupancy (87.5% FlatHashMap, 75% Map) before growing
+    const U32 kSize = 1 << 21;
+    const U32 kKeyCounts[] = { kSize * 7 / 8 - 1, kSize * 3 / 4 - 1 };
+
+    for (U32 k = 0; k < E_ELEMENT_COUNT(kKeyCounts); ++k)
+    {
+      std::vector<U32> keys;
+      std::vector<U32> missingKeys;
+      for (U32 i = 0; i < kKeyCounts[k]; ++i)
+      {
+        keys.push_back(i * 2);
+        missingKeys.push_back(i * 2 + 1);
+      }
+      std::random_shuffle(keys.begin(), keys.end());
+
+      std::cout << "Key count: " << kKeyCounts[k] << " (" << kKeyCounts[k] * 100.0 / kSize << "% of " << kSize << ")" << std::endl;
+      E::Containers::FlatHashMap<U32, U32> flatHashMap(kSize);
+      PrintMapTimes("FlatHashMap", flatHashMap, keys, missingKeys);
+      E::Containers::Map<U32, U32> map(kSize);
+      PrintMapTimes("Map\t", map, keys, missingKeys);
+      std::unordered_map<U32, U32> stdMap(kSize);
+      PrintMapTimes("unordered_map", stdMap, keys, missingKeys);
+      std::cout << std::endl;
+    }
+  }
+  catch (...)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -69,6 +69,28 @@ F32 TimeInsert(U32 count, std::vector<I32>& intList);
 F32 TimeRemove(U32 count, E::Containers::List<I32>& intList);
 F32 TimeRemove(U32 count, std::vector<I32>& intList);
 F32 TimeRemoveFast(U32 count, E::Containers::List<I32>& intList);
+template <typename ListClass>
+F32 TimeShortLists(U32 listCount, U32 elementCount, E::Memory::IAllocator* pAllocator);
+
+// Non-POD item counting copies and moves (used to check that List growth moves instead of copying)
+struct CopyCounter
+{
+  static U32 sCopyCount;
+  static U32 sMoveCount;
+
+  I32 value;
+
+  CopyCounter() : value(0) {}
+  explicit CopyCounter(I32 v) : value(v) {}
+  CopyCounter(const CopyCounter& other) : value(other.value) { ++sCopyCount; }
+  CopyCounter(CopyCounter&& other) : value(other.value) { ++sMoveCount; }
+  CopyCounter& operator=(const CopyCounter& other) { value = other.value; ++sCopyCount; return *this; }
+  CopyCounter& operator=(CopyCounter&& other) { value = other.value; ++sMoveCount; return *this; }
+  bool operator==(const CopyCounter& other) const { return value == other.value; }
+};
+
+U32 CopyCounter::sCopyCount = 0;
+U32 CopyCounter::sMoveCount = 0;
 
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
@@ -453,6 +475,113 @@ bool Test::List::RunFunctionalityTest()
       elementCounter ++;
       E_ASSERT(*it == elementCounter);
     }
+
+    /*-----------------------------------------------------------------
+    Move semantics
+    -----------------------------------------------------------------*/
+    {
+      CopyCounter::sCopyCount = 0;
+      E::Containers::List<CopyCounter> counterList;
+      for (I32 i = 0; i < TEST_SIZE; ++i)
+      {
+        counterList.EmplaceBack(i);
+      }
+      counterList.PushBack(CopyCounter(TEST_SIZE));
+      counterList.InsertAt(CopyCounter(-1), 0);
+      E_ASSERT(counterList.GetCount() == TEST_SIZE + 2 && counterList[0].value == -1 && counterList[TEST_SIZE + 1].value == TEST_SIZE);
+      E_ASSERT(CopyCounter::sCopyCount == 0);
+
+      // Move construction / assignment steal the memory
+      const CopyCounter* pCounterData = counterList.GetPtr();
+      E::Containers::List<CopyCounter> movedCounterList(std::move(counterList));
+      E_ASSERT(movedCounterList.GetPtr() == pCounterData && counterList.IsEmpty() && counterList.GetSize() == 0);
+      counterList = std::move(movedCounterList);
+      E_ASSERT(counterList.GetPtr() == pCounterData && movedCounterList.IsEmpty());
+      counterList.RemoveFast(counterList.GetBegin());
+      E_ASSERT(counterList[0].value == TEST_SIZE && CopyCounter::sCopyCount == 0);
+
+      // Copies still deep copy
+      movedCounterList = counterList;
+      E_ASSERT(movedCounterList.GetPtr() != counterList.GetPtr() && movedCounterList.GetCount() == counterList.GetCount());
+
+      E::Containers::List<E::StringBuffer> stringList;
+      E::StringBuffer str("move me");
+      stringList.PushBack(std::move(str));
+      stringList.EmplaceBack("emplaced");
+      E_ASSERT(str.GetLength() == 0 && str == "" && stringList[0] == "move me" && stringList[1] == "emplaced");
+      str << "reused";
+      E_ASSERT(str == "reused");
+    }
+
+    /*-----------------------------------------------------------------
+    SmallList
+    -----------------------------------------------------------------*/
+    {
+      E::Memory::TrackingAllocator trackingAllocator;
+      E::Memory::AllocationSnapshot snapshot;
+      E::Containers::SmallList<I32, 4> smallList;
+      smallList.SetAllocator(&trackingAllocator);
+      E_ASSERT(smallList.IsInline() && smallList.GetSize() == 4);
+      for (I32 i = 0; i < 4; ++i) smallList.PushBack(i);
+      trackingAllocator.GetSnapshot(snapshot);
+      E_ASSERT(smallList.IsInline() && snapshot.GetTotalStats().allocationCount == 0);
+
+      // Spill to the heap
+      smallList.InsertAt(10, 0);
+      E_ASSERT(!smallList.IsInline() && smallList.GetCount() == 5);
+      E_ASSERT(smallList[0] == 10 && smallList[4] == 3);
+      trackingAllocator.GetSnapshot(snapshot);
+      E_ASSERT(snapshot.GetTotalStats().allocationCount == 1);
+      smallList.RemoveIndex(0);
+
+      // Copy (heap) & move back inline
+      E::Containers::SmallList<I32, 4> smallListCopy(smallList);
+      E_ASSERT(!smallListCopy.IsInline() && smallListCopy.GetPtr() != smallList.GetPtr());
+      smallList.Compact();
+      E_ASSERT(smallList.IsInline() && smallList.GetCount() == 4);
+      for (I32 i = 0; i < 4; ++i)
+      {
+        E_ASSERT(smallList[i] == i && smallListCopy[i] == i);
+      }
+
+      // Copy (inline)
+      smallListCopy = smallList;
+      E_ASSERT(smallListCopy.IsInline() && smallListCopy.GetPtr() != smallList.GetPtr());
+      I32 valueCounter = 0;
+      for (auto it = begin(smallListCopy); it != end(smallListCopy); ++it)
+      {
+        E_ASSERT(*it == valueCounter);
+        valueCounter++;
+      }
+      E_ASSERT(valueCounter == 4);
+      bool removed = smallListCopy.RemoveIfFast(0);
+      E_ASSERT(removed && smallListCopy.GetCount() == 3 && smallListCopy[0] == 3);
+
+      // Shrinking under the count trims it
+      smallList.Resize(6);
+      smallList.Fill(7, 4);
+      E_ASSERT(!smallList.IsInline() && smallList.GetCount() == 6 && smallList[5] == 7);
+      smallList.Resize(2);
+      E_ASSERT(smallList.IsInline() && smallList.GetCount() == 2 && smallList[1] == 1);
+      trackingAllocator.GetSnapshot(snapshot);
+      E::Memory::AllocationStats stats = snapshot.GetTotalStats();
+      E_ASSERT(stats.liveBytes == 0 && stats.allocationCount == stats.deallocationCount);
+
+      // Move semantics: heap memory is taken over, inline elements and growth are moved
+      CopyCounter::sCopyCount = 0;
+      E::Containers::SmallList<CopyCounter, 4> counterList;
+      for (I32 i = 0; i < 4; ++i) counterList.EmplaceBack(i);
+      counterList.PushBack(CopyCounter(4));
+      counterList.InsertAt(CopyCounter(-1), 0);
+      E_ASSERT(!counterList.IsInline() && counterList.GetCount() == 6 && counterList[0].value == -1 && counterList[5].value == 4);
+      const CopyCounter* pCounterData = counterList.GetPtr();
+      E::Containers::SmallList<CopyCounter, 4> movedCounterList(std::move(counterList));
+      E_ASSERT(movedCounterList.GetPtr() == pCounterData && counterList.IsEmpty() && counterList.IsInline());
+      movedCounterList.Resize(4);
+      counterList = std::move(movedCounterList);
+      E_ASSERT(counterList.IsInline() && counterList.GetCount() == 4 && counterList[3].value == 2 && movedCounterList.IsEmpty());
+      E_ASSERT(CopyCounter::sCopyCount == 0);
+    }
   }
   catch (...)
   {
@@ -517,6 +646,45 @@ bool Test::List::RunPerformanceTest()
       std::cout << "Find time [" << findTime << " / " << findTimeStd << "]\t" << (findTimeStd / findTime * 100.0) - 100.0 << "% faster" << std::endl;
       std::cout << "Rmv time [" << removeTime << " / " << removeTimeStd << "]\t" << (removeTimeStd / removeTime * 100.0) - 100.0 << "% faster" << std::endl;
       std::cout << "RmvFst time [" << removeTimeFast << " / " << removeTimeStd << "]\t" << (removeTimeStd / removeTimeFast * 100.0) - 100.0 << "% faster" << std::endl << std::endl;
+
+      // Short lists (the usual per event / per binding / per draw case): List vs SmallList allocations
+      const U32 shortListCount = 100000;
+      for (U32 elementCount = 2; elementCount <= 8; elementCount *= 2)
+      {
+        E::Memory::TrackingAllocator trackingAllocator;
+        E::Memory::AllocationSnapshot snapshot;
+        F32 listTime = TimeShortLists<E::Containers::List<I32> >(shortListCount, elementCount, &trackingAllocator);
+        trackingAllocator.GetSnapshot(snapshot);
+        U64 listAllocationCount = snapshot.GetTotalStats().allocationCount;
+        F32 smallListTime = TimeShortLists<E::Containers::SmallList<I32, 4> >(shortListCount, elementCount, &trackingAllocator);
+        trackingAllocator.GetSnapshot(snapshot);
+        U64 smallListAllocationCount = snapshot.GetTotalStats().allocationCount - listAllocationCount;
+        std::cout << shortListCount << " lists of " << elementCount << " elements. List: " << listAllocationCount << " allocations " << listTime 
+          << " ms SmallList<4>: " << smallListAllocationCount << " allocations " << smallListTime << " ms" << std::endl;
+      }
+      std::cout << std::endl;
+
+      // Growth of a non-POD list: items are moved into the new memory instead of being copied
+      {
+        const U32 itemCount = 100000;
+        CopyCounter::sCopyCount = 0;
+        CopyCounter::sMoveCount = 0;
+        E::Time::Timer growthTimer;
+        E::Containers::List<CopyCounter> counterList;
+        for (U32 i = 0; i < itemCount; ++i) counterList.EmplaceBack(i);
+        std::cout << "List<CopyCounter> growth to " << itemCount << " items: " << CopyCounter::sCopyCount << " copies " 
+          << CopyCounter::sMoveCount << " moves " << growthTimer.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+
+        growthTimer.Reset();
+        E::Containers::List<E::StringBuffer> stringList;
+        for (U32 i = 0; i < itemCount; ++i) stringList.EmplaceBack("A string long enough to live in the heap");
+        std::cout << "List<StringBuffer> growth to " << itemCount << " items: " << growthTimer.GetElapsed().GetMilliseconds() << " ms" << std::endl;
+
+        growthTimer.Reset();
+        std::vector<std::string> stdStringList;
+        for (U32 i = 0; i < itemCount; ++i) stdStringList.emplace_back("A string long enough to live in the heap");
+        std::cout << "STD vector<string> growth to " << itemCount << " items: " << growthTimer.GetElapsed().GetMilliseconds() << " ms" << std::endl << std::endl;
+      }
       
       /*
       PC: 
@@ -627,3 +795,22 @@ F32 TimeRemoveFast(U32 count, E::Containers::List<I32>& intList)
 
   return static_cast<F32>(t.GetElapsed().GetMilliseconds());
 }
+
+template <typename ListClass>
+F32 TimeShortLists(U32 listCount, U32 elementCount, E::Memory::IAllocator* pAllocator)
+{
+  U32 checksum = 0;
+  E::Time::Timer t;
+  for (U32 i = 0; i < listCount; ++i)
+  {
+    ListClass list;
+    list.SetAllocator(pAllocator);
+    for (U32 j = 0; j < elementCount; ++j) list.PushBack(static_cast<I32>(i + j));
+    for (auto it = begin(list); it != end(list); ++it) checksum += static_cast<U32>(*it);
+  }
+  F32 time = static_cast<F32>(t.GetElapsed().GetMilliseconds());
+
+  // Use the checksum so the loop cannot be discarded
+  if (checksum == 0) std::cout << "Unexpected checksum" << std::endl;
+  return time;
+}
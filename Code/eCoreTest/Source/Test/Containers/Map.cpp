@@ -59,6 +59,11 @@ F32 TimeInsert(U32 count, std::map<U32, U32>& intMap);
 F32 TimeRemoveBoth(U32 count, std::map<U32, U32>& intMapStd, E::Containers::Map<U32, U32>& intMap);
 F32 TimeRemove(U32 count, E::Containers::Map<U32, U32>& intMap);
 F32 TimeRemove(U32 count, std::map<U32, U32>& intMap);
+F32 TimeFind(U32 count, const std::unordered_map<U32, U32>& intMap);
+F32 TimeInsert(U32 count, std::unordered_map<U32, U32>& intMap);
+F32 TimeRemove(U32 count, std::unordered_map<U32, U32>& intMap);
+F32 TimeStringKeys(const std::vector<E::String>& keys, E::Containers::Map<E::String, U32>& strMap);
+F32 TimeStringKeys(const std::vector<std::string>& keys, std::unordered_map<std::string, U32>& strMap);
 
 #ifdef E_DEBUG
 void CompareMap(const E::Containers::Map<U32, U32>& map, const std::map<U32, U32>& stdMap)
@@ -111,6 +116,22 @@ struct MapFoo
   I32 v;
 };
 
+// Resource owning value type counting its live instances
+struct MapResource
+{
+  MapResource() : pValue(new U32(0)) { ++sLiveCount; }
+  explicit MapResource(U32 v) : pValue(new U32(v)) { ++sLiveCount; }
+  MapResource(const MapResource& other) : pValue(new U32(*other.pValue)) { ++sLiveCount; }
+  MapResource(MapResource&& other) : pValue(other.pValue) { other.pValue = nullptr; ++sLiveCount; }
+  ~MapResource() { delete pValue; --sLiveCount; }
+  MapResource& operator=(MapResource other) { std::swap(pValue, other.pValue); return *this; }
+
+  U32* pValue;
+  static I32 sLiveCount;
+};
+
+I32 MapResource::sLiveCount = 0;
+
 bool Test::Map::RunFunctionalityTest()
 {
   try
@@ -137,6 +158,60 @@ bool Test::Map::RunFunctionalityTest()
     E::Containers::Map<E::String, I64> strMap;
     strMap.Insert("SomeStr", 45);
 
+    // Non-POD keys and values (values must be constructed only for valid pairs and moved on rehash)
+    {
+      E::Containers::Map<E::String, MapResource> resourceMap;
+      E::String key;
+      for (U32 i = 0; i < TEST_SMALL_SIZE * 4; ++i)
+      {
+        key.Print("Key%u", i);
+        resourceMap.Insert(key, MapResource(i));
+      }
+      E_ASSERT(resourceMap.GetCount() == TEST_SMALL_SIZE * 4);
+      E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount()));
+      for (U32 i = 0; i < TEST_SMALL_SIZE * 4; ++i)
+      {
+        key.Print("Key%u", i);
+        E_ASSERT(*resourceMap.FindValue(key)->pValue == i);
+        E_ASSERT(*resourceMap[key].pValue == i);
+      }
+
+      E_ASSERT(*resourceMap.Emplace("Emplaced", 7U)->second.pValue == 7);
+      E_ASSERT(*resourceMap.Emplace("Emplaced", 8U)->second.pValue == 8);
+      E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount()));
+
+      {
+        E::Containers::Map<E::String, MapResource> resourceMapCopy(resourceMap);
+        E_ASSERT(resourceMapCopy.GetCount() == resourceMap.GetCount());
+        E_ASSERT(*resourceMapCopy["Emplaced"].pValue == 8);
+        E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount() * 2));
+
+        E::Containers::Map<E::String, MapResource> resourceMapMoved(std::move(resourceMapCopy));
+        E_ASSERT(resourceMapCopy.IsEmpty() && resourceMapMoved.GetCount() == resourceMap.GetCount());
+        E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount() * 2));
+      }
+      E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount()));
+
+      for (U32 i = 0; i < TEST_SMALL_SIZE * 4; i += 2)
+      {
+        key.Print("Key%u", i);
+        E_ASSERT(resourceMap.RemoveIf(key));
+      }
+      for (U32 i = 1; i < TEST_SMALL_SIZE * 4; i += 2)
+      {
+        key.Print("Key%u", i);
+        E_ASSERT(*resourceMap.FindValue(key)->pValue == i);
+      }
+      E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount()));
+
+      resourceMap.Compact();
+      E_ASSERT(MapResource::sLiveCount == static_cast<I32>(resourceMap.GetCount()));
+      resourceMap.Clear();
+      E_ASSERT(MapResource::sLiveCount == 0);
+      resourceMap.Insert("Last", MapResource(1));
+    }
+    E_ASSERT(MapResource::sLiveCount == 0);
+
     // Map();
     //~Map();
     E::Containers::Map<U32, U32> map;
@@ -353,6 +428,46 @@ bool Test::Map::RunPerformanceTest()
     std::cout << "Find   time [" << findTime << " / " << findTimeStd << "]\t" << (findTimeStd / findTime * 100.0) - 100.0 << "% faster" << std::endl;
     std::cout << "Find V time [" << findTimeValue << " / " << findTimeStd << "]\t" << (findTimeStd / findTimeValue * 100.0) - 100.0 << "% faster" << std::endl;
     std::cout << "Remove time [" << removeTime << " / " << removeTimeStd << "]\t" << (removeTimeStd / removeTime * 100.0) - 100.0 << "% faster" << std::endl;
+
+    // Unordered (hash) map comparison
+    F32 insertTimeHash = 0;
+    F32 findTimeHash = 0;
+    F32 removeTimeHash = 0;
+    for (U32 j = 0; j < iterationCount; ++j)
+    {
+      std::unordered_map<U32, U32> hashMap;
+      for (U32 i = 2; i <= maxOperationCount; i*=2)
+      {
+        hashMap.clear();
+        insertTimeHash += TimeInsert(i, hashMap);
+        findTimeHash += TimeFind(i, hashMap);
+        removeTimeHash += TimeRemove(i, hashMap);
+      }
+    }
+    std::cout << "Insert time [" << insertTime << " / " << insertTimeHash << "]\t" << (insertTimeHash / insertTime * 100.0) - 100.0 << "% faster (unordered_map)" << std::endl;
+    std::cout << "Find V time [" << findTimeValue << " / " << findTimeHash << "]\t" << (findTimeHash / findTimeValue * 100.0) - 100.0 << "% faster (unordered_map)" << std::endl;
+    std::cout << "Remove time [" << removeTime << " / " << removeTimeHash << "]\t" << (removeTimeHash / removeTime * 100.0) - 100.0 << "% faster (unordered_map)" << std::endl;
+
+    // Non-POD (string) keys comparison
+    std::vector<E::String> keys;
+    std::vector<std::string> keysStd;
+    for (U32 i = 0; i < maxOperationCount; ++i)
+    {
+      E::String key;
+      key.Print("Key%u", Math::Global::GetRandom().GetU32(0xffffff));
+      keys.push_back(key);
+      keysStd.push_back(key.GetPtr());
+    }
+    F32 stringTime = 0;
+    F32 stringTimeHash = 0;
+    for (U32 j = 0; j < iterationCount; ++j)
+    {
+      E::Containers::Map<E::String, U32> strMap;
+      std::unordered_map<std::string, U32> strHashMap;
+      stringTime += TimeStringKeys(keys, strMap);
+      stringTimeHash += TimeStringKeys(keysStd, strHashMap);
+    }
+    std::cout << "String time [" << stringTime << " / " << stringTimeHash << "]\t" << (stringTimeHash / stringTime * 100.0) - 100.0 << "% faster (unordered_map)" << std::endl;
     /* 
     Pre-iterator (GetNext method):
 
@@ -517,3 +632,60 @@ F32 TimeRemove(U32 count, std::map<U32, U32>& intMap)
 
   return static_cast<F32>(t.GetElapsed().GetMilliseconds());
 }
+
+F32 TimeFind(U32 count, const std::unordered_map<U32, U32>& intMap)
+{
+  Math::Global::GetRandom().SetSeed(456456);
+  E::Time::Timer t;
+  for (U32 i = 0; i < count; ++i)
+    intMap.find(Math::Global::GetRandom().GetI32(0, gNumber));
+
+  return static_cast<F32>(t.GetElapsed().GetMilliseconds());
+}
+
+F32 TimeInsert(U32 count, std::unordered_map<U32, U32>& intMap)
+{
+  E::Time::Timer t;
+  for (U32 i = 0; i < count; ++i)
+  {
+    intMap.insert(std::make_pair(Math::Global::GetRandom().GetI32(0, gNumber), 0));
+  }
+
+  return static_cast<F32>(t.GetElapsed().GetMilliseconds());
+}
+
+F32 TimeRemove(U32 count, std::unordered_map<U32, U32>& intMap)
+{
+  Math::Global::GetRandom().SetSeed(1012324);
+  E::Time::Timer t;
+  for (U32 i = 0; i < count; ++i)
+  {
+    std::unordered_map<U32, U32>::iterator it = intMap.find(Math::Global::GetRandom().GetI32(0, gNumber));
+    if (it != intMap.end())
+      intMap.erase(it);
+  }
+
+  return static_cast<F32>(t.GetElapsed().GetMilliseconds());
+}
+
+F32 TimeStringKeys(const std::vector<E::String>& keys, E::Containers::Map<E::String, U32>& strMap)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) strMap.Insert(keys[i], static_cast<U32>(i));
+  for (size_t i = 0; i < keys.size(); ++i) strMap.FindPair(keys[i]);
+  for (size_t i = 0; i < keys.size(); ++i) strMap.RemoveIf(keys[i]);
+  E_ASSERT(strMap.IsEmpty());
+
+  return static_cast<F32>(t.GetElapsed().GetMilliseconds());
+}
+
+F32 TimeStringKeys(const std::vector<std::string>& keys, std::unordered_map<std::string, U32>& strMap)
+{
+  E::Time::Timer t;
+  for (size_t i = 0; i < keys.size(); ++i) strMap.insert(std::make_pair(keys[i], static_cast<U32>(i)));
+  for (size_t i = 0; i < keys.size(); ++i) strMap.find(keys[i]);
+  for (size_t i = 0; i < keys.size(); ++i) strMap.erase(keys[i]);
+  E_ASSERT(strMap.empty());
+
+  return static_cast<F32>(t.GetElapsed().GetMilliseconds());
+}
@@ -228,6 +228,23 @@ bool Test::Queue::RunFunctionalityTest()
       queue.Pop();
     }
     E_ASSERT(queue.IsEmpty());
+
+    // Move semantics (wrapping around the circular buffer on growth)
+    E::Containers::Queue<E::StringBuffer> stringQueue(2);
+    E::StringBuffer str("first");
+    stringQueue.Push(std::move(str));
+    stringQueue.Emplace("second");
+    stringQueue.Pop();
+    stringQueue.Emplace("third");
+    stringQueue.Emplace("fourth");
+    E_ASSERT(str.GetPtr() == nullptr && stringQueue.GetCount() == 3 && stringQueue.GetFront() == "second");
+    E::Containers::Queue<E::StringBuffer> movedStringQueue(std::move(stringQueue));
+    E_ASSERT(stringQueue.IsEmpty() && movedStringQueue.GetCount() == 3);
+    movedStringQueue.Pop();
+    E_ASSERT(movedStringQueue.GetFront() == "third");
+    movedStringQueue.Pop();
+    E_ASSERT(movedStringQueue.GetFront() == "fourth");
+    E_ASSERT(queue.IsEmpty());
   }
   catch (...)
   {
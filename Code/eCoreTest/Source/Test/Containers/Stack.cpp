@@ -191,6 +191,18 @@ bool Test::Stack::RunFunctionalityTest()
     E_ASSERT(stack.GetSize() >= TEST_SIZE);
     stack.Resize(10);
     E_ASSERT(stack.GetSize() == 10);
+
+    // Move semantics
+    E::Containers::Stack<E::StringBuffer> stringStack;
+    E::StringBuffer str("first");
+    stringStack.Push(std::move(str));
+    stringStack.Emplace("second");
+    E_ASSERT(str.GetPtr() == nullptr && stringStack.GetCount() == 2 && stringStack.GetTop() == "second");
+    E::Containers::Stack<E::StringBuffer> movedStringStack(std::move(stringStack));
+    E_ASSERT(stringStack.IsEmpty() && movedStringStack.GetTop() == "second");
+    movedStringStack.Pop();
+    E_ASSERT(movedStringStack.GetTop() == "first");
+    E_ASSERT(stack.GetSize() == 10);
   }
   catch (...)
   {
@@ -94,6 +94,17 @@ public:
 
 };
 
+class CountingSubscriber : public  IEventHandler {
+public:
+  CountingSubscriber() : mCount(0) {}
+  void OnEventA(const EventA&) { ++mCount; }
+  U32 GetCount() const { return mCount; }
+  void Reset() { mCount = 0; }
+
+private:
+  U32 mCount;
+};
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -200,5 +211,38 @@ bool Test::Event::RunPerformanceTest()
 {
   std::cout << "[Test::Event::RunPerformanceTest]" << std::endl;
 
+  // Bind, raise & unbind on many callbacks. Binding lists keep up to 4 bindings inline so no allocations are expected
+  // below that (each callback used to allocate on its first Bind and on every binding list growth).
+  const U32 callbackCount = 10000;
+  const U32 raiseCount = 10;
+  const U32 maxBindingCount = 8;
+  CountingSubscriber subscribers[maxBindingCount];
+  for (U32 bindingCount = 1; bindingCount <= maxBindingCount; bindingCount *= 2)
+  {
+    E::Memory::TrackingAllocator trackingAllocator;
+    E::Containers::DynamicArray<EventCallback<EventA> > callbacks(callbackCount);
+    E::Time::Timer t;
+    for (U32 i = 0; i < callbackCount; ++i)
+    {
+      EventCallback<EventA>& callback = callbacks[i];
+      callback.SetAllocator(&trackingAllocator);
+      for (U32 j = 0; j < bindingCount; ++j) callback.Bind<CountingSubscriber, &CountingSubscriber::OnEventA>(&subscribers[j]);
+      for (U32 j = 0; j < raiseCount; ++j) callback.Raise(EventA(static_cast<F32>(j)));
+      for (U32 j = 0; j < bindingCount; ++j) callback.Unbind(&subscribers[j]);
+    }
+    D64 time = t.GetElapsed().GetMilliseconds();
+
+    E::Memory::AllocationSnapshot snapshot;
+    trackingAllocator.GetSnapshot(snapshot);
+    U64 allocationCount = snapshot.GetTotalStats().allocationCount;
+    E_ASSERT(bindingCount > 4 || allocationCount == 0);
+    for (U32 j = 0; j < bindingCount; ++j)
+    {
+      E_ASSERT(subscribers[j].GetCount() == callbackCount * raiseCount);
+      subscribers[j].Reset();
+    }
+    std::cout << callbackCount << " callbacks with " << bindingCount << " bindings: " << allocationCount << " allocations " << time << " ms" << std::endl;
+  }
+
   return true;
 }
@@ -0,0 +1,304 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Archive.cpp
+This file defines Archive test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+typedef Containers::DynamicArray<U8> Buffer;
+
+static const size_t kChunkSize = 1024 * 1024;
+#ifdef E_CPU_X64
+static const size_t kPerformanceFileSize = static_cast<size_t>(2048) * kChunkSize;
+#else
+static const size_t kPerformanceFileSize = 512 * kChunkSize;
+#endif
+
+inline U8 GetByte(size_t index)
+{
+  return static_cast<U8>((index * 31) ^ (index >> 11));
+}
+
+// Word sum, cheap enough not to hide the load throughput
+inline U64 GetChecksum(const U8* pData, size_t size)
+{
+  U64 checksum = 0;
+  size_t i = 0;
+  for (U64 word; i + sizeof(word) <= size; i += sizeof(word))
+  {
+    Memory::Copy(reinterpret_cast<U8*>(&word), pData + i, sizeof(word));
+    checksum += word;
+  }
+  for (; i < size; ++i) checksum += pData[i];
+  return checksum;
+}
+
+inline FilePath GetTestFilePath(const char* pName)
+{
+  FilePath filePath = FileSystem::Directory::GetBase();
+  filePath += "\\";
+  filePath += pName;
+  return filePath;
+}
+
+inline bool WriteTestFile(const FilePath& filePath, size_t size)
+{
+  FileSystem::Archive archive;
+  if (!archive.Open(filePath, FileSystem::Archive::eOpenModeWrite)) return false;
+  Buffer buffer(Math::Min(size, kChunkSize));
+  for (size_t offset = 0; offset < size; offset += buffer.GetSize())
+  {
+    const size_t length = Math::Min(size - offset, buffer.GetSize());
+    for (size_t i = 0; i < length; ++i) buffer[i] = GetByte(offset + i);
+    archive.Write(reinterpret_cast<const char*>(buffer.GetPtr()), length);
+  }
+  return true;
+}
+
+// Opening a file without buffering makes the OS drop its cached pages (best effort), so the next load is cold
+inline void PurgeFileCache(const FilePath& filePath)
+{
+#ifdef WIN32
+  HANDLE fileHandle = ::CreateFileA(filePath.GetPtr(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, 
+                                    OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+  if (fileHandle != INVALID_HANDLE_VALUE) ::CloseHandle(fileHandle);
+#endif
+}
+
+U64 LoadStream(const FilePath& filePath, Buffer& buffer)
+{
+  FileSystem::Archive archive;
+  const bool opened = archive.Open(filePath);
+  E_ASSERT(opened);
+  if (!opened) return 0;
+  U64 checksum = 0;
+  for (size_t offset = 0; offset < archive.GetSize(); offset += buffer.GetSize())
+  {
+    const size_t length = Math::Min(archive.GetSize() - offset, buffer.GetSize());
+    archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), length);
+    checksum += GetChecksum(buffer.GetPtr(), length);
+  }
+  return checksum;
+}
+
+U64 LoadMap(const FilePath& filePath, Buffer& buffer)
+{
+  FileSystem::Archive archive;
+  const bool opened = archive.Open(filePath, FileSystem::Archive::eOpenModeMap, 
+                                  FileSystem::Archive::eAccessPatternSequential);
+  E_ASSERT(opened);
+  if (!opened) return 0;
+  U64 checksum = 0;
+  for (size_t offset = 0; offset < archive.GetSize(); offset += buffer.GetSize())
+  {
+    const size_t length = Math::Min(archive.GetSize() - offset, buffer.GetSize());
+    archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), length);
+    checksum += GetChecksum(buffer.GetPtr(), length);
+  }
+  return checksum;
+}
+
+U64 LoadView(const FilePath& filePath, size_t chunkSize)
+{
+  FileSystem::Archive archive;
+  const bool opened = archive.Open(filePath, FileSystem::Archive::eOpenModeMap, 
+                                  FileSystem::Archive::eAccessPatternSequential);
+  E_ASSERT(opened);
+  if (!opened) return 0;
+  U64 checksum = 0;
+  for (size_t offset = 0; offset < archive.GetSize(); offset += chunkSize)
+  {
+    const size_t length = Math::Min(archive.GetSize() - offset, chunkSize);
+    // Ask for the next chunk while the current one is processed
+    const size_t next = offset + length;
+    if (next < archive.GetSize()) archive.Prefetch(next, Math::Min(archive.GetSize() - next, chunkSize));
+    FileSystem::Archive::View view = archive.ReadView(length);
+    checksum += GetChecksum(view.pData, view.size);
+    archive.Release(offset, length);
+  }
+  return checksum;
+}
+
+template <typename F>
+U64 Benchmark(const char* pName, F load)
+{
+  Time::Timer t;
+  const U64 pageFaultCount = FileSystem::Archive::GetPageFaultCount();
+  t.Reset();
+  const U64 checksum = load();
+  const D64 seconds = t.GetElapsed().GetSeconds();
+  std::cout << pName << ": " << (kPerformanceFileSize / kChunkSize) / seconds << " MB/s (" 
+            << FileSystem::Archive::GetPageFaultCount() - pageFaultCount << " page faults)" << std::endl;
+  return checksum;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Archive::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Archive::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Archive::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Archive::RunFunctionalityTest()
+{
+  std::cout << "[Test::Archive::RunFunctionalityTest]" << std::endl;
+
+  // Not a page size multiple on purpose
+  const size_t size = kChunkSize + 4321;
+  const FilePath filePath = GetTestFilePath("ArchiveTest.bin");
+  E_ASSERT(WriteTestFile(filePath, size));
+
+  // Stream read
+  FileSystem::Archive archive;
+  E_ASSERT(archive.Open(filePath));
+  E_ASSERT(archive.IsOpen() && !archive.IsMapped());
+  E_ASSERT(archive.GetPath() == filePath);
+  E_ASSERT(archive.GetSize() == size);
+  Buffer buffer(size);
+  archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), size);
+  for (size_t i = 0; i < size; ++i) E_ASSERT(buffer[i] == GetByte(i));
+  archive.SetPosition(1000);
+  archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), 16);
+  for (size_t i = 0; i < 16; ++i) E_ASSERT(buffer[i] == GetByte(1000 + i));
+  E_ASSERT(archive.GetPosition() == 1016);
+  archive.Close();
+  E_ASSERT(!archive.IsOpen());
+  E_ASSERT(archive.GetPath().GetLength() == 0);
+
+  // Map read
+  const U64 pageFaultCount = FileSystem::Archive::GetPageFaultCount();
+  E_ASSERT(archive.Open(filePath, FileSystem::Archive::eOpenModeMap, FileSystem::Archive::eAccessPatternRandom));
+  E_ASSERT(archive.IsOpen() && archive.IsMapped());
+  E_ASSERT(archive.GetSize() == size);
+  const U8* pData = archive.GetData();
+  for (size_t i = 0; i < size; ++i) E_ASSERT(pData[i] == GetByte(i));
+  E_ASSERT(FileSystem::Archive::GetPageFaultCount() >= pageFaultCount);
+  E_ASSERT(archive.GetResidentSize(0, size) > 0);
+
+  FileSystem::Archive::View view = archive.GetView(size - 100, 100);
+  E_ASSERT(view.pData == pData + size - 100 && view.size == 100);
+  E_ASSERT(archive.GetView(size, 0).size == 0);
+
+  // Ranges past the file end are clamped
+  E_ASSERT(archive.GetView(size - 10, 100).size == 10 && archive.GetView(size + 1, 1).size == 0);
+  E_ASSERT(archive.GetView(1, static_cast<size_t>(-1)).size == size - 1);
+
+  // Read and ReadView share the mapped position
+  E_ASSERT(archive.GetPosition() == 0);
+  view = archive.ReadView(500);
+  E_ASSERT(view.pData == pData && view.size == 500);
+  archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), 500);
+  for (size_t i = 0; i < 500; ++i) E_ASSERT(buffer[i] == GetByte(500 + i));
+  E_ASSERT(archive.GetPosition() == 1000);
+  archive.SetPosition(size - 1);
+  view = archive.ReadView(1);
+  E_ASSERT(*view.pData == GetByte(size - 1));
+  E_ASSERT(archive.GetPosition() == size);
+  E_ASSERT(archive.ReadView(1).size == 0 && archive.GetPosition() == size);
+  archive.SetPosition(size - 4);
+  archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), 16);
+  for (size_t i = 0; i < 4; ++i) E_ASSERT(buffer[i] == GetByte(size - 4 + i));
+  E_ASSERT(archive.GetPosition() == size);
+  archive.SetPosition(size + 100);
+  E_ASSERT(archive.GetPosition() == size && archive.ReadView(1).size == 0);
+  E_ASSERT(archive.GetResidentSize(size + 1, 1) == 0 && archive.GetResidentSize(0, static_cast<size_t>(-1)) <= size);
+  archive.Prefetch(size - 1, 4096);
+  archive.Release(size - 1, 4096);
+
+  // Hints never change the contents
+  const U64 checksum = GetChecksum(pData, size);
+  archive.Release(0, size);
+  E_ASSERT(archive.GetResidentSize(0, size) <= size);
+  archive.Prefetch(0, size);
+  E_ASSERT(GetChecksum(archive.GetData(), size) == checksum);
+  archive.Close();
+  E_ASSERT(!archive.IsOpen() && !archive.IsMapped());
+  E_ASSERT(!archive.Open(GetTestFilePath("ArchiveTestMissing.bin"), FileSystem::Archive::eOpenModeMap));
+
+  // Empty files are mapped without data
+  E_ASSERT(WriteTestFile(filePath, 0));
+  E_ASSERT(archive.Open(filePath, FileSystem::Archive::eOpenModeMap));
+  E_ASSERT(archive.IsMapped() && archive.GetSize() == 0);
+  E_ASSERT(archive.GetView(0, 0).size == 0);
+  archive.Close();
+
+  E_ASSERT(FileSystem::File::Destroy(filePath));
+
+  return true;
+}
+
+bool Test::Archive::RunPerformanceTest()
+{
+  std::cout << "[Test::Archive::RunPerformanceTest]" << std::endl;
+
+  const FilePath filePath = GetTestFilePath("ArchivePerformanceTest.bin");
+  std::cout << "Writing " << kPerformanceFileSize / kChunkSize << " MB test file" << std::endl;
+  // Results are accumulated (not just asserted) so that release builds still run every call
+  bool result = WriteTestFile(filePath, kPerformanceFileSize);
+
+  Buffer buffer(kChunkSize);
+  U64 checksums[6];
+  PurgeFileCache(filePath);
+  checksums[0] = Benchmark("Cold fstream read", [&]() { return LoadStream(filePath, buffer); });
+  checksums[1] = Benchmark("Warm fstream read", [&]() { return LoadStream(filePath, buffer); });
+  PurgeFileCache(filePath);
+  checksums[2] = Benchmark("Cold mapped read", [&]() { return LoadMap(filePath, buffer); });
+  checksums[3] = Benchmark("Warm mapped read", [&]() { return LoadMap(filePath, buffer); });
+  PurgeFileCache(filePath);
+  checksums[4] = Benchmark("Cold mapped view", [&]() { return LoadView(filePath, kChunkSize); });
+  checksums[5] = Benchmark("Warm mapped view", [&]() { return LoadView(filePath, kChunkSize); });
+  for (size_t i = 1; i < E_ELEMENT_COUNT(checksums); ++i) result &= checksums[i] == checksums[0];
+
+  result &= FileSystem::File::Destroy(filePath);
+
+  E_ASSERT(result);
+  return result;
+}
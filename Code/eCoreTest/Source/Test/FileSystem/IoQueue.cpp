@@ -0,0 +1,350 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file IoQueue.cpp
+This file defines IoQueue test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+typedef Containers::DynamicArray<U8> Buffer;
+typedef FileSystem::IoQueue::Request IoRequest;
+typedef Containers::DynamicArray<IoRequest> IoRequests;
+
+static const size_t kFileCount = 24;
+static const size_t kPerformanceFileCount = 256;
+static const size_t kPerformanceFileSize = 2 * 1024 * 1024;
+
+struct Completion : public Threads::IRunnable
+{
+  I32 Run() { ++runCount; return 0; }
+  A32 runCount;
+};
+
+// Records the completion order
+struct OrderedCompletion : public Threads::IRunnable
+{
+  I32 Run() 
+  { 
+    Threads::Lock l(*pMutex);
+    pOrder->PushBack(id);
+    ++*pCount;
+    return 0; 
+  }
+  Threads::Mutex* pMutex;
+  Containers::List<U32>* pOrder;
+  A32* pCount;
+  U32 id;
+};
+
+inline U8 GetByte(size_t file, size_t index)
+{
+  return static_cast<U8>(file * 131 + index * 7 + (index >> 9));
+}
+
+inline size_t GetFileSize(size_t file)
+{
+  return 64 * 1024 * (file % 7) + 13 * file;
+}
+
+inline FilePath GetTestFilePath(size_t file)
+{
+  FilePath filePath = FileSystem::Directory::GetBase();
+  E::String name;
+  name.Print("\\IoQueueTest%03d.bin", file);
+  filePath += name.GetPtr();
+  return filePath;
+}
+
+inline bool WriteTestFile(size_t file, size_t size)
+{
+  Buffer buffer(size);
+  for (size_t i = 0; i < size; ++i) buffer[i] = GetByte(file, i);
+  FileSystem::Archive archive;
+  if (!archive.Open(GetTestFilePath(file), FileSystem::Archive::eOpenModeWrite)) return false;
+  archive.Write(reinterpret_cast<const char*>(buffer.GetPtr()), size);
+  return true;
+}
+
+// Opening a file without buffering makes the OS drop its cached pages (best effort), so the next load is cold
+inline void PurgeFileCache(const FilePath& filePath)
+{
+#ifdef WIN32
+  HANDLE fileHandle = ::CreateFileA(filePath.GetPtr(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, 
+                                    OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+  if (fileHandle != INVALID_HANDLE_VALUE) ::CloseHandle(fileHandle);
+#endif
+}
+
+inline bool CheckRequest(const IoRequest& request, size_t file, size_t offset, size_t size)
+{
+  if (request.GetStatus() != FileSystem::IoQueue::eStatusCompleted || request.GetReadSize() != size) return false;
+  for (size_t i = 0; i < size; ++i) if (request.pTarget[i] != GetByte(file, offset + i)) return false;
+  return true;
+}
+
+inline bool TestQueue(FileSystem::IoQueue::Backend backend)
+{
+  FileSystem::IoQueue queue(backend);
+  std::cout << "Backend: " << (queue.GetBackend() == FileSystem::IoQueue::eBackendNative ? "native" : "thread pool") 
+            << std::endl;
+  // Calls with side effects are accumulated (not just asserted) so that release builds still run them
+  bool result = true;
+
+  // Batch read (whole files past their end, a partial read and a missing file)
+  size_t maxFileSize = 0;
+  for (size_t i = 0; i < kFileCount; ++i) maxFileSize = Math::Max(maxFileSize, GetFileSize(i) + 100);
+  Buffer buffer((kFileCount + 2) * maxFileSize);
+  Completion completions[kFileCount + 2];
+  IoRequests requests(kFileCount + 2);
+  for (size_t i = 0; i < kFileCount; ++i)
+  {
+    requests[i] = IoRequest(GetTestFilePath(i), buffer.GetPtr() + i * maxFileSize, GetFileSize(i) + 100, 0, 
+                            &completions[i]);
+  }
+  requests[kFileCount] = IoRequest(GetTestFilePath(6), buffer.GetPtr() + kFileCount * maxFileSize, 500, 1000, 
+                                   &completions[kFileCount]);
+  requests[kFileCount + 1] = IoRequest(GetTestFilePath(kFileCount), buffer.GetPtr(), 10, 0, 
+                                       &completions[kFileCount + 1]);
+  queue.Submit(requests.GetPtr(), requests.GetSize());
+  queue.WaitForIdle();
+  E_ASSERT(queue.IsIdle() && queue.GetPendingCount() == 0 && queue.GetInFlightCount() == 0);
+  for (size_t i = 0; i < kFileCount; ++i) E_ASSERT(CheckRequest(requests[i], i, 0, GetFileSize(i)));
+  E_ASSERT(CheckRequest(requests[kFileCount], 6, 1000, 500));
+  E_ASSERT(requests[kFileCount + 1].GetStatus() == FileSystem::IoQueue::eStatusFailed);
+  Threads::Global::GetThreadPool().WaitForIdle();
+  for (size_t i = 0; i < E_ELEMENT_COUNT(completions); ++i) E_ASSERT(completions[i].runCount.Get() == 1);
+
+  // Requests can be submitted again once done
+  queue.Submit(requests[1], FileSystem::IoQueue::ePriorityHigh);
+  queue.Wait(requests[1]);
+  E_ASSERT(CheckRequest(requests[1], 1, 0, GetFileSize(1)));
+  result &= !queue.Cancel(requests[1]);
+  queue.WaitForIdle();
+  Threads::Global::GetThreadPool().WaitForIdle();
+
+  // Priorities: with a single read in flight at most one of the low priority requests not done on the high priority 
+  // ones submission completes before them
+  Threads::Mutex orderMutex;
+  Containers::List<U32> order;
+  A32 orderCount;
+  OrderedCompletion orderedCompletions[kFileCount];
+  queue.SetThreadPool(nullptr);
+  queue.SetMaxInFlightCount(1);
+  for (size_t i = 0; i < kFileCount; ++i)
+  {
+    orderedCompletions[i].pMutex = &orderMutex;
+    orderedCompletions[i].pOrder = &order;
+    orderedCompletions[i].pCount = &orderCount;
+    orderedCompletions[i].id = static_cast<U32>(i);
+    requests[i].pCompletion = &orderedCompletions[i];
+  }
+  const size_t halfCount = kFileCount / 2;
+  queue.Submit(requests.GetPtr(), halfCount, FileSystem::IoQueue::ePriorityLow);
+  queue.Submit(requests.GetPtr() + halfCount, halfCount, FileSystem::IoQueue::ePriorityHigh);
+  const size_t doneCount = orderCount.Get();
+  queue.WaitForIdle();
+  E_ASSERT(order.GetCount() == kFileCount);
+  size_t lowCount = 0;
+  size_t highCount = 0;
+  for (auto it = begin(order); it != end(order) && highCount < halfCount; ++it)
+  {
+    if (*it < halfCount) ++lowCount;
+    else ++highCount;
+  }
+  E_ASSERT(lowCount <= doneCount + 1);
+
+  // Cancellation
+  for (size_t i = 0; i < kFileCount; ++i) requests[i].pCompletion = &completions[i];
+  for (size_t i = 0; i < kFileCount; ++i) completions[i].runCount = 0;
+  queue.Submit(requests.GetPtr(), kFileCount);
+  for (size_t i = halfCount; i < kFileCount; ++i) result &= queue.Cancel(requests[i]) || requests[i].IsDone();
+  queue.WaitForIdle();
+  size_t cancelledCount = 0;
+  for (size_t i = 0; i < kFileCount; ++i)
+  {
+    E_ASSERT(completions[i].runCount.Get() == 1);
+    if (requests[i].GetStatus() == FileSystem::IoQueue::eStatusCancelled) ++cancelledCount;
+    else E_ASSERT(CheckRequest(requests[i], i, 0, GetFileSize(i)));
+  }
+  std::cout << "Cancelled " << cancelledCount << " of " << halfCount << " requests" << std::endl;
+
+  // Destruction cancels pending requests
+  {
+    FileSystem::IoQueue otherQueue(backend);
+    otherQueue.SetThreadPool(nullptr);
+    otherQueue.Submit(requests.GetPtr(), kFileCount);
+  }
+  for (size_t i = 0; i < kFileCount; ++i) E_ASSERT(requests[i].IsDone());
+
+  E_ASSERT(result);
+  return result;
+}
+
+struct LoadResult
+{
+  D64 seconds;
+  U64 tickCount;
+};
+
+// Fake main loop work between two polls
+inline U32 Tick(U32 x)
+{
+  for (U32 i = 0; i < 1000; ++i) x = x * 1664525 + 1013904223;
+  return x;
+}
+
+inline LoadResult LoadSync(Buffer& buffer)
+{
+  LoadResult result = { 0, 0 };
+  Time::Timer t;
+  for (size_t i = 0; i < kPerformanceFileCount; ++i)
+  {
+    FileSystem::Archive archive;
+    const bool opened = archive.Open(GetTestFilePath(i));
+    E_ASSERT(opened);
+    if (opened) archive.Read(reinterpret_cast<char*>(buffer.GetPtr() + i * kPerformanceFileSize), kPerformanceFileSize);
+  }
+  result.seconds = t.GetElapsed().GetSeconds();
+  return result;
+}
+
+inline LoadResult LoadAsync(Buffer& buffer, FileSystem::IoQueue::Backend backend, U32 maxInFlightCount)
+{
+  FileSystem::IoQueue queue(backend);
+  queue.SetMaxInFlightCount(maxInFlightCount);
+  IoRequests requests(kPerformanceFileCount);
+  for (size_t i = 0; i < kPerformanceFileCount; ++i)
+  {
+    requests[i] = IoRequest(GetTestFilePath(i), buffer.GetPtr() + i * kPerformanceFileSize, kPerformanceFileSize);
+  }
+
+  LoadResult result = { 0, 0 };
+  U32 x = 1;
+  Time::Timer t;
+  queue.Submit(requests.GetPtr(), requests.GetSize());
+  // The main loop keeps ticking while the files load
+  while (!queue.IsIdle())
+  {
+    x = Tick(x);
+    ++result.tickCount;
+  }
+  result.seconds = t.GetElapsed().GetSeconds();
+  if (x == 0) std::cout << std::endl; // Keeps the ticks from being optimized away
+  for (size_t i = 0; i < kPerformanceFileCount; ++i) E_ASSERT(requests[i].GetReadSize() == kPerformanceFileSize);
+  return result;
+}
+
+inline void PrintLoadResult(const char* pName, const LoadResult& result)
+{
+  const D64 megaBytes = static_cast<D64>(kPerformanceFileCount * kPerformanceFileSize) / (1024 * 1024);
+  std::cout << pName << ": " << megaBytes / result.seconds << " MB/s, " << result.tickCount << " main loop ticks" 
+            << std::endl;
+}
+
+inline void PurgeFileCaches()
+{
+  for (size_t i = 0; i < kPerformanceFileCount; ++i) PurgeFileCache(GetTestFilePath(i));
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::IoQueue::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::IoQueue::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::IoQueue::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::IoQueue::RunFunctionalityTest()
+{
+  std::cout << "[Test::IoQueue::RunFunctionalityTest]" << std::endl;
+
+  // Results are accumulated (not just asserted) so that release builds still run every call
+  bool result = true;
+  for (size_t i = 0; i < kFileCount; ++i) result &= WriteTestFile(i, GetFileSize(i));
+  result &= TestQueue(FileSystem::IoQueue::eBackendNative);
+  result &= TestQueue(FileSystem::IoQueue::eBackendThreadPool);
+  Threads::Global::GetThreadPool().WaitForIdle();
+  for (size_t i = 0; i < kFileCount; ++i) result &= FileSystem::File::Destroy(GetTestFilePath(i));
+
+  E_ASSERT(result);
+  return result;
+}
+
+bool Test::IoQueue::RunPerformanceTest()
+{
+  std::cout << "[Test::IoQueue::RunPerformanceTest]" << std::endl;
+
+  std::cout << "Writing " << kPerformanceFileCount << " files of " << kPerformanceFileSize / 1024 << " KB" << std::endl;
+  // Results are accumulated (not just asserted) so that release builds still run every call
+  bool result = true;
+  for (size_t i = 0; i < kPerformanceFileCount; ++i) result &= WriteTestFile(i, kPerformanceFileSize);
+  Buffer buffer(kPerformanceFileCount * kPerformanceFileSize);
+
+  PurgeFileCaches();
+  PrintLoadResult("Cold synchronous", LoadSync(buffer));
+  PurgeFileCaches();
+  PrintLoadResult("Cold native (1 in flight)", LoadAsync(buffer, FileSystem::IoQueue::eBackendNative, 1));
+  PurgeFileCaches();
+  PrintLoadResult("Cold native (32 in flight)", LoadAsync(buffer, FileSystem::IoQueue::eBackendNative, 32));
+  PurgeFileCaches();
+  PrintLoadResult("Cold thread pool (32 in flight)", LoadAsync(buffer, FileSystem::IoQueue::eBackendThreadPool, 32));
+  PrintLoadResult("Warm synchronous", LoadSync(buffer));
+  PrintLoadResult("Warm native (32 in flight)", LoadAsync(buffer, FileSystem::IoQueue::eBackendNative, 32));
+  PrintLoadResult("Warm thread pool (32 in flight)", LoadAsync(buffer, FileSystem::IoQueue::eBackendThreadPool, 32));
+  for (size_t i = 0; i < kPerformanceFileCount; ++i)
+  {
+    const U8* pData = buffer.GetPtr() + i * kPerformanceFileSize;
+    for (size_t j = 0; j < kPerformanceFileSize; j += 4093) E_ASSERT(pData[j] == GetByte(i, j));
+  }
+
+  for (size_t i = 0; i < kPerformanceFileCount; ++i) result &= FileSystem::File::Destroy(GetTestFilePath(i));
+
+  E_ASSERT(result);
+  return result;
+}
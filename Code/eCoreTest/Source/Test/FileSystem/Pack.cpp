@@ -0,0 +1,356 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Pack.cpp
+This file defines Pack test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+typedef Containers::DynamicArray<U8> Buffer;
+
+static const size_t kPackEntryCount = 40;
+static const size_t kPackDirectoryCount = 50;
+static const size_t kPackDirectoryFileCount = 1000; // 50K files in the performance test
+
+inline U8 GetPackByte(size_t entry, size_t index)
+{
+  return static_cast<U8>(entry * 37 + index * 11 + (index >> 8));
+}
+
+inline size_t GetPackEntrySize(size_t entry)
+{
+  return entry % 5 == 0 ? 0 : 97 * entry + (entry % 3) * FileSystem::Pack::kAlignment;
+}
+
+inline FilePath GetPackEntryPath(size_t entry)
+{
+  E::String name;
+  name.Print("Dir%02d/Entry%04d.bin", entry % 4, entry);
+  return name.GetPtr();
+}
+
+inline FilePath GetPackTestPath(const char* pName)
+{
+  FilePath filePath = FileSystem::Directory::GetBase();
+  filePath += "\\";
+  filePath += pName;
+  return filePath;
+}
+
+inline void FillPackEntry(Buffer& buffer, size_t entry, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) buffer[i] = GetPackByte(entry, i);
+}
+
+inline bool CheckPackEntry(const FileSystem::Pack& pack, const FileSystem::Pack::Entry* pEntry, size_t entry, 
+                           size_t size)
+{
+  if (!pEntry || pEntry->storedSize != size || pEntry->offset % FileSystem::Pack::kAlignment != 0) return false;
+  FileSystem::Archive::View view = pack.GetView(*pEntry);
+  if (view.size != size) return false;
+  for (size_t i = 0; i < size; ++i) if (view.pData[i] != GetPackByte(entry, i)) return false;
+  return true;
+}
+
+inline FilePath GetLooseFilePath(size_t directory, size_t file)
+{
+  E::String name;
+  name.Print("PackTest\\Dir%02d\\File%04d.bin", directory, file);
+  return GetPackTestPath(name.GetPtr());
+}
+
+inline size_t GetLooseFileSize(size_t file)
+{
+  return 256 + (file * 389) % 3840;
+}
+
+// Sum of all the bytes, enough to check the loads and keep them from being optimized away
+inline U64 GetPackChecksum(const U8* pData, size_t size)
+{
+  U64 checksum = 0;
+  for (size_t i = 0; i < size; ++i) checksum += pData[i];
+  return checksum;
+}
+
+inline U64 LoadLooseFiles(Buffer& buffer)
+{
+  U64 checksum = 0;
+  for (size_t i = 0; i < kPackDirectoryCount; ++i)
+  {
+    for (size_t j = 0; j < kPackDirectoryFileCount; ++j)
+    {
+      FileSystem::Archive archive;
+      const bool opened = archive.Open(GetLooseFilePath(i, j));
+      E_ASSERT(opened);
+      if (!opened) continue;
+      archive.Read(reinterpret_cast<char*>(buffer.GetPtr()), archive.GetSize());
+      checksum += GetPackChecksum(buffer.GetPtr(), archive.GetSize());
+    }
+  }
+  return checksum;
+}
+
+inline U64 LoadPackEntries(const FilePath& packPath)
+{
+  FileSystem::Pack pack;
+  const bool opened = pack.Open(packPath);
+  E_ASSERT(opened);
+  if (!opened) return 0;
+  U64 checksum = 0;
+  E::String name;
+  for (size_t i = 0; i < kPackDirectoryCount; ++i)
+  {
+    for (size_t j = 0; j < kPackDirectoryFileCount; ++j)
+    {
+      name.Print("Dir%02d\\File%04d.bin", i, j);
+      const FileSystem::Pack::Entry* pEntry = pack.Find(name.GetPtr());
+      E_ASSERT(pEntry);
+      if (pEntry == nullptr) continue;
+      FileSystem::Archive::View view = pack.GetView(*pEntry);
+      checksum += GetPackChecksum(view.pData, view.size);
+    }
+  }
+  return checksum;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Pack::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Pack::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Pack::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Pack::RunFunctionalityTest()
+{
+  std::cout << "[Test::Pack::RunFunctionalityTest]" << std::endl;
+
+  const FilePath packPath = GetPackTestPath("PackTest.pak");
+  const FilePath filePath = GetPackTestPath("PackTestFile.bin");
+  size_t maxEntrySize = 0;
+  for (size_t i = 0; i < kPackEntryCount; ++i) maxEntrySize = Math::Max(maxEntrySize, GetPackEntrySize(i));
+  Buffer buffer(maxEntrySize + 1);
+
+  // Write (entries of all sizes, a file, compressed data and duplicates)
+  {
+    FileSystem::Archive archive;
+    E_ASSERT(archive.Open(filePath, FileSystem::Archive::eOpenModeWrite));
+    FillPackEntry(buffer, kPackEntryCount, maxEntrySize);
+    archive.Write(reinterpret_cast<const char*>(buffer.GetPtr()), maxEntrySize);
+  }
+  FileSystem::PackWriter writer;
+  E_ASSERT(writer.Open(packPath));
+  for (size_t i = 0; i < kPackEntryCount; ++i)
+  {
+    FillPackEntry(buffer, i, GetPackEntrySize(i));
+    E_ASSERT(writer.Add(GetPackEntryPath(i), buffer.GetPtr(), GetPackEntrySize(i)));
+  }
+  E_ASSERT(writer.AddFile("File.bin", filePath));
+  FillPackEntry(buffer, kPackEntryCount + 1, 1000);
+  E_ASSERT(writer.AddCompressed("Compressed.bin", buffer.GetPtr(), 1000, 4000, 
+                                FileSystem::Pack::eEntryFlagUser * 3));
+  E_ASSERT(!writer.Add(GetPackEntryPath(3), buffer.GetPtr(), 10));
+  E_ASSERT(!writer.Add("\\Dir03\\Entry0003.bin", buffer.GetPtr(), 10));
+  E_ASSERT(!writer.AddFile("Missing.bin", GetPackTestPath("PackTestMissing.bin")));
+  E_ASSERT(writer.GetEntryCount() == kPackEntryCount + 2);
+  E_ASSERT(writer.Close());
+  E_ASSERT(!writer.IsOpen());
+
+  // Read
+  FileSystem::Pack pack;
+  E_ASSERT(pack.Open(packPath));
+  E_ASSERT(pack.GetEntryCount() == kPackEntryCount + 2);
+  for (size_t i = 0; i < kPackEntryCount; ++i)
+  {
+    const FileSystem::Pack::Entry* pEntry = pack.Find(GetPackEntryPath(i));
+    E_ASSERT(CheckPackEntry(pack, pEntry, i, GetPackEntrySize(i)));
+    E_ASSERT(!pEntry->IsCompressed() && pEntry->size == pEntry->storedSize);
+    E_ASSERT(GetPackEntryPath(i) == pack.GetName(*pEntry));
+  }
+  E_ASSERT(CheckPackEntry(pack, pack.Find("File.bin"), kPackEntryCount, maxEntrySize));
+  const FileSystem::Pack::Entry* pCompressedEntry = pack.Find("Compressed.bin");
+  E_ASSERT(CheckPackEntry(pack, pCompressedEntry, kPackEntryCount + 1, 1000));
+  E_ASSERT(pCompressedEntry->IsCompressed() && pCompressedEntry->size == 4000);
+  E_ASSERT(pCompressedEntry->flags / FileSystem::Pack::eEntryFlagUser == 3);
+  // Windows style paths and missing entries
+  E_ASSERT(pack.Find("\\Dir01\\Entry0001.bin") == pack.Find(GetPackEntryPath(1)));
+  E_ASSERT(!pack.Find("Dir01/entry0001.bin"));
+  E_ASSERT(!pack.Find("Dir01"));
+  E_ASSERT(!pack.Find("Missing.bin"));
+  size_t entryCount = 0;
+  for (size_t i = 0; i < pack.GetEntryCount(); ++i)
+  {
+    if (pack.Find(pack.GetName(pack.GetEntry(i))) == &pack.GetEntry(i)) ++entryCount;
+  }
+  E_ASSERT(entryCount == pack.GetEntryCount());
+  pack.Close();
+  E_ASSERT(!pack.IsOpen() && pack.GetEntryCount() == 0);
+
+  // Packing a directory tree
+  E_ASSERT(FileSystem::Directory::Create(GetPackTestPath("PackTestTree")));
+  E_ASSERT(FileSystem::Directory::Create(GetPackTestPath("PackTestTree\\Dir00")));
+  E_ASSERT(FileSystem::Directory::Create(GetPackTestPath("PackTestTree\\Dir01")));
+  for (size_t i = 0; i < 8; ++i)
+  {
+    E::String name;
+    name.Print("PackTestTree\\Dir%02d\\Entry%04d.bin", i % 2, i);
+    FileSystem::Archive archive;
+    E_ASSERT(archive.Open(GetPackTestPath(name.GetPtr()), FileSystem::Archive::eOpenModeWrite));
+    FillPackEntry(buffer, i, GetPackEntrySize(i));
+    archive.Write(reinterpret_cast<const char*>(buffer.GetPtr()), GetPackEntrySize(i));
+  }
+  E_ASSERT(writer.Open(packPath));
+  E_ASSERT(writer.AddDirectory(GetPackTestPath("PackTestTree")));
+  E_ASSERT(writer.Close());
+  E_ASSERT(pack.Open(packPath));
+  E_ASSERT(pack.GetEntryCount() == 8);
+  for (size_t i = 0; i < 8; ++i)
+  {
+    E::String name;
+    name.Print("Dir%02d/Entry%04d.bin", i % 2, i);
+    E_ASSERT(CheckPackEntry(pack, pack.Find(name.GetPtr()), i, GetPackEntrySize(i)));
+    name.Print("PackTestTree\\Dir%02d\\Entry%04d.bin", i % 2, i);
+    E_ASSERT(FileSystem::File::Destroy(GetPackTestPath(name.GetPtr())));
+  }
+  pack.Close();
+  E_ASSERT(FileSystem::Directory::Destroy(GetPackTestPath("PackTestTree\\Dir00")));
+  E_ASSERT(FileSystem::Directory::Destroy(GetPackTestPath("PackTestTree\\Dir01")));
+  E_ASSERT(FileSystem::Directory::Destroy(GetPackTestPath("PackTestTree")));
+
+  // Empty pack and invalid packs
+  E_ASSERT(writer.Open(packPath));
+  E_ASSERT(writer.Close());
+  E_ASSERT(pack.Open(packPath));
+  E_ASSERT(pack.GetEntryCount() == 0 && !pack.Find("File.bin"));
+  pack.Close();
+  E_ASSERT(!pack.Open(filePath));
+  E_ASSERT(!pack.IsOpen());
+  E_ASSERT(!pack.Open(GetPackTestPath("PackTestMissing.bin")));
+  E_ASSERT(writer.Open(packPath));
+  E_ASSERT(writer.Add("File.bin", buffer.GetPtr(), 10));
+  writer.Close();
+  {
+    // Truncated table of contents
+    FileSystem::Archive archive;
+    E_ASSERT(archive.Open(packPath));
+    Buffer packData(archive.GetSize());
+    archive.Read(reinterpret_cast<char*>(packData.GetPtr()), packData.GetSize());
+    archive.Close();
+    E_ASSERT(archive.Open(packPath, FileSystem::Archive::eOpenModeWrite));
+    archive.Write(reinterpret_cast<const char*>(packData.GetPtr()), packData.GetSize() - 1);
+  }
+  E_ASSERT(!pack.Open(packPath));
+
+  E_ASSERT(FileSystem::File::Destroy(packPath));
+  E_ASSERT(FileSystem::File::Destroy(filePath));
+
+  return true;
+}
+
+bool Test::Pack::RunPerformanceTest()
+{
+  std::cout << "[Test::Pack::RunPerformanceTest]" << std::endl;
+
+  // Results are accumulated (not just asserted) so that release builds still run every call
+  bool result = true;
+
+  const size_t fileCount = kPackDirectoryCount * kPackDirectoryFileCount;
+  std::cout << "Writing " << fileCount << " loose files" << std::endl;
+  Buffer buffer(4096);
+  result &= FileSystem::Directory::Create(GetPackTestPath("PackTest"));
+  for (size_t i = 0; i < kPackDirectoryCount; ++i)
+  {
+    E::String name;
+    name.Print("PackTest\\Dir%02d", i);
+    result &= FileSystem::Directory::Create(GetPackTestPath(name.GetPtr()));
+    for (size_t j = 0; j < kPackDirectoryFileCount; ++j)
+    {
+      FileSystem::Archive archive;
+      result &= archive.Open(GetLooseFilePath(i, j), FileSystem::Archive::eOpenModeWrite);
+      FillPackEntry(buffer, j, GetLooseFileSize(j));
+      archive.Write(reinterpret_cast<const char*>(buffer.GetPtr()), GetLooseFileSize(j));
+    }
+  }
+
+  E::Time::Timer t;
+  const FilePath packPath = GetPackTestPath("PackTest.pak");
+  FileSystem::PackWriter writer;
+  result &= writer.Open(packPath);
+  result &= writer.AddDirectory(GetPackTestPath("PackTest"));
+  result &= writer.GetEntryCount() == fileCount;
+  result &= writer.Close();
+  std::cout << "Packing: " << t.GetElapsed().GetSeconds() << " s" << std::endl;
+
+  // Warm loads: both runs measure the per entry open cost, not the disk
+  const U64 checksum = LoadLooseFiles(buffer);
+  const U64 warmPackChecksum = LoadPackEntries(packPath);
+  t.Reset();
+  const U64 looseChecksum = LoadLooseFiles(buffer);
+  const D64 looseSeconds = t.GetElapsed().GetSeconds();
+  t.Reset();
+  const U64 packChecksum = LoadPackEntries(packPath);
+  const D64 packSeconds = t.GetElapsed().GetSeconds();
+  result &= warmPackChecksum == checksum && looseChecksum == checksum && packChecksum == checksum;
+  std::cout << "Loose files: " << fileCount / looseSeconds << " entries/s" << std::endl;
+  std::cout << "Pack: " << fileCount / packSeconds << " entries/s (x" << looseSeconds / packSeconds << ")" 
+            << std::endl;
+
+  for (size_t i = 0; i < kPackDirectoryCount; ++i)
+  {
+    for (size_t j = 0; j < kPackDirectoryFileCount; ++j) result &= FileSystem::File::Destroy(GetLooseFilePath(i, j));
+    E::String name;
+    name.Print("PackTest\\Dir%02d", i);
+    result &= FileSystem::Directory::Destroy(GetPackTestPath(name.GetPtr()));
+  }
+  result &= FileSystem::Directory::Destroy(GetPackTestPath("PackTest"));
+  result &= FileSystem::File::Destroy(packPath);
+
+  E_ASSERT(result);
+  return result;
+}
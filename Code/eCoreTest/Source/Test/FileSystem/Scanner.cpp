@@ -0,0 +1,286 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Scanner.cpp
+This file defines Scanner test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+static const size_t kScannerDirectoryCount = 20;
+static const size_t kScannerSubdirectoryCount = 10;
+static const size_t kScannerFileCount = 50;       // 10K files in the performance test
+
+inline FilePath GetScannerTestPath(const char* pName)
+{
+  FilePath filePath = FileSystem::Directory::GetBase();
+  filePath += "\\";
+  filePath += pName;
+  return filePath;
+}
+
+inline void CreateScannerFile(const FilePath& filePath, size_t size)
+{
+  FileSystem::Archive archive;
+  const bool opened = archive.Open(filePath, FileSystem::Archive::eOpenModeWrite);
+  E_ASSERT(opened);
+  if (!opened) return;
+  for (size_t i = 0; i < size; ++i) archive.Write("s", 1);
+}
+
+inline const FileSystem::Scanner::Item* FindScannerItem(const FileSystem::Scanner::ItemList& itemList, 
+                                                        const FilePath& path)
+{
+  for (auto it = begin(itemList); it != end(itemList); ++it) if ((*it).path == path) return &(*it);
+  return nullptr;
+}
+
+// Walks a tree the way Scanner replaces: a listing per directory plus an info query per child
+inline size_t ScanByQuery(const FilePath& path)
+{
+  FilePathList pathList;
+  if (!FileSystem::Directory::GetChildren(path, pathList)) return 0;
+  size_t count = pathList.GetCount();
+  for (auto it = begin(pathList); it != end(pathList); ++it)
+  {
+    FileInfo info;
+    const bool queried = FileSystem::File::GetInfo(*it, info);
+    E_ASSERT(queried);
+    if (queried && (info.flags & FileFlags::eFlagDirectory)) count += ScanByQuery(*it);
+  }
+  return count;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Scanner::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Scanner::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Scanner::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Scanner::RunFunctionalityTest()
+{
+  std::cout << "[Test::Scanner::RunFunctionalityTest]" << std::endl;
+
+  // ScannerTest: A.bin, Dir0 (B.bin, Sub (C.bin, D.bin)), Dir1 (empty)
+  const FilePath rootPath = GetScannerTestPath("ScannerTest");
+  const FilePath cachePath = GetScannerTestPath("ScannerTest.cache");
+  E_ASSERT(FileSystem::Directory::Create(rootPath));
+  E_ASSERT(FileSystem::Directory::Create(GetScannerTestPath("ScannerTest\\Dir0")));
+  E_ASSERT(FileSystem::Directory::Create(GetScannerTestPath("ScannerTest\\Dir0\\Sub")));
+  E_ASSERT(FileSystem::Directory::Create(GetScannerTestPath("ScannerTest\\Dir1")));
+  CreateScannerFile(GetScannerTestPath("ScannerTest\\A.bin"), 10);
+  CreateScannerFile(GetScannerTestPath("ScannerTest\\Dir0\\B.bin"), 20);
+  CreateScannerFile(GetScannerTestPath("ScannerTest\\Dir0\\Sub\\C.bin"), 30);
+  CreateScannerFile(GetScannerTestPath("ScannerTest\\Dir0\\Sub\\D.bin"), 0);
+
+  // Parallel and calling thread only scans
+  FileSystem::Scanner scanner;
+  FileSystem::Scanner::ItemList itemList;
+  for (U32 i = 0; i < 2; ++i)
+  {
+    scanner.ClearCache();
+    scanner.SetThreadPool(i == 0 ? &Threads::Global::GetThreadPool() : nullptr);
+    E_ASSERT(scanner.Scan(rootPath, itemList));
+    E_ASSERT(itemList.GetCount() == 7);
+    E_ASSERT(scanner.GetScannedDirectoryCount() == 4 && scanner.GetReusedDirectoryCount() == 0);
+    E_ASSERT(scanner.GetCachedDirectoryCount() == 4);
+    const FileSystem::Scanner::Item* pItem = FindScannerItem(itemList, GetScannerTestPath("ScannerTest\\Dir0\\Sub\\C.bin"));
+    E_ASSERT(pItem && pItem->info.byteSize == 30 && (pItem->info.flags & FileFlags::eFlagFile));
+    pItem = FindScannerItem(itemList, GetScannerTestPath("ScannerTest\\Dir1"));
+    E_ASSERT(pItem && (pItem->info.flags & FileFlags::eFlagDirectory));
+    E_ASSERT(!FindScannerItem(itemList, rootPath));
+  }
+  scanner.SetThreadPool(&Threads::Global::GetThreadPool());
+
+  // File flags
+  E_ASSERT(scanner.Scan(rootPath, itemList, FileFlags::eFlagFile));
+  E_ASSERT(itemList.GetCount() == 4);
+  E_ASSERT(scanner.Scan(rootPath, itemList, FileFlags::eFlagDirectory));
+  E_ASSERT(itemList.GetCount() == 3);
+  E_ASSERT(scanner.GetCachedDirectoryCount() == 4);
+
+  // Unchanged directories reuse their cached listing, changed ones are enumerated again
+  E_ASSERT(scanner.Scan(rootPath, itemList));
+  E_ASSERT(scanner.GetReusedDirectoryCount() == 4 && scanner.GetScannedDirectoryCount() == 0);
+  E_ASSERT(itemList.GetCount() == 7);
+  Threads::Thread::Sleep(TimeValue::kOneMillisecond * 20);
+  CreateScannerFile(GetScannerTestPath("ScannerTest\\Dir0\\Sub\\E.bin"), 40);
+  E_ASSERT(scanner.Scan(rootPath, itemList));
+  E_ASSERT(scanner.GetReusedDirectoryCount() == 3 && scanner.GetScannedDirectoryCount() == 1);
+  E_ASSERT(itemList.GetCount() == 8);
+  const FileSystem::Scanner::Item* pItem = FindScannerItem(itemList, GetScannerTestPath("ScannerTest\\Dir0\\Sub\\E.bin"));
+  E_ASSERT(pItem && pItem->info.byteSize == 40);
+
+  // Cache file
+  E_ASSERT(scanner.SaveCache(cachePath));
+  {
+    FileSystem::Scanner loadedScanner;
+    E_ASSERT(loadedScanner.LoadCache(cachePath));
+    E_ASSERT(loadedScanner.GetCachedDirectoryCount() == 4);
+    E_ASSERT(loadedScanner.Scan(rootPath, itemList));
+    E_ASSERT(loadedScanner.GetReusedDirectoryCount() == 4 && loadedScanner.GetScannedDirectoryCount() == 0);
+    E_ASSERT(itemList.GetCount() == 8);
+    pItem = FindScannerItem(itemList, GetScannerTestPath("ScannerTest\\Dir0\\Sub\\E.bin"));
+    E_ASSERT(pItem && pItem->info.byteSize == 40);
+  }
+  {
+    // Truncated cache
+    FileSystem::Archive archive;
+    E_ASSERT(archive.Open(cachePath));
+    Containers::DynamicArray<U8> cacheData(archive.GetSize());
+    archive.Read(reinterpret_cast<char*>(cacheData.GetPtr()), cacheData.GetSize());
+    archive.Close();
+    E_ASSERT(archive.Open(cachePath, FileSystem::Archive::eOpenModeWrite));
+    archive.Write(reinterpret_cast<const char*>(cacheData.GetPtr()), cacheData.GetSize() - 1);
+  }
+  E_ASSERT(!scanner.LoadCache(cachePath));
+  E_ASSERT(scanner.GetCachedDirectoryCount() == 4);
+  E_ASSERT(!scanner.LoadCache(GetScannerTestPath("ScannerTest\\A.bin")));
+  E_ASSERT(!scanner.LoadCache(GetScannerTestPath("ScannerTestMissing.cache")));
+  scanner.ClearCache();
+  E_ASSERT(scanner.GetCachedDirectoryCount() == 0);
+
+  // Invalid roots
+  E_ASSERT(!scanner.Scan(GetScannerTestPath("ScannerTestMissing"), itemList));
+  E_ASSERT(!scanner.Scan(GetScannerTestPath("ScannerTest\\A.bin"), itemList));
+  E_ASSERT(itemList.IsEmpty());
+
+  E_ASSERT(FileSystem::File::Destroy(GetScannerTestPath("ScannerTest\\Dir0\\Sub\\E.bin")));
+  E_ASSERT(FileSystem::File::Destroy(GetScannerTestPath("ScannerTest\\Dir0\\Sub\\D.bin")));
+  E_ASSERT(FileSystem::File::Destroy(GetScannerTestPath("ScannerTest\\Dir0\\Sub\\C.bin")));
+  E_ASSERT(FileSystem::File::Destroy(GetScannerTestPath("ScannerTest\\Dir0\\B.bin")));
+  E_ASSERT(FileSystem::File::Destroy(GetScannerTestPath("ScannerTest\\A.bin")));
+  E_ASSERT(FileSystem::Directory::Destroy(GetScannerTestPath("ScannerTest\\Dir0\\Sub")));
+  E_ASSERT(FileSystem::Directory::Destroy(GetScannerTestPath("ScannerTest\\Dir0")));
+  E_ASSERT(FileSystem::Directory::Destroy(GetScannerTestPath("ScannerTest\\Dir1")));
+  E_ASSERT(FileSystem::Directory::Destroy(rootPath));
+  E_ASSERT(FileSystem::File::Destroy(cachePath));
+
+  return true;
+}
+
+bool Test::Scanner::RunPerformanceTest()
+{
+  std::cout << "[Test::Scanner::RunPerformanceTest]" << std::endl;
+
+  // Results are accumulated (not just asserted) so that release builds still run every call
+  bool result = true;
+
+  // ScannerPerf\DirXX\SubYY\FileZZZZ.bin
+  const size_t itemCount = kScannerDirectoryCount * (1 + kScannerSubdirectoryCount * (1 + kScannerFileCount));
+  std::cout << "Writing " << itemCount << " files and directories" << std::endl;
+  const FilePath rootPath = GetScannerTestPath("ScannerPerf");
+  result &= FileSystem::Directory::Create(rootPath);
+  E::String name;
+  for (size_t i = 0; i < kScannerDirectoryCount; ++i)
+  {
+    name.Print("ScannerPerf\\Dir%02d", i);
+    result &= FileSystem::Directory::Create(GetScannerTestPath(name.GetPtr()));
+    for (size_t j = 0; j < kScannerSubdirectoryCount; ++j)
+    {
+      name.Print("ScannerPerf\\Dir%02d\\Sub%02d", i, j);
+      result &= FileSystem::Directory::Create(GetScannerTestPath(name.GetPtr()));
+      for (size_t k = 0; k < kScannerFileCount; ++k)
+      {
+        name.Print("ScannerPerf\\Dir%02d\\Sub%02d\\File%04d.bin", i, j, k);
+        CreateScannerFile(GetScannerTestPath(name.GetPtr()), k);
+      }
+    }
+  }
+
+  // Warm runs: all of them measure the file system calls, not the disk
+  const size_t warmQueryCount = ScanByQuery(rootPath);
+  E::Time::Timer t;
+  const size_t queryCount = ScanByQuery(rootPath);
+  const D64 querySeconds = t.GetElapsed().GetSeconds();
+  result &= warmQueryCount == itemCount && queryCount == itemCount;
+  std::cout << "Listing and info queries: " << itemCount / querySeconds << " items/s" << std::endl;
+
+  FileSystem::Scanner scanner;
+  FileSystem::Scanner::ItemList itemList;
+  const U32 workerCounts[] = { 1, FileSystem::Scanner::kDefaultMaxWorkerCount };
+  for (size_t i = 0; i < E_ELEMENT_COUNT(workerCounts); ++i)
+  {
+    scanner.SetMaxWorkerCount(workerCounts[i]);
+    scanner.ClearCache();
+    t.Reset();
+    const bool scanned = scanner.Scan(rootPath, itemList);
+    const D64 scanSeconds = t.GetElapsed().GetSeconds();
+    result &= scanned && itemList.GetCount() == itemCount;
+    std::cout << "Scanner (" << workerCounts[i] << " workers): " << itemCount / scanSeconds << " items/s (x" 
+              << querySeconds / scanSeconds << ")" << std::endl;
+  }
+  t.Reset();
+  const bool cachedScanned = scanner.Scan(rootPath, itemList);
+  const D64 cachedSeconds = t.GetElapsed().GetSeconds();
+  result &= cachedScanned && itemList.GetCount() == itemCount && scanner.GetScannedDirectoryCount() == 0;
+  std::cout << "Scanner (cached): " << itemCount / cachedSeconds << " items/s (x" << querySeconds / cachedSeconds 
+            << ")" << std::endl;
+
+  for (size_t i = 0; i < kScannerDirectoryCount; ++i)
+  {
+    for (size_t j = 0; j < kScannerSubdirectoryCount; ++j)
+    {
+      for (size_t k = 0; k < kScannerFileCount; ++k)
+      {
+        name.Print("ScannerPerf\\Dir%02d\\Sub%02d\\File%04d.bin", i, j, k);
+        result &= FileSystem::File::Destroy(GetScannerTestPath(name.GetPtr()));
+      }
+      name.Print("ScannerPerf\\Dir%02d\\Sub%02d", i, j);
+      result &= FileSystem::Directory::Destroy(GetScannerTestPath(name.GetPtr()));
+    }
+    name.Print("ScannerPerf\\Dir%02d", i);
+    result &= FileSystem::Directory::Destroy(GetScannerTestPath(name.GetPtr()));
+  }
+  result &= FileSystem::Directory::Destroy(rootPath);
+
+  E_ASSERT(result);
+  return result;
+}
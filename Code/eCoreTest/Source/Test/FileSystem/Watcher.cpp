@@ -0,0 +1,274 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Watcher.cpp
+This file defines Watcher test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+typedef Containers::List<FileSystem::Watcher::ChangeEvent> WatcherEventList;
+
+static const size_t kWatcherFileCount = 5000;
+
+class WatcherSubscriber : public EventSystem::IEventHandler
+{
+public:
+  void OnEvent(const FileSystem::Watcher::ChangeEvent& event) { eventList.PushBack(event); }
+
+  WatcherEventList eventList;
+};
+
+inline FilePath GetWatcherTestPath(const char* pName)
+{
+  FilePath filePath = FileSystem::Directory::GetBase();
+  filePath += "\\";
+  filePath += pName;
+  return filePath;
+}
+
+inline void WriteWatcherFile(const FilePath& filePath, FileSystem::Archive::OpenMode openMode)
+{
+  FileSystem::Archive archive;
+  const bool opened = archive.Open(filePath, openMode);
+  E_ASSERT(opened);
+  if (opened) archive.Write("watcher", 7);
+}
+
+// Counts the events of a path, the last one of them is taken if pAction is not nullptr
+inline size_t CountWatcherEvents(const WatcherEventList& eventList, const FilePath& path, 
+                                 FileSystem::Watcher::Action* pAction = nullptr)
+{
+  size_t count = 0;
+  for (auto it = begin(eventList); it != end(eventList); ++it)
+  {
+    if ((*it).path != path) continue;
+    if (pAction) *pAction = (*it).action;
+    ++count;
+  }
+  return count;
+}
+
+// Updates the watcher till an event of the path is raised (or the time out is reached)
+inline bool WaitForWatcherEvent(FileSystem::Watcher& watcher, const WatcherSubscriber& subscriber, const FilePath& path)
+{
+  for (U32 i = 0; i < 250; ++i)
+  {
+    watcher.Update();
+    if (CountWatcherEvents(subscriber.eventList, path)) return true;
+    Threads::Thread::Sleep(TimeValue::kOneMillisecond * 20);
+  }
+  return false;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Watcher::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Watcher::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Watcher::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Watcher::RunFunctionalityTest()
+{
+  std::cout << "[Test::Watcher::RunFunctionalityTest]" << std::endl;
+
+  const FilePath rootPath = GetWatcherTestPath("WatcherTest");
+  const FilePath subPath = GetWatcherTestPath("WatcherTest\\Sub");
+  E_ASSERT(FileSystem::Directory::Create(rootPath));
+  E_ASSERT(FileSystem::Directory::Create(subPath));
+  WriteWatcherFile(GetWatcherTestPath("WatcherTest\\Existing.bin"), FileSystem::Archive::eOpenModeWrite);
+
+  FileSystem::Watcher watcher;
+  WatcherSubscriber subscriber;
+  watcher.GetChangeEventCallback() += &subscriber;
+  E_ASSERT(watcher.IsAvailable());
+  watcher.SetDebounceTime(TimeValue::kOneMillisecond * 200);
+
+  // Invalid watches
+  E_ASSERT(watcher.AddWatch(GetWatcherTestPath("WatcherTestMissing")) == FileSystem::Watcher::kInvalidWatchId);
+  E_ASSERT(watcher.AddWatch(GetWatcherTestPath("WatcherTest\\Existing.bin")) == FileSystem::Watcher::kInvalidWatchId);
+  E_ASSERT(watcher.GetWatchCount() == 0);
+
+  // Recursive watch: additions coalesced with the following writes, modifications and removals
+  const U32 watchId = watcher.AddWatch(rootPath);
+  E_ASSERT(watchId != FileSystem::Watcher::kInvalidWatchId && watcher.GetWatchCount() == 1);
+  const FilePath filePath = GetWatcherTestPath("WatcherTest\\A.bin");
+  WriteWatcherFile(filePath, FileSystem::Archive::eOpenModeWrite);
+  WriteWatcherFile(filePath, FileSystem::Archive::eOpenModeAppend);
+  WriteWatcherFile(filePath, FileSystem::Archive::eOpenModeAppend);
+  E_ASSERT(WaitForWatcherEvent(watcher, subscriber, filePath));
+  FileSystem::Watcher::Action action = FileSystem::Watcher::eActionRescan;
+  E_ASSERT(CountWatcherEvents(subscriber.eventList, filePath, &action) == 1);
+  E_ASSERT(action == FileSystem::Watcher::eActionAdded);
+  for (auto it = begin(subscriber.eventList); it != end(subscriber.eventList); ++it) E_ASSERT((*it).watchId == watchId);
+  subscriber.eventList.Clear();
+
+  WriteWatcherFile(GetWatcherTestPath("WatcherTest\\Existing.bin"), FileSystem::Archive::eOpenModeAppend);
+  E_ASSERT(WaitForWatcherEvent(watcher, subscriber, GetWatcherTestPath("WatcherTest\\Existing.bin")));
+  E_ASSERT(CountWatcherEvents(subscriber.eventList, GetWatcherTestPath("WatcherTest\\Existing.bin"), &action) == 1);
+  E_ASSERT(action == FileSystem::Watcher::eActionModified);
+
+  const FilePath subFilePath = GetWatcherTestPath("WatcherTest\\Sub\\B.bin");
+  WriteWatcherFile(subFilePath, FileSystem::Archive::eOpenModeWrite);
+  E_ASSERT(WaitForWatcherEvent(watcher, subscriber, subFilePath));
+  E_ASSERT(CountWatcherEvents(subscriber.eventList, subFilePath, &action) == 1);
+  E_ASSERT(action == FileSystem::Watcher::eActionAdded);
+
+  E_ASSERT(FileSystem::File::Destroy(filePath));
+  E_ASSERT(WaitForWatcherEvent(watcher, subscriber, filePath));
+  E_ASSERT(CountWatcherEvents(subscriber.eventList, filePath, &action) == 1);
+  E_ASSERT(action == FileSystem::Watcher::eActionRemoved);
+
+  // Added and removed before the debounce time: nothing to report
+  const FilePath tempPath = GetWatcherTestPath("WatcherTest\\Temp.bin");
+  const FilePath markerPath = GetWatcherTestPath("WatcherTest\\Marker.bin");
+  WriteWatcherFile(tempPath, FileSystem::Archive::eOpenModeWrite);
+  E_ASSERT(FileSystem::File::Destroy(tempPath));
+  WriteWatcherFile(markerPath, FileSystem::Archive::eOpenModeWrite);
+  E_ASSERT(WaitForWatcherEvent(watcher, subscriber, markerPath));
+  E_ASSERT(CountWatcherEvents(subscriber.eventList, tempPath) == 0);
+
+  // Non recursive watch
+  E_ASSERT(watcher.RemoveWatch(watchId));
+  E_ASSERT(!watcher.RemoveWatch(watchId));
+  const U32 flatWatchId = watcher.AddWatch(rootPath, false);
+  E_ASSERT(flatWatchId != FileSystem::Watcher::kInvalidWatchId && flatWatchId != watchId);
+  subscriber.eventList.Clear();
+  E_ASSERT(FileSystem::File::Destroy(subFilePath));
+  E_ASSERT(FileSystem::File::Destroy(markerPath));
+  E_ASSERT(WaitForWatcherEvent(watcher, subscriber, markerPath));
+  E_ASSERT(CountWatcherEvents(subscriber.eventList, subFilePath) == 0);
+
+  // Removed watches drop their pending changes and raise no more events
+  WriteWatcherFile(markerPath, FileSystem::Archive::eOpenModeWrite);
+  Threads::Thread::Sleep(TimeValue::kOneMillisecond * 100);
+  E_ASSERT(watcher.RemoveWatch(flatWatchId));
+  E_ASSERT(watcher.GetWatchCount() == 0 && watcher.GetPendingCount() == 0);
+  subscriber.eventList.Clear();
+  E_ASSERT(FileSystem::File::Destroy(markerPath));
+  Threads::Thread::Sleep(TimeValue::kOneMillisecond * 100);
+  E_ASSERT(watcher.Flush() == 0 && subscriber.eventList.IsEmpty());
+
+  watcher.GetChangeEventCallback() -= &subscriber;
+  E_ASSERT(FileSystem::File::Destroy(GetWatcherTestPath("WatcherTest\\Existing.bin")));
+  E_ASSERT(FileSystem::Directory::Destroy(subPath));
+  E_ASSERT(FileSystem::Directory::Destroy(rootPath));
+
+  return true;
+}
+
+bool Test::Watcher::RunPerformanceTest()
+{
+  std::cout << "[Test::Watcher::RunPerformanceTest]" << std::endl;
+
+  // Results are accumulated (not just asserted) so that release builds still run every call
+  bool result = true;
+
+  std::cout << "Writing " << kWatcherFileCount << " files" << std::endl;
+  const FilePath rootPath = GetWatcherTestPath("WatcherPerf");
+  result &= FileSystem::Directory::Create(rootPath);
+  FilePathList pathList;
+  E::String name;
+  for (size_t i = 0; i < kWatcherFileCount; ++i)
+  {
+    name.Print("WatcherPerf\\File%04d.bin", i);
+    pathList.PushBack(GetWatcherTestPath(name.GetPtr()));
+    WriteWatcherFile(pathList[i], FileSystem::Archive::eOpenModeWrite);
+  }
+
+  FileSystem::Watcher watcher;
+  WatcherSubscriber subscriber;
+  watcher.GetChangeEventCallback() += &subscriber;
+  result &= watcher.AddWatch(rootPath) != FileSystem::Watcher::kInvalidWatchId;
+
+  // Idle cost: a polling pass against a watcher update
+  E::Time::Timer t;
+  FileInfo info;
+  bool polled = true;
+  for (auto it = begin(pathList); it != end(pathList); ++it) polled &= FileSystem::File::GetInfo(*it, info);
+  const D64 pollSeconds = t.GetElapsed().GetSeconds();
+  result &= polled;
+  t.Reset();
+  for (U32 i = 0; i < 1000; ++i) watcher.Update();
+  const D64 updateSeconds = t.GetElapsed().GetSeconds() / 1000;
+  std::cout << "Polling pass: " << pollSeconds * 1000 << " ms, watcher update: " << updateSeconds * 1000 << " ms" 
+            << std::endl;
+
+  // Change delivery: every file modified once
+  watcher.SetDebounceTime(0);
+  t.Reset();
+  for (auto it = begin(pathList); it != end(pathList); ++it) 
+  {
+    WriteWatcherFile(*it, FileSystem::Archive::eOpenModeAppend);
+  }
+  const D64 writeSeconds = t.GetElapsed().GetSeconds();
+  size_t rescanCount = 0;
+  for (U32 i = 0; i < 500 && subscriber.eventList.GetCount() < kWatcherFileCount && rescanCount == 0; ++i)
+  {
+    watcher.Flush();
+    rescanCount = 0;
+    for (auto it = begin(subscriber.eventList); it != end(subscriber.eventList); ++it)
+    {
+      if ((*it).action == FileSystem::Watcher::eActionRescan) ++rescanCount;
+    }
+    Threads::Thread::Sleep(TimeValue::kOneMillisecond * 10);
+  }
+  const D64 deliverySeconds = t.GetElapsed().GetSeconds() - writeSeconds;
+  // A rescan event stands for the changes lost if the change buffer overflowed
+  result &= subscriber.eventList.GetCount() >= kWatcherFileCount || rescanCount > 0;
+  std::cout << "Changes: " << subscriber.eventList.GetCount() << " events (" << rescanCount << " rescans), delivered " 
+            << deliverySeconds * 1000 << " ms after the writes" << std::endl;
+
+  watcher.GetChangeEventCallback() -= &subscriber;
+  for (auto it = begin(pathList); it != end(pathList); ++it) result &= FileSystem::File::Destroy(*it);
+  result &= FileSystem::Directory::Destroy(rootPath);
+
+  E_ASSERT(result);
+  return result;
+}
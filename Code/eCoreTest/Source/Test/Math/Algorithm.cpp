@@ -39,6 +39,23 @@ using namespace std;
 Auxiliary method declaration
 ----------------------------------------------------------------------------------------------------------------------*/
 void SortPerformanceComparison(I32 minValue, I32 maxValue, U32 maxArraySize, U32 iterationCount);
+template <typename T>
+void LargeSortPerformanceComparison(const char* keyName, T minValue, T maxValue, U32 arraySize, U32 iterationCount);
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary types
+----------------------------------------------------------------------------------------------------------------------*/
+struct DrawItem
+{
+  F32 depth;
+  U32 index;
+};
+
+struct DrawItemDepth
+{
+  typedef F32 KeyType;
+  inline static F32 GetKey(const DrawItem& item) { return item.depth; }
+};
 
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
@@ -65,11 +82,9 @@ bool Test::Algorithm::Run()
 template <typename T>
 void CheckSortedArray(const E::Containers::DynamicArray<T>& a, bool printValuesFlag = false)
 {
-  T val = E::Math::NumericLimits<T>::Min();
   for (U32 i = 0; i < a.GetSize(); ++i)
   {
-    E_ASSERT(val <= a[i]);
-    val = a[i];
+    E_ASSERT(i == 0 || a[i - 1] <= a[i]);
     if (printValuesFlag)
       std::cout << a[i] << " ";
   }
@@ -131,6 +146,61 @@ bool Test::Algorithm::RunFunctionalityTest()
   E::Math::Sorting<I32>::QuickSort(b.GetPtr(), b.GetSize());
   CompareSortedArray(b, v);
 
+  // Radix sort
+  b.Copy(a.GetPtr(), a.GetSize());
+  E::Math::Sorting<I32>::RadixSort(b.GetPtr(), b.GetSize());
+  CompareSortedArray(b, v);
+
+  E::Containers::DynamicArray<I32> buffer(8);
+  b.Copy(a.GetPtr(), a.GetSize());
+  for (U32 i = 0; i < b.GetSize(); ++i) b[i] = -b[i];
+  std::vector<I32> vNegative(v.rbegin(), v.rend());
+  for (U32 i = 0; i < vNegative.size(); ++i) vNegative[i] = -vNegative[i];
+  E::Math::Sorting<I32>::RadixSort(b.GetPtr(), b.GetSize(), buffer.GetPtr());
+  CompareSortedArray(b, vNegative);
+
+  const U32 kLargeArraySize = 1 << 20;
+  E::Containers::DynamicArray<F32> floatArray(kLargeArraySize);
+  std::vector<F32> floatArrayStd(kLargeArraySize);
+  for (U32 i = 0; i < kLargeArraySize; ++i)
+  {
+    floatArray[i] = floatArrayStd[i] = Math::Global::GetRandom().GetF32(-1000.0f, 1000.0f);
+  }
+  std::sort(floatArrayStd.begin(), floatArrayStd.end());
+  E::Math::Sorting<F32>::RadixSort(floatArray.GetPtr(), floatArray.GetSize());
+  CheckSortedArray(floatArray);
+  CompareSortedArray(floatArray, floatArrayStd);
+
+  // Radix sort with a key extractor must be stable
+  E::Containers::DynamicArray<DrawItem> drawItems(kLargeArraySize);
+  for (U32 i = 0; i < kLargeArraySize; ++i)
+  {
+    drawItems[i].depth = static_cast<F32>(Math::Global::GetRandom().GetI32(-100, 100));
+    drawItems[i].index = i;
+  }
+  E::Math::Sorting<DrawItem>::RadixSort<DrawItemDepth>(drawItems.GetPtr(), drawItems.GetSize());
+  for (U32 i = 1; i < kLargeArraySize; ++i)
+  {
+    E_ASSERT(drawItems[i - 1].depth <= drawItems[i].depth);
+    E_ASSERT(drawItems[i - 1].depth < drawItems[i].depth || drawItems[i - 1].index < drawItems[i].index);
+  }
+
+  // Parallel sort
+  b.Copy(a.GetPtr(), a.GetSize());
+  E::Math::Sorting<I32>::ParallelSort(b.GetPtr(), b.GetSize());
+  CompareSortedArray(b, v);
+
+  E::Containers::DynamicArray<I32> intArray(kLargeArraySize + 3);
+  std::vector<I32> intArrayStd(kLargeArraySize + 3);
+  for (U32 i = 0; i < intArray.GetSize(); ++i)
+  {
+    intArray[i] = intArrayStd[i] = Math::Global::GetRandom().GetI32(0, Math::NumericLimits<I32>::Max());
+  }
+  std::sort(intArrayStd.begin(), intArrayStd.end());
+  E::Math::Sorting<I32>::ParallelSort(intArray.GetPtr(), intArray.GetSize());
+  CheckSortedArray(intArray);
+  CompareSortedArray(intArray, intArrayStd);
+
 
   return true;
 }
@@ -152,10 +222,76 @@ bool Test::Algorithm::RunPerformanceTest()
   maxValue = 100;
   
   SortPerformanceComparison(minValue, maxValue, maxArraySize, iterationCount);
+
+  // Draw keys and entity distances
+  LargeSortPerformanceComparison<U32>("U32", 0, Math::NumericLimits<I32>::Max(), 10000, 100);
+  LargeSortPerformanceComparison<U32>("U32", 0, Math::NumericLimits<I32>::Max(), 1000000, 10);
+  LargeSortPerformanceComparison<U32>("U32", 0, Math::NumericLimits<I32>::Max(), 10000000, 2);
+  LargeSortPerformanceComparison<F32>("F32", 0.0f, 10000.0f, 10000, 100);
+  LargeSortPerformanceComparison<F32>("F32", 0.0f, 10000.0f, 1000000, 10);
+  LargeSortPerformanceComparison<F32>("F32", 0.0f, 10000.0f, 10000000, 2);
  
   return true;
 }
 
+template <typename T>
+T GetRandomValue(T minValue, T maxValue);
+
+template <>
+U32 GetRandomValue(U32 minValue, U32 maxValue) 
+{ 
+  return static_cast<U32>(Math::Global::GetRandom().GetI32(static_cast<I32>(minValue), static_cast<I32>(maxValue)));
+}
+
+template <>
+F32 GetRandomValue(F32 minValue, F32 maxValue) { return Math::Global::GetRandom().GetF32(minValue, maxValue); }
+
+template <typename T>
+void LargeSortPerformanceComparison(const char* keyName, T minValue, T maxValue, U32 arraySize, U32 iterationCount)
+{
+  /*-------------------------------------------------------------------------------
+  IntroSort vs RadixSort vs ParallelSort with big arrays
+  -------------------------------------------------------------------------------*/
+  std::cout << "Parameters: " << std::endl
+            << "- Key type            [" << keyName << "]" << std::endl
+            << "- Array size          [" << arraySize << "]" << std::endl
+            << "- Iteration count     [" << iterationCount << "]"  << std::endl << std::endl;
+
+  E::Time::Timer t;
+  F32 introSortTime = 0;
+  F32 radixSortTime = 0;
+  F32 parallelSortTime = 0;
+  E::Containers::DynamicArray<T> source(arraySize), array(arraySize), buffer(arraySize);
+
+  for (U32 i = 0; i < iterationCount; ++i)
+  {
+    for (U32 j = 0; j < arraySize; ++j) source[j] = GetRandomValue(minValue, maxValue);
+
+    array.Copy(source.GetPtr(), arraySize);
+    t.Reset();
+    Math::Sorting<T>::IntroSort(array.GetPtr(), arraySize);
+    introSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    CheckSortedArray(array);
+
+    array.Copy(source.GetPtr(), arraySize);
+    t.Reset();
+    Math::Sorting<T>::RadixSort(array.GetPtr(), arraySize, buffer.GetPtr());
+    radixSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    CheckSortedArray(array);
+
+    array.Copy(source.GetPtr(), arraySize);
+    t.Reset();
+    Math::Sorting<T>::ParallelSort(array.GetPtr(), arraySize, buffer.GetPtr());
+    parallelSortTime += static_cast<F32>(t.GetElapsed().GetMilliseconds());
+    CheckSortedArray(array);
+  }
+
+  std::cout << "IntroSort    time [" << introSortTime << " ms]" << std::endl
+            << "RadixSort    time [" << radixSortTime << " / " << introSortTime << " ms]\t" << (introSortTime / radixSortTime * 100.0f) - 100.0f << "% faster" << std::endl
+            << "ParallelSort time [" << parallelSortTime << " / " << introSortTime << " ms]\t" << (introSortTime / parallelSortTime * 100.0f) - 100.0f << "% faster" << std::endl
+            << std::endl;
+}
+
 I32 compare_ints(const void* a, const void* b)   // comparison function
 {
   I32 arg1 = *reinterpret_cast<const I32*>(a);
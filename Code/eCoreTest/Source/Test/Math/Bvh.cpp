@@ -0,0 +1,394 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Bvh.cpp
+This file defines Bvh test functions.
+*/
+
+#include <CoreTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary declarations
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Triangle soup: vertices 3 * i, 3 * i + 1 and 3 * i + 2 form triangle i
+typedef E::Containers::DynamicArray<Vector3f> Vertices;
+
+struct RayIntersector
+{
+  RayIntersector(const Vertices& vertices, const Vector3f& origin, const Vector3f& direction) 
+    : pVertices(vertices.GetPtr()), origin(origin), direction(direction) {}
+  bool operator()(U32 i, F32& lambda) const
+  {
+    return Math::IntersectRayTriangle(origin, direction, pVertices[3 * i], pVertices[3 * i + 1], pVertices[3 * i + 2], 
+                                      lambda);
+  }
+  const Vector3f* pVertices;
+  Vector3f origin;
+  Vector3f direction;
+};
+
+struct PointDistance
+{
+  PointDistance(const Vertices& vertices, const Vector3f& point) : pVertices(vertices.GetPtr()), point(point) {}
+  F32 operator()(U32 i, Vector3f& closestPoint) const
+  {
+    return Math::DistancePointTriangleSquared(point, pVertices[3 * i], pVertices[3 * i + 1], pVertices[3 * i + 2], 
+                                              closestPoint);
+  }
+  const Vector3f* pVertices;
+  Vector3f point;
+};
+
+void      BuildGrid(Vertices& vertices, U32 size);
+void      BuildSoup(Vertices& vertices, U32 count, F32 triangleSize);
+void      GetBounds(E::Containers::DynamicArray<Box3f>& bounds, const Vertices& vertices);
+Vector3f  GetRandomDirection();
+bool      CheckQueries(const Bvhf& bvh, const Vertices& vertices, const E::Containers::DynamicArray<Box3f>& bounds);
+
+/*----------------------------------------------------------------------------------------------------------------------
+Test::Bvh methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool Test::Bvh::Run()
+{
+  try
+  {
+    E::Time::Timer t;
+    Test::PrintResultTimeAndReset(RunFunctionalityTest(), t, "Test::Bvh::RunFunctionalityTest");
+    Test::PrintResultTimeAndReset(RunPerformanceTest(), t, "Test::Bvh::RunPerformanceTest");
+
+    return true;
+  }
+  catch(const Exception& e)
+  {
+    Test::PrintException(e);
+  }
+
+  return false;
+}
+
+bool Test::Bvh::RunFunctionalityTest()
+{
+  std::cout << "[Test::Bvh::RunFunctionalityTest]" << std::endl;
+
+  /*-------------------------------------------------------------------------------
+  Intersection & Distance
+  -------------------------------------------------------------------------------*/
+  F32 lambda = 0.0f;
+  Vector3f closestPoint;
+  Spheref sphere(Vector3f(0.0f, 0.0f, 5.0f), 1.0f);
+  E_ASSERT(Math::IntersectRaySphere(Vector3f(0.0f), Vector3f(0.0f, 0.0f, 1.0f), sphere, lambda));
+  E_ASSERT(Math::IsEqual(lambda, 4.0f));
+  E_ASSERT(Math::IntersectRayBox3(Vector3f(0.0f), Vector3f(0.0f, 0.0f, 1.0f), 
+                                  Box3f(Vector3f(-1.0f, -1.0f, 2.0f), Vector3f(1.0f, 1.0f, 3.0f)), lambda));
+  E_ASSERT(Math::IsEqual(lambda, 2.0f));
+  E_ASSERT(Math::IntersectRayTriangle(Vector3f(0.2f, 0.2f, -1.0f), Vector3f(0.0f, 0.0f, 1.0f), Vector3f(0.0f), 
+                                      Vector3f(1.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f), lambda));
+  E_ASSERT(Math::IsEqual(lambda, 1.0f));
+  E_ASSERT(Math::IsEqual(Math::DistancePointTriangleSquared(Vector3f(0.2f, 0.2f, 2.0f), Vector3f(0.0f), 
+                                                            Vector3f(1.0f, 0.0f, 0.0f), Vector3f(0.0f, 1.0f, 0.0f), 
+                                                            closestPoint), 4.0f));
+  E_ASSERT((closestPoint - Vector3f(0.2f, 0.2f, 0.0f)).GetLengthSquared() < 1e-10f);
+
+  /*-------------------------------------------------------------------------------
+  Bvh
+  -------------------------------------------------------------------------------*/
+  Bvhf bvh;
+  U32 primitive = 0;
+  F32 distanceSquared = 0.0f;
+  E_ASSERT(bvh.IsEmpty() && bvh.GetBounds().IsEmpty());
+  E_ASSERT(!bvh.RayCast(Vector3f(0.0f), Vector3f(1.0f, 0.0f, 0.0f), 1.0f, 
+                        RayIntersector(Vertices(), Vector3f(0.0f), Vector3f(1.0f, 0.0f, 0.0f)), primitive, lambda));
+  E_ASSERT(!bvh.FindClosestPoint(Vector3f(0.0f), PointDistance(Vertices(), Vector3f(0.0f)), primitive, closestPoint, 
+                                 distanceSquared));
+
+  // Query results must match the brute force ones
+  const U32 kSoupSizes[] = { 1, 2, 7, 100, 5000 };
+  for (U32 i = 0; i < sizeof(kSoupSizes) / sizeof(U32); ++i)
+  {
+    Vertices vertices;
+    E::Containers::DynamicArray<Box3f> bounds;
+    BuildSoup(vertices, kSoupSizes[i], 1.0f);
+    if (kSoupSizes[i] > 2)
+    {
+      // Degenerate triangles and coincident centroids
+      vertices[0] = vertices[1] = vertices[2] = vertices[3] = vertices[4] = Vector3f(1.0f, 1.0f, 1.0f);
+      vertices[5] = Vector3f(1.0f, 1.0f, 1.5f);
+    }
+    GetBounds(bounds, vertices);
+    bvh.Build(bounds.GetPtr(), kSoupSizes[i]);
+    E_ASSERT(bvh.GetPrimitiveCount() == kSoupSizes[i] && bvh.GetNodeCount() < 2 * kSoupSizes[i]);
+    E_ASSERT(CheckQueries(bvh, vertices, bounds));
+
+    // Full refit
+    for (U32 j = 0; j < vertices.GetSize(); ++j) vertices[j] += Vector3f(0.5f, -0.25f, static_cast<F32>(j % 3));
+    GetBounds(bounds, vertices);
+    bvh.Refit(bounds.GetPtr());
+    E_ASSERT(CheckQueries(bvh, vertices, bounds));
+
+    // Single primitive refits
+    for (U32 j = 0; j < kSoupSizes[i]; j += 5)
+    {
+      for (U32 k = 0; k < 3; ++k) vertices[3 * j + k] += Vector3f(3.0f, 3.0f, -3.0f);
+      bounds[j] = Box3f(Vector3f::Min(Vector3f::Min(vertices[3 * j], vertices[3 * j + 1]), vertices[3 * j + 2]), 
+                        Vector3f::Max(Vector3f::Max(vertices[3 * j], vertices[3 * j + 1]), vertices[3 * j + 2]));
+      bvh.Refit(j, bounds[j]);
+    }
+    E_ASSERT(CheckQueries(bvh, vertices, bounds));
+  }
+
+  // Many sub-epsilon single primitive refits must still reach the root
+  {
+    E::Containers::DynamicArray<Box3f> bounds(64);
+    for (U32 i = 0; i < 64; ++i) bounds[i] = Box3f(Vector3f(static_cast<F32>(i), 0.0f, 0.0f), 
+                                                   Vector3f(static_cast<F32>(i) + 0.5f, 1.0f, 1.0f));
+    bvh.Build(bounds.GetPtr(), 64);
+    const F32 kStep = 0.25f * Math::Epsilon<F32>::Get();
+    for (U32 i = 0; i < 1000; ++i)
+    {
+      bounds[0] = Box3f(bounds[0].GetMin() - Vector3f(kStep, 0.0f, 0.0f), bounds[0].GetMax());
+      bvh.Refit(0, bounds[0]);
+    }
+    E_ASSERT(bvh.GetBounds().GetMin().x == bounds[0].GetMin().x);
+    Box3f query(bounds[0].GetMin(), Vector3f(0.5f * bounds[0].GetMin().x, 1.0f, 1.0f));
+    E_ASSERT(bvh.FindOverlaps(query, [](U32 primitive) { E_ASSERT(primitive == 0); }) == 1);
+  }
+
+  // D64
+  Box3d box(Vector3d(0.0, 0.0, 0.0), Vector3d(1.0, 1.0, 1.0));
+  Bvhd bvhd(&box, 1);
+  E_ASSERT(bvhd.GetNodeCount() == 1 && bvhd.FindOverlaps(box, [](U32) {}) == 1);
+
+  return true;
+}
+
+bool Test::Bvh::RunPerformanceTest()
+{
+  std::cout << "[Test::Bvh::RunPerformanceTest]" << std::endl;
+
+  // 708 x 708 quad height field (1M triangles)
+  const U32 kGridSize = 708;
+  const U32 kQueryCount = 100000;
+  const U32 kBruteForceQueryCount = 10;
+  Vertices vertices;
+  E::Containers::DynamicArray<Box3f> bounds;
+  BuildGrid(vertices, kGridSize);
+  GetBounds(bounds, vertices);
+  const U32 triangleCount = static_cast<U32>(bounds.GetSize());
+  E::Containers::DynamicArray<Vector3f> origins(kQueryCount);
+  E::Containers::DynamicArray<Vector3f> directions(kQueryCount);
+  for (U32 i = 0; i < kQueryCount; ++i)
+  {
+    // Picking rays from above plus random rays
+    origins[i] = Vector3f(Math::Global::GetRandom().GetF32(0.0f, static_cast<F32>(kGridSize)), 
+                          Math::Global::GetRandom().GetF32(2.0f, 20.0f), 
+                          Math::Global::GetRandom().GetF32(0.0f, static_cast<F32>(kGridSize)));
+    directions[i] = (i % 2 == 0) ? Vector3f(0.0f, -1.0f, 0.0f) : GetRandomDirection();
+  }
+
+  std::cout << "Bvh (" << triangleCount << " triangles, " << kQueryCount << " queries)" << std::endl;
+  E::Time::Timer t;
+  Bvhf bvh(bounds.GetPtr(), triangleCount);
+  std::cout << "  Build                 [" << t.GetElapsed().GetMilliseconds() << " ms, " << bvh.GetNodeCount() 
+            << " nodes]" << std::endl;
+  t.Reset();
+  bvh.Refit(bounds.GetPtr());
+  std::cout << "  Refit                 [" << t.GetElapsed().GetMilliseconds() << " ms]" << std::endl;
+
+  U32 primitive = 0;
+  F32 lambda = 0.0f;
+  U32 hitCount = 0;
+  t.Reset();
+  for (U32 i = 0; i < kBruteForceQueryCount; ++i)
+  {
+    RayIntersector intersect(vertices, origins[i], directions[i]);
+    F32 bestLambda = std::numeric_limits<F32>::max();
+    for (U32 j = 0; j < triangleCount; ++j)
+    {
+      if (intersect(j, lambda) && lambda >= 0.0f && lambda < bestLambda) bestLambda = lambda;
+    }
+  }
+  D64 seconds = t.GetElapsed().GetSeconds();
+  std::cout << "  RayCast brute force   [" << kBruteForceQueryCount / seconds << " queries/s]" << std::endl;
+  t.Reset();
+  for (U32 i = 0; i < kQueryCount; ++i)
+  {
+    RayIntersector intersect(vertices, origins[i], directions[i]);
+    if (bvh.RayCast(origins[i], directions[i], std::numeric_limits<F32>::max(), intersect, primitive, lambda)) 
+    {
+      ++hitCount;
+    }
+  }
+  seconds = t.GetElapsed().GetSeconds();
+  std::cout << "  RayCast               [" << kQueryCount / seconds << " queries/s, " << hitCount << " hits]" 
+            << std::endl;
+  Vector3f closestPoint;
+  F32 distanceSquared = 0.0f;
+  t.Reset();
+  for (U32 i = 0; i < kQueryCount; ++i)
+  {
+    bvh.FindClosestPoint(origins[i], PointDistance(vertices, origins[i]), primitive, closestPoint, distanceSquared);
+  }
+  seconds = t.GetElapsed().GetSeconds();
+  std::cout << "  FindClosestPoint      [" << kQueryCount / seconds << " queries/s]" << std::endl;
+  size_t overlapCount = 0;
+  t.Reset();
+  for (U32 i = 0; i < kQueryCount; ++i)
+  {
+    Box3f box(origins[i] - Vector3f(2.0f, 20.0f, 2.0f), origins[i] + Vector3f(2.0f, 0.0f, 2.0f));
+    overlapCount += bvh.FindOverlaps(box, [](U32) {});
+  }
+  seconds = t.GetElapsed().GetSeconds();
+  std::cout << "  FindOverlaps          [" << kQueryCount / seconds << " queries/s, " << overlapCount << " overlaps]" 
+            << std::endl;
+  std::cout << std::endl;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+void BuildGrid(Vertices& vertices, U32 size)
+{
+  vertices.Resize(6 * size * size);
+  U32 vertex = 0;
+  for (U32 z = 0; z < size; ++z)
+  {
+    for (U32 x = 0; x < size; ++x)
+    {
+      F32 heights[4];
+      for (U32 i = 0; i < 4; ++i) 
+      {
+        F32 cornerX = static_cast<F32>(x + i % 2);
+        F32 cornerZ = static_cast<F32>(z + i / 2);
+        heights[i] = Math::Sin(cornerX * 0.05f) * Math::Cos(cornerZ * 0.07f) * 2.0f;
+      }
+      Vector3f corners[4] = { Vector3f(static_cast<F32>(x), heights[0], static_cast<F32>(z)), 
+                              Vector3f(static_cast<F32>(x + 1), heights[1], static_cast<F32>(z)), 
+                              Vector3f(static_cast<F32>(x), heights[2], static_cast<F32>(z + 1)), 
+                              Vector3f(static_cast<F32>(x + 1), heights[3], static_cast<F32>(z + 1)) };
+      vertices[vertex++] = corners[0];
+      vertices[vertex++] = corners[2];
+      vertices[vertex++] = corners[1];
+      vertices[vertex++] = corners[1];
+      vertices[vertex++] = corners[2];
+      vertices[vertex++] = corners[3];
+    }
+  }
+}
+
+void BuildSoup(Vertices& vertices, U32 count, F32 triangleSize)
+{
+  vertices.Resize(3 * count);
+  for (U32 i = 0; i < count; ++i)
+  {
+    Vector3f center = GetRandomDirection() * Math::Global::GetRandom().GetF32(0.0f, 10.0f);
+    for (U32 j = 0; j < 3; ++j) vertices[3 * i + j] = center + GetRandomDirection() * triangleSize;
+  }
+}
+
+void GetBounds(E::Containers::DynamicArray<Box3f>& bounds, const Vertices& vertices)
+{
+  const size_t count = vertices.GetSize() / 3;
+  bounds.Resize(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    bounds[i] = Box3f(Vector3f::Min(Vector3f::Min(vertices[3 * i], vertices[3 * i + 1]), vertices[3 * i + 2]), 
+                      Vector3f::Max(Vector3f::Max(vertices[3 * i], vertices[3 * i + 1]), vertices[3 * i + 2]));
+  }
+}
+
+Vector3f GetRandomDirection()
+{
+  Vector3f direction;
+  do
+  {
+    direction.Set(Math::Global::GetRandom().GetF32(-1.0f, 1.0f), Math::Global::GetRandom().GetF32(-1.0f, 1.0f), 
+                  Math::Global::GetRandom().GetF32(-1.0f, 1.0f));
+  } while (direction.GetLengthSquared() < 0.01f);
+  direction.Normalize();
+  return direction;
+}
+
+// Ray casts, closest points and overlaps against the brute force results
+bool CheckQueries(const Bvhf& bvh, const Vertices& vertices, const E::Containers::DynamicArray<Box3f>& bounds)
+{
+  const U32 count = static_cast<U32>(bounds.GetSize());
+  for (U32 i = 0; i < 200; ++i)
+  {
+    Vector3f origin = GetRandomDirection() * Math::Global::GetRandom().GetF32(0.0f, 15.0f);
+    Vector3f direction = GetRandomDirection();
+    RayIntersector intersect(vertices, origin, direction);
+    PointDistance distance(vertices, origin);
+    F32 bestLambda = 100.0f;
+    F32 bestDistance = std::numeric_limits<F32>::max();
+    bool hit = false;
+    for (U32 j = 0; j < count; ++j)
+    {
+      F32 lambda;
+      Vector3f closestPoint;
+      if (intersect(j, lambda) && lambda >= 0.0f && lambda < bestLambda)
+      {
+        bestLambda = lambda;
+        hit = true;
+      }
+      bestDistance = Math::Min(bestDistance, distance(j, closestPoint));
+    }
+    U32 primitive;
+    F32 lambda, distanceSquared;
+    Vector3f closestPoint;
+    if (bvh.RayCast(origin, direction, 100.0f, intersect, primitive, lambda) != hit) return false;
+    if (hit && lambda != bestLambda) return false;
+    if (!bvh.FindClosestPoint(origin, distance, primitive, closestPoint, distanceSquared)) return false;
+    if (distanceSquared != bestDistance || distance(primitive, closestPoint) != distanceSquared) return false;
+
+    const Box3f box(origin, origin + Vector3f(1.0f, 2.0f, 3.0f));
+    const Vector3f boxMin = box.GetMin();
+    const Vector3f boxMax = box.GetMax();
+    E::Containers::DynamicArray<U8> reported(count);
+    reported.SetZero();
+    U8* pReported = reported.GetPtr();
+    size_t overlapCount = bvh.FindOverlaps(box, [pReported](U32 j) { ++pReported[j]; });
+    for (U32 j = 0; j < count; ++j)
+    {
+      Vector3f min = bounds[j].GetMin();
+      Vector3f max = bounds[j].GetMax();
+      bool overlaps = min.x <= boxMax.x && boxMin.x <= max.x && min.y <= boxMax.y && boxMin.y <= max.y && 
+                      min.z <= boxMax.z && boxMin.z <= max.z;
+      if (reported[j] != (overlaps ? 1 : 0)) return false;
+      if (overlaps) --overlapCount;
+    }
+    if (overlapCount != 0) return false;
+  }
+  return true;
+}
@@ -37,6 +37,21 @@ using namespace E;
 /*----------------------------------------------------------------------------------------------------------------------
 Auxiliary declarations
 ----------------------------------------------------------------------------------------------------------------------*/
+bool      IsNear(const Matrix4f& a, const Matrix4d& b, F32 tolerance);
+Matrix4f  MultiplyScalar(const Matrix4f& a, const Matrix4f& b);
+Matrix4f  GetRandomTransform();
+Matrix4d  ToMatrix4d(const Matrix4f& m);
+Vector3f  GetRandomPoint();
+bool      CheckBatch(U32 count, Threads::ThreadPool* pPool);
+bool      CheckFrustum(U32 count);
+Matrix4f  GetViewProjection();
+void      PrintBatchTimes(const char* operationName, TimeValue loopTime, TimeValue batchTime, TimeValue poolTime);
+template <typename ResultType, typename SourceType>
+TimeValue BenchmarkBatch(U32 passCount, 
+                         void (*BatchFunction)(ResultType*, const SourceType*, size_t, const Matrix4f&, 
+                                               Threads::ThreadPool*), 
+                         ResultType* pResults, const SourceType* pSources, U32 count, const Matrix4f& m, 
+                         Threads::ThreadPool* pPool);
 
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
@@ -269,6 +284,73 @@ bool Test::Matrix::RunFunctionalityTest()
   m.SetRotationZ(Math::Rad(30.f));
   E_ASSERT(m == m2);
 
+  /*-------------------------------------------------------------------------------
+  Matrix4f (SIMD) vs Matrix4d (scalar)
+  -------------------------------------------------------------------------------*/
+  E_ASSERT(reinterpret_cast<size_t>(&m) % 16 == 0);
+  for (U32 i = 0; i < 1000; ++i)
+  {
+    Matrix4f a = GetRandomTransform();
+    Matrix4f b = GetRandomTransform();
+    Matrix4d ad = ToMatrix4d(a);
+    Matrix4d bd = ToMatrix4d(b);
+    E_ASSERT(IsNear(a * b, ad * bd, 1e-4f));
+    E_ASSERT(IsNear(a + b, ad + bd, 1e-4f));
+    E_ASSERT(IsNear(a - b, ad - bd, 1e-4f));
+    E_ASSERT(IsNear(-a, -ad, 1e-4f));
+    E_ASSERT(IsNear(a * 3.0f, ad * 3.0, 1e-4f));
+    E_ASSERT(IsNear(Matrix4f::Transpose(a), Matrix4d::Transpose(ad), 0.0f));
+    E_ASSERT(IsNear(Matrix4f::Invert(a), Matrix4d::Invert(ad), 1e-4f));
+    E_ASSERT(IsNear(a * Matrix4f::Invert(a), Matrix4d::Identity(), 1e-4f));
+
+    Vector4f v(Math::Global::GetRandom().GetF32(-10.0f, 10.0f), Math::Global::GetRandom().GetF32(-10.0f, 10.0f), 
+               Math::Global::GetRandom().GetF32(-10.0f, 10.0f), 1.0f);
+    Vector4f tv = Matrix4f::Transform(a, v);
+    Vector4d tvd = Matrix4d::Transform(ad, Vector4d(v.x, v.y, v.z, v.w));
+    E_ASSERT(Math::IsEqual(tv.x, static_cast<F32>(tvd.x), 1e-4f) && Math::IsEqual(tv.y, static_cast<F32>(tvd.y), 1e-4f));
+    E_ASSERT(Math::IsEqual(tv.z, static_cast<F32>(tvd.z), 1e-4f) && Math::IsEqual(tv.w, static_cast<F32>(tvd.w), 1e-4f));
+    Vector3f tp = Matrix4f::TransformPoint(a, Vector3f(v.x, v.y, v.z));
+    Vector3d tpd = Matrix4d::TransformPoint(ad, Vector3d(v.x, v.y, v.z));
+    E_ASSERT(Math::IsEqual(tp.x, static_cast<F32>(tpd.x), 1e-4f) && Math::IsEqual(tp.y, static_cast<F32>(tpd.y), 1e-4f));
+    E_ASSERT(Math::IsEqual(tp.z, static_cast<F32>(tpd.z), 1e-4f));
+    E_ASSERT(Math::IsEqual(tv.x, tp.x, 1e-4f) && Math::IsEqual(tv.y, tp.y, 1e-4f) && Math::IsEqual(tv.z, tp.z, 1e-4f));
+  }
+
+  /*-------------------------------------------------------------------------------
+  Batch vs per element methods
+  -------------------------------------------------------------------------------*/
+  const U32 kBatchSizes[] = { 0, 1, 3, 4, 5, 1023, 3 * Math::Batch<F32>::kMinTaskLength + 1 };
+  for (U32 i = 0; i < sizeof(kBatchSizes) / sizeof(U32); ++i)
+  {
+    E_ASSERT(CheckBatch(kBatchSizes[i], nullptr));
+    E_ASSERT(CheckBatch(kBatchSizes[i], &Threads::Global::GetThreadPool()));
+  }
+
+  /*-------------------------------------------------------------------------------
+  Frustum
+  -------------------------------------------------------------------------------*/
+  // Camera 5 units behind the origin looking along +z
+  Frustumf frustum(GetViewProjection());
+  E_ASSERT(frustum.IsVisible(Vector3f(0.0f, 0.0f, 0.0f)));
+  E_ASSERT(!frustum.IsVisible(Vector3f(0.0f, 0.0f, -10.0f)));
+  E_ASSERT(!frustum.IsVisible(Vector3f(0.0f, 0.0f, 10.0f)));
+  E_ASSERT(!frustum.IsVisible(Vector3f(10.0f, 0.0f, 0.0f)));
+  E_ASSERT(frustum.IsVisible(Spheref(Vector3f(0.0f, 0.0f, -5.0f), 1.5f)));
+  E_ASSERT(!frustum.IsVisible(Spheref(Vector3f(0.0f, 0.0f, -5.0f), 0.5f)));
+  E_ASSERT(!frustum.IsVisible(Spheref()));
+  E_ASSERT(frustum.IsVisible(Box3f(Vector3f(-1.0f, -1.0f, 6.0f), Vector3f(1.0f, 1.0f, 8.0f))));
+  E_ASSERT(!frustum.IsVisible(Box3f(Vector3f(9.0f, -1.0f, -1.0f), Vector3f(11.0f, 1.0f, 1.0f))));
+  E_ASSERT(frustum.IsVisible(Box3f(Vector3f(-20.0f, -1.0f, -1.0f), Vector3f(20.0f, 1.0f, 1.0f))));
+  E_ASSERT(!frustum.IsVisible(Box3f()));
+  for (U32 i = 0; i < Frustumf::ePlaneCount; ++i)
+  {
+    const Plane<F32>& plane = frustum.GetPlane(static_cast<Frustumf::PlaneType>(i));
+    E_ASSERT(Math::IsEqual(plane.GetNormal().GetLength(), 1.0f, 1e-5f));
+    E_ASSERT(plane.GetDistanceToPoint(Vector3f(0.0f, 0.0f, 1.0f)) > 0.0f);
+  }
+  const U32 kFrustumSizes[] = { 0, 1, 3, 4, 5, 31, 32, 33, 1000 };
+  for (U32 i = 0; i < sizeof(kFrustumSizes) / sizeof(U32); ++i) E_ASSERT(CheckFrustum(kFrustumSizes[i]));
+
   return true;
 }
 
@@ -365,6 +447,408 @@ bool Test::Matrix::RunPerformanceTest()
       Math::IsEqual(rotationXYZ[14], rotation[14]) &&
       Math::IsEqual(rotationXYZ[15], rotation[15]));
   }
-  
+
+  /*-------------------------------------------------------------------------------
+  Matrix4f (SIMD) vs scalar vs D3DX
+  -------------------------------------------------------------------------------*/
+  const U32 kMatrixCount = 1024;
+  const U32 kPassCount = 1000;
+  E::Containers::DynamicArray<Matrix4f> matrices(kMatrixCount);
+  E::Containers::DynamicArray<Matrix4f> results(kMatrixCount);
+  E::Containers::DynamicArray<D3DXMATRIX> dxMatrices(kMatrixCount);
+  E::Containers::DynamicArray<D3DXMATRIX> dxResults(kMatrixCount);
+  for (U32 i = 0; i < kMatrixCount; ++i)
+  {
+    matrices[i] = GetRandomTransform();
+    dxMatrices[i] = D3DXMATRIX(&matrices[i][0]);
+  }
+
+  E::Time::Timer t;
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 1; i < kMatrixCount; ++i) results[i] = MultiplyScalar(matrices[i - 1], matrices[i]);
+  }
+  TimeValue scalarMultiplyTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 1; i < kMatrixCount; ++i) results[i] = matrices[i - 1] * matrices[i];
+  }
+  TimeValue simdMultiplyTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 1; i < kMatrixCount; ++i) D3DXMatrixMultiply(&dxResults[i], &dxMatrices[i - 1], &dxMatrices[i]);
+  }
+  TimeValue dxMultiplyTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 0; i < kMatrixCount; ++i) results[i] = Matrix4f::Invert(matrices[i]);
+  }
+  TimeValue simdInvertTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 0; i < kMatrixCount; ++i) D3DXMatrixInverse(&dxResults[i], nullptr, &dxMatrices[i]);
+  }
+  TimeValue dxInvertTime = t.GetElapsed();
+
+  std::cout << std::endl << "Matrix4f operations (" << kMatrixCount * kPassCount << " times)" << std::endl
+            << "Multiply scalar     [" << scalarMultiplyTime.GetMilliseconds() << " ms]" << std::endl
+            << "Multiply SIMD       [" << simdMultiplyTime.GetMilliseconds() << " ms]" << std::endl
+            << "Multiply D3DX       [" << dxMultiplyTime.GetMilliseconds() << " ms]" << std::endl
+            << "Invert SIMD         [" << simdInvertTime.GetMilliseconds() << " ms]" << std::endl
+            << "Invert D3DX         [" << dxInvertTime.GetMilliseconds() << " ms]" << std::endl << std::endl;
+
+  /*-------------------------------------------------------------------------------
+  Batch vs per element loop
+  -------------------------------------------------------------------------------*/
+  const U32 kElementCount = 1 << 20;
+  const U32 kBatchPassCount = 10;
+  Threads::ThreadPool* pPool = &Threads::Global::GetThreadPool();
+  Matrix4f transform = GetRandomTransform();
+  E::Containers::DynamicArray<Vector3f> points(kElementCount);
+  E::Containers::DynamicArray<Vector3f> transformedPoints(kElementCount);
+  E::Containers::DynamicArray<F32> x(kElementCount), y(kElementCount), z(kElementCount);
+  E::Containers::DynamicArray<F32> transformedX(kElementCount), transformedY(kElementCount);
+  E::Containers::DynamicArray<F32> transformedZ(kElementCount);
+  E::Containers::DynamicArray<Box3f> boxes(kElementCount);
+  E::Containers::DynamicArray<Box3f> transformedBoxes(kElementCount);
+  E::Containers::DynamicArray<Matrix4f> batchMatrices(kElementCount);
+  E::Containers::DynamicArray<Matrix4f> batchResults(kElementCount);
+  for (U32 i = 0; i < kElementCount; ++i)
+  {
+    points[i] = GetRandomPoint();
+    x[i] = points[i].x;
+    y[i] = points[i].y;
+    z[i] = points[i].z;
+    boxes[i] = Box3f(points[i], points[i] + Vector3f(1.0f, 1.0f, 1.0f));
+    batchMatrices[i] = GetRandomTransform();
+  }
+
+  std::cout << "Batch operations (" << kElementCount << " elements, " << kBatchPassCount << " times)" << std::endl;
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    for (U32 i = 0; i < kElementCount; ++i) transformedPoints[i] = Matrix4f::TransformPoint(transform, points[i]);
+  }
+  PrintBatchTimes("TransformPoints", t.GetElapsed(), 
+    BenchmarkBatch(kBatchPassCount, Math::Batch<F32>::TransformPoints, transformedPoints.GetPtr(), points.GetPtr(), 
+                   kElementCount, transform, nullptr), 
+    BenchmarkBatch(kBatchPassCount, Math::Batch<F32>::TransformPoints, transformedPoints.GetPtr(), points.GetPtr(), 
+                   kElementCount, transform, pPool));
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    for (U32 i = 0; i < kElementCount; ++i) 
+    {
+      Vector3f p = Matrix4f::TransformPoint(transform, Vector3f(x[i], y[i], z[i]));
+      transformedX[i] = p.x;
+      transformedY[i] = p.y;
+      transformedZ[i] = p.z;
+    }
+  }
+  TimeValue loopTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    Math::Batch<F32>::TransformPoints(transformedX.GetPtr(), transformedY.GetPtr(), transformedZ.GetPtr(), 
+                                      x.GetPtr(), y.GetPtr(), z.GetPtr(), kElementCount, transform);
+  }
+  TimeValue batchTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    Math::Batch<F32>::TransformPoints(transformedX.GetPtr(), transformedY.GetPtr(), transformedZ.GetPtr(), 
+                                      x.GetPtr(), y.GetPtr(), z.GetPtr(), kElementCount, transform, pPool);
+  }
+  PrintBatchTimes("TransformPoints SoA", loopTime, batchTime, t.GetElapsed());
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    for (U32 i = 0; i < kElementCount; ++i) transformedPoints[i] = Matrix4f::RotateVector(transform, points[i]);
+  }
+  PrintBatchTimes("RotateVectors", t.GetElapsed(), 
+    BenchmarkBatch(kBatchPassCount, Math::Batch<F32>::RotateVectors, transformedPoints.GetPtr(), points.GetPtr(), 
+                   kElementCount, transform, nullptr), 
+    BenchmarkBatch(kBatchPassCount, Math::Batch<F32>::RotateVectors, transformedPoints.GetPtr(), points.GetPtr(), 
+                   kElementCount, transform, pPool));
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    for (U32 i = 0; i < kElementCount; ++i) 
+    {
+      transformedBoxes[i] = boxes[i];
+      transformedBoxes[i].Transform(transform);
+    }
+  }
+  PrintBatchTimes("TransformBoxes", t.GetElapsed(), 
+    BenchmarkBatch(kBatchPassCount, Math::Batch<F32>::TransformBoxes, transformedBoxes.GetPtr(), boxes.GetPtr(), 
+                   kElementCount, transform, nullptr), 
+    BenchmarkBatch(kBatchPassCount, Math::Batch<F32>::TransformBoxes, transformedBoxes.GetPtr(), boxes.GetPtr(), 
+                   kElementCount, transform, pPool));
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    for (U32 i = 1; i < kElementCount; ++i) batchResults[i] = batchMatrices[i - 1] * batchMatrices[i];
+  }
+  loopTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    Math::Batch<F32>::Multiply(batchResults.GetPtr() + 1, batchMatrices.GetPtr(), batchMatrices.GetPtr() + 1, 
+                               kElementCount - 1);
+  }
+  batchTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kBatchPassCount; ++j)
+  {
+    Math::Batch<F32>::Multiply(batchResults.GetPtr() + 1, batchMatrices.GetPtr(), batchMatrices.GetPtr() + 1, 
+                               kElementCount - 1, pPool);
+  }
+  PrintBatchTimes("Multiply", loopTime, batchTime, t.GetElapsed());
+  std::cout << std::endl;
+
+  const U32 kCullCount = 100000;
+  const U32 kCullPassCount = 100;
+  Frustumf frustum(GetViewProjection());
+  E::Containers::DynamicArray<U32> visibilityMask(Frustumf::GetMaskWordCount(kCullCount));
+  E::Containers::DynamicArray<Spheref> spheres(kCullCount);
+  for (U32 i = 0; i < kCullCount; ++i)
+  {
+    spheres[i] = Spheref(points[i], Math::Global::GetRandom().GetF32(0.1f, 1.0f));
+    boxes[i] = Box3f(points[i], points[i] + Vector3f(1.0f, 1.0f, 1.0f));
+  }
+  std::cout << "Frustum culling (" << kCullCount << " objects, " << kCullPassCount << " times)" << std::endl;
+  size_t visibleCount = 0;
+  t.Reset();
+  for (U32 j = 0; j < kCullPassCount; ++j)
+  {
+    Memory::Zero(visibilityMask.GetPtr(), visibilityMask.GetSize());
+    for (U32 i = 0; i < kCullCount; ++i)
+    {
+      if (frustum.IsVisible(boxes[i])) visibilityMask[i / 32] |= 1u << (i % 32);
+    }
+  }
+  loopTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kCullPassCount; ++j)
+  {
+    visibleCount = frustum.Cull(visibilityMask.GetPtr(), boxes.GetPtr(), kCullCount);
+  }
+  batchTime = t.GetElapsed();
+  std::cout << "Box3 (" << visibleCount << " visible)" << std::endl
+            << "  Per element loop  [" << loopTime.GetMilliseconds() << " ms]" << std::endl
+            << "  Cull              [" << batchTime.GetMilliseconds() << " ms]" << std::endl;
+  t.Reset();
+  for (U32 j = 0; j < kCullPassCount; ++j)
+  {
+    Memory::Zero(visibilityMask.GetPtr(), visibilityMask.GetSize());
+    for (U32 i = 0; i < kCullCount; ++i)
+    {
+      if (frustum.IsVisible(spheres[i])) visibilityMask[i / 32] |= 1u << (i % 32);
+    }
+  }
+  loopTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kCullPassCount; ++j)
+  {
+    visibleCount = frustum.Cull(visibilityMask.GetPtr(), spheres.GetPtr(), kCullCount);
+  }
+  batchTime = t.GetElapsed();
+  std::cout << "Sphere (" << visibleCount << " visible)" << std::endl
+            << "  Per element loop  [" << loopTime.GetMilliseconds() << " ms]" << std::endl
+            << "  Cull              [" << batchTime.GetMilliseconds() << " ms]" << std::endl;
+  std::cout << std::endl;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+bool IsNear(const Matrix4f& a, const Matrix4d& b, F32 tolerance)
+{
+  for (U32 i = 0; i < 16; ++i)
+  {
+    F32 value = static_cast<F32>(b[i]);
+    if (Math::Abs(a[i] - value) > tolerance * (1.0f + Math::Abs(value))) return false;
+  }
   return true;
 }
+
+// Scalar version of Matrix4<T>::operator* (the F32 version uses SIMD)
+Matrix4f MultiplyScalar(const Matrix4f& a, const Matrix4f& b)
+{
+  Matrix4f result;
+  for (U32 row = 0; row < 4; ++row)
+  {
+    for (U32 col = 0; col < 4; ++col)
+    {
+      result(row, col) = a(row, 0) * b(0, col) + a(row, 1) * b(1, col) + a(row, 2) * b(2, col) + a(row, 3) * b(3, col);
+    }
+  }
+  return result;
+}
+
+Matrix4f GetRandomTransform()
+{
+  Matrix4f m;
+  m.SetRotation(Math::Rad(Math::Global::GetRandom().GetF32(-180.0f, 180.0f)), 
+                Math::Rad(Math::Global::GetRandom().GetF32(-180.0f, 180.0f)), 
+                Math::Rad(Math::Global::GetRandom().GetF32(-180.0f, 180.0f)));
+  m.Scale(Math::Global::GetRandom().GetF32(0.5f, 2.0f));
+  m.SetTranslation(Math::Global::GetRandom().GetF32(-10.0f, 10.0f), Math::Global::GetRandom().GetF32(-10.0f, 10.0f), 
+                   Math::Global::GetRandom().GetF32(-10.0f, 10.0f));
+  return m;
+}
+
+Matrix4d ToMatrix4d(const Matrix4f& m)
+{
+  Matrix4d result;
+  for (U32 i = 0; i < 16; ++i) result[i] = m[i];
+  return result;
+}
+
+Vector3f GetRandomPoint()
+{
+  return Vector3f(Math::Global::GetRandom().GetF32(-10.0f, 10.0f), Math::Global::GetRandom().GetF32(-10.0f, 10.0f), 
+                  Math::Global::GetRandom().GetF32(-10.0f, 10.0f));
+}
+
+// Batch results must be equal to the per element ones
+bool CheckBatch(U32 count, Threads::ThreadPool* pPool)
+{
+  Matrix4f transform = GetRandomTransform();
+  Matrix4f projection = transform;
+  projection[3] = 0.1f;
+  projection[11] = -0.2f;
+  E::Containers::DynamicArray<Vector3f> points(count + 1);
+  E::Containers::DynamicArray<Vector3f> results(count + 1);
+  E::Containers::DynamicArray<F32> x(count + 1), y(count + 1), z(count + 1);
+  E::Containers::DynamicArray<F32> resultsX(count + 1), resultsY(count + 1), resultsZ(count + 1);
+  E::Containers::DynamicArray<Box3f> boxes(count + 1);
+  E::Containers::DynamicArray<Box3f> resultBoxes(count + 1);
+  E::Containers::DynamicArray<Matrix4f> matrices(count + 1);
+  E::Containers::DynamicArray<Matrix4f> resultMatrices(count + 1);
+  for (U32 i = 0; i < count; ++i)
+  {
+    points[i] = GetRandomPoint();
+    x[i] = points[i].x;
+    y[i] = points[i].y;
+    z[i] = points[i].z;
+    // Every 8th box is left empty
+    if (i % 8 != 7) boxes[i] = Box3f(points[i], points[i] + Vector3f(1.0f, 2.0f, 3.0f));
+    matrices[i] = GetRandomTransform();
+  }
+
+  for (U32 pass = 0; pass < 2; ++pass)
+  {
+    const Matrix4f& m = (pass == 0) ? transform : projection;
+    Math::Batch<F32>::TransformPoints(results.GetPtr(), points.GetPtr(), count, m, pPool);
+    Math::Batch<F32>::TransformPoints(resultsX.GetPtr(), resultsY.GetPtr(), resultsZ.GetPtr(), x.GetPtr(), y.GetPtr(), 
+                                      z.GetPtr(), count, m, pPool);
+    for (U32 i = 0; i < count; ++i)
+    {
+      Vector3f p = Matrix4f::TransformPoint(m, points[i]);
+      if (results[i] != p || resultsX[i] != p.x || resultsY[i] != p.y || resultsZ[i] != p.z) return false;
+    }
+    Math::Batch<F32>::RotateVectors(results.GetPtr(), points.GetPtr(), count, m, pPool);
+    Math::Batch<F32>::RotateVectors(resultsX.GetPtr(), resultsY.GetPtr(), resultsZ.GetPtr(), x.GetPtr(), y.GetPtr(), 
+                                    z.GetPtr(), count, m, pPool);
+    for (U32 i = 0; i < count; ++i)
+    {
+      Vector3f v = Matrix4f::RotateVector(m, points[i]);
+      if (results[i] != v || resultsX[i] != v.x || resultsY[i] != v.y || resultsZ[i] != v.z) return false;
+    }
+  }
+  Math::Batch<F32>::TransformBoxes(resultBoxes.GetPtr(), boxes.GetPtr(), count, transform, pPool);
+  for (U32 i = 0; i < count; ++i)
+  {
+    Box3f box = boxes[i];
+    box.Transform(transform);
+    if (resultBoxes[i].IsEmpty() != box.IsEmpty()) return false;
+    if (resultBoxes[i].GetMin() != box.GetMin() || resultBoxes[i].GetMax() != box.GetMax()) return false;
+  }
+  Math::Batch<F32>::Multiply(resultMatrices.GetPtr(), matrices.GetPtr(), matrices.GetPtr() + 1, count, pPool);
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (resultMatrices[i] != matrices[i] * matrices[i + 1]) return false;
+  }
+  // In place
+  Math::Batch<F32>::TransformPoints(points.GetPtr(), points.GetPtr(), count, transform, pPool);
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (points[i] != Matrix4f::TransformPoint(transform, Vector3f(x[i], y[i], z[i]))) return false;
+  }
+  return true;
+}
+
+// Cull masks must match the per element visibility tests
+bool CheckFrustum(U32 count)
+{
+  Frustumf frustum(GetViewProjection());
+  E::Containers::DynamicArray<Box3f> boxes(count + 1);
+  E::Containers::DynamicArray<Spheref> spheres(count + 1);
+  E::Containers::DynamicArray<U32> visibilityMask(Frustumf::GetMaskWordCount(count) + 1);
+  for (U32 i = 0; i < count; ++i)
+  {
+    Vector3f point = GetRandomPoint();
+    F32 size = Math::Global::GetRandom().GetF32(0.0f, 2.0f);
+    // Every 8th bound is left empty
+    if (i % 8 == 7) continue;
+    boxes[i] = Box3f(point, point + Vector3f(size, 2.0f * size, 0.5f * size));
+    spheres[i] = Spheref(point, size);
+  }
+  const U32 kGuard = 0xDEADBEEF;
+  size_t visibleCount = 0;
+  visibilityMask[Frustumf::GetMaskWordCount(count)] = kGuard;
+  size_t cullCount = frustum.Cull(visibilityMask.GetPtr(), boxes.GetPtr(), count);
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (Frustumf::IsVisible(visibilityMask.GetPtr(), i) != frustum.IsVisible(boxes[i])) return false;
+    if (frustum.IsVisible(boxes[i])) ++visibleCount;
+  }
+  if (cullCount != visibleCount) return false;
+  for (U32 i = count; i < Frustumf::GetMaskWordCount(count) * 32; ++i)
+  {
+    if (Frustumf::IsVisible(visibilityMask.GetPtr(), i)) return false;
+  }
+  visibleCount = 0;
+  cullCount = frustum.Cull(visibilityMask.GetPtr(), spheres.GetPtr(), count);
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (Frustumf::IsVisible(visibilityMask.GetPtr(), i) != frustum.IsVisible(spheres[i])) return false;
+    if (frustum.IsVisible(spheres[i])) ++visibleCount;
+  }
+  return cullCount == visibleCount && visibilityMask[Frustumf::GetMaskWordCount(count)] == kGuard;
+}
+
+Matrix4f GetViewProjection()
+{
+  Matrix4f view;
+  view.SetTranslation(0.0f, 0.0f, 5.0f);
+  return view * Math::BuildPerspectiveLH(60, 1.5f, 1.0f, 12.0f);
+}
+
+void PrintBatchTimes(const char* operationName, TimeValue loopTime, TimeValue batchTime, TimeValue poolTime)
+{
+  std::cout << operationName << std::endl
+            << "  Per element loop  [" << loopTime.GetMilliseconds() << " ms]" << std::endl
+            << "  Batch             [" << batchTime.GetMilliseconds() << " ms]" << std::endl
+            << "  Batch ThreadPool  [" << poolTime.GetMilliseconds() << " ms]" << std::endl;
+}
+
+template <typename ResultType, typename SourceType>
+TimeValue BenchmarkBatch(U32 passCount, 
+                         void (*BatchFunction)(ResultType*, const SourceType*, size_t, const Matrix4f&, 
+                                               Threads::ThreadPool*), 
+                         ResultType* pResults, const SourceType* pSources, U32 count, const Matrix4f& m, 
+                         Threads::ThreadPool* pPool)
+{
+  E::Time::Timer t;
+  for (U32 j = 0; j < passCount; ++j) BatchFunction(pResults, pSources, count, m, pPool);
+  return t.GetElapsed();
+}
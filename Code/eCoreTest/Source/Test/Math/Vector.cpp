@@ -38,6 +38,10 @@ using namespace E;
 Auxiliary declarations
 ----------------------------------------------------------------------------------------------------------------------*/
 
+bool      CheckVector3Stream(U32 count);
+bool      CheckVector4Stream(U32 count);
+Vector3f  GetRandomVector3f();
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -406,9 +410,32 @@ bool Test::Vector::RunFunctionalityTest()
   }
   Vector4f v4fMin, v4fMax;
   Vector4f::MinMax(v4fMin, v4fMax, v4fList.GetPtr(), static_cast<U32>(v4fList.GetCount()));
+  for (U32 i = 0; i < v4fList.GetCount(); ++i)
+  {
+    const Vector4f& v = v4fList[i];
+    E_ASSERT(v4fMin.x <= v.x && v4fMin.y <= v.y && v4fMin.z <= v.z && v4fMin.w <= v.w);
+    E_ASSERT(v4fMax.x >= v.x && v4fMax.y >= v.y && v4fMax.z >= v.z && v4fMax.w >= v.w);
+  }
+  E_ASSERT(reinterpret_cast<size_t>(&v4fMin) % 16 == 0);
   ss << "Min: " << v4fMin.x << "," << v4fMin.y << "," << v4fMin.z << "," << v4fMin.w << " Max: " << v4fMax.x << "," << v4fMax.y << "," << v4fMax.z << "," << v4fMax.w;
   std::cout << ss.GetPtr() << std::endl;
 
+  /*-------------------------------------------------------------------------------
+  Vector3Stream / Vector4Stream
+  -------------------------------------------------------------------------------*/
+  const U32 kStreamSizes[] = { 1, 3, 4, 7, 8, 9, 100, 1001 };
+  for (U32 i = 0; i < sizeof(kStreamSizes) / sizeof(U32); ++i)
+  {
+    E_ASSERT(CheckVector3Stream(kStreamSizes[i]));
+    E_ASSERT(CheckVector4Stream(kStreamSizes[i]));
+  }
+  Vector3Streamf emptyStream;
+  E_ASSERT(emptyStream.IsEmpty() && emptyStream.GetSize() == 0);
+  emptyStream.Normalize();
+  emptyStream.Resize(5);
+  E_ASSERT(emptyStream.GetSize() == 5 && emptyStream.Get(4) == Vector3f(0.0f, 0.0f, 0.0f));
+  E_ASSERT(reinterpret_cast<size_t>(emptyStream.GetZ()) % 32 == 0);
+
   return true;
 }
 
@@ -416,5 +443,190 @@ bool Test::Vector::RunPerformanceTest()
 {
   std::cout << "[Test::Vector::RunPerformanceTest]" << std::endl;
 
+  /*-------------------------------------------------------------------------------
+  Vector3f array (AoS) vs Vector3Streamf (SoA)
+  -------------------------------------------------------------------------------*/
+  const U32 kVectorCount = 1 << 20;
+  const U32 kPassCount = 10;
+  E::Containers::DynamicArray<Vector3f> vectors(kVectorCount);
+  E::Containers::DynamicArray<Vector3f> otherVectors(kVectorCount);
+  E::Containers::DynamicArray<F32> results(kVectorCount);
+  for (U32 i = 0; i < kVectorCount; ++i)
+  {
+    vectors[i] = GetRandomVector3f();
+    otherVectors[i] = GetRandomVector3f();
+  }
+  Vector3Streamf stream(vectors.GetPtr(), kVectorCount);
+  Vector3Streamf otherStream(otherVectors.GetPtr(), kVectorCount);
+  Vector3f min, max;
+
+  E::Time::Timer t;
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 0; i < kVectorCount; ++i) results[i] = Vector3f::Dot(vectors[i], otherVectors[i]);
+  }
+  TimeValue arrayDotTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) Vector3Streamf::Dot(results.GetPtr(), stream, otherStream);
+  TimeValue streamDotTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 0; i < kVectorCount; ++i) results[i] = vectors[i].GetLength();
+  }
+  TimeValue arrayLengthTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) stream.GetLengths(results.GetPtr());
+  TimeValue streamLengthTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) Vector3f::MinMax(min, max, vectors.GetPtr(), kVectorCount);
+  TimeValue arrayMinMaxTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) stream.MinMax(min, max);
+  TimeValue streamMinMaxTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 0; i < kVectorCount; ++i) otherVectors[i] = Vector3f::Cross(vectors[i], otherVectors[i]);
+  }
+  TimeValue arrayCrossTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) Vector3Streamf::Cross(otherStream, stream, otherStream);
+  TimeValue streamCrossTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j)
+  {
+    for (U32 i = 0; i < kVectorCount; ++i) vectors[i].Normalize();
+  }
+  TimeValue arrayNormalizeTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) stream.Normalize();
+  TimeValue streamNormalizeTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) stream.Copy(vectors.GetPtr(), kVectorCount);
+  TimeValue copyTime = t.GetElapsed();
+  t.Reset();
+  for (U32 j = 0; j < kPassCount; ++j) stream.CopyTo(vectors.GetPtr());
+  TimeValue copyToTime = t.GetElapsed();
+
+  std::cout << std::endl << "Vector3f operations (" << kVectorCount * kPassCount << " times)" << std::endl
+            << "Dot array           [" << arrayDotTime.GetMilliseconds() << " ms]" << std::endl
+            << "Dot stream          [" << streamDotTime.GetMilliseconds() << " ms]" << std::endl
+            << "Length array        [" << arrayLengthTime.GetMilliseconds() << " ms]" << std::endl
+            << "Length stream       [" << streamLengthTime.GetMilliseconds() << " ms]" << std::endl
+            << "MinMax array        [" << arrayMinMaxTime.GetMilliseconds() << " ms]" << std::endl
+            << "MinMax stream       [" << streamMinMaxTime.GetMilliseconds() << " ms]" << std::endl
+            << "Cross array         [" << arrayCrossTime.GetMilliseconds() << " ms]" << std::endl
+            << "Cross stream        [" << streamCrossTime.GetMilliseconds() << " ms]" << std::endl
+            << "Normalize array     [" << arrayNormalizeTime.GetMilliseconds() << " ms]" << std::endl
+            << "Normalize stream    [" << streamNormalizeTime.GetMilliseconds() << " ms]" << std::endl
+            << "Copy to stream      [" << copyTime.GetMilliseconds() << " ms]" << std::endl
+            << "Copy from stream    [" << copyToTime.GetMilliseconds() << " ms]" << std::endl << std::endl;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+Auxiliary functions
+----------------------------------------------------------------------------------------------------------------------*/
+
+Vector3f GetRandomVector3f()
+{
+  return Vector3f(Math::Global::GetRandom().GetF32(-10.0f, 10.0f), Math::Global::GetRandom().GetF32(-10.0f, 10.0f), 
+                  Math::Global::GetRandom().GetF32(-10.0f, 10.0f));
+}
+
+// Stream kernels must give the same results as the per element Vector3 methods
+bool CheckVector3Stream(U32 count)
+{
+  E::Containers::DynamicArray<Vector3f> a(count);
+  E::Containers::DynamicArray<Vector3f> b(count);
+  E::Containers::DynamicArray<Vector3f> copy(count);
+  E::Containers::DynamicArray<F32> results(count);
+  for (U32 i = 0; i < count; ++i)
+  {
+    a[i] = GetRandomVector3f();
+    b[i] = GetRandomVector3f();
+  }
+  Vector3Streamf streamA(a.GetPtr(), count);
+  Vector3Streamf streamB(b.GetPtr(), count);
+  streamA.CopyTo(copy.GetPtr());
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (copy[i].x != a[i].x || copy[i].y != a[i].y || copy[i].z != a[i].z) return false;
+  }
+  Vector3Streamf::Dot(results.GetPtr(), streamA, streamB);
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (results[i] != Vector3f::Dot(a[i], b[i])) return false;
+  }
+  streamA.GetLengths(results.GetPtr());
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (results[i] != a[i].GetLength()) return false;
+  }
+  Vector3Streamf cross;
+  Vector3Streamf::Cross(cross, streamA, streamB);
+  for (U32 i = 0; i < count; ++i)
+  {
+    Vector3f expected = Vector3f::Cross(a[i], b[i]);
+    Vector3f v = cross.Get(i);
+    if (v.x != expected.x || v.y != expected.y || v.z != expected.z) return false;
+  }
+  Vector3f min, max, expectedMin, expectedMax;
+  streamA.MinMax(min, max);
+  Vector3f::MinMax(expectedMin, expectedMax, a.GetPtr(), count);
+  if (min.x != expectedMin.x || min.y != expectedMin.y || min.z != expectedMin.z) return false;
+  if (max.x != expectedMax.x || max.y != expectedMax.y || max.z != expectedMax.z) return false;
+  streamA.Normalize();
+  for (U32 i = 0; i < count; ++i)
+  {
+    Vector3f expected = a[i];
+    expected.Normalize();
+    Vector3f v = streamA.Get(i);
+    if (v.x != expected.x || v.y != expected.y || v.z != expected.z) return false;
+  }
+  return true;
+}
+
+bool CheckVector4Stream(U32 count)
+{
+  E::Containers::DynamicArray<Vector4f> a(count);
+  E::Containers::DynamicArray<Vector4f> b(count);
+  E::Containers::DynamicArray<Vector4f> copy(count);
+  E::Containers::DynamicArray<F32> results(count);
+  for (U32 i = 0; i < count; ++i)
+  {
+    Vector3f v = GetRandomVector3f();
+    a[i] = Vector4f(v.x, v.y, v.z, Math::Global::GetRandom().GetF32(-10.0f, 10.0f));
+    v = GetRandomVector3f();
+    b[i] = Vector4f(v.x, v.y, v.z, Math::Global::GetRandom().GetF32(-10.0f, 10.0f));
+  }
+  Vector4Streamf streamA(a.GetPtr(), count);
+  Vector4Streamf streamB(b.GetPtr(), count);
+  streamA.CopyTo(copy.GetPtr());
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (copy[i].x != a[i].x || copy[i].y != a[i].y || copy[i].z != a[i].z || copy[i].w != a[i].w) return false;
+  }
+  // Vector4f uses a SIMD horizontal sum, which may differ in the last bits
+  Vector4Streamf::Dot(results.GetPtr(), streamA, streamB);
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (!Math::IsEqual(results[i], Vector4f::Dot(a[i], b[i]), 1e-3f)) return false;
+  }
+  Vector4f min, max, expectedMin, expectedMax;
+  streamA.MinMax(min, max);
+  Vector4f::MinMax(expectedMin, expectedMax, a.GetPtr(), count);
+  for (U32 i = 0; i < 4; ++i)
+  {
+    if (min[i] != expectedMin[i] || max[i] != expectedMax[i]) return false;
+  }
+  streamA.Normalize();
+  streamA.GetLengths(results.GetPtr());
+  for (U32 i = 0; i < count; ++i)
+  {
+    if (!Math::IsEqual(results[i], 1.0f)) return false;
+  }
   return true;
 }
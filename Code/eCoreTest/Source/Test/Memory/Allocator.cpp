@@ -76,6 +76,46 @@ private:
 
 typedef E::Singleton<MyAllocator> GMyAllocator;
 
+// Allocates and deallocates blocks of several sizes from a thread
+struct AllocatorUser : public E::Threads::IRunnable
+{
+  AllocatorUser() : pAllocator(nullptr), iterationCount(0) {}
+
+  I32 Run()
+  {
+    const size_t kSizes[] = { 8, 24, 64, 100, 256, 1000 };
+    void* pBlocks[E_ELEMENT_COUNT(kSizes)];
+    for (U32 i = 0; i < iterationCount; ++i)
+    {
+      for (U32 j = 0; j < E_ELEMENT_COUNT(kSizes); ++j) pBlocks[j] = pAllocator->Allocate(kSizes[j]);
+      for (U32 j = 0; j < E_ELEMENT_COUNT(kSizes); ++j) pAllocator->Deallocate(pBlocks[j]);
+    }
+    return 0;
+  }
+
+  E::Memory::IAllocator*  pAllocator;
+  U32                     iterationCount;
+};
+
+TimeValue RunAllocatorUsers(E::Memory::IAllocator* pAllocator, U32 threadCount, U32 iterationCount)
+{
+  E::Containers::List<AllocatorUser> userList(threadCount, AllocatorUser());
+  E::Containers::List<E::Threads::Thread*> threadList;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    userList[i].pAllocator = pAllocator;
+    userList[i].iterationCount = iterationCount;
+    threadList.PushBack(new E::Threads::Thread(userList[i]));
+  }
+
+  E::Time::Timer t;
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  TimeValue elapsed = t.GetElapsed();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+  return elapsed;
+}
+
 
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
@@ -130,6 +170,139 @@ bool Test::Allocator::RunFunctionalityTest()
     }
     std::cout << "MyAllocator allocations: " << GMyAllocator::GetInstance().GetAllocationCount() << std::endl;
     E::Memory::Global::SetDefaultAllocator();
+
+    /*-----------------------------------------------------------------
+    LinearAllocator
+    -----------------------------------------------------------------*/
+    {
+      E::Memory::LinearAllocator linearAllocator(4096);
+      U8* p1 = static_cast<U8*>(linearAllocator.Allocate(10));
+      U8* p2 = static_cast<U8*>(linearAllocator.Allocate(20));
+      E_ASSERT(reinterpret_cast<size_t>(p1) % 16 == 0 && p2 == p1 + 16);
+      E_ASSERT(linearAllocator.GetUsedSize() == 48 && linearAllocator.GetOverflowCount() == 0);
+      // Overflow goes to the parent allocator
+      void* p3 = linearAllocator.Allocate(8192);
+      E_ASSERT(linearAllocator.GetOverflowCount() == 1 && reinterpret_cast<size_t>(p3) % 16 == 0);
+      linearAllocator.Deallocate(p3);
+      linearAllocator.Reset();
+      E_ASSERT(linearAllocator.Allocate(10) == p1 && linearAllocator.GetUsedSize() == 16);
+
+      // Per frame container
+      linearAllocator.Reset();
+      E::Containers::List<U32> list;
+      list.SetAllocator(&linearAllocator);
+      for (U32 i = 0; i < 64; ++i) list.PushBack(i);
+      E_ASSERT(list.GetAllocator() == &linearAllocator && linearAllocator.GetOverflowCount() == 0);
+    }
+
+    /*-----------------------------------------------------------------
+    PoolAllocator
+    -----------------------------------------------------------------*/
+    {
+      E::Memory::PoolAllocator poolAllocator(20, 4);
+      E_ASSERT(poolAllocator.GetBlockSize() == 32 && poolAllocator.GetPageCount() == 0);
+      void* pBlocks[6];
+      for (U32 i = 0; i < 6; ++i) pBlocks[i] = poolAllocator.Allocate(20);
+      E_ASSERT(poolAllocator.GetPageCount() == 2 && poolAllocator.GetFreeBlockCount() == 2);
+      for (U32 i = 0; i < 6; ++i) poolAllocator.Deallocate(pBlocks[i]);
+      E_ASSERT(poolAllocator.GetFreeBlockCount() == 8);
+      // Steady state: no more pages
+      for (U32 i = 0; i < 6; ++i) pBlocks[i] = poolAllocator.Allocate(20);
+      for (U32 i = 0; i < 6; ++i) poolAllocator.Deallocate(pBlocks[i]);
+      E_ASSERT(poolAllocator.GetPageCount() == 2);
+      // Oversized allocations are rejected without growing the pool
+      E_ASSERT(poolAllocator.Allocate(33) == nullptr && poolAllocator.GetPageCount() == 2);
+    }
+
+    /*-----------------------------------------------------------------
+    CachedAllocator
+    -----------------------------------------------------------------*/
+    {
+      MyAllocator countingAllocator;
+      E::Memory::CachedAllocator cachedAllocator;
+      cachedAllocator.SetParentAllocator(&countingAllocator);
+      E::Containers::Map<U32, U32> map;
+      map.SetAllocator(&cachedAllocator);
+      for (U32 i = 0; i < 100; ++i) map.Insert(i, i);
+      map.Clear();
+      map.Resize(0);
+      // Steady state: the second round does not reach the parent allocator
+      U32 allocationCount = countingAllocator.GetAllocationCount();
+      for (U32 i = 0; i < 100; ++i) map.Insert(i, i);
+      map.Resize(0);
+      E_ASSERT(countingAllocator.GetAllocationCount() == allocationCount);
+
+      // Big allocations
+      void* p = cachedAllocator.Allocate(10000);
+      E_ASSERT(countingAllocator.GetAllocationCount() == allocationCount + 1);
+      cachedAllocator.Deallocate(p);
+
+      // Multiple threads
+      RunAllocatorUsers(&cachedAllocator, 4, 10000);
+      cachedAllocator.Flush();
+    }
+
+    /*-----------------------------------------------------------------
+    SlabPool
+    -----------------------------------------------------------------*/
+    {
+      E::Memory::SlabPool slabPool(20, 64);
+      E_ASSERT(slabPool.GetBlockSize() == 32 && slabPool.GetSlabCount() == 0);
+      void* pBlocks[100];
+      for (U32 i = 0; i < 100; ++i) pBlocks[i] = slabPool.Allocate(20);
+      E_ASSERT(slabPool.GetSlabCount() == 2 && slabPool.GetAllocatedCount() == 100);
+      // Blocks are 16 byte aligned and enumerable
+      E_ASSERT((reinterpret_cast<size_t>(pBlocks[0]) & 15) == 0 && slabPool.GetBlockCount() == 128);
+      for (U32 i = 0; i < 100; ++i) slabPool.Deallocate(pBlocks[i]);
+      E_ASSERT(slabPool.GetAllocatedCount() == 0);
+      // Steady state: no more slabs
+      for (U32 i = 0; i < 100; ++i) pBlocks[i] = slabPool.Allocate(20);
+      for (U32 i = 0; i < 100; ++i) slabPool.Deallocate(pBlocks[i]);
+      slabPool.Flush();
+      E_ASSERT(slabPool.GetSlabCount() == 2);
+
+      // Multiple threads
+      E::Memory::SlabPool threadSlabPool(1000);
+      RunAllocatorUsers(&threadSlabPool, 4, 10000);
+      E_ASSERT(threadSlabPool.GetAllocatedCount() == 0);
+    }
+
+    /*-----------------------------------------------------------------
+    TrackingAllocator
+    -----------------------------------------------------------------*/
+    {
+      E::Memory::TrackingAllocator trackingAllocator;
+      E::Memory::AllocationSnapshot snapshot1, snapshot2;
+      trackingAllocator.GetSnapshot(snapshot1);
+      {
+        E::Containers::List<U32> list;
+        list.SetAllocator(&trackingAllocator);
+        for (U32 i = 0; i < 1000; ++i) list.PushBack(i);
+        trackingAllocator.GetSnapshot(snapshot2);
+        const E::Memory::AllocationStats& stats = snapshot2.GetStats(Memory::IAllocator::eTagArrayNew);
+        E_ASSERT(stats.allocationCount > 0 && stats.allocationCount == stats.deallocationCount + 1);
+        E_ASSERT(stats.liveBytes == static_cast<I64>(list.GetSize() * sizeof(U32)));
+        E_ASSERT(stats.peakBytes >= stats.liveBytes);
+      }
+      // Deallocations are recorded under the allocation tag
+      void* p = trackingAllocator.Allocate(100, Memory::IAllocator::eTagNew);
+      trackingAllocator.Deallocate(p, Memory::IAllocator::eTagDelete);
+
+      // Multiple threads
+      RunAllocatorUsers(&trackingAllocator, 4, 10000);
+      E::Memory::AllocationSnapshot snapshot3;
+      trackingAllocator.GetSnapshot(snapshot3);
+      E::Memory::AllocationSnapshot diff = snapshot3.Diff(snapshot1);
+      E::Memory::AllocationStats total = diff.GetTotalStats();
+      E_ASSERT(total.liveBytes == 0 && total.allocationCount == total.deallocationCount);
+      E_ASSERT(diff.GetStats(Memory::IAllocator::eTagNew).allocationCount == 4 * 10000 * 6 + 1);
+      std::cout << "TrackingAllocator allocations: " << total.allocationCount << " (" 
+        << diff.GetAllocationRate(Memory::IAllocator::eTagNew) << " per second)" << std::endl;
+
+      // Export
+      E::Serialization::XmlSerializer xmlSerializer;
+      E_SERIALIZE(xmlSerializer, diff, snapshot);
+    }
   }
   catch (const E::Exception& e)
   {
@@ -145,5 +318,57 @@ bool Test::Allocator::RunPerformanceTest()
 {
   std::cout << "[Test::Allocator::RunPerformanceTest]" << std::endl;
 
+  try
+  {
+    const U32 kIterationCount = 100000;
+    const U32 kThreadCounts[] = { 1, 2, 4, 8 };
+
+    E::Memory::CachedAllocator cachedAllocator;
+    for (U32 i = 0; i < E_ELEMENT_COUNT(kThreadCounts); ++i)
+    {
+      U32 n = kThreadCounts[i];
+      D64 defaultTime = RunAllocatorUsers(E::Memory::Global::GetAllocator(), n, kIterationCount).GetMilliseconds();
+      D64 cachedTime = RunAllocatorUsers(&cachedAllocator, n, kIterationCount).GetMilliseconds();
+      std::cout << n << " threads  Default: " << defaultTime << " ms\tCached: " << cachedTime << " ms" << std::endl;
+    }
+
+    // Tracking overhead
+    E::Memory::TrackingAllocator trackingAllocator;
+    for (U32 i = 0; i < E_ELEMENT_COUNT(kThreadCounts); ++i)
+    {
+      U32 n = kThreadCounts[i];
+      D64 defaultTime = RunAllocatorUsers(E::Memory::Global::GetAllocator(), n, kIterationCount).GetMilliseconds();
+      D64 trackingTime = RunAllocatorUsers(&trackingAllocator, n, kIterationCount).GetMilliseconds();
+      std::cout << n << " threads  Default: " << defaultTime << " ms\tTracking: " << trackingTime << " ms" << std::endl;
+    }
+
+    // Frame simulation: container allocations per frame
+    const U32 kFrameCount = 1000;
+    E::Memory::LinearAllocator linearAllocator(1 << 20);
+    E::Time::Timer t;
+    for (U32 frame = 0; frame < kFrameCount; ++frame)
+    {
+      E::Containers::List<U32> list;
+      for (U32 i = 0; i < 1000; ++i) list.PushBack(i);
+    }
+    D64 defaultTime = t.GetElapsed().GetMilliseconds();
+    t.Reset();
+    for (U32 frame = 0; frame < kFrameCount; ++frame)
+    {
+      {
+        E::Containers::List<U32> list;
+        list.SetAllocator(&linearAllocator);
+        for (U32 i = 0; i < 1000; ++i) list.PushBack(i);
+      }
+      linearAllocator.Reset();
+    }
+    D64 linearTime = t.GetElapsed().GetMilliseconds();
+    std::cout << "Frames: " << kFrameCount << "  Default: " << defaultTime << " ms\tLinear: " << linearTime << " ms" << std::endl;
+  }
+  catch (...)
+  {
+    return false;
+  }
+
   return true;
 }
@@ -88,31 +88,37 @@ typedef IFooFactory::Ref                IFooInstance;
 typedef Memory::GCWeakPtr<FooA>             FooAInstance;
 typedef Memory::GCWeakPtr<FooB>             FooBInstance;
 typedef Memory::GCThisPtr<FooA>       FooAOwner;
+typedef Memory::GCGenericFactory<IFoo, U32, Memory::eGCFactoryModePooled>  PooledIFooFactory;
+typedef Memory::GCConcreteFactory<FooA, Memory::eGCFactoryModePooled>      PooledFooAFactory;
 
-class IFooFactoryRegistrar
+template <class FactoryType>
+class FooFactoryRegistrar
 {
 public:
-  IFooFactoryRegistrar(IFooFactory& factory)
+  FooFactoryRegistrar(FactoryType& factory)
     : mFactory(factory)
   {
     mFactory.Register(&mAFactory, IFoo::eA);
     mFactory.Register(&mBFactory, IFoo::eB);
   }
 
-  ~IFooFactoryRegistrar()
+  ~FooFactoryRegistrar()
   {
     mFactory.Unregister(&mBFactory);
     mFactory.Unregister(&mAFactory);
   }
 
 private:
-  IFooFactory&							          mFactory;
+  FactoryType&							          mFactory;
   Memory::AbstractFactory<IFoo, FooA>	mAFactory;
   Memory::AbstractFactory<IFoo, FooB>	mBFactory;
 
-  E_DISABLE_COPY_AND_ASSSIGNMENT(IFooFactoryRegistrar);
+  E_DISABLE_COPY_AND_ASSSIGNMENT(FooFactoryRegistrar);
 };
 
+typedef FooFactoryRegistrar<IFooFactory>       IFooFactoryRegistrar;
+typedef FooFactoryRegistrar<PooledIFooFactory> PooledIFooFactoryRegistrar;
+
 struct FooTask : public E::Threads::IRunnable
 {
   FooTask(const IFooInstance& foo)
@@ -135,6 +141,136 @@ struct FooTask : public E::Threads::IRunnable
   IFooInstance foo;
 };
 
+// Creates objects and keeps a few of them alive for a while so that collection happens out of creation order
+template <class FactoryType>
+struct FooUser : public E::Threads::IRunnable
+{
+  FooUser() : pFactory(nullptr), objectCount(0) {}
+
+  I32 Run()
+  {
+    const U32 kKeptCount = 16;
+    typename FactoryType::Ref keptFoos[kKeptCount];
+    for (U32 i = 0; i < objectCount; ++i)
+    {
+      typename FactoryType::Ref foo = pFactory->Create();
+      keptFoos[i % kKeptCount] = foo;
+    }
+    return 0;
+  }
+
+  FactoryType*  pFactory;
+  U32           objectCount;
+};
+
+// Releases a range of references so that collection races with the factory CleanUp
+template <class FactoryType>
+struct FooReleaser : public E::Threads::IRunnable
+{
+  FooReleaser() : pRefList(nullptr), first(0), count(0) {}
+
+  I32 Run()
+  {
+    for (U32 i = first; i < first + count; ++i) (*pRefList)[i].Reset();
+    return 0;
+  }
+
+  E::Containers::List<typename FactoryType::Ref>* pRefList;
+  U32                                             first;
+  U32                                             count;
+};
+
+// Collects garbage from a ThreadPool task so that destruction does not land on the frame thread
+template <class FactoryType>
+struct GarbageCollectionTask : public E::Threads::IRunnable
+{
+  GarbageCollectionTask() : pFactory(nullptr), budget(0), destroyedCount(0) {}
+
+  I32 Run()
+  {
+    destroyedCount += pFactory->CollectGarbage(budget);
+    return 0;
+  }
+
+  FactoryType*  pFactory;
+  size_t        budget;
+  size_t        destroyedCount;
+};
+
+// Object with a non trivial destruction cost
+struct HeavyFoo
+{
+  HeavyFoo() : data(1024, 0) {}
+
+  E::Containers::List<U32> data;
+};
+
+typedef Memory::GCConcreteFactory<HeavyFoo> HeavyFooFactory;
+
+// Simulates frames where a scene releases most of its resources at once. Returns the worst frame time.
+TimeValue RunFrames(HeavyFooFactory& factory, U32 frameCount, U32 objectCount, size_t budget)
+{
+  E::Containers::List<HeavyFooFactory::Ref> objects;
+  TimeValue maxFrameTime;
+  for (U32 frame = 0; frame < frameCount; ++frame)
+  {
+    E::Time::Timer t;
+    if (frame % 10 == 0) objects.Clear();
+    for (U32 i = 0; i < objectCount / 10; ++i) objects.PushBack(factory.Create());
+    // End of frame safe point
+    factory.AdvanceEpoch();
+    factory.CollectGarbage(budget);
+    TimeValue frameTime = t.GetElapsed();
+    if (maxFrameTime < frameTime) maxFrameTime = frameTime;
+  }
+  objects.Clear();
+  factory.CleanUp();
+  return maxFrameTime;
+}
+
+template <class FactoryType>
+TimeValue RunFooUsers(FactoryType& factory, U32 threadCount, U32 objectCount)
+{
+  E::Containers::List<FooUser<FactoryType>> userList(threadCount, FooUser<FactoryType>());
+  E::Containers::List<E::Threads::Thread*> threadList;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    userList[i].pFactory = &factory;
+    userList[i].objectCount = objectCount / threadCount;
+    threadList.PushBack(new E::Threads::Thread(userList[i]));
+  }
+
+  E::Time::Timer t;
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  TimeValue elapsed = t.GetElapsed();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+  return elapsed;
+}
+
+// Releases objectCount references (made by create) from threadCount threads while the factory is cleaned up
+template <class FactoryType, typename Function>
+void RunCleanUpRace(FactoryType& factory, Function create, U32 threadCount, U32 objectCount)
+{
+  E::Containers::List<typename FactoryType::Ref> refList;
+  for (U32 i = 0; i < objectCount; ++i) refList.PushBack(create());
+
+  E::Containers::List<FooReleaser<FactoryType>> releaserList(threadCount, FooReleaser<FactoryType>());
+  E::Containers::List<E::Threads::Thread*> threadList;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    releaserList[i].pRefList = &refList;
+    releaserList[i].first = i * (objectCount / threadCount);
+    releaserList[i].count = objectCount / threadCount;
+    threadList.PushBack(new E::Threads::Thread(releaserList[i]));
+  }
+
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  factory.CleanUp();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -261,6 +397,121 @@ bool Test::GarbageCollection::RunFunctionalityTest()
     E_ASSERT(fooFactory.GetLiveCount() == 0);
   }
 
+  // GCConcreteFactory (deferred collection)
+  {
+    FooAFactory fooAFactory;
+    fooAFactory.SetCollectionMode(Memory::eGCCollectionModeDeferred);
+    IFooInstance foo = fooAFactory.Create();
+    for (U32 i = 0; i < 100; ++i) fooAFactory.Create();
+    E_ASSERT(fooAFactory.GetLiveCount() == 1 && fooAFactory.GetPendingCount() == 100);
+
+    // Objects collected in the current epoch are kept
+    E_ASSERT(fooAFactory.CollectGarbage() == 0);
+    fooAFactory.AdvanceEpoch();
+    foo.Reset();
+    E_ASSERT(fooAFactory.CollectGarbage(40) == 40 && fooAFactory.GetPendingCount() == 61);
+    E_ASSERT(fooAFactory.CollectGarbage() == 60 && fooAFactory.GetPendingCount() == 1);
+
+    // Collection from a ThreadPool task
+    for (U32 i = 0; i < 100; ++i) fooAFactory.Create();
+    fooAFactory.AdvanceEpoch();
+    {
+      E::Threads::ThreadPool pool;
+      GarbageCollectionTask<FooAFactory> task;
+      task.pFactory = &fooAFactory;
+      task.budget = 50;
+      pool.AddItem(&task);
+      pool.WaitForIdle();
+      E_ASSERT(task.destroyedCount == 50);
+    }
+
+    // CleanUp destroys every pending object
+    fooAFactory.CleanUp();
+    E_ASSERT(fooAFactory.GetLiveCount() == 0 && fooAFactory.GetPendingCount() == 0);
+  }
+
+  // GCGenericFactory (deferred collection)
+  {
+    IFooFactory fooFactory;
+    IFooFactoryRegistrar fooRegistrar(fooFactory);
+    fooFactory.SetCollectionMode(Memory::eGCCollectionModeDeferred);
+    {
+      IFooInstance foo = fooFactory.Create(IFoo::eA);
+      foo = fooFactory.Create(IFoo::eB);
+      E_ASSERT(fooFactory.GetLiveCount() == 1 && fooFactory.GetPendingCount() == 1);
+    }
+    fooFactory.AdvanceEpoch();
+    E_ASSERT(fooFactory.CollectGarbage() == 2 && fooFactory.GetPendingCount() == 0);
+  }
+
+  // GCConcreteFactory (pooled)
+  {
+    PooledFooAFactory fooAFactory;
+    IFooInstance foo = fooAFactory.Create();
+    foo->Print();
+    E_ASSERT(fooAFactory.GetLiveCount() == 1);
+
+    // Collected slots are reused
+    {
+      FooAInstance aFoo = fooAFactory.Create();
+      FooA* pFooA = aFoo.GetPtr();
+      aFoo.Reset();
+      aFoo = fooAFactory.Create();
+      E_ASSERT(aFoo.GetPtr() == pFooA && fooAFactory.GetLiveCount() == 2);
+    }
+    E_ASSERT(fooAFactory.GetLiveCount() == 1);
+
+    // Detached references
+    fooAFactory.CleanUp();
+    E_ASSERT(foo == nullptr && fooAFactory.GetLiveCount() == 0);
+    IFooInstance anotherFoo = foo;
+    E_ASSERT(anotherFoo == foo);
+    foo.Reset();
+    anotherFoo.Reset();
+
+    // Objects collected from another thread
+    RunFooUsers(fooAFactory, 4, 10000);
+    E_ASSERT(fooAFactory.GetLiveCount() == 0);
+
+    // CleanUp racing with released references destroys and recycles each slot once
+    for (U32 i = 0; i < 16; ++i)
+    {
+      RunCleanUpRace(fooAFactory, [&]() { return fooAFactory.Create(); }, 4, 4000);
+      E_ASSERT(fooAFactory.GetLiveCount() == 0);
+    }
+  }
+
+  // GCGenericFactory (pooled)
+  {
+    PooledIFooFactory fooFactory;
+    PooledIFooFactoryRegistrar fooRegistrar(fooFactory);
+    IFooInstance foo = fooFactory.Create(IFoo::eA);
+
+    foo->Print();
+    fooFactory.CleanUp();
+    E_ASSERT(foo == nullptr);
+    foo.Reset();
+
+    {
+      IFooInstance foo = fooFactory.Create(IFoo::eA);
+      FooAInstance aFoo = foo;
+      foo.Reset();
+      aFoo->Print();
+      foo = fooFactory.Create(IFoo::eB);
+      FooBInstance bFoo = foo;
+      bFoo->Print();
+      E_ASSERT(fooFactory.GetLiveCount() == 2);
+    }
+    E_ASSERT(fooFactory.GetLiveCount() == 0);
+
+    // CleanUp racing with released references destroys and recycles each slot once
+    for (U32 i = 0; i < 16; ++i)
+    {
+      RunCleanUpRace(fooFactory, [&]() { return fooFactory.Create(i % 2 ? IFoo::eA : IFoo::eB); }, 4, 4000);
+      E_ASSERT(fooFactory.GetLiveCount() == 0);
+    }
+  }
+
   return true;
 }
 
@@ -309,5 +560,35 @@ bool Test::GarbageCollection::RunPerformanceTest()
     for (auto it = begin(fooTaskList); it != end(fooTaskList); ++it) delete *it;
   }
 
+  // Locked vs pooled creation and collection
+  {
+    const U32 kObjectCount = 2000000;
+    const U32 kThreadCounts[] = { 1, 2, 4, 8 };
+    FooAFactory lockedFactory;
+    PooledFooAFactory pooledFactory;
+    std::cout << "Objects: " << kObjectCount << std::endl;
+    for (U32 t = 0; t < E_ELEMENT_COUNT(kThreadCounts); ++t)
+    {
+      D64 lockedTime = RunFooUsers(lockedFactory, kThreadCounts[t], kObjectCount).GetMilliseconds();
+      D64 pooledTime = RunFooUsers(pooledFactory, kThreadCounts[t], kObjectCount).GetMilliseconds();
+      std::cout << kThreadCounts[t] << " threads\tLocked: " << lockedTime << " ms (" << kObjectCount / lockedTime / 1000.0 
+        << " Mobjects/s)\tPooled: " << pooledTime << " ms (" << kObjectCount / pooledTime / 1000.0 << " Mobjects/s)" << std::endl;
+    }
+    E_ASSERT(lockedFactory.GetLiveCount() == 0 && pooledFactory.GetLiveCount() == 0);
+  }
+
+  // Immediate vs deferred collection worst frame time
+  {
+    const U32 kFrameCount = 100;
+    const U32 kObjectCount = 20000;
+    const size_t kBudget = kObjectCount / 10;
+    HeavyFooFactory immediateFactory, deferredFactory;
+    deferredFactory.SetCollectionMode(Memory::eGCCollectionModeDeferred);
+    D64 immediateTime = RunFrames(immediateFactory, kFrameCount, kObjectCount, kBudget).GetMilliseconds();
+    D64 deferredTime = RunFrames(deferredFactory, kFrameCount, kObjectCount, kBudget).GetMilliseconds();
+    std::cout << "Worst frame (" << kObjectCount << " objects, budget " << kBudget << ")\tImmediate: " << immediateTime 
+      << " ms\tDeferred: " << deferredTime << " ms" << std::endl;
+  }
+
   return true;
 }
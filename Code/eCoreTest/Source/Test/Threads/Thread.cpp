@@ -57,6 +57,240 @@ struct Task : public E::Threads::IRunnable
 
 };
 
+struct CounterTask : public E::Threads::IRunnable
+{
+  CounterTask() : pCounter(nullptr), workCount(0), result(0) {}
+
+  I32 Run()
+  {
+    // Small amount of busy work to emulate a fine grained job
+    for (U32 i = 0; i < workCount; ++i) result = result * 1664525 + 1013904223;
+    ++(*pCounter);
+    return 0;
+  }
+
+  E::A32* pCounter;
+  U32     workCount;
+  U32     result;
+};
+
+struct SpawnTask : public E::Threads::IRunnable
+{
+  SpawnTask() : pScheduler(nullptr), pChildren(nullptr), childCount(0) {}
+
+  I32 Run()
+  {
+    // Items added from a worker thread go to the worker local queue and get stolen by idle workers
+    for (U32 i = 0; i < childCount; ++i) pScheduler->AddItem(&pChildren[i]);
+    return 0;
+  }
+
+  E::Threads::TaskScheduler*  pScheduler;
+  CounterTask*                pChildren;
+  U32                         childCount;
+};
+
+// Adds its children from the running worker, as items spawning items do (ThreadPool or TaskScheduler)
+template <typename PoolType>
+struct FanOutTask : public E::Threads::IRunnable
+{
+  FanOutTask() : pPool(nullptr), pChildren(nullptr), childCount(0) {}
+
+  I32 Run()
+  {
+    for (U32 i = 0; i < childCount; ++i) pPool->AddItem(&pChildren[i]);
+    return 0;
+  }
+
+  PoolType*     pPool;
+  CounterTask*  pChildren;
+  U32           childCount;
+};
+
+// Runs every job once, either added from the calling thread (fanOutCount == 0) or from fanOutCount items. Returns the 
+// elapsed seconds.
+template <typename PoolType>
+D64 RunJobPass(PoolType& pool, E::Containers::List<CounterTask>& jobList, U32 fanOutCount)
+{
+  U32 jobCount = static_cast<U32>(jobList.GetCount());
+  E::Containers::List<FanOutTask<PoolType>> fanOutList(fanOutCount, FanOutTask<PoolType>());
+  for (U32 i = 0; i < fanOutCount; ++i)
+  {
+    fanOutList[i].pPool = &pool;
+    fanOutList[i].pChildren = &jobList[i * (jobCount / fanOutCount)];
+    fanOutList[i].childCount = jobCount / fanOutCount;
+  }
+
+  E::Time::Timer t;
+  if (fanOutCount == 0) for (U32 i = 0; i < jobCount; ++i) pool.AddItem(&jobList[i]);
+  for (U32 i = 0; i < fanOutCount; ++i) pool.AddItem(&fanOutList[i]);
+  pool.WaitForIdle();
+  return t.GetElapsed().GetSeconds();
+}
+
+struct SumParallelFor : public E::Threads::IParallelForRunnable
+{
+  SumParallelFor() : pCounter(nullptr) {}
+
+  void Run(U32 begin, U32 end)
+  {
+    for (U32 i = begin; i < end; ++i) ++(*pCounter);
+  }
+
+  E::A32* pCounter;
+};
+
+struct OrderTask : public E::Threads::IRunnable
+{
+  OrderTask() : pOrder(nullptr), order(0) {}
+
+  I32 Run()
+  {
+    order = ++(*pOrder);
+    return 0;
+  }
+
+  E::A32* pOrder;
+  U32     order;
+};
+
+template <typename CounterType>
+struct IncrementTask : public E::Threads::IRunnable
+{
+  IncrementTask() : pCounter(nullptr), incrementCount(0) {}
+
+  I32 Run()
+  {
+    for (U32 i = 0; i < incrementCount; ++i) ++(*pCounter);
+    return 0;
+  }
+
+  CounterType*  pCounter;
+  U32           incrementCount;
+};
+
+// Increments through a compare and exchange loop, as lock-free structures built on Atomic do
+struct CompareExchangeTask : public E::Threads::IRunnable
+{
+  CompareExchangeTask() : pCounter(nullptr), incrementCount(0) {}
+
+  I32 Run()
+  {
+    for (U32 i = 0; i < incrementCount; ++i)
+    {
+      U32 expected = pCounter->Get();
+      for (;;)
+      {
+        U32 original = pCounter->CompareExchange(expected, expected + 1);
+        if (original == expected) break;
+        expected = original;
+      }
+    }
+    return 0;
+  }
+
+  E::A32* pCounter;
+  U32     incrementCount;
+};
+
+template <typename TaskType, typename CounterType>
+D64 RunIncrementTasks(CounterType& counter, U32 threadCount, U32 incrementCount)
+{
+  E::Containers::List<TaskType> taskList(threadCount, TaskType());
+  E::Containers::List<E::Threads::Thread*> threadList;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    taskList[i].pCounter = &counter;
+    taskList[i].incrementCount = incrementCount / threadCount;
+    threadList.PushBack(new E::Threads::Thread(taskList[i]));
+  }
+
+  E::Time::Timer t;
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  D64 elapsed = t.GetElapsed().GetMilliseconds();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+  return elapsed;
+}
+
+// Critical section without spinning, used as the plain mutex reference
+class PlainMutex
+{
+public:
+  PlainMutex()  { InitializeCriticalSection(&mCriticalSection); }
+  ~PlainMutex() { DeleteCriticalSection(&mCriticalSection); }
+
+  void Lock()   { EnterCriticalSection(&mCriticalSection); }
+  void Unlock() { LeaveCriticalSection(&mCriticalSection); }
+
+private:
+  CRITICAL_SECTION mCriticalSection;
+};
+
+// Short critical sections over shared data. Shared mutexes take a shared lock for readPercentage of the operations.
+template <typename MutexType, bool Shared>
+struct LockUser : public E::Threads::IRunnable
+{
+  LockUser() : pMutex(nullptr), pData(nullptr), operationCount(0), readPercentage(0), seed(0), sum(0) {}
+
+  I32 Run()
+  {
+    U32 random = seed;
+    for (U32 i = 0; i < operationCount; ++i)
+    {
+      random = random * 1664525 + 1013904223;
+      Access(random, std::integral_constant<bool, Shared>());
+    }
+    return 0;
+  }
+
+  void Access(U32 random, std::true_type)
+  {
+    if ((random >> 8) % 100 >= readPercentage) return Access(random, std::false_type());
+    pMutex->LockShared();
+    sum += pData[random & 15];
+    pMutex->UnlockShared();
+  }
+
+  void Access(U32 random, std::false_type)
+  {
+    pMutex->Lock();
+    pData[random & 15] += 1;
+    pMutex->Unlock();
+  }
+
+  MutexType*  pMutex;
+  U32*        pData;
+  U32         operationCount;
+  U32         readPercentage;
+  U32         seed;
+  U32         sum;
+};
+
+template <typename MutexType, bool Shared>
+D64 RunLockUsers(MutexType& mutex, U32 threadCount, U32 operationCount, U32 readPercentage)
+{
+  U32 data[16] = { 0 };
+  E::Containers::List<LockUser<MutexType, Shared>> userList(threadCount, LockUser<MutexType, Shared>());
+  E::Containers::List<E::Threads::Thread*> threadList;
+  for (U32 i = 0; i < threadCount; ++i)
+  {
+    userList[i].pMutex = &mutex;
+    userList[i].pData = data;
+    userList[i].operationCount = operationCount / threadCount;
+    userList[i].readPercentage = readPercentage;
+    userList[i].seed = i + 1;
+    threadList.PushBack(new E::Threads::Thread(userList[i]));
+  }
+
+  E::Time::Timer t;
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->Start();
+  for (auto it = begin(threadList); it != end(threadList); ++it) (*it)->WaitForTermination();
+  D64 elapsed = t.GetElapsed().GetMilliseconds();
+  for (auto it = begin(threadList); it != end(threadList); ++it) delete (*it);
+  return elapsed;
+}
+
 /*----------------------------------------------------------------------------------------------------------------------
 TestList methods
 ----------------------------------------------------------------------------------------------------------------------*/
@@ -156,12 +390,135 @@ bool Test::Thread::RunFunctionalityTest()
 
   for (E::Containers::List<Task*>::ConstIterator cit = taskList.GetBegin(); cit != taskList.GetEnd(); ++cit) delete (*cit);
 
-  E::Threads::Atomic<U32> au;
-  au.Get();
-  ++au;
-  au++;
+  /*-----------------------------------------------------------------
+  Atomic
+  -----------------------------------------------------------------*/
+  {
+    E::Threads::Atomic<U32> au;
+    au.Get();
+    E_ASSERT(++au == 1 && au++ == 1 && au == 2 && au-- == 2 && --au == 0);
+    au += 2;
+    E_ASSERT(au == 2 && (au -= 2) == 0);
+    E_ASSERT(au.FetchOr(0x6) == 0 && au.FetchAnd(0x4) == 0x6 && au.FetchXor(0x5) == 0x4 && au == 0x1);
+    E_ASSERT(au.Exchange(7) == 1 && au.CompareExchange(3, 8) == 7 && au.CompareExchange(7, 8) == 7 && au == 8);
+    au.Store(9, E::Threads::eMemoryOrderRelease);
+    E_ASSERT(au.Load(E::Threads::eMemoryOrderAcquire) == 9);
+    au.Store(10, E::Threads::eMemoryOrderSequential);
+    E_ASSERT(au.FetchSub(4) == 10 && au.Get() == 6);
+
+    E::Threads::Atomic<U64> au64(0xffffffffull);
+    E_ASSERT(au64++ == 0xffffffffull && au64-- == 0x100000000ull && au64 == 0xffffffffull);
+    E_ASSERT(++au64 == 0x100000000ull && au64.FetchOr(1) == 0x100000000ull && au64.Exchange(0) == 0x100000001ull);
+    au64.SetRelease(5);
+    E_ASSERT(au64.GetAcquire() == 5 && au64.CompareExchange(5, 6) == 5 && au64 == 6);
+
+    E::Threads::Atomic<bool> ab;
+    E_ASSERT(ab == false && ab.CompareExchange(false, true) == false && ab == true && ab.Exchange(false) == true);
+    ab.Store(true, E::Threads::eMemoryOrderSequential);
+    E_ASSERT(ab.Load(E::Threads::eMemoryOrderSequential));
+
+    U32 values[4] = { 0, 1, 2, 3 };
+    E::Threads::Atomic<U32*> ap(values);
+    E_ASSERT(ap++ == values && ap-- == &values[1] && ap == values);
+    E_ASSERT(*(++ap) == 1 && ap.FetchAdd(2) == &values[1] && ap == &values[3]);
+    E_ASSERT(ap.CompareExchange(&values[3], values) == &values[3] && ap.Exchange(nullptr) == values && ap == nullptr);
+
+    // Mutex based fallback
+    E::Threads::Atomic<I64> ai(-1);
+    E_ASSERT(ai++ == -1 && ai-- == 0 && ai == -1);
+    E_ASSERT(++ai == 0 && ai.FetchAdd(5) == 0 && ai.CompareExchange(5, -5) == 5 && ai.Exchange(2) == -5 && ai == 2);
+    E::Threads::AtomicFence(E::Threads::eMemoryOrderSequential);
+  }
   std::cout << std::endl;
 
+  /*-----------------------------------------------------------------
+  SharedMutex
+  -----------------------------------------------------------------*/
+  {
+    E::Threads::SharedMutex sharedMutex;
+    {
+      // Several readers at once
+      E::Threads::ReadLock l1(sharedMutex);
+      E::Threads::ReadLock l2(sharedMutex);
+    }
+    {
+      E::Threads::WriteLock l(sharedMutex);
+    }
+    const U32 kOperationCount = 100000;
+    RunLockUsers<E::Threads::SharedMutex, true>(sharedMutex, 4, kOperationCount, 50);
+  }
+
+  /*-----------------------------------------------------------------
+  TaskScheduler
+  -----------------------------------------------------------------*/
+  {
+    const U32 kSpawnCount = 64;
+    const U32 kChildCount = 256;
+    E::A32 counter;
+    E::Containers::List<CounterTask> childList(kSpawnCount * kChildCount, CounterTask());
+    E::Containers::List<SpawnTask> spawnList(kSpawnCount, SpawnTask());
+    E::Threads::TaskScheduler scheduler;
+    scheduler.SetWorkerCount(4);
+    for (U32 i = 0; i < kSpawnCount; ++i)
+    {
+      for (U32 j = 0; j < kChildCount; ++j) childList[i * kChildCount + j].pCounter = &counter;
+      spawnList[i].pScheduler = &scheduler;
+      spawnList[i].pChildren = &childList[i * kChildCount];
+      spawnList[i].childCount = kChildCount;
+      scheduler.AddItem(&spawnList[i]);
+    }
+    scheduler.WaitForIdle();
+    E_ASSERT(scheduler.IsIdle());
+    E_ASSERT(counter == kSpawnCount * kChildCount);
+
+    // Worker count change terminates the current workers (they are lazily recreated)
+    scheduler.SetWorkerCount(1);
+    for (U32 i = 0; i < kSpawnCount; ++i) scheduler.AddItem(&spawnList[i]);
+    scheduler.WaitForIdle();
+    E_ASSERT(counter == 2 * kSpawnCount * kChildCount);
+    scheduler.CleanUp();
+  }
+
+  /*-----------------------------------------------------------------
+  TaskGraph
+  -----------------------------------------------------------------*/
+  {
+    // Diamond: a -> (b, parallel for) -> c -> d (continuation)
+    const U32 kParallelForCount = 10000;
+    E::A32 order;
+    E::A32 counter;
+    OrderTask a, b, c, d, completion;
+    a.pOrder = b.pOrder = c.pOrder = d.pOrder = completion.pOrder = &order;
+    SumParallelFor body;
+    body.pCounter = &counter;
+
+    E::Threads::TaskGraph graph;
+    E::Threads::TaskGraph::Handle ha = graph.AddTask(&a);
+    E::Threads::TaskGraph::Handle hb = graph.AddTask(&b);
+    E::Threads::TaskGraph::Handle hp = graph.AddParallelFor(&body, kParallelForCount, 256);
+    E::Threads::TaskGraph::Handle hc = graph.AddTask(&c);
+    graph.AddContinuation(hc, &d);
+    graph.DependsOn(hb, ha);
+    graph.DependsOn(hp, ha);
+    graph.DependsOn(hc, hb);
+    graph.DependsOn(hc, hp);
+
+    for (U32 i = 0; i < 2; ++i)
+    {
+      order = 0;
+      counter = 0;
+      graph.Run(&completion);
+      graph.Wait();
+      E_ASSERT(graph.IsFinished());
+      E_ASSERT(a.order == 1);
+      E_ASSERT(b.order > a.order && c.order > b.order && d.order > c.order && completion.order > d.order);
+      E_ASSERT(counter == kParallelForCount);
+      E_ASSERT(graph.GetCriticalPathTime() <= graph.GetRunTime());
+    }
+    std::cout << "TaskGraph run time: " << graph.GetRunTime().GetMilliseconds() << " ms, critical path time: " 
+      << graph.GetCriticalPathTime().GetMilliseconds() << " ms" << std::endl;
+  }
+
   /*-----------------------------------------------------------------
   ThreadPool Wrong exit test
   -----------------------------------------------------------------*/
@@ -180,5 +537,103 @@ bool Test::Thread::RunPerformanceTest()
 {
   std::cout << "[Test::Thread::RunPerformanceTest]" << std::endl;
 
+  /*-----------------------------------------------------------------
+  ThreadPool vs TaskScheduler (jobs per second)
+  -----------------------------------------------------------------*/
+  const U32 kJobCount = 1 << 16;
+  const U32 kJobWorkCount = 64;
+  const U32 kFanOutCount = 64;   // Items adding kJobCount / kFanOutCount jobs each from the workers
+  const U32 kThreadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+  // ThreadPool keeps a waiter entry per item so every job must be a different object
+  E::A32 counter;
+  E::Containers::List<CounterTask> jobList(kJobCount, CounterTask());
+  for (U32 i = 0; i < kJobCount; ++i)
+  {
+    jobList[i].pCounter = &counter;
+    jobList[i].workCount = kJobWorkCount;
+  }
+
+  for (U32 i = 0; i < sizeof(kThreadCounts) / sizeof(kThreadCounts[0]); ++i)
+  {
+    U32 threadCount = kThreadCounts[i];
+
+    // Both get an untimed pass first so that thread creation is excluded from the measures
+    E::Threads::ThreadPool pool;
+    pool.SetMaxActiveThreadCount(threadCount);
+    pool.SetMaxPendingItemCount(kJobCount + kFanOutCount);
+    RunJobPass(pool, jobList, 0);
+    counter = 0;
+    D64 poolSeconds = RunJobPass(pool, jobList, 0);
+    E_ASSERT(counter == kJobCount);
+    counter = 0;
+    D64 poolFanOutSeconds = RunJobPass(pool, jobList, kFanOutCount);
+    E_ASSERT(counter == kJobCount);
+    pool.CleanUp(true);
+
+    E::Threads::TaskScheduler scheduler;
+    scheduler.SetWorkerCount(threadCount);
+    RunJobPass(scheduler, jobList, 0);
+    counter = 0;
+    D64 schedulerSeconds = RunJobPass(scheduler, jobList, 0);
+    E_ASSERT(counter == kJobCount);
+    counter = 0;
+    D64 schedulerFanOutSeconds = RunJobPass(scheduler, jobList, kFanOutCount);
+    E_ASSERT(counter == kJobCount);
+    scheduler.CleanUp();
+
+    std::cout << "Threads: " << threadCount
+      << "\tThreadPool: " << static_cast<U64>(kJobCount / poolSeconds) << " jobs/s ("
+      << static_cast<U64>(kJobCount / poolFanOutSeconds) << " added from items)"
+      << "\tTaskScheduler: " << static_cast<U64>(kJobCount / schedulerSeconds) << " jobs/s ("
+      << static_cast<U64>(kJobCount / schedulerFanOutSeconds) << " added from items)" << std::endl;
+  }
+
+  /*-----------------------------------------------------------------
+  Mutex contention (short critical sections)
+  -----------------------------------------------------------------*/
+  {
+    const U32 kOperationCount = 1 << 20;
+    const U32 kReadPercentage = 90;
+    const U32 kLockThreadCounts[] = { 1, 2, 4, 8, 16, 32 };
+    PlainMutex plainMutex;
+    E::Threads::Mutex mutex;
+    E::Threads::SharedMutex sharedMutex;
+    std::cout << "Operations: " << kOperationCount << std::endl;
+    for (U32 i = 0; i < E_ELEMENT_COUNT(kLockThreadCounts); ++i)
+    {
+      U32 threadCount = kLockThreadCounts[i];
+      D64 plainTime = RunLockUsers<PlainMutex, false>(plainMutex, threadCount, kOperationCount, 0);
+      D64 mutexTime = RunLockUsers<E::Threads::Mutex, false>(mutex, threadCount, kOperationCount, 0);
+      D64 exclusiveTime = RunLockUsers<E::Threads::SharedMutex, false>(sharedMutex, threadCount, kOperationCount, 0);
+      D64 sharedTime = RunLockUsers<E::Threads::SharedMutex, true>(sharedMutex, threadCount, kOperationCount, kReadPercentage);
+      std::cout << "Threads: " << threadCount << "\tPlain: " << plainTime << " ms\tMutex (spin): " << mutexTime 
+        << " ms\tSharedMutex: " << exclusiveTime << " ms\tSharedMutex (" << kReadPercentage << "% reads): " 
+        << sharedTime << " ms" << std::endl;
+    }
+  }
+
+  /*-----------------------------------------------------------------
+  Atomic contended increments (lock-free vs mutex fallback)
+  -----------------------------------------------------------------*/
+  {
+    const U32 kIncrementCount = 1 << 22;
+    const U32 kAtomicThreadCounts[] = { 1, 2, 4, 8 };
+    for (U32 i = 0; i < E_ELEMENT_COUNT(kAtomicThreadCounts); ++i)
+    {
+      U32 threadCount = kAtomicThreadCounts[i];
+      E::A32 lockFreeCounter;
+      E::A32 compareExchangeCounter;
+      E::Threads::Atomic<I64> mutexCounter;
+      D64 lockFreeTime = RunIncrementTasks<IncrementTask<E::A32>>(lockFreeCounter, threadCount, kIncrementCount);
+      D64 compareExchangeTime = RunIncrementTasks<CompareExchangeTask>(compareExchangeCounter, threadCount, kIncrementCount);
+      D64 mutexTime = RunIncrementTasks<IncrementTask<E::Threads::Atomic<I64>>>(mutexCounter, threadCount, kIncrementCount);
+      E_ASSERT(lockFreeCounter == compareExchangeCounter && mutexCounter == static_cast<I64>(lockFreeCounter.Get()));
+      std::cout << "Threads: " << threadCount << "\tInterlocked: " << kIncrementCount / lockFreeTime / 1000.0 
+        << " Mops/s\tCAS loop: " << kIncrementCount / compareExchangeTime / 1000.0 << " Mops/s\tMutex: " 
+        << kIncrementCount / mutexTime / 1000.0 << " Mops/s" << std::endl;
+    }
+  }
+
   return true;
 }
@@ -108,8 +108,8 @@ private:
   typedef Memory::GCConcreteFactory<DX11Shader> 	          ShaderFactory;
   typedef Memory::GCConcreteFactory<DX11VertexLayout>	      VertexLayoutFactory;
   typedef Memory::GCConcreteFactory<DX11Sampler>	          SamplerFactory;
-  typedef Memory::GCConcreteFactory<DX11Buffer>	            BufferFactory;
-  typedef Memory::GCConcreteFactory<DX11Texture2D>	        Texture2DFactory;
+  typedef Memory::GCConcreteFactory<DX11Buffer, Memory::eGCFactoryModePooled>    BufferFactory;
+  typedef Memory::GCConcreteFactory<DX11Texture2D, Memory::eGCFactoryModePooled> Texture2DFactory;
 
   Descriptor                  mDescriptor;
   BlendStateFactory		        mBlendStateFactory;
@@ -0,0 +1,118 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AllocationCounter.cpp
+This file defines the AllocationCounter class.
+*/
+
+#include <GraphicsTestPch.h>
+
+using namespace E;
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationCounter initialization & finalization
+----------------------------------------------------------------------------------------------------------------------*/
+
+AllocationCounter::AllocationCounter()
+  : mpParentAllocator(Memory::Global::GetAllocator())
+  , mpWindow(nullptr)
+  , mLastAllocationCount(0)
+  , mFrameCount(0)
+  , mAllocatingFrameCount(0)
+{
+  Memory::Global::SetAllocator(this);
+}
+
+AllocationCounter::~AllocationCounter()
+{
+  if (mpWindow) mpWindow->GetUpdateEventCallback() -= this;
+  Memory::Global::SetAllocator(mpParentAllocator);
+  E_ASSERT_MSG(mAllocatingFrameCount == 0, E_ASSERT_MSG_ALLOCATION_COUNTER_STEADY_STATE_ALLOCATION, mAllocatingFrameCount, 
+    GetSteadyStateFrameCount());
+}
+
+void AllocationCounter::Initialize(Application::IWindow* pWindow)
+{
+  E_ASSERT_PTR(pWindow);
+  mpWindow = pWindow;
+  pWindow->GetUpdateEventCallback() += this;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationCounter accessors
+----------------------------------------------------------------------------------------------------------------------*/
+
+U32 AllocationCounter::GetAllocatingFrameCount() const
+{
+  return mAllocatingFrameCount;
+}
+
+U32 AllocationCounter::GetFrameCount() const
+{
+  return mFrameCount;
+}
+
+U32 AllocationCounter::GetSteadyStateFrameCount() const
+{
+  return mFrameCount > kWarmUpFrameCount ? mFrameCount - kWarmUpFrameCount : 0;
+}
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationCounter methods
+----------------------------------------------------------------------------------------------------------------------*/
+
+void* AllocationCounter::Allocate(size_t size, const Tag tag)
+{
+  ++mAllocationCount;
+  return mpParentAllocator->Allocate(size, tag);
+}
+
+void AllocationCounter::Deallocate(void* p, const Tag tag)
+{
+  mpParentAllocator->Deallocate(p, tag);
+}
+
+/**
+Writes the number of steady state frames which allocated heap memory to the debugger output.
+@return the number of steady state frames which allocated heap memory.
+@throw nothing.
+*/
+U32 AllocationCounter::Report() const
+{
+  char report[128];
+  sprintf_s(report, E_ALLOCATION_COUNTER_REPORT, mAllocatingFrameCount, GetSteadyStateFrameCount());
+  OutputDebugStringA(report);
+  return mAllocatingFrameCount;
+}
+
+void AllocationCounter::OnEvent(const Application::UpdateEvent&)
+{
+  U32 allocationCount = mAllocationCount.Get();
+  if (++mFrameCount > kWarmUpFrameCount && allocationCount != mLastAllocationCount) ++mAllocatingFrameCount;
+  mLastAllocationCount = allocationCount;
+}
@@ -0,0 +1,93 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this 
+software and associated documentation files (the "Software"), to deal in the Software 
+without restriction, including without limitation the rights to use, copy, modify, merge, 
+publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons
+to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or 
+substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, 
+INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR 
+PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER 
+DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file AllocationCounter.h
+This file declares the AllocationCounter class.
+*/
+
+#ifndef E3_ALLOCATION_COUNTER_H
+#define E3_ALLOCATION_COUNTER_H
+
+/*----------------------------------------------------------------------------------------------------------------------
+AllocationCounter assertion messages
+----------------------------------------------------------------------------------------------------------------------*/
+#define E_ASSERT_MSG_ALLOCATION_COUNTER_STEADY_STATE_ALLOCATION "%d of %d steady state frames allocated heap memory"
+#define E_ALLOCATION_COUNTER_REPORT "AllocationCounter: %d of %d steady state frames allocated heap memory\n"
+
+namespace E
+{
+  /*--------------------------------------------------------------------------------------------------------------------
+  AllocationCounter
+
+  AllocationCounter checks the updaters do not allocate heap memory once they reach a steady state.
+
+  Please note that this class has the following usage contract:
+
+  1. AllocationCounter replaces the global allocator on construction (restoring it on destruction) counting all the 
+  allocations made through it.
+  2. AllocationCounter MUST subscribe to the main window update event before any updater so each update event closes a
+  whole frame. It unsubscribes on destruction, so the window MUST outlive it.
+  3. Frames after kWarmUpFrameCount are considered steady state frames. Report writes the number of them which allocated
+  to the debugger output (in every configuration) and returns it. The destructor also asserts none of them allocated.
+  --------------------------------------------------------------------------------------------------------------------*/
+  class AllocationCounter : public Memory::IAllocator, public EventSystem::IEventHandler
+  {
+  public:
+    static const U32                      kWarmUpFrameCount = 120;
+
+                                          AllocationCounter();
+                                          ~AllocationCounter();
+
+    void                                  Initialize(Application::IWindow* pWindow);
+
+    // Accessors
+    U32                                   GetAllocatingFrameCount() const;
+    U32                                   GetFrameCount() const;
+    U32                                   GetSteadyStateFrameCount() const;
+
+    // Methods
+    void*                                 Allocate(size_t size, const Tag tag = IAllocator::eTagNew);
+    void                                  Deallocate(void* p, const Tag tag = IAllocator::eTagDelete);
+    U32                                   Report() const;
+
+    // Callback methods
+    void                                  OnEvent(const Application::UpdateEvent& event);
+
+  private:
+    Memory::IAllocator*                   mpParentAllocator;
+    Application::IWindow*                 mpWindow;
+    A32                                   mAllocationCount;
+    U32                                   mLastAllocationCount;
+    U32                                   mFrameCount;
+    U32                                   mAllocatingFrameCount;
+
+    E_DISABLE_COPY_AND_ASSSIGNMENT(AllocationCounter);
+  };
+}
+
+#endif
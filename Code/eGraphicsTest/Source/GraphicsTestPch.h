@@ -46,6 +46,7 @@ This file defines includes all the headers required by the Gpu test application
 #include <Math/Vector4.h>
 #include <Math/Matrix4.h>
 #include <Math/Projection.h>
+#include <Memory/LinearAllocator.h>
 
 /*----------------------------------------------------------------------------------------------------------------------
 [Gpu]
@@ -62,6 +63,7 @@ This file defines includes all the headers required by the Gpu test application
 /*----------------------------------------------------------------------------------------------------------------------
 [GpuTest]
 ----------------------------------------------------------------------------------------------------------------------*/
+#include "AllocationCounter.h"
 #include "SimpleVertexUpdater.h"
 #include "TextureVertexUpdater.h"
 #include "InstanceVertexUpdater.h"
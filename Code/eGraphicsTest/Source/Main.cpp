@@ -37,10 +37,15 @@ using namespace E;
 
 int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
 {
+  // Counts the heap allocations of every frame once the updaters reach a steady state
+  AllocationCounter allocationCounter;
+
   Application::Application& app = Application::Global::GetApplication();
+  Application::IWindow* pMainWindow = app.CreateMainWindow(512, 512, "Color Sample");
+  allocationCounter.Initialize(pMainWindow);
 
   SimpleVertexUpdater simpleVertexUpdater;
-  simpleVertexUpdater.Initialize(app.CreateMainWindow(512, 512, "Color Sample"));
+  simpleVertexUpdater.Initialize(pMainWindow);
 
   TextureVertexUpdater textureVertexUpdater;
   textureVertexUpdater.Initialize(app.CreateChildWindow(512, 512, "Texture Sample"));
@@ -62,6 +67,7 @@ int WINAPI WinMain(HINSTANCE, HINSTANCE, LPSTR, int)
 
   app.Run();
 
-  return 0;
+  // The exit code is the number of steady state frames which allocated heap memory
+  return static_cast<int>(allocationCounter.Report());
 }
 
@@ -39,7 +39,8 @@ SimpleVertexUpdater initialization & finalization
 ----------------------------------------------------------------------------------------------------------------------*/
 
 SimpleVertexUpdater::SimpleVertexUpdater()
-  : mDevice(Graphics::Global::GetDevice()) {}
+  : mDevice(Graphics::Global::GetDevice())
+  , mFrameAllocator(kFrameAllocatorSize) {}
 
 SimpleVertexUpdater::~SimpleVertexUpdater()
 {
@@ -94,6 +95,8 @@ void SimpleVertexUpdater::Draw()
 
 void SimpleVertexUpdater::OnEvent(const Application::UpdateEvent&)
 {
+  mFrameAllocator.Reset();
+  UpdateConstantBuffers();
   Bind();
   Draw();
   ThrowIfFalse(mViewport->Update(), Exception::eExceptionTypeGraphicsTest);
@@ -157,6 +160,18 @@ void SimpleVertexUpdater::CreateConstantBuffers()
   mConstantBuffer->Update();
 }
 
+void SimpleVertexUpdater::UpdateConstantBuffers()
+{
+  // World, view and projection matrices are staged in frame memory and uploaded once per frame
+  Containers::List<F32> constants;
+  constants.SetAllocator(&mFrameAllocator);
+  constants.PushBack(&Matrix4f::Identity()[0], 16);
+  constants.PushBack(&Matrix4f::Identity()[0], 16);
+  constants.PushBack(&mProjectionMatrix[0], 16);
+  mConstantBuffer->Set(constants.GetPtr(), static_cast<U32>(constants.GetCount()), 0);
+  ThrowIfFalse(mConstantBuffer->Update(), Exception::eExceptionTypeGraphicsTest);
+}
+
 void SimpleVertexUpdater::CreateContexts()
 {
   Graphics::ITexture2DInstance colorTarget = mDevice->CreateTexture2D(mViewport);
@@ -35,9 +35,19 @@ This file declares the SimpleVertexUpdater class.
 
 namespace E
 {
+  /*--------------------------------------------------------------------------------------------------------------------
+  SimpleVertexUpdater
+
+  Please note that this class has the following usage contract:
+
+  1. The frame allocator is reset at the beginning of every update. Any container built while updating a frame MUST use
+  it (see UpdateConstantBuffers) so that steady state frames do not allocate heap memory.
+  --------------------------------------------------------------------------------------------------------------------*/
   class SimpleVertexUpdater : public EventSystem::IEventHandler
   {
   public:
+    static const size_t                   kFrameAllocatorSize = 16 * 1024;
+
                                           SimpleVertexUpdater();
                                           ~SimpleVertexUpdater();
 
@@ -68,11 +78,13 @@ namespace E
     Graphics::IBufferInstance             mConstantBuffer;
     Graphics::IBufferInstance             mVertexBuffer;
     Graphics::IShaderInstance             mShader;
+    Memory::LinearAllocator               mFrameAllocator;
 
     virtual void                          CreateContexts();
     virtual void				                  CreateConstantBuffers();
     virtual void				                  CreateShaders();
     virtual void				                  CreateVertexBuffers();
+    virtual void                          UpdateConstantBuffers();
 
   private:
     void				                          InitializeDevice();
@@ -0,0 +1,98 @@
+/*----------------------------------------------------------------------------------------------------------------------
+This source file is part of the E3 Project
+
+Copyright (c) 2010-2014 Elías Lozada-Benavente
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated 
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the 
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit 
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the 
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE 
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR 
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR 
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+----------------------------------------------------------------------------------------------------------------------*/
+
+// Created 16-Oct-2026 by Elías Lozada-Benavente
+// 
+// $Revision: $
+// $Date: $
+// $Author: $
+
+/** @file Main.cpp
+This file defines the pack tool entry point. Usage:
+
+ePack <directory> <pack file>   Packs the files of a directory tree
+ePack -l <pack file>            Lists the entries of a pack
+*/
+
+#include <CorePch.h>
+#include <Time/Timer.h>
+#include <iostream>
+
+using namespace E;
+
+int PackDirectory(const char* pDirectoryPath, const char* pPackPath)
+{
+  Time::Timer t;
+  FileSystem::PackWriter writer;
+  if (!writer.Open(pPackPath))
+  {
+    std::cerr << "Can not create " << pPackPath << std::endl;
+    return 1;
+  }
+  if (!writer.AddDirectory(pDirectoryPath))
+  {
+    std::cerr << "Can not pack " << pDirectoryPath << " (missing directory, unreadable file or duplicate entry)" 
+              << std::endl;
+    return 1;
+  }
+  const size_t entryCount = writer.GetEntryCount();
+  writer.Close();
+  std::cout << "Packed " << entryCount << " entries in " << t.GetElapsed().GetSeconds() << " s" << std::endl;
+  return 0;
+}
+
+int ListPack(const char* pPackPath)
+{
+  FileSystem::Pack pack;
+  if (!pack.Open(pPackPath))
+  {
+    std::cerr << pPackPath << " is not a valid pack" << std::endl;
+    return 1;
+  }
+  U64 storedSize = 0;
+  for (size_t i = 0; i < pack.GetEntryCount(); ++i)
+  {
+    const FileSystem::Pack::Entry& entry = pack.GetEntry(i);
+    std::cout << pack.GetName(entry) << " " << entry.storedSize;
+    if (entry.IsCompressed()) std::cout << " (" << entry.size << ")";
+    std::cout << std::endl;
+    storedSize += entry.storedSize;
+  }
+  std::cout << pack.GetEntryCount() << " entries, " << storedSize << " bytes (" << pack.GetArchive().GetSize() 
+            << " bytes pack)" << std::endl;
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc == 3 && strcmp(argv[1], "-l") == 0) return ListPack(argv[2]);
+    if (argc == 3) return PackDirectory(argv[1], argv[2]);
+
+    std::cout << "Usage:" << std::endl;
+    std::cout << "  ePack <directory> <pack file>   Packs the files of a directory tree" << std::endl;
+    std::cout << "  ePack -l <pack file>            Lists the entries of a pack" << std::endl;
+  }
+  catch(Exception& ex)
+  {
+    std::cerr << "Error: " << ex.description.GetPtr() << std::endl;
+  }
+  return 1;
+}